@@ -0,0 +1,338 @@
+/*
+ * Google Benchmark micro-benchmarks of the APyTypes kernel layer. The kernels are
+ * called directly, without passing through the Python bindings, so that regressions
+ * in the kernels themselves are not hidden by binding overhead.
+ *
+ * Build with `meson setup build -Dbenchmarks=true` and run with
+ * `meson test -C build --benchmark`, which writes the results to
+ * `build/kernel_benchmarks.json`.
+ */
+
+#include "apybuffer.h"
+#include "apyfixed_util.h"
+#include "apytypes_common.h"
+#include "apytypes_fwd.h"
+#include "apytypes_mp.h"
+#include "apytypes_simd.h"
+#include "apytypes_util.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::int64_t
+#include <random>  // std::mt19937_64
+#include <vector>  // std::vector
+
+using vector_type = APyBuffer<apy_limb_t>::vector_type;
+
+//! Create a limb vector of `n` random limbs
+static vector_type random_limbs(std::size_t n, std::uint64_t seed = 0x5EED)
+{
+    std::mt19937_64 engine(seed);
+    vector_type result(n);
+    for (auto& limb : result) {
+        limb = apy_limb_t(engine());
+    }
+    return result;
+}
+
+//! Create a limb vector of `n` random, non-zero, sign-extended `bits`-bit elements
+static vector_type
+random_single_limb_elements(std::size_t n, unsigned bits, std::uint64_t seed = 0x5EED)
+{
+    std::mt19937_64 engine(seed);
+    vector_type result(n);
+    const unsigned shift = unsigned(APY_LIMB_SIZE_BITS) - bits;
+    for (auto& limb : result) {
+        apy_limb_t value = apy_limb_t(engine()) | 1;
+        limb = apy_limb_t(apy_limb_signed_t(value << shift) >> shift);
+    }
+    return result;
+}
+
+//! Report the number of processed elements and bytes
+static void set_counters(benchmark::State& state, std::size_t n, std::size_t limbs)
+{
+    state.SetItemsProcessed(std::int64_t(state.iterations() * n));
+    state.SetBytesProcessed(
+        std::int64_t(state.iterations() * n * limbs * sizeof(apy_limb_t))
+    );
+}
+
+/* ********************************************************************************** *
+ * *                       Single-limb SIMD kernels (`simd::`)                      * *
+ * ********************************************************************************** */
+
+static void BM_vector_add(benchmark::State& state)
+{
+    const auto n = std::size_t(state.range(0));
+    const vector_type src1 = random_single_limb_elements(n, 30, 1);
+    const vector_type src2 = random_single_limb_elements(n, 30, 2);
+    vector_type dst(n);
+    for (auto _ : state) {
+        simd::vector_add(std::cbegin(src1), std::cbegin(src2), std::begin(dst), n);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    set_counters(state, n, 1);
+}
+
+static void BM_vector_sub(benchmark::State& state)
+{
+    const auto n = std::size_t(state.range(0));
+    const vector_type src1 = random_single_limb_elements(n, 30, 1);
+    const vector_type src2 = random_single_limb_elements(n, 30, 2);
+    vector_type dst(n);
+    for (auto _ : state) {
+        simd::vector_sub(std::cbegin(src1), std::cbegin(src2), std::begin(dst), n);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    set_counters(state, n, 1);
+}
+
+static void BM_vector_shift_add(benchmark::State& state)
+{
+    const auto n = std::size_t(state.range(0));
+    const vector_type src1 = random_single_limb_elements(n, 30, 1);
+    const vector_type src2 = random_single_limb_elements(n, 30, 2);
+    vector_type dst(n);
+    for (auto _ : state) {
+        simd::vector_shift_add(
+            std::cbegin(src1), std::cbegin(src2), std::begin(dst), 3, 0, n
+        );
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    set_counters(state, n, 1);
+}
+
+static void BM_vector_mul(benchmark::State& state)
+{
+    const auto n = std::size_t(state.range(0));
+    const vector_type src1 = random_single_limb_elements(n, 16, 1);
+    const vector_type src2 = random_single_limb_elements(n, 16, 2);
+    vector_type dst(n);
+    for (auto _ : state) {
+        simd::vector_mul(std::cbegin(src1), std::cbegin(src2), std::begin(dst), n);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    set_counters(state, n, 1);
+}
+
+static void BM_vector_shift_div_signed(benchmark::State& state)
+{
+    const auto n = std::size_t(state.range(0));
+    const vector_type src1 = random_single_limb_elements(n, 16, 1);
+    const vector_type src2 = random_single_limb_elements(n, 16, 2);
+    vector_type dst(n);
+    for (auto _ : state) {
+        simd::vector_shift_div_signed(
+            std::cbegin(src1), std::cbegin(src2), std::begin(dst), 16, n
+        );
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    set_counters(state, n, 1);
+}
+
+static void BM_vector_multiply_accumulate(benchmark::State& state)
+{
+    const auto n = std::size_t(state.range(0));
+    const vector_type src1 = random_single_limb_elements(n, 16, 1);
+    const vector_type src2 = random_single_limb_elements(n, 16, 2);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            simd::vector_multiply_accumulate(std::cbegin(src1), std::cbegin(src2), n)
+        );
+    }
+    set_counters(state, n, 1);
+}
+
+template <auto CAST_KERNEL> static void BM_vector_cast(benchmark::State& state)
+{
+    const auto n = std::size_t(state.range(0));
+    const bool saturate = bool(state.range(1));
+    const vector_type src = random_single_limb_elements(n, 40);
+    vector_type dst(n);
+    for (auto _ : state) {
+        CAST_KERNEL(std::cbegin(src), std::begin(dst), -12, 20, saturate, n);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    set_counters(state, n, 1);
+}
+
+static void simd_arguments(benchmark::internal::Benchmark* b)
+{
+    b->RangeMultiplier(8)->Range(64, 1 << 20);
+}
+
+static void simd_cast_arguments(benchmark::internal::Benchmark* b)
+{
+    b->ArgNames({ "n", "saturate" });
+    for (std::int64_t n = 64; n <= (1 << 20); n *= 8) {
+        b->Args({ n, 0 });
+        b->Args({ n, 1 });
+    }
+}
+
+BENCHMARK(BM_vector_add)->Apply(simd_arguments);
+BENCHMARK(BM_vector_sub)->Apply(simd_arguments);
+BENCHMARK(BM_vector_shift_add)->Apply(simd_arguments);
+BENCHMARK(BM_vector_mul)->Apply(simd_arguments);
+BENCHMARK(BM_vector_shift_div_signed)->Apply(simd_arguments);
+BENCHMARK(BM_vector_multiply_accumulate)->Apply(simd_arguments);
+BENCHMARK(BM_vector_cast<simd::vector_cast_trn>)->Apply(simd_cast_arguments);
+BENCHMARK(BM_vector_cast<simd::vector_cast_rnd>)->Apply(simd_cast_arguments);
+BENCHMARK(BM_vector_cast<simd::vector_cast_rnd_conv>)->Apply(simd_cast_arguments);
+BENCHMARK(BM_vector_cast<simd::vector_cast_jam>)->Apply(simd_cast_arguments);
+
+/* ********************************************************************************** *
+ * *                     Multi-precision limb vector arithmetic                     * *
+ * ********************************************************************************** */
+
+static void BM_apy_unsigned_multiplication(benchmark::State& state)
+{
+    const auto limbs = std::size_t(state.range(0));
+    const vector_type src1 = random_limbs(limbs, 1);
+    const vector_type src2 = random_limbs(limbs, 2);
+    vector_type dst(2 * limbs);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(apy_unsigned_multiplication(
+            dst.data(), src1.data(), limbs, src2.data(), limbs
+        ));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()));
+}
+
+static void BM_apy_unsigned_division(benchmark::State& state)
+{
+    const auto limbs = std::size_t(state.range(0));
+    const vector_type numerator = random_limbs(2 * limbs, 1);
+    vector_type denominator = random_limbs(limbs, 2);
+    denominator[limbs - 1] |= apy_limb_t(1); // Non-zero most significant limb
+    vector_type quotient(limbs + 1);
+    for (auto _ : state) {
+        apy_unsigned_division(
+            std::begin(quotient),
+            std::cbegin(numerator),
+            std::cend(numerator),
+            std::cbegin(denominator),
+            std::cend(denominator)
+        );
+        benchmark::DoNotOptimize(quotient.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations()));
+}
+
+static void limb_arguments(benchmark::internal::Benchmark* b)
+{
+    b->ArgName("limbs")->RangeMultiplier(2)->Range(1, 64);
+}
+
+BENCHMARK(BM_apy_unsigned_multiplication)->Apply(limb_arguments);
+BENCHMARK(BM_apy_unsigned_division)->Apply(limb_arguments);
+
+/* ********************************************************************************** *
+ * *                        Fixed-point inner products and casts                    * *
+ * ********************************************************************************** */
+
+static void BM_FixedPointInnerProduct(benchmark::State& state)
+{
+    const int bits = int(state.range(0));
+    const auto n = std::size_t(state.range(1));
+    const APyFixedSpec src_spec { bits, bits / 2 };
+    const int dst_bits = 2 * bits + bit_width(n);
+    const APyFixedSpec dst_spec { dst_bits, 2 * (bits / 2) + bit_width(n) };
+    const std::size_t src_limbs = bits_to_limbs(bits);
+
+    vector_type src1 = random_limbs(n * src_limbs, 1);
+    vector_type src2 = random_limbs(n * src_limbs, 2);
+    if (src_limbs == 1) {
+        src1 = random_single_limb_elements(n, unsigned(bits), 1);
+        src2 = random_single_limb_elements(n, unsigned(bits), 2);
+    }
+    vector_type dst(bits_to_limbs(dst_bits));
+
+    const FixedPointInnerProduct inner_product(
+        src_spec, src_spec, dst_spec, std::nullopt
+    );
+    for (auto _ : state) {
+        inner_product(std::cbegin(src1), std::cbegin(src2), std::begin(dst), n);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations() * n));
+}
+
+static void inner_product_arguments(benchmark::internal::Benchmark* b)
+{
+    // Single-limb result, two-limb result, and multi-limb operands
+    b->ArgNames({ "bits", "n" });
+    for (std::int64_t bits : { 16, 40, 100, 300 }) {
+        for (std::int64_t n : { 16, 256, 4096 }) {
+            b->Args({ bits, n });
+        }
+    }
+}
+
+BENCHMARK(BM_FixedPointInnerProduct)->Apply(inner_product_arguments);
+
+static void BM_fixed_point_cast_unsafe(benchmark::State& state)
+{
+    const int src_bits = int(state.range(0));
+    const auto q_mode = QuantizationMode(state.range(1));
+    const auto v_mode = OverflowMode(state.range(2));
+    const std::size_t n = 1024;
+
+    // Cast to half the number of fractional bits and half the number of integer bits
+    const int src_int_bits = src_bits / 2;
+    const int dst_bits = src_bits / 2;
+    const int dst_int_bits = src_int_bits / 2;
+    const std::size_t src_limbs = bits_to_limbs(src_bits);
+
+    const vector_type src = random_limbs(n * src_limbs);
+    vector_type dst(n * src_limbs);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < n; i++) {
+            fixed_point_cast_unsafe(
+                std::cbegin(src) + i * src_limbs,
+                std::cbegin(src) + (i + 1) * src_limbs,
+                std::begin(dst) + i * src_limbs,
+                std::begin(dst) + (i + 1) * src_limbs,
+                src_bits,
+                src_int_bits,
+                dst_bits,
+                dst_int_bits,
+                q_mode,
+                v_mode
+            );
+        }
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations() * n));
+}
+
+static void cast_arguments(benchmark::internal::Benchmark* b)
+{
+    b->ArgNames({ "bits", "quantization", "overflow" });
+    for (std::int64_t bits : { 40, 100, 300 }) {
+        for (auto q : { QuantizationMode::TRN,
+                        QuantizationMode::RND_CONV,
+                        QuantizationMode::JAM,
+                        QuantizationMode::STOCH_WEIGHTED }) {
+            for (auto v : { OverflowMode::WRAP, OverflowMode::SAT }) {
+                b->Args({ bits, std::int64_t(q), std::int64_t(v) });
+            }
+        }
+    }
+}
+
+BENCHMARK(BM_fixed_point_cast_unsafe)->Apply(cast_arguments);
+
+BENCHMARK_MAIN();
@@ -3,17 +3,25 @@ from __future__ import annotations
 import numbers
 
 from apytypes._apytypes import (
+    APyBufferPoolContext,
     APyCFixed,
     APyCFixedArray,
+    APyCFixedFIR,
     APyCFloat,
     APyCFloatArray,
+    APyCFloatFIR,
     APyFixed,
     APyFixedAccumulatorContext,
     APyFixedArray,
     APyFixedCastContext,
+    APyFixedFIR,
+    APyFixedIIR,
     APyFloat,
     APyFloatAccumulatorContext,
     APyFloatArray,
+    APyFloatArrayPlanes,
+    APyFloatFIR,
+    APyFloatIIR,
     APyFloatQuantizationContext,
     ConvolutionMode,
     OverflowMode,
@@ -34,8 +42,11 @@ from apytypes._apytypes import (
 from apytypes._array_functions import (
     arange,
     convolve,
+    convolve2d,
+    correlate,
     expand_dims,
     export_csv,
+    export_mem,
     eye,
     flatten,
     full,
@@ -43,6 +54,7 @@ from apytypes._array_functions import (
     fullrange,
     identity,
     import_csv,
+    import_mem,
     meshgrid,
     moveaxis,
     ones,
@@ -57,23 +69,34 @@ from apytypes._array_functions import (
     zeros,
     zeros_like,
 )
+from apytypes._fuse import Expr, expr
+from apytypes._io import load, save
 from apytypes._utils import fn, fp, from_bits, fx
 from apytypes._version import version as __version__
 
 __all__ = [
+    "APyBufferPoolContext",
     "APyCFixed",
     "APyCFixedArray",
+    "APyCFixedFIR",
     "APyCFloat",
     "APyCFloatArray",
+    "APyCFloatFIR",
     "APyFixed",
     "APyFixedAccumulatorContext",
     "APyFixedArray",
     "APyFixedCastContext",
+    "APyFixedFIR",
+    "APyFixedIIR",
     "APyFloat",
     "APyFloatAccumulatorContext",
     "APyFloatArray",
+    "APyFloatArrayPlanes",
+    "APyFloatFIR",
+    "APyFloatIIR",
     "APyFloatQuantizationContext",
     "ConvolutionMode",
+    "Expr",
     "OverflowMode",
     "QuantizationMode",
     "ThirdPartyArrayLibrary",
@@ -81,9 +104,13 @@ __all__ = [
     "_get_simd_version_str",
     "arange",
     "convolve",
+    "convolve2d",
+    "correlate",
     "expand_dims",
     "export_csv",
+    "export_mem",
     "eye",
+    "expr",
     "flatten",
     "fn",
     "fp",
@@ -98,6 +125,8 @@ __all__ = [
     "get_float_quantization_seed",
     "identity",
     "import_csv",
+    "import_mem",
+    "load",
     "meshgrid",
     "moveaxis",
     "n_threads",
@@ -107,6 +136,7 @@ __all__ = [
     "ravel",
     "reset_thread_pool",
     "reshape",
+    "save",
     "set_array_library",
     "set_fixed_quantization_seed",
     "set_float_quantization_mode",
@@ -276,6 +306,42 @@ If no quantization mode is specified to the accumulator context it will fallback
 mode set globally, see :class:`APyFloatQuantizationContext`.
 """
 
+APyBufferPoolContext.__doc__ = r"""
+Context for recycling array storage between operations.
+
+Every arithmetic operation on arrays allocates a new buffer for its result, and frees
+the buffers of temporaries that go out of scope. Within an
+:class:`APyBufferPoolContext`, freed array storage is instead cached on the calling
+thread and reused by later operations producing arrays of similar size, avoiding
+repeated heap allocations and zero-initialization in tight loops over same-sized
+arrays. Results are identical to those computed outside of the context.
+
+Parameters
+----------
+max_bytes : :class:`int`, default: 2**28
+    Maximum number of bytes of cached storage. Storage freed when the cache is full
+    is returned to the system.
+
+Examples
+--------
+
+>>> import numpy as np
+>>> from apytypes import APyFloatArray, APyBufferPoolContext
+
+>>> a = APyFloatArray.from_float(np.linspace(0, 1, 1000), exp_bits=5, man_bits=10)
+>>> b = APyFloatArray.from_float(np.linspace(1, 2, 1000), exp_bits=5, man_bits=10)
+
+>>> with APyBufferPoolContext():
+...     for _ in range(10):
+...         c = (a * b + a).cast(exp_bits=4, man_bits=3)
+
+All cached storage is freed upon exiting the outermost context. Nesting the contexts is
+possible, where the inner context temporarily changes the maximum number of cached
+bytes.
+
+.. versionadded:: 0.6
+"""
+
 APyFixed.__doc__ = r"""
 Class for configurable scalar fixed-point formats.
 
@@ -785,6 +785,7 @@ class APyCFixedArray:
     def __setstate__(
         self, arg: tuple[int, int, Sequence[int], Sequence[int]], /
     ) -> None: ...
+    def __reduce_ex__(self, protocol: int) -> object: ...
     @overload
     def __add__(self, arg: APyCFixedArray) -> APyCFixedArray: ...
     @overload
@@ -1024,17 +1025,27 @@ class APyCFixedArray:
 
     def to_numpy(
         self, dtype: object | None = None, copy: bool | None = None
-    ) -> NDArray[numpy.complex128]:
+    ) -> NDArray:
         """
         Return array as a :class:`numpy.ndarray` of :class:`numpy.complex128`.
 
         The returned array has the same `shape` and values as `self`. This
         method rounds away from infinity on ties.
 
+        If `dtype` is :class:`numpy.complex64`, or a single- or half-precision
+        floating-point type, a :class:`numpy.complex64` array is returned instead,
+        with the real and imaginary parts rounded once, to nearest with ties to
+        even. Other values of `dtype` give a :class:`numpy.complex128` array. Large
+        arrays are converted in parallel.
+
+        .. versionchanged:: 0.6
+            A :class:`numpy.complex64` array is returned for the corresponding
+            `dtype`.
+
         Parameters
         ----------
-        dtype : :py:class:`numpy.dtype`
-            The desired data type of the output array. This parameter is currently ignored.
+        dtype : :py:class:`numpy.dtype`, optional
+            The desired floating-point data type of the output array.
         copy : :class:`bool`
             Whether to copy the data or not. Must be :code:`True` or :code:`None`.
 
@@ -1330,6 +1341,52 @@ class APyCFixedArray:
         :class:`APyCFixedArray`
         """
 
+    def fma(
+        self,
+        b: APyCFixedArray,
+        c: APyCFixedArray,
+        int_bits: int | None = None,
+        frac_bits: int | None = None,
+        quantization: QuantizationMode | None = None,
+        overflow: OverflowMode | None = None,
+        bits: int | None = None,
+    ) -> APyCFixedArray:
+        """
+        Fused multiply-add, ``self * b + c``, with a single cast of the result.
+
+        The products and sums are evaluated in full precision, using the same word
+        lengths as ``self * b + c``. The real and imaginary parts are then quantized
+        and overflowed once into the new format. The result is identical to
+        ``(self * b + c).cast(int_bits, frac_bits, quantization, overflow, bits)``,
+        but no intermediate arrays are created.
+
+        Exactly two of three bit-specifiers (`bits`, `int_bits`, `frac_bits`) must
+        be set.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        b : :class:`APyCFixedArray`
+            The array to multiply with.
+        c : :class:`APyCFixedArray`
+            The array to add to the product.
+        int_bits : :class:`int`, optional
+            Number of integer bits in the result.
+        frac_bits : :class:`int`, optional
+            Number of fractional bits in the result.
+        quantization : :class:`QuantizationMode`, optional
+            Quantization mode to use in the cast.
+        overflow : :class:`OverflowMode`, optional
+            Overflowing mode to use in the cast.
+        bits : :class:`int`, optional
+            Total number of bits in the result.
+
+        Returns
+        -------
+        :class:`APyCFixedArray`
+        """
+
     def broadcast_to(self, shape: int | tuple[int, ...]) -> APyCFixedArray:
         """
         Broadcast array to new shape.
@@ -1383,6 +1440,251 @@ class APyCFixedArray:
     def convolve(
         self, other: APyCFixedArray, mode: Literal["full", "same", "valid"] = "full"
     ) -> APyCFixedArray: ...
+    @overload
+    def convolve2d(
+        self,
+        other: APyCFixedArray,
+        mode: ConvolutionMode = ConvolutionMode.FULL,
+        stride: int | tuple[int, ...] = 1,
+    ) -> APyCFixedArray:
+        """
+        Return the two-dimensional discrete linear convolution with another array.
+
+        The convolution is taken over the last two axes. The array `other` must be
+        two-dimensional, and any leading axes of `self` are batch axes: each
+        two-dimensional slice of `self` is convolved with `other`. Along each of the
+        two axes, `mode` selects the outputs as for :func:`convolve`. With `stride`,
+        only every `stride`-th output is computed, as in a strided convolutional
+        layer.
+
+        The result format is that of :func:`convolve`, with the length of the
+        shorter array replaced by the largest number of products of an output. An
+        active :class:`APyFixedAccumulatorContext` sets the result format instead.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        other : :class:`APyCFixedArray`
+            The two-dimensional array to convolve with.
+        mode : :class:`ConvolutionMode` or {'full', 'same', 'valid'}, default: :class:`~ConvolutionMode.FULL`
+            The outputs to keep along each axis, see :func:`convolve`.
+        stride : :class:`int` or :class:`tuple` of :class:`int`, default: 1
+            Step between the kept outputs, either for both axes or one per axis.
+
+        Returns
+        -------
+        convolved : :class:`APyCFixedArray`
+            The convolved array.
+        """
+
+    @overload
+    def convolve2d(
+        self,
+        other: APyCFixedArray,
+        mode: Literal["full", "same", "valid"] = "full",
+        stride: int | tuple[int, ...] = 1,
+    ) -> APyCFixedArray: ...
+    @overload
+    def correlate(
+        self,
+        other: APyCFixedArray,
+        mode: ConvolutionMode = ConvolutionMode.FULL,
+        stride: int | tuple[int, ...] = 1,
+    ) -> APyCFixedArray:
+        """
+        Return the discrete linear cross-correlation with another array.
+
+        The correlation is taken over the last :code:`other.ndim` axes, and any
+        leading axes of `self` are batch axes. For one-dimensional arrays, the
+        result is that of :func:`numpy.correlate`, but `mode` defaults to
+        :class:`~ConvolutionMode.FULL`. The correlation is the convolution with the
+        conjugate of `other`, reversed along all axes. The conjugate has one more
+        integer bit than `other`, and so has the result.
+
+        With a `stride`, only every `stride`-th output is computed, as in a strided
+        convolutional layer. A correlation with the kernel of a convolutional layer
+        in :class:`~ConvolutionMode.VALID` mode sums over its input channels.
+
+        The result format is that of :func:`convolve`, with the length of the
+        shorter array replaced by the largest number of products of an output. An
+        active :class:`APyFixedAccumulatorContext` sets the result format instead.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        other : :class:`APyCFixedArray`
+            The array to correlate with.
+        mode : :class:`ConvolutionMode` or {'full', 'same', 'valid'}, default: :class:`~ConvolutionMode.FULL`
+            The outputs to keep along each axis, see :func:`convolve`. With
+            :class:`~ConvolutionMode.SAME`, the outputs are centered as for
+            :func:`numpy.correlate`.
+        stride : :class:`int` or :class:`tuple` of :class:`int`, default: 1
+            Step between the kept outputs, either for all axes or one per axis.
+
+        Returns
+        -------
+        correlated : :class:`APyCFixedArray`
+            The correlated array.
+        """
+
+    @overload
+    def correlate(
+        self,
+        other: APyCFixedArray,
+        mode: Literal["full", "same", "valid"] = "full",
+        stride: int | tuple[int, ...] = 1,
+    ) -> APyCFixedArray: ...
+    def fft(
+        self,
+        axis: int = -1,
+        int_bits: int | Sequence[int] | None = None,
+        frac_bits: int | Sequence[int] | None = None,
+        quantization: QuantizationMode | Sequence[QuantizationMode] | None = None,
+        overflow: OverflowMode | Sequence[OverflowMode] | None = None,
+        twiddle_bits: int | None = None,
+    ) -> APyCFixedArray:
+        """
+        Compute the bit-true discrete Fourier transform using a radix-2 fast
+        Fourier transform.
+
+        The transform is evaluated as :code:`log2(N)` stages of decimation-in-time
+        butterflies, as in a hardware implementation. In each stage, the butterfly
+        outputs :code:`a + w * b` and :code:`a - w * b` are computed exactly and are
+        then quantized and overflowed to the format of the stage. The twiddle
+        factors :code:`w = exp(-2j * pi * k / N)` are rounded once, to the nearest
+        value with ties away from zero.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        axis : :class:`int`, default: -1
+            Axis along which to transform. The length along the axis must be a
+            power of two.
+        int_bits : :class:`int` or :class:`list` of :class:`int`, optional
+            Number of integer bits of the result of each butterfly stage, either
+            for all stages or as one value per stage. Defaults to the integer bits
+            of the input plus one bit per stage, plus one, which never overflows.
+        frac_bits : :class:`int` or :class:`list` of :class:`int`, optional
+            Number of fractional bits of the result of each butterfly stage, either
+            for all stages or as one value per stage. Defaults to the fractional
+            bits of the input.
+        quantization : :class:`QuantizationMode` or :class:`list` of \
+        :class:`QuantizationMode`, optional
+            Quantization mode of each butterfly stage. Defaults to the quantization
+            mode of the current :func:`set_fixed_cast_mode` context.
+        overflow : :class:`OverflowMode` or :class:`list` of \
+        :class:`OverflowMode`, optional
+            Overflow mode of each butterfly stage. Defaults to the overflow mode of
+            the current :func:`set_fixed_cast_mode` context.
+        twiddle_bits : :class:`int`, optional
+            Total number of bits of the twiddle factors, of which two are integer
+            bits. Must be at least two. Defaults to the number of bits of the input,
+            or two, whichever is larger.
+
+        Returns
+        -------
+        :class:`APyCFixedArray`
+            The transformed array, in the format of the last stage.
+
+        Raises
+        ------
+        :class:`ValueError`
+            If the length along `axis` is not a power of two, or if the length of a
+            per-stage list is not :code:`log2(N)`.
+        :class:`IndexError`
+            If `axis` is out of range.
+
+        See Also
+        --------
+        ifft
+
+        Examples
+        --------
+        >>> import apytypes as apy
+        >>> x = apy.APyCFixedArray.from_complex(
+        ...     [1, 1j, -1, -1j], int_bits=2, frac_bits=2
+        ... )
+        >>> x.fft()
+        APyCFixedArray([ (0, 0), (16, 0),  (0, 0),  (0, 0)], int_bits=5, frac_bits=2)
+        """
+
+    def ifft(
+        self,
+        axis: int = -1,
+        int_bits: int | Sequence[int] | None = None,
+        frac_bits: int | Sequence[int] | None = None,
+        quantization: QuantizationMode | Sequence[QuantizationMode] | None = None,
+        overflow: OverflowMode | Sequence[OverflowMode] | None = None,
+        twiddle_bits: int | None = None,
+    ) -> APyCFixedArray:
+        """
+        Compute the bit-true inverse discrete Fourier transform using a radix-2
+        fast Fourier transform.
+
+        The butterfly stages are evaluated as in :func:`fft`, using the conjugate
+        twiddle factors :code:`w = exp(2j * pi * k / N)`. The scaling by
+        :code:`1 / N` is exact: the binary point of the result is moved
+        :code:`log2(N)` bits to the left.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        axis : :class:`int`, default: -1
+            Axis along which to transform. The length along the axis must be a
+            power of two.
+        int_bits : :class:`int` or :class:`list` of :class:`int`, optional
+            Number of integer bits of the result of each butterfly stage, either
+            for all stages or as one value per stage. Defaults to the integer bits
+            of the input plus one bit per stage, plus one, which never overflows.
+        frac_bits : :class:`int` or :class:`list` of :class:`int`, optional
+            Number of fractional bits of the result of each butterfly stage, either
+            for all stages or as one value per stage. Defaults to the fractional
+            bits of the input.
+        quantization : :class:`QuantizationMode` or :class:`list` of \
+        :class:`QuantizationMode`, optional
+            Quantization mode of each butterfly stage. Defaults to the quantization
+            mode of the current :func:`set_fixed_cast_mode` context.
+        overflow : :class:`OverflowMode` or :class:`list` of \
+        :class:`OverflowMode`, optional
+            Overflow mode of each butterfly stage. Defaults to the overflow mode of
+            the current :func:`set_fixed_cast_mode` context.
+        twiddle_bits : :class:`int`, optional
+            Total number of bits of the twiddle factors, of which two are integer
+            bits. Must be at least two. Defaults to the number of bits of the input,
+            or two, whichever is larger.
+
+        Returns
+        -------
+        :class:`APyCFixedArray`
+            The transformed array, with :code:`log2(N)` fewer integer bits than the
+            last stage.
+
+        Raises
+        ------
+        :class:`ValueError`
+            If the length along `axis` is not a power of two, or if the length of a
+            per-stage list is not :code:`log2(N)`.
+        :class:`IndexError`
+            If `axis` is out of range.
+
+        See Also
+        --------
+        fft
+
+        Examples
+        --------
+        >>> import apytypes as apy
+        >>> x = apy.APyCFixedArray.from_complex(
+        ...     [1, 1j, -1, -1j], int_bits=2, frac_bits=2
+        ... )
+        >>> x.fft().ifft()
+        APyCFixedArray([  (16, 0),   (0, 16), (1008, 0), (0, 1008)], int_bits=6, frac_bits=4)
+        """
+
     def squeeze(self, axis: int | tuple[int, ...] | None = None) -> APyCFixedArray:
         """
         Remove axes of size one at the specified axis/axes.
@@ -1852,6 +2154,47 @@ class APyCFixedArray:
         :class:`APyCFixedArray`
         """
 
+    @staticmethod
+    def from_dlpack(
+        x: object,
+        int_bits: int | None = None,
+        frac_bits: int | None = None,
+        bits: int | None = None,
+    ) -> APyCFixedArray:
+        """
+        Create an :class:`APyCFixedArray` object from limbs in a DLPack-compatible
+        array.
+
+        The limbs are laid out as exported by :func:`__dlpack__`, with the real and
+        imaginary parts along an additional dimension of size two. For single-limb
+        formats (at most 64 bits on 64-bit platforms), `x` holds the bit pattern of
+        each part, and may be of any integer type. For multi-limb formats, yet
+        another innermost dimension holds the limbs of each part, least significant
+        limb first. Bits outside of the format are discarded by wrapping. Exactly
+        two of the three bit-specifiers (`bits`, `int_bits`, `frac_bits`) must be
+        set.
+
+        Only arrays in CPU memory can be imported, other devices raise
+        :class:`BufferError`.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        x : object
+            DLPack-compatible array, e.g., a NumPy array or a PyTorch tensor.
+        int_bits : :class:`int`, optional
+            Number of integer bits in the created fixed-point tensor.
+        frac_bits : :class:`int`, optional
+            Number of fractional bits in the created fixed-point tensor.
+        bits : :class:`int`, optional
+            Total number of bits in the created fixed-point tensor.
+
+        Returns
+        -------
+        :class:`APyCFixedArray`
+        """
+
     @staticmethod
     def zeros(
         shape: int | tuple[int, ...],
@@ -2055,7 +2398,56 @@ class APyCFixedArray:
     def __iter__(self) -> APyCFixedArrayIterator: ...
     def __array__(
         self, dtype: object | None = None, copy: bool | None = None
-    ) -> NDArray[numpy.complex128]: ...
+    ) -> NDArray: ...
+
+    def __dlpack__(
+        self,
+        *,
+        stream: object | None = None,
+        max_version: tuple[int, int] | None = None,
+        dl_device: tuple[int, int] | None = None,
+        copy: bool | None = None,
+    ) -> object:
+        """
+        Export the underlying limbs through the DLPack protocol.
+
+        The limbs are exported without a copy, unless `copy` is :code:`True`, as
+        signed integers of the limb size (64 bits on 64-bit platforms). An
+        additional dimension of size two holds the real and imaginary parts of each
+        element. For single-limb arrays (at most 64 bits), each part is the two's
+        complement bit pattern of the value, sign-extended to the full limb. For
+        multi-limb arrays, yet another innermost dimension holds the limbs of each
+        part, least significant limb first.
+
+        The unsigned bit patterns of :func:`to_bits` are the exported values modulo
+        ``2**bits``. They are not exported without a copy, as the limbs are stored
+        sign-extended, but ``to_bits(numpy=True)`` returns them in a NumPy array,
+        which in turn supports DLPack.
+
+        .. versionadded:: 0.6
+
+        Examples
+        --------
+        >>> import apytypes as apy
+        >>> import numpy as np
+        >>> a = apy.APyCFixedArray.from_complex(
+        ...     [1 + 2j, -0.5j], int_bits=4, frac_bits=2
+        ... )
+        >>> np.from_dlpack(a)
+        array([[ 4,  8],
+               [ 0, -2]])
+
+        See Also
+        --------
+        from_dlpack
+        """
+
+    def __dlpack_device__(self) -> tuple[int, int]:
+        """
+        Return the DLPack device of the array, which is always the CPU.
+
+        .. versionadded:: 0.6
+        """
 
 class APyCFixedArrayIterator:
     def __iter__(self) -> APyCFixedArrayIterator: ...
@@ -2594,6 +2986,7 @@ class APyCFloatArray:
         ],
         /,
     ) -> None: ...
+    def __reduce_ex__(self, protocol: int) -> object: ...
     @overload
     def __add__(self, arg: APyCFloatArray) -> APyCFloatArray: ...
     @overload
@@ -3397,17 +3790,27 @@ class APyCFloatArray:
 
     def to_numpy(
         self, dtype: object | None = None, copy: bool | None = None
-    ) -> NDArray[numpy.complex128]:
+    ) -> NDArray:
         """
         Return array as a :class:`numpy.ndarray` of :class:`numpy.complex128`.
 
         The returned array has the same `shape` and values as `self`. This
-        method rounds away from infinity on ties.
+        method rounds to nearest with ties to even.
+
+        If `dtype` is :class:`numpy.complex64`, or a single- or half-precision
+        floating-point type, a :class:`numpy.complex64` array is returned instead,
+        with the real and imaginary parts rounded once. Other values of `dtype`
+        give a :class:`numpy.complex128` array. Large arrays are converted in
+        parallel.
+
+        .. versionchanged:: 0.6
+            A :class:`numpy.complex64` array is returned for the corresponding
+            `dtype`.
 
         Parameters
         ----------
-        dtype : :py:class:`numpy.dtype`
-            The desired data type of the output array. This parameter is currently ignored.
+        dtype : :py:class:`numpy.dtype`, optional
+            The desired floating-point data type of the output array.
         copy : :class:`bool`
             Whether to copy the data or not. Must be :code:`True` or :code:`None`.
 
@@ -3473,6 +3876,52 @@ class APyCFloatArray:
         :class:`APyCFloatArray`
         """
 
+    def fma(
+        self,
+        b: APyCFloatArray,
+        c: APyCFloatArray,
+        exp_bits: int | None = None,
+        man_bits: int | None = None,
+        bias: int | None = None,
+        quantization: QuantizationMode | None = None,
+    ) -> APyCFloatArray:
+        """
+        Fused multiply-add, ``self * b + c``, with a single rounding.
+
+        The real and imaginary parts of the product and sum are evaluated exactly
+        and rounded once into the new format. Stochastic quantization modes round
+        the sums with two extra mantissa bits.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        b : :class:`APyCFloatArray`
+            The array to multiply with.
+        c : :class:`APyCFloatArray`
+            The array to add to the product.
+        exp_bits : :class:`int`, optional
+            Number of exponent bits in the result. If not provided, the largest
+            number of exponent bits of the operands is used.
+        man_bits : :class:`int`, optional
+            Number of mantissa bits in the result. If not provided, the largest
+            number of mantissa bits of the operands is used.
+        bias : :class:`int`, optional
+            Bias used in the result. If not provided, *bias* is ``2**(exp_bits - 1) - 1``.
+        quantization : :class:`QuantizationMode`, optional.
+            Quantization mode to use. If None, use the global quantization mode.
+
+        Returns
+        -------
+        :class:`APyCFloatArray`
+
+        Raises
+        ------
+        :class:`ValueError`
+            If the result has more than 59 mantissa bits or more than 29 exponent
+            bits.
+        """
+
     def cast(
         self,
         exp_bits: int | None = None,
@@ -3911,6 +4360,101 @@ class APyCFloatArray:
     def convolve(
         self, other: APyCFloatArray, mode: Literal["full", "same", "valid"] = "full"
     ) -> APyCFloatArray: ...
+    @overload
+    def convolve2d(
+        self,
+        other: APyCFloatArray,
+        mode: ConvolutionMode = ConvolutionMode.FULL,
+        stride: int | tuple[int, ...] = 1,
+    ) -> APyCFloatArray:
+        """
+        Return the two-dimensional discrete linear convolution with another array.
+
+        The convolution is taken over the last two axes. The array `other` must be
+        two-dimensional, and any leading axes of `self` are batch axes: each
+        two-dimensional slice of `self` is convolved with `other`. Along each of the
+        two axes, `mode` selects the outputs as for :func:`convolve`. With `stride`,
+        only every `stride`-th output is computed, as in a strided convolutional
+        layer.
+
+        The result format is that of :func:`convolve`. The products of each output
+        are accumulated in index order of the array with the most items, as for
+        :func:`convolve`.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        other : :class:`APyCFloatArray`
+            The two-dimensional array to convolve with.
+        mode : :class:`ConvolutionMode` or {'full', 'same', 'valid'}, default: :class:`~ConvolutionMode.FULL`
+            The outputs to keep along each axis, see :func:`convolve`.
+        stride : :class:`int` or :class:`tuple` of :class:`int`, default: 1
+            Step between the kept outputs, either for both axes or one per axis.
+
+        Returns
+        -------
+        convolved : :class:`APyCFloatArray`
+            The convolved array.
+        """
+
+    @overload
+    def convolve2d(
+        self,
+        other: APyCFloatArray,
+        mode: Literal["full", "same", "valid"] = "full",
+        stride: int | tuple[int, ...] = 1,
+    ) -> APyCFloatArray: ...
+    @overload
+    def correlate(
+        self,
+        other: APyCFloatArray,
+        mode: ConvolutionMode = ConvolutionMode.FULL,
+        stride: int | tuple[int, ...] = 1,
+    ) -> APyCFloatArray:
+        """
+        Return the discrete linear cross-correlation with another array.
+
+        The correlation is taken over the last :code:`other.ndim` axes, and any
+        leading axes of `self` are batch axes. For one-dimensional arrays, the
+        result is that of :func:`numpy.correlate`, but `mode` defaults to
+        :class:`~ConvolutionMode.FULL`. The correlation is the convolution with the
+        conjugate of `other`, reversed along all axes.
+
+        With a `stride`, only every `stride`-th output is computed, as in a strided
+        convolutional layer. A correlation with the kernel of a convolutional layer
+        in :class:`~ConvolutionMode.VALID` mode sums over its input channels.
+
+        The result format is that of :func:`convolve`. The products of each output
+        are accumulated in index order of the array with the most items, as for
+        :func:`convolve`.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        other : :class:`APyCFloatArray`
+            The array to correlate with.
+        mode : :class:`ConvolutionMode` or {'full', 'same', 'valid'}, default: :class:`~ConvolutionMode.FULL`
+            The outputs to keep along each axis, see :func:`convolve`. With
+            :class:`~ConvolutionMode.SAME`, the outputs are centered as for
+            :func:`numpy.correlate`.
+        stride : :class:`int` or :class:`tuple` of :class:`int`, default: 1
+            Step between the kept outputs, either for all axes or one per axis.
+
+        Returns
+        -------
+        correlated : :class:`APyCFloatArray`
+            The correlated array.
+        """
+
+    @overload
+    def correlate(
+        self,
+        other: APyCFloatArray,
+        mode: Literal["full", "same", "valid"] = "full",
+        stride: int | tuple[int, ...] = 1,
+    ) -> APyCFloatArray: ...
     def conj(self) -> APyCFloatArray:
         """
         Return complex conjugate.
@@ -3985,7 +4529,7 @@ class APyCFloatArray:
     def __iter__(self) -> APyCFloatArrayIterator: ...
     def __array__(
         self, dtype: object | None = None, copy: bool | None = None
-    ) -> NDArray[numpy.complex128]: ...
+    ) -> NDArray: ...
 
 class APyCFloatArrayIterator:
     def __iter__(self) -> APyCFloatArrayIterator: ...
@@ -4618,6 +5162,7 @@ class APyFixedArray:
     def __setstate__(
         self, arg: tuple[int, int, Sequence[int], Sequence[int]], /
     ) -> None: ...
+    def __reduce_ex__(self, protocol: int) -> object: ...
     @overload
     def __add__(self, arg: APyFixedArray) -> APyFixedArray: ...
     @overload
@@ -4633,7 +5178,7 @@ class APyFixedArray:
     @overload
     def __add__(self, arg: float) -> APyFixedArray: ...
     @overload
-    def __add__(self, arg: Annotated[NDArray, dict(order="C")]) -> APyFixedArray: ...
+    def __add__(self, arg: NDArray) -> APyFixedArray: ...
     @overload
     def __sub__(self, arg: APyFixedArray) -> APyFixedArray: ...
     @overload
@@ -4649,7 +5194,7 @@ class APyFixedArray:
     @overload
     def __sub__(self, arg: float) -> APyFixedArray: ...
     @overload
-    def __sub__(self, arg: Annotated[NDArray, dict(order="C")]) -> APyFixedArray: ...
+    def __sub__(self, arg: NDArray) -> APyFixedArray: ...
     @overload
     def __mul__(self, arg: APyFixedArray) -> APyFixedArray: ...
     @overload
@@ -4665,7 +5210,7 @@ class APyFixedArray:
     @overload
     def __mul__(self, arg: float) -> APyFixedArray: ...
     @overload
-    def __mul__(self, arg: Annotated[NDArray, dict(order="C")]) -> APyFixedArray: ...
+    def __mul__(self, arg: NDArray) -> APyFixedArray: ...
     @overload
     def __truediv__(self, arg: APyFixedArray) -> APyFixedArray: ...
     @overload
@@ -4681,9 +5226,7 @@ class APyFixedArray:
     @overload
     def __truediv__(self, arg: float) -> APyFixedArray: ...
     @overload
-    def __truediv__(
-        self, arg: Annotated[NDArray, dict(order="C")]
-    ) -> APyFixedArray: ...
+    def __truediv__(self, arg: NDArray) -> APyFixedArray: ...
     def __neg__(self) -> APyFixedArray: ...
     def __pos__(self) -> APyFixedArray: ...
     def __ilshift__(self, arg: int, /) -> APyFixedArray: ...
@@ -4937,17 +5480,26 @@ class APyFixedArray:
 
     def to_numpy(
         self, dtype: object | None = None, copy: bool | None = None
-    ) -> NDArray[numpy.float64]:
+    ) -> NDArray:
         """
         Return array as a :class:`numpy.ndarray` of :class:`numpy.float64`.
 
         The returned array has the same `shape` and values as `self`. This
         method rounds away from infinity on ties.
 
+        If `dtype` is :class:`numpy.float32` or :class:`numpy.float16`, the values
+        are instead rounded once, to nearest with ties to even, directly to that
+        data type. Other values of `dtype` give a :class:`numpy.float64` array.
+        Large arrays are converted in parallel.
+
+        .. versionchanged:: 0.6
+            Single- and half-precision arrays are returned for the corresponding
+            `dtype`.
+
         Parameters
         ----------
-        dtype : :py:class:`numpy.dtype`
-            The desired data type of the output array. This parameter is currently ignored.
+        dtype : :py:class:`numpy.dtype`, optional
+            The desired floating-point data type of the output array.
         copy : :class:`bool`
             Whether to copy the data or not. Must be :code:`True` or :code:`None`.
 
@@ -4968,17 +5520,21 @@ class APyFixedArray:
         """
         Return the underlying bit representations.
 
+        If *numpy* is :code:`True` and the total number of bits is more than 64, each
+        bit representation is split into 64-bit words, least significant word first,
+        along an additional, innermost, dimension of a :class:`numpy.ndarray` of
+        unsigned 64-bit integers.
+
+        .. versionchanged:: 0.6
+            Bit representations of more than 64 bits can be returned in a
+            :class:`numpy.ndarray`.
+
         Parameters
         ----------
         numpy : :class:`bool`, default: :code:`False`
             If :code:`True`, return the bit representations in a :class:`numpy.ndarray`.
             If :code:`False`, return the bit representations in a :class:`list`.
 
-        Raises
-        ------
-        :class:`ValueError`
-            If *numpy* is :code:`True` and the total number of bits is more than 64.
-
         Examples
         --------
         >>> from apytypes import fx
@@ -4989,6 +5545,11 @@ class APyFixedArray:
         [4, 6, 8, 10]
         >>> a.to_bits(numpy=True)
         array([ 4,  6,  8, 10], dtype=uint8)
+        >>> from apytypes import APyFixedArray
+        >>> b = APyFixedArray([2**80 - 1, 2**64 + 3], int_bits=80, frac_bits=0)
+        >>> b.to_bits(numpy=True)
+        array([[18446744073709551615,                65535],
+               [                   3,                    1]], dtype=uint64)
 
         Returns
         -------
@@ -5212,12 +5773,67 @@ class APyFixedArray:
         :class:`APyFixedArray`
         """
 
-    def broadcast_to(self, shape: int | tuple[int, ...]) -> APyFixedArray:
-        """
-        Broadcast array to new shape.
-
-        .. versionadded:: 0.2
-
+    def fma(
+        self,
+        b: APyFixedArray,
+        c: APyFixedArray,
+        int_bits: int | None = None,
+        frac_bits: int | None = None,
+        quantization: QuantizationMode | None = None,
+        overflow: OverflowMode | None = None,
+        bits: int | None = None,
+    ) -> APyFixedArray:
+        """
+        Fused multiply-add, ``self * b + c``, with a single cast of the result.
+
+        The products and sums are evaluated in full precision, using the same word
+        lengths as ``self * b + c``, and are then quantized and overflowed once into
+        the new format. The result is identical to
+        ``(self * b + c).cast(int_bits, frac_bits, quantization, overflow, bits)``,
+        but no intermediate arrays are created.
+
+        Exactly two of three bit-specifiers (`bits`, `int_bits`, `frac_bits`) must
+        be set.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        b : :class:`APyFixedArray`
+            The array to multiply with.
+        c : :class:`APyFixedArray`
+            The array to add to the product.
+        int_bits : :class:`int`, optional
+            Number of integer bits in the result.
+        frac_bits : :class:`int`, optional
+            Number of fractional bits in the result.
+        quantization : :class:`QuantizationMode`, optional
+            Quantization mode to use in the cast.
+        overflow : :class:`OverflowMode`, optional
+            Overflowing mode to use in the cast.
+        bits : :class:`int`, optional
+            Total number of bits in the result.
+
+        Returns
+        -------
+        :class:`APyFixedArray`
+
+        Examples
+        --------
+        >>> import apytypes as apy
+        >>> a = apy.fx([1.0, 2.0, 3.0], int_bits=4, frac_bits=2)
+        >>> b = apy.fx([0.5, 0.25, -1.0], int_bits=4, frac_bits=2)
+        >>> c = apy.fx([2.0, 0.75, 4.5], int_bits=4, frac_bits=2)
+        >>> a.fma(b, c, int_bits=4, frac_bits=1)
+        APyFixedArray([5, 2, 3], int_bits=4, frac_bits=1)
+        """
+
+    def broadcast_to(self, shape: int | tuple[int, ...]) -> APyFixedArray:
+        """
+        Broadcast array to new shape.
+
+        .. versionadded:: 0.2
+
         Parameters
         ----------
         shape : :class:`tuple` of :class:`int` or :class:`int`
@@ -5267,6 +5883,121 @@ class APyFixedArray:
     def convolve(
         self, other: APyFixedArray, mode: Literal["full", "same", "valid"] = "full"
     ) -> APyFixedArray: ...
+    @overload
+    def convolve2d(
+        self,
+        other: APyFixedArray,
+        mode: ConvolutionMode = ConvolutionMode.FULL,
+        stride: int | tuple[int, ...] = 1,
+    ) -> APyFixedArray:
+        """
+        Return the two-dimensional discrete linear convolution with another array.
+
+        The convolution is taken over the last two axes. The array `other` must be
+        two-dimensional, and any leading axes of `self` are batch axes: each
+        two-dimensional slice of `self` is convolved with `other`. Along each of the
+        two axes, `mode` selects the outputs as for :func:`convolve`. With `stride`,
+        only every `stride`-th output is computed, as in a strided convolutional
+        layer.
+
+        The result format is that of :func:`convolve`, with the length of the
+        shorter array replaced by the largest number of products of an output. An
+        active :class:`APyFixedAccumulatorContext` sets the result format instead.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        other : :class:`APyFixedArray`
+            The two-dimensional array to convolve with.
+        mode : :class:`ConvolutionMode` or {'full', 'same', 'valid'}, default: :class:`~ConvolutionMode.FULL`
+            The outputs to keep along each axis, see :func:`convolve`.
+        stride : :class:`int` or :class:`tuple` of :class:`int`, default: 1
+            Step between the kept outputs, either for both axes or one per axis.
+
+        Returns
+        -------
+        convolved : :class:`APyFixedArray`
+            The convolved array.
+
+        Examples
+        --------
+        >>> import apytypes as apy
+        >>> a = apy.fx([[1, 2], [3, 4]], int_bits=4, frac_bits=0)
+        >>> k = apy.fx([[1, 1], [1, 1]], int_bits=2, frac_bits=0)
+        >>> a.convolve2d(k)
+        APyFixedArray([[ 1,  3,  2],
+                       [ 4, 10,  6],
+                       [ 3,  7,  4]], int_bits=8, frac_bits=0)
+        """
+
+    @overload
+    def convolve2d(
+        self,
+        other: APyFixedArray,
+        mode: Literal["full", "same", "valid"] = "full",
+        stride: int | tuple[int, ...] = 1,
+    ) -> APyFixedArray: ...
+    @overload
+    def correlate(
+        self,
+        other: APyFixedArray,
+        mode: ConvolutionMode = ConvolutionMode.FULL,
+        stride: int | tuple[int, ...] = 1,
+    ) -> APyFixedArray:
+        """
+        Return the discrete linear cross-correlation with another array.
+
+        The correlation is taken over the last :code:`other.ndim` axes, and any
+        leading axes of `self` are batch axes. For one-dimensional arrays, the
+        result is that of :func:`numpy.correlate`, but `mode` defaults to
+        :class:`~ConvolutionMode.FULL`. The correlation is the convolution with
+        `other` reversed along all axes.
+
+        With a `stride`, only every `stride`-th output is computed, as in a strided
+        convolutional layer. A correlation with the kernel of a convolutional layer
+        in :class:`~ConvolutionMode.VALID` mode sums over its input channels.
+
+        The result format is that of :func:`convolve`, with the length of the
+        shorter array replaced by the largest number of products of an output. An
+        active :class:`APyFixedAccumulatorContext` sets the result format instead.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        other : :class:`APyFixedArray`
+            The array to correlate with.
+        mode : :class:`ConvolutionMode` or {'full', 'same', 'valid'}, default: :class:`~ConvolutionMode.FULL`
+            The outputs to keep along each axis, see :func:`convolve`. With
+            :class:`~ConvolutionMode.SAME`, the outputs are centered as for
+            :func:`numpy.correlate`.
+        stride : :class:`int` or :class:`tuple` of :class:`int`, default: 1
+            Step between the kept outputs, either for all axes or one per axis.
+
+        Returns
+        -------
+        correlated : :class:`APyFixedArray`
+            The correlated array.
+
+        Examples
+        --------
+        >>> import apytypes as apy
+        >>> a = apy.fx([1, 2, 3], int_bits=3, frac_bits=0)
+        >>> v = apy.fx([0, 1, 2], int_bits=3, frac_bits=0)
+        >>> a.correlate(v)
+        APyFixedArray([2, 5, 8, 3, 0], int_bits=8, frac_bits=0)
+        >>> a.correlate(v, mode="same")
+        APyFixedArray([5, 8, 3], int_bits=8, frac_bits=0)
+        """
+
+    @overload
+    def correlate(
+        self,
+        other: APyFixedArray,
+        mode: Literal["full", "same", "valid"] = "full",
+        stride: int | tuple[int, ...] = 1,
+    ) -> APyFixedArray: ...
     def squeeze(self, axis: int | tuple[int, ...] | None = None) -> APyFixedArray:
         """
         Remove axes of size one at the specified axis/axes.
@@ -5743,7 +6474,7 @@ class APyFixedArray:
 
     @staticmethod
     def from_array(
-        ndarray: Annotated[NDArray, dict(order="C")],
+        ndarray: NDArray,
         int_bits: int | None = None,
         frac_bits: int | None = None,
         bits: int | None = None,
@@ -5796,6 +6527,55 @@ class APyFixedArray:
         fx
         """
 
+    @staticmethod
+    def from_dlpack(
+        x: object,
+        int_bits: int | None = None,
+        frac_bits: int | None = None,
+        bits: int | None = None,
+    ) -> APyFixedArray:
+        """
+        Create an :class:`APyFixedArray` object from limbs in a DLPack-compatible
+        array.
+
+        The limbs are laid out as exported by :func:`__dlpack__`. For single-limb
+        formats (at most 64 bits on 64-bit platforms), `x` holds the bit pattern of
+        each element, and may be of any integer type. For multi-limb formats, an
+        additional innermost dimension of `x` holds the limbs of each element,
+        least significant limb first. Bits outside of the format are discarded by
+        wrapping. Exactly two of the three bit-specifiers (`bits`, `int_bits`,
+        `frac_bits`) must be set.
+
+        Only arrays in CPU memory can be imported, other devices raise
+        :class:`BufferError`.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        x : object
+            DLPack-compatible array, e.g., a NumPy array or a PyTorch tensor.
+        int_bits : :class:`int`, optional
+            Number of integer bits in the created fixed-point tensor.
+        frac_bits : :class:`int`, optional
+            Number of fractional bits in the created fixed-point tensor.
+        bits : :class:`int`, optional
+            Total number of bits in the created fixed-point tensor.
+
+        Examples
+        --------
+        >>> import apytypes as apy
+        >>> import numpy as np
+        >>> a = apy.fx([1.0, -0.5, 2.25], int_bits=4, frac_bits=2)
+        >>> b = np.from_dlpack(a)
+        >>> apy.APyFixedArray.from_dlpack(b, int_bits=4, frac_bits=2)
+        APyFixedArray([ 4, 62,  9], int_bits=4, frac_bits=2)
+
+        Returns
+        -------
+        :class:`APyFixedArray`
+        """
+
     @staticmethod
     def zeros(
         shape: int | tuple[int, ...],
@@ -5953,7 +6733,52 @@ class APyFixedArray:
     def __iter__(self) -> APyFixedArrayIterator: ...
     def __array__(
         self, dtype: object | None = None, copy: bool | None = None
-    ) -> NDArray[numpy.float64]: ...
+    ) -> NDArray: ...
+
+    def __dlpack__(
+        self,
+        *,
+        stream: object | None = None,
+        max_version: tuple[int, int] | None = None,
+        dl_device: tuple[int, int] | None = None,
+        copy: bool | None = None,
+    ) -> object:
+        """
+        Export the underlying limbs through the DLPack protocol.
+
+        The limbs are exported without a copy, unless `copy` is :code:`True`, as
+        signed integers of the limb size (64 bits on 64-bit platforms). For
+        single-limb arrays (at most 64 bits), each element is the two's complement
+        bit pattern of the value, sign-extended to the full limb. For multi-limb
+        arrays, an additional innermost dimension holds the limbs of each element,
+        least significant limb first.
+
+        The unsigned bit patterns of :func:`to_bits` are the exported values modulo
+        ``2**bits``. They are not exported without a copy, as the limbs are stored
+        sign-extended, but ``to_bits(numpy=True)`` returns them in a NumPy array,
+        which in turn supports DLPack.
+
+        .. versionadded:: 0.6
+
+        Examples
+        --------
+        >>> import apytypes as apy
+        >>> import numpy as np
+        >>> a = apy.fx([1.0, -0.5, 2.25], int_bits=4, frac_bits=2)
+        >>> np.from_dlpack(a)
+        array([ 4, -2,  9])
+
+        See Also
+        --------
+        from_dlpack
+        """
+
+    def __dlpack_device__(self) -> tuple[int, int]:
+        """
+        Return the DLPack device of the array, which is always the CPU.
+
+        .. versionadded:: 0.6
+        """
 
 class APyFixedArrayIterator:
     def __iter__(self) -> APyFixedArrayIterator: ...
@@ -6895,6 +7720,7 @@ class APyFloatArray:
         ],
         /,
     ) -> None: ...
+    def __reduce_ex__(self, protocol: int) -> object: ...
     @overload
     def __add__(self, arg: APyFloatArray) -> APyFloatArray: ...
     @overload
@@ -6904,7 +7730,7 @@ class APyFloatArray:
     @overload
     def __add__(self, arg: APyFloat) -> APyFloatArray: ...
     @overload
-    def __add__(self, arg: Annotated[NDArray, dict(order="C")]) -> APyFloatArray: ...
+    def __add__(self, arg: NDArray) -> APyFloatArray: ...
     @overload
     def __sub__(self, arg: APyFloatArray) -> APyFloatArray: ...
     @overload
@@ -6914,7 +7740,7 @@ class APyFloatArray:
     @overload
     def __sub__(self, arg: APyFloat) -> APyFloatArray: ...
     @overload
-    def __sub__(self, arg: Annotated[NDArray, dict(order="C")]) -> APyFloatArray: ...
+    def __sub__(self, arg: NDArray) -> APyFloatArray: ...
     @overload
     def __mul__(self, arg: APyFloatArray) -> APyFloatArray: ...
     @overload
@@ -6924,7 +7750,7 @@ class APyFloatArray:
     @overload
     def __mul__(self, arg: APyFloat) -> APyFloatArray: ...
     @overload
-    def __mul__(self, arg: Annotated[NDArray, dict(order="C")]) -> APyFloatArray: ...
+    def __mul__(self, arg: NDArray) -> APyFloatArray: ...
     @overload
     def __truediv__(self, arg: APyFloatArray) -> APyFloatArray: ...
     @overload
@@ -6934,9 +7760,7 @@ class APyFloatArray:
     @overload
     def __truediv__(self, arg: APyFloat) -> APyFloatArray: ...
     @overload
-    def __truediv__(
-        self, arg: Annotated[NDArray, dict(order="C")]
-    ) -> APyFloatArray: ...
+    def __truediv__(self, arg: NDArray) -> APyFloatArray: ...
     def __neg__(self) -> APyFloatArray: ...
     def __pos__(self) -> APyFloatArray: ...
     @overload
@@ -7111,17 +7935,26 @@ class APyFloatArray:
 
     def to_numpy(
         self, dtype: object | None = None, copy: bool | None = None
-    ) -> NDArray[numpy.float64]:
+    ) -> NDArray:
         """
         Return array as a :class:`numpy.ndarray` of :class:`numpy.float64`.
 
         The returned array has the same `shape` and values as `self`. This
-        method rounds away from infinity on ties.
+        method rounds to nearest with ties to even.
+
+        If `dtype` is :class:`numpy.float32` or :class:`numpy.float16`, the values
+        are instead rounded once, directly to that data type. Other values of
+        `dtype` give a :class:`numpy.float64` array. Large arrays are converted in
+        parallel.
+
+        .. versionchanged:: 0.6
+            Single- and half-precision arrays are returned for the corresponding
+            `dtype`.
 
         Parameters
         ----------
-        dtype : :py:class:`numpy.dtype`
-            The desired data type of the output array. This parameter is currently ignored.
+        dtype : :py:class:`numpy.dtype`, optional
+            The desired floating-point data type of the output array.
         copy : :class:`bool`
             Whether to copy the data or not. Must be :code:`True` or :code:`None`.
 
@@ -7167,6 +8000,32 @@ class APyFloatArray:
         :class:`list` of :class:`int` or :class:`numpy.ndarray`
         """
 
+    def to_planes(self) -> APyFloatArrayPlanes:
+        """
+        Return a compact copy with the signs, exponents, and mantissas stored in
+        separate planes.
+
+        Each plane uses the smallest unsigned integer type that fits the
+        corresponding field, e.g., three bytes per element for 8-bit formats. Use
+        :func:`APyFloatArrayPlanes.to_array` to convert back.
+
+        .. versionadded:: 0.6
+
+        Examples
+        --------
+        >>> import apytypes as apy
+        >>> a = apy.fp([1.0, 0.25, -1.5], exp_bits=4, man_bits=3)
+        >>> p = a.to_planes()
+        >>> p.nbytes
+        9
+        >>> p.to_array().is_identical(a)
+        True
+
+        Returns
+        -------
+        :class:`APyFloatArrayPlanes`
+        """
+
     def reshape(self, new_shape: int | tuple[int, ...]) -> APyFloatArray:
         """
         Reshape the APyFloatArray to the specified shape without changing its data.
@@ -7322,7 +8181,7 @@ class APyFloatArray:
 
     @staticmethod
     def from_array(
-        ndarray: Annotated[NDArray, dict(order="C")],
+        ndarray: NDArray,
         exp_bits: int,
         man_bits: int,
         bias: int | None = None,
@@ -7728,6 +8587,101 @@ class APyFloatArray:
     def convolve(
         self, other: APyFloatArray, mode: Literal["full", "same", "valid"] = "full"
     ) -> APyFloatArray: ...
+    @overload
+    def convolve2d(
+        self,
+        other: APyFloatArray,
+        mode: ConvolutionMode = ConvolutionMode.FULL,
+        stride: int | tuple[int, ...] = 1,
+    ) -> APyFloatArray:
+        """
+        Return the two-dimensional discrete linear convolution with another array.
+
+        The convolution is taken over the last two axes. The array `other` must be
+        two-dimensional, and any leading axes of `self` are batch axes: each
+        two-dimensional slice of `self` is convolved with `other`. Along each of the
+        two axes, `mode` selects the outputs as for :func:`convolve`. With `stride`,
+        only every `stride`-th output is computed, as in a strided convolutional
+        layer.
+
+        The result format is that of :func:`convolve`. The products of each output
+        are accumulated in index order of the array with the most items, as for
+        :func:`convolve`.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        other : :class:`APyFloatArray`
+            The two-dimensional array to convolve with.
+        mode : :class:`ConvolutionMode` or {'full', 'same', 'valid'}, default: :class:`~ConvolutionMode.FULL`
+            The outputs to keep along each axis, see :func:`convolve`.
+        stride : :class:`int` or :class:`tuple` of :class:`int`, default: 1
+            Step between the kept outputs, either for both axes or one per axis.
+
+        Returns
+        -------
+        convolved : :class:`APyFloatArray`
+            The convolved array.
+        """
+
+    @overload
+    def convolve2d(
+        self,
+        other: APyFloatArray,
+        mode: Literal["full", "same", "valid"] = "full",
+        stride: int | tuple[int, ...] = 1,
+    ) -> APyFloatArray: ...
+    @overload
+    def correlate(
+        self,
+        other: APyFloatArray,
+        mode: ConvolutionMode = ConvolutionMode.FULL,
+        stride: int | tuple[int, ...] = 1,
+    ) -> APyFloatArray:
+        """
+        Return the discrete linear cross-correlation with another array.
+
+        The correlation is taken over the last :code:`other.ndim` axes, and any
+        leading axes of `self` are batch axes. For one-dimensional arrays, the
+        result is that of :func:`numpy.correlate`, but `mode` defaults to
+        :class:`~ConvolutionMode.FULL`. The correlation is the convolution with
+        `other` reversed along all axes.
+
+        With a `stride`, only every `stride`-th output is computed, as in a strided
+        convolutional layer. A correlation with the kernel of a convolutional layer
+        in :class:`~ConvolutionMode.VALID` mode sums over its input channels.
+
+        The result format is that of :func:`convolve`. The products of each output
+        are accumulated in index order of the array with the most items, as for
+        :func:`convolve`.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        other : :class:`APyFloatArray`
+            The array to correlate with.
+        mode : :class:`ConvolutionMode` or {'full', 'same', 'valid'}, default: :class:`~ConvolutionMode.FULL`
+            The outputs to keep along each axis, see :func:`convolve`. With
+            :class:`~ConvolutionMode.SAME`, the outputs are centered as for
+            :func:`numpy.correlate`.
+        stride : :class:`int` or :class:`tuple` of :class:`int`, default: 1
+            Step between the kept outputs, either for all axes or one per axis.
+
+        Returns
+        -------
+        correlated : :class:`APyFloatArray`
+            The correlated array.
+        """
+
+    @overload
+    def correlate(
+        self,
+        other: APyFloatArray,
+        mode: Literal["full", "same", "valid"] = "full",
+        stride: int | tuple[int, ...] = 1,
+    ) -> APyFloatArray: ...
     def squeeze(self, axis: int | tuple[int, ...] | None = None) -> APyFloatArray:
         """
         Remove axes of size one at the specified axis/axes.
@@ -8190,7 +9144,54 @@ class APyFloatArray:
     def __iter__(self) -> APyFloatArrayIterator: ...
     def __array__(
         self, dtype: object | None = None, copy: bool | None = None
-    ) -> NDArray[numpy.float64]: ...
+    ) -> NDArray: ...
+    def fma(
+        self,
+        b: APyFloatArray,
+        c: APyFloatArray,
+        exp_bits: int | None = None,
+        man_bits: int | None = None,
+        bias: int | None = None,
+        quantization: QuantizationMode | None = None,
+    ) -> APyFloatArray:
+        """
+        Fused multiply-add, ``self * b + c``, with a single rounding.
+
+        The product and sum are evaluated exactly and rounded once into the new
+        format, as done by a hardware fused multiply-add unit. Stochastic
+        quantization modes round the sum with two extra mantissa bits.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        b : :class:`APyFloatArray`
+            The array to multiply with.
+        c : :class:`APyFloatArray`
+            The array to add to the product.
+        exp_bits : :class:`int`, optional
+            Number of exponent bits in the result. If not provided, the largest
+            number of exponent bits of the operands is used.
+        man_bits : :class:`int`, optional
+            Number of mantissa bits in the result. If not provided, the largest
+            number of mantissa bits of the operands is used.
+        bias : :class:`int`, optional
+            Bias used in the result. If not provided, *bias* is ``2**(exp_bits - 1) - 1``.
+        quantization : :class:`QuantizationMode`, optional.
+            Quantization mode to use. If None, use the global quantization mode.
+
+        Returns
+        -------
+        :class:`APyFloatArray`
+
+        Raises
+        ------
+        :class:`ValueError`
+            If the result has more than 59 mantissa bits, or more than 29 exponent
+            bits for operands whose exact products need more than 61 mantissa bits
+            or 30 exponent bits.
+        """
+
     def cast(
         self,
         exp_bits: int | None = None,
@@ -8340,29 +9341,795 @@ class APyFloatArray:
         :class:`APyFloatArray`
         """
 
-class APyFloatArrayIterator:
-    def __iter__(self) -> APyFloatArrayIterator: ...
-    def __next__(self) -> APyFloatArray | APyFloat: ...
+class APyFloatArrayPlanes:
+    """
+    Compact structure-of-arrays floating-point array.
 
-class ContextManager:
-    pass
+    The signs, biased exponents, and mantissas are stored in separate planes, each
+    using the smallest unsigned integer type that fits the corresponding field.
+    Planes are created using :func:`APyFloatArrayPlanes.from_float`,
+    :func:`APyFloatArrayPlanes.zeros`, or :func:`APyFloatArray.to_planes`.
+    Addition, subtraction, and multiplication of planes with the same shape return
+    planes, and are computed a block of elements at a time, so the full array is
+    never stored as an :class:`APyFloatArray`.
 
-class APyFloatQuantizationContext(ContextManager):
+    .. versionadded:: 0.6
     """
-    Context for changing the quantization mode used for floating-point operations.
-
-    If not specified explicitly, floating-point operations will use the quantization mode
-    that is set globally, which is :class:`QuantizationMode.TIES_EVEN` by default. The mode
-    however can be changed using the static method
-    :func:`apytypes.set_float_quantization_mode`, or, preferably, by using a so-called
-    quantization context. With a quantization context one can change the quantization mode
-    used by all operations within a specific section in the code.
 
-    Examples
-    --------
+    def __add__(self, arg: APyFloatArrayPlanes) -> APyFloatArrayPlanes: ...
+    def __sub__(self, arg: APyFloatArrayPlanes) -> APyFloatArrayPlanes: ...
+    def __mul__(self, arg: APyFloatArrayPlanes) -> APyFloatArrayPlanes: ...
+    @staticmethod
+    def from_float(
+        number_sequence: Iterable[Any],
+        exp_bits: int,
+        man_bits: int,
+        bias: int | None = None,
+    ) -> APyFloatArrayPlanes:
+        """
+        Create an :class:`APyFloatArrayPlanes` from iterable sequence of numbers.
 
-    >>> from apytypes import APyFloat, QuantizationMode
-    >>> from apytypes import APyFloatQuantizationContext
+        NumPy arrays are converted a block of elements at a time.
+
+        Parameters
+        ----------
+        number_sequence : :class:`~collections.abc.Iterable` of numbers
+            Floating point values to initialize from. The shape will be taken from
+            the sequence shape.
+        exp_bits : :class:`int`
+            Number of exponent bits.
+        man_bits : :class:`int`
+            Number of mantissa bits.
+        bias : :class:`int`, optional
+            Exponent bias. If not provided, *bias* is ``2**(exp_bits - 1) - 1``.
+
+        Examples
+        --------
+        >>> import apytypes as apy
+        >>> p = apy.APyFloatArrayPlanes.from_float(
+        ...     [1.0, 0.25, -1.5], exp_bits=4, man_bits=3
+        ... )
+        >>> p.nbytes
+        9
+        >>> float((p * p).to_array()[2])
+        2.25
+
+        Returns
+        -------
+        :class:`APyFloatArrayPlanes`
+        """
+
+    @staticmethod
+    def zeros(
+        shape: int | tuple[int, ...],
+        exp_bits: int,
+        man_bits: int,
+        bias: int | None = None,
+    ) -> APyFloatArrayPlanes:
+        """
+        Initialize planes with zeros.
+
+        Parameters
+        ----------
+        shape : :class:`tuple`
+            Shape of the array.
+        exp_bits : :class:`int`
+            Number of exponent bits.
+        man_bits : :class:`int`
+            Number of mantissa bits.
+        bias : :class:`int`, optional
+            Exponent bias. If not provided, *bias* is ``2**(exp_bits - 1) - 1``.
+
+        Returns
+        -------
+        :class:`APyFloatArrayPlanes`
+        """
+
+
+    def to_array(self) -> APyFloatArray:
+        """
+        Convert to an :class:`APyFloatArray`.
+
+        Returns
+        -------
+        :class:`APyFloatArray`
+        """
+
+    @property
+    def shape(self) -> tuple[int, ...]:
+        """
+        The shape of the array.
+
+        Returns
+        -------
+        :class:`tuple` of :class:`int`
+        """
+
+    @property
+    def exp_bits(self) -> int:
+        """
+        Number of exponent bits.
+
+        Returns
+        -------
+        :class:`int`
+        """
+
+    @property
+    def man_bits(self) -> int:
+        """
+        Number of mantissa bits.
+
+        Returns
+        -------
+        :class:`int`
+        """
+
+    @property
+    def bias(self) -> int:
+        """
+        Exponent bias.
+
+        Returns
+        -------
+        :class:`int`
+        """
+
+    @property
+    def nbytes(self) -> int:
+        """
+        Number of bytes used by the planes.
+
+        Returns
+        -------
+        :class:`int`
+        """
+
+    @property
+    def sign(self) -> (
+        NDArray[numpy.uint64]
+        | NDArray[numpy.uint32]
+        | NDArray[numpy.uint16]
+        | NDArray[numpy.uint8]
+    ):
+        """
+        Copy of the sign plane.
+
+        Returns
+        -------
+        :class:`numpy.ndarray`
+        """
+
+    @property
+    def exp(self) -> (
+        NDArray[numpy.uint64]
+        | NDArray[numpy.uint32]
+        | NDArray[numpy.uint16]
+        | NDArray[numpy.uint8]
+    ):
+        """
+        Copy of the biased exponent plane.
+
+        Returns
+        -------
+        :class:`numpy.ndarray`
+        """
+
+    @property
+    def man(self) -> (
+        NDArray[numpy.uint64]
+        | NDArray[numpy.uint32]
+        | NDArray[numpy.uint16]
+        | NDArray[numpy.uint8]
+    ):
+        """
+        Copy of the mantissa plane, without the hidden one.
+
+        Returns
+        -------
+        :class:`numpy.ndarray`
+        """
+
+class APyFloatArrayIterator:
+    def __iter__(self) -> APyFloatArrayIterator: ...
+    def __next__(self) -> APyFloatArray | APyFloat: ...
+
+class APyFixedFIR:
+    """
+    Streaming FIR filter for :class:`APyFixedArray` sample streams.
+
+    The filter holds its taps, pre-arranged for the inner products, and a delay
+    line, so that an endless stream can be filtered one block at a time without
+    any per-block setup. The stream is upsampled by `interpolation` through zero
+    insertion, filtered, and downsampled by `decimation`. The rate change is
+    evaluated in polyphase form: only the kept outputs are computed and the
+    inserted zeros are never multiplied.
+
+    The output format is that of :func:`APyFixedArray.convolve`, with the number
+    of taps replaced by the number of products of each output,
+    ``ceil(len(taps) / interpolation)``. The accumulator context active when the
+    filter is created, if any, is used for all blocks, see
+    :class:`APyFixedAccumulatorContext`.
+
+    .. versionadded:: 0.6
+
+    Parameters
+    ----------
+    taps : :class:`APyFixedArray`
+        One-dimensional array of filter taps.
+    decimation : :class:`int`, default: 1
+        Decimation factor.
+    interpolation : :class:`int`, default: 1
+        Interpolation factor.
+
+    Examples
+    --------
+    >>> import apytypes as apy
+    >>> taps = apy.fx([0.25, 0.5, 0.25], int_bits=1, frac_bits=2)
+    >>> fir = apy.APyFixedFIR(taps)
+    >>> fir.process(apy.fx([1, 0], int_bits=2, frac_bits=0))
+    APyFixedArray([1, 2], int_bits=5, frac_bits=2)
+    >>> fir.process(apy.fx([0, 0], int_bits=2, frac_bits=0))
+    APyFixedArray([1, 0], int_bits=5, frac_bits=2)
+
+    Decimation by two only computes every other output
+
+    >>> fir = apy.APyFixedFIR(taps, decimation=2)
+    >>> fir.process(apy.fx([1, 0, 0, 0], int_bits=2, frac_bits=0))
+    APyFixedArray([1, 1], int_bits=5, frac_bits=2)
+    """
+
+    def __init__(
+        self, taps: APyFixedArray, *, decimation: int = 1, interpolation: int = 1
+    ) -> None: ...
+    def process(self, x: APyFixedArray) -> APyFixedArray:
+        """
+        Filter the next block of the input stream.
+
+        The delay line carries over between blocks, so filtering a stream block by
+        block gives the same result as filtering it all at once. Blocks may have
+        any length, including zero. The format of the first block after creation
+        or :func:`reset` sets the input format of the filter.
+
+        Parameters
+        ----------
+        x : one-dimensional array
+            The next block of input samples.
+
+        Returns
+        -------
+        out : array of the same type as `x`
+            The output samples of the block. With decimation, the number of
+            outputs may vary between blocks.
+
+        Raises
+        ------
+        :class:`ValueError`
+            If `x` is not one-dimensional or if its format differs from that of
+            the previous blocks.
+        """
+
+    def reset(self) -> None:
+        """
+        Clear the delay line and the input format.
+
+        The next block is filtered as the start of a new stream.
+        """
+
+    @property
+    def taps(self) -> APyFixedArray:
+        """
+        Copy of the filter taps.
+        """
+
+    @property
+    def decimation(self) -> int:
+        """
+        Decimation factor.
+
+        Returns
+        -------
+        :class:`int`
+        """
+
+    @property
+    def interpolation(self) -> int:
+        """
+        Interpolation factor.
+
+        Returns
+        -------
+        :class:`int`
+        """
+
+class APyCFixedFIR:
+    """
+    Streaming FIR filter for :class:`APyCFixedArray` sample streams.
+
+    Works as :class:`APyFixedFIR`, with complex-valued taps and samples. The output
+    format is that of :func:`APyCFixedArray.convolve`, with the number of taps
+    replaced by the number of products of each output.
+
+    .. versionadded:: 0.6
+
+    Parameters
+    ----------
+    taps : :class:`APyCFixedArray`
+        One-dimensional array of filter taps.
+    decimation : :class:`int`, default: 1
+        Decimation factor.
+    interpolation : :class:`int`, default: 1
+        Interpolation factor.
+    """
+
+    def __init__(
+        self, taps: APyCFixedArray, *, decimation: int = 1, interpolation: int = 1
+    ) -> None: ...
+    def process(self, x: APyCFixedArray) -> APyCFixedArray:
+        """
+        Filter the next block of the input stream.
+
+        The delay line carries over between blocks, so filtering a stream block by
+        block gives the same result as filtering it all at once. Blocks may have
+        any length, including zero. The format of the first block after creation
+        or :func:`reset` sets the input format of the filter.
+
+        Parameters
+        ----------
+        x : one-dimensional array
+            The next block of input samples.
+
+        Returns
+        -------
+        out : array of the same type as `x`
+            The output samples of the block. With decimation, the number of
+            outputs may vary between blocks.
+
+        Raises
+        ------
+        :class:`ValueError`
+            If `x` is not one-dimensional or if its format differs from that of
+            the previous blocks.
+        """
+
+    def reset(self) -> None:
+        """
+        Clear the delay line and the input format.
+
+        The next block is filtered as the start of a new stream.
+        """
+
+    @property
+    def taps(self) -> APyCFixedArray:
+        """
+        Copy of the filter taps.
+        """
+
+    @property
+    def decimation(self) -> int:
+        """
+        Decimation factor.
+
+        Returns
+        -------
+        :class:`int`
+        """
+
+    @property
+    def interpolation(self) -> int:
+        """
+        Interpolation factor.
+
+        Returns
+        -------
+        :class:`int`
+        """
+
+class APyFloatFIR:
+    """
+    Streaming FIR filter for :class:`APyFloatArray` sample streams.
+
+    Works as :class:`APyFixedFIR`, with floating-point taps and samples. The
+    output format is that of :func:`APyFloatArray.convolve`. The products of each
+    output are accumulated from the oldest to the newest sample. The accumulator
+    context, or else the quantization mode, active when the filter is created is
+    used for all blocks.
+
+    .. versionadded:: 0.6
+
+    Parameters
+    ----------
+    taps : :class:`APyFloatArray`
+        One-dimensional array of filter taps.
+    decimation : :class:`int`, default: 1
+        Decimation factor.
+    interpolation : :class:`int`, default: 1
+        Interpolation factor.
+    """
+
+    def __init__(
+        self, taps: APyFloatArray, *, decimation: int = 1, interpolation: int = 1
+    ) -> None: ...
+    def process(self, x: APyFloatArray) -> APyFloatArray:
+        """
+        Filter the next block of the input stream.
+
+        The delay line carries over between blocks, so filtering a stream block by
+        block gives the same result as filtering it all at once. Blocks may have
+        any length, including zero. The format of the first block after creation
+        or :func:`reset` sets the input format of the filter.
+
+        Parameters
+        ----------
+        x : one-dimensional array
+            The next block of input samples.
+
+        Returns
+        -------
+        out : array of the same type as `x`
+            The output samples of the block. With decimation, the number of
+            outputs may vary between blocks.
+
+        Raises
+        ------
+        :class:`ValueError`
+            If `x` is not one-dimensional or if its format differs from that of
+            the previous blocks.
+        """
+
+    def reset(self) -> None:
+        """
+        Clear the delay line and the input format.
+
+        The next block is filtered as the start of a new stream.
+        """
+
+    @property
+    def taps(self) -> APyFloatArray:
+        """
+        Copy of the filter taps.
+        """
+
+    @property
+    def decimation(self) -> int:
+        """
+        Decimation factor.
+
+        Returns
+        -------
+        :class:`int`
+        """
+
+    @property
+    def interpolation(self) -> int:
+        """
+        Interpolation factor.
+
+        Returns
+        -------
+        :class:`int`
+        """
+
+class APyCFloatFIR:
+    """
+    Streaming FIR filter for :class:`APyCFloatArray` sample streams.
+
+    Works as :class:`APyFloatFIR`, with complex-valued taps and samples.
+
+    .. versionadded:: 0.6
+
+    Parameters
+    ----------
+    taps : :class:`APyCFloatArray`
+        One-dimensional array of filter taps.
+    decimation : :class:`int`, default: 1
+        Decimation factor.
+    interpolation : :class:`int`, default: 1
+        Interpolation factor.
+    """
+
+    def __init__(
+        self, taps: APyCFloatArray, *, decimation: int = 1, interpolation: int = 1
+    ) -> None: ...
+    def process(self, x: APyCFloatArray) -> APyCFloatArray:
+        """
+        Filter the next block of the input stream.
+
+        The delay line carries over between blocks, so filtering a stream block by
+        block gives the same result as filtering it all at once. Blocks may have
+        any length, including zero. The format of the first block after creation
+        or :func:`reset` sets the input format of the filter.
+
+        Parameters
+        ----------
+        x : one-dimensional array
+            The next block of input samples.
+
+        Returns
+        -------
+        out : array of the same type as `x`
+            The output samples of the block. With decimation, the number of
+            outputs may vary between blocks.
+
+        Raises
+        ------
+        :class:`ValueError`
+            If `x` is not one-dimensional or if its format differs from that of
+            the previous blocks.
+        """
+
+    def reset(self) -> None:
+        """
+        Clear the delay line and the input format.
+
+        The next block is filtered as the start of a new stream.
+        """
+
+    @property
+    def taps(self) -> APyCFloatArray:
+        """
+        Copy of the filter taps.
+        """
+
+    @property
+    def decimation(self) -> int:
+        """
+        Decimation factor.
+
+        Returns
+        -------
+        :class:`int`
+        """
+
+    @property
+    def interpolation(self) -> int:
+        """
+        Interpolation factor.
+
+        Returns
+        -------
+        :class:`int`
+        """
+
+class APyFixedIIR:
+    """
+    Bit-true IIR filter for :class:`APyFixedArray` sample streams, as a cascade of
+    second-order sections.
+
+    Each section is evaluated in direct form I,
+
+    .. math::
+        y[n] = b_0 x[n] + b_1 x[n-1] + b_2 x[n-2] - a_1 y[n-1] - a_2 y[n-2],
+
+    where the right-hand side is computed exactly and is then quantized and
+    overflowed once, to the output format of the section. The output of each
+    section is the input of the next. Each section has its own coefficient format,
+    output format, quantization, and overflow, which makes the filter bit-true to
+    a hardware implementation with the same word lengths.
+
+    Any number of independent channels are filtered at once, and large blocks are
+    split over the channels on the thread pool.
+
+    .. versionadded:: 0.6
+
+    Parameters
+    ----------
+    sos : :class:`APyFixedArray` or :class:`list` of :class:`APyFixedArray`
+        The second-order sections :code:`[b0, b1, b2, a0, a1, a2]`, in the layout
+        of :func:`scipy.signal.sosfilt`. Either a single array of shape
+        :code:`(n_sections, 6)`, or one array of shape :code:`(6,)` per section,
+        for per-section coefficient formats. The coefficient :code:`a0` must be
+        one.
+    int_bits : :class:`int` or :class:`list` of :class:`int`
+        Number of integer bits of the output of each section, either for all
+        sections or as one value per section.
+    frac_bits : :class:`int` or :class:`list` of :class:`int`
+        Number of fractional bits of the output of each section, either for all
+        sections or as one value per section.
+    quantization : :class:`QuantizationMode` or :class:`list` of \
+    :class:`QuantizationMode`, optional
+        Quantization mode of each section. Defaults to the quantization mode of
+        the :func:`set_fixed_cast_mode` context active on creation.
+    overflow : :class:`OverflowMode` or :class:`list` of \
+    :class:`OverflowMode`, optional
+        Overflow mode of each section. Defaults to the overflow mode of the
+        :func:`set_fixed_cast_mode` context active on creation.
+
+    Examples
+    --------
+    >>> import apytypes as apy
+    >>> sos = apy.fx([[0.5, 0, 0, 1, -0.5, 0]], int_bits=2, frac_bits=1)
+    >>> iir = apy.APyFixedIIR(
+    ...     sos, int_bits=3, frac_bits=3, quantization=apy.QuantizationMode.TRN
+    ... )
+    >>> iir.process(apy.fx([1, 0, 0, 0, 0], int_bits=2, frac_bits=0))
+    APyFixedArray([4, 2, 1, 0, 0], int_bits=3, frac_bits=3)
+
+    Rounding, instead of truncation, results in a limit cycle
+
+    >>> iir = apy.APyFixedIIR(
+    ...     sos, int_bits=3, frac_bits=3, quantization=apy.QuantizationMode.RND
+    ... )
+    >>> iir.process(apy.fx([1, 0, 0, 0, 0], int_bits=2, frac_bits=0))
+    APyFixedArray([4, 2, 1, 1, 1], int_bits=3, frac_bits=3)
+    """
+
+    def __init__(
+        self,
+        sos: APyFixedArray | Sequence[APyFixedArray],
+        *,
+        int_bits: int | Sequence[int],
+        frac_bits: int | Sequence[int],
+        quantization: QuantizationMode | Sequence[QuantizationMode] | None = None,
+        overflow: OverflowMode | Sequence[OverflowMode] | None = None,
+    ) -> None: ...
+    def process(self, x: APyFixedArray, axis: int = -1) -> APyFixedArray:
+        """
+        Filter the next block of the input streams.
+
+        Each one-dimensional slice of `x` along `axis` is a block of an
+        independent channel, with its own filter state. The state carries over
+        between blocks, so filtering the streams block by block gives the same
+        result as filtering them all at once. Blocks may have any length along
+        `axis`, including zero. The format of the first block after creation or
+        :func:`reset`, and the shape of its channels, are kept for the following
+        blocks.
+
+        Parameters
+        ----------
+        x : array
+            The next block of input samples of each channel.
+        axis : :class:`int`, default: -1
+            Axis along which to filter.
+
+        Returns
+        -------
+        out : array of the same type and shape as `x`
+            The output samples of the block, in the format of the last section.
+
+        Raises
+        ------
+        :class:`ValueError`
+            If the format of `x`, or the shape of its channels, differs from that
+            of the previous blocks.
+        :class:`IndexError`
+            If `axis` is out of range.
+        """
+
+    def reset(self) -> None:
+        """
+        Clear the filter state, the input format, and the shape of the channels.
+
+        The next block is filtered as the start of new streams.
+        """
+
+    @property
+    def n_sections(self) -> int:
+        """
+        Number of second-order sections.
+
+        Returns
+        -------
+        :class:`int`
+        """
+
+class APyFloatIIR:
+    """
+    Bit-true IIR filter for :class:`APyFloatArray` sample streams, as a cascade of
+    second-order sections.
+
+    Each section is evaluated in direct form I. The feed-forward sum
+    :code:`b2 * x[n-2] + b1 * x[n-1] + b0 * x[n]` and the feedback sum
+    :code:`a2 * y[n-2] + a1 * y[n-1]` are accumulated in the output format of the
+    section, oldest sample first, and the output is their difference. The output
+    of each section is the input of the next.
+
+    Any number of independent channels are filtered at once, and large blocks are
+    split over the channels on the thread pool.
+
+    .. versionadded:: 0.6
+
+    Parameters
+    ----------
+    sos : :class:`APyFloatArray` or :class:`list` of :class:`APyFloatArray`
+        The second-order sections :code:`[b0, b1, b2, a0, a1, a2]`, in the layout
+        of :func:`scipy.signal.sosfilt`. Either a single array of shape
+        :code:`(n_sections, 6)`, or one array of shape :code:`(6,)` per section,
+        for per-section coefficient formats. The coefficient :code:`a0` must be
+        one.
+    exp_bits : :class:`int` or :class:`list` of :class:`int`
+        Number of exponent bits of the output of each section, either for all
+        sections or as one value per section.
+    man_bits : :class:`int` or :class:`list` of :class:`int`
+        Number of mantissa bits of the output of each section, either for all
+        sections or as one value per section.
+    bias : :class:`int` or :class:`list` of :class:`int`, optional
+        Exponent bias of the output of each section. Defaults to the IEEE-like
+        bias of each section.
+    quantization : :class:`QuantizationMode` or :class:`list` of \
+    :class:`QuantizationMode`, optional
+        Quantization mode of each section. Defaults to the
+        :func:`set_float_quantization_mode` context active on creation.
+    """
+
+    def __init__(
+        self,
+        sos: APyFloatArray | Sequence[APyFloatArray],
+        *,
+        exp_bits: int | Sequence[int],
+        man_bits: int | Sequence[int],
+        bias: int | Sequence[int] | None = None,
+        quantization: QuantizationMode | Sequence[QuantizationMode] | None = None,
+    ) -> None: ...
+    def process(self, x: APyFloatArray, axis: int = -1) -> APyFloatArray:
+        """
+        Filter the next block of the input streams.
+
+        Each one-dimensional slice of `x` along `axis` is a block of an
+        independent channel, with its own filter state. The state carries over
+        between blocks, so filtering the streams block by block gives the same
+        result as filtering them all at once. Blocks may have any length along
+        `axis`, including zero. The format of the first block after creation or
+        :func:`reset`, and the shape of its channels, are kept for the following
+        blocks.
+
+        Parameters
+        ----------
+        x : array
+            The next block of input samples of each channel.
+        axis : :class:`int`, default: -1
+            Axis along which to filter.
+
+        Returns
+        -------
+        out : array of the same type and shape as `x`
+            The output samples of the block, in the format of the last section.
+
+        Raises
+        ------
+        :class:`ValueError`
+            If the format of `x`, or the shape of its channels, differs from that
+            of the previous blocks.
+        :class:`IndexError`
+            If `axis` is out of range.
+        """
+
+    def reset(self) -> None:
+        """
+        Clear the filter state, the input format, and the shape of the channels.
+
+        The next block is filtered as the start of new streams.
+        """
+
+    @property
+    def n_sections(self) -> int:
+        """
+        Number of second-order sections.
+
+        Returns
+        -------
+        :class:`int`
+        """
+
+class ContextManager:
+    pass
+
+class APyFloatQuantizationContext(ContextManager):
+    """
+    Context for changing the quantization mode used for floating-point operations.
+
+    If not specified explicitly, floating-point operations will use the quantization mode
+    that is set globally, which is :class:`QuantizationMode.TIES_EVEN` by default. The mode
+    however can be changed using the static method
+    :func:`apytypes.set_float_quantization_mode`, or, preferably, by using a so-called
+    quantization context. With a quantization context one can change the quantization mode
+    used by all operations within a specific section in the code.
+
+    Examples
+    --------
+
+    >>> from apytypes import APyFloat, QuantizationMode
+    >>> from apytypes import APyFloatQuantizationContext
 
     Addition using the default round to nearest, ties even
 
@@ -8484,3 +10251,49 @@ class APyFixedCastContext(ContextManager):
         exc_value: object | None = None,
         traceback: object | None = None,
     ) -> None: ...
+
+class APyBufferPoolContext(ContextManager):
+    """
+    Context for recycling array storage between operations.
+
+    Every arithmetic operation on arrays allocates a new buffer for its result, and frees
+    the buffers of temporaries that go out of scope. Within an
+    :class:`APyBufferPoolContext`, freed array storage is instead cached on the calling
+    thread and reused by later operations producing arrays of similar size, avoiding
+    repeated heap allocations and zero-initialization in tight loops over same-sized
+    arrays. Results are identical to those computed outside of the context.
+
+    Parameters
+    ----------
+    max_bytes : :class:`int`, default: 2**28
+        Maximum number of bytes of cached storage. Storage freed when the cache is full
+        is returned to the system.
+
+    Examples
+    --------
+
+    >>> import numpy as np
+    >>> from apytypes import APyFloatArray, APyBufferPoolContext
+
+    >>> a = APyFloatArray.from_float(np.linspace(0, 1, 1000), exp_bits=5, man_bits=10)
+    >>> b = APyFloatArray.from_float(np.linspace(1, 2, 1000), exp_bits=5, man_bits=10)
+
+    >>> with APyBufferPoolContext():
+    ...     for _ in range(10):
+    ...         c = (a * b + a).cast(exp_bits=4, man_bits=3)
+
+    All cached storage is freed upon exiting the outermost context. Nesting the contexts is
+    possible, where the inner context temporarily changes the maximum number of cached
+    bytes.
+
+    .. versionadded:: 0.6
+    """
+
+    def __init__(self, max_bytes: int = 268435456) -> None: ...
+    def __enter__(self) -> None: ...
+    def __exit__(
+        self,
+        exc_type: object | None = None,
+        exc_value: object | None = None,
+        traceback: object | None = None,
+    ) -> None: ...
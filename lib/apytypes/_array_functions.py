@@ -1,4 +1,3 @@
-import csv
 from collections.abc import Sequence
 from pathlib import Path
 from typing import Literal, overload
@@ -131,6 +130,147 @@ def convolve(
         raise TypeError(f"Cannot convolve {type(a)} with {type(v)}")
 
 
+@overload
+def convolve2d(
+    a: APyFixedArray,
+    v: APyFixedArray,
+    mode: ConvolutionMode | Literal["full", "same", "valid"] = ConvolutionMode.FULL,
+    stride: int | tuple[int, ...] = 1,
+) -> APyFixedArray: ...
+@overload
+def convolve2d(
+    a: APyFloatArray,
+    v: APyFloatArray,
+    mode: ConvolutionMode | Literal["full", "same", "valid"] = ConvolutionMode.FULL,
+    stride: int | tuple[int, ...] = 1,
+) -> APyFloatArray: ...
+@overload
+def convolve2d(
+    a: APyCFixedArray,
+    v: APyCFixedArray,
+    mode: ConvolutionMode | Literal["full", "same", "valid"] = ConvolutionMode.FULL,
+    stride: int | tuple[int, ...] = 1,
+) -> APyCFixedArray: ...
+@overload
+def convolve2d(
+    a: APyCFloatArray,
+    v: APyCFloatArray,
+    mode: ConvolutionMode | Literal["full", "same", "valid"] = ConvolutionMode.FULL,
+    stride: int | tuple[int, ...] = 1,
+) -> APyCFloatArray: ...
+
+
+def convolve2d(
+    a: APyArray,
+    v: APyArray,
+    mode: ConvolutionMode | Literal["full", "same", "valid"] = ConvolutionMode.FULL,
+    stride: int | tuple[int, ...] = 1,
+) -> APyArray:
+    """
+    Return the two-dimensional discrete linear convolution of two arrays.
+
+    The convolution is taken over the last two axes. The array `v` must be
+    two-dimensional, and any leading axes of `a` are batch axes.
+
+    .. versionadded:: 0.6
+
+    Parameters
+    ----------
+    a : :class:`APyFloatArray` or :class:`APyFixedArray`
+        Array with at least two dimensions.
+
+    v : :class:`APyFloatArray` or :class:`APyFixedArray`
+        Two-dimensional array.
+
+    mode : :class:`ConvolutionMode` or {'full', 'same', 'valid'}, default: :class:`~ConvolutionMode.FULL`
+        The outputs to keep along each axis, as for :func:`convolve`.
+
+    stride : :class:`int` or :class:`tuple` of :class:`int`, default: 1
+        Step between the kept outputs, either for both axes or one per axis.
+
+    Returns
+    -------
+    convolved : :class:`APyFloatArray` or :class:`APyFixedArray`
+        The convolved array.
+
+    """
+    try:
+        return a.convolve2d(v, mode=mode, stride=stride)
+    except (TypeError, AttributeError):
+        raise TypeError(f"Cannot convolve2d {type(a)} with {type(v)}")
+
+
+@overload
+def correlate(
+    a: APyFixedArray,
+    v: APyFixedArray,
+    mode: ConvolutionMode | Literal["full", "same", "valid"] = ConvolutionMode.FULL,
+    stride: int | tuple[int, ...] = 1,
+) -> APyFixedArray: ...
+@overload
+def correlate(
+    a: APyFloatArray,
+    v: APyFloatArray,
+    mode: ConvolutionMode | Literal["full", "same", "valid"] = ConvolutionMode.FULL,
+    stride: int | tuple[int, ...] = 1,
+) -> APyFloatArray: ...
+@overload
+def correlate(
+    a: APyCFixedArray,
+    v: APyCFixedArray,
+    mode: ConvolutionMode | Literal["full", "same", "valid"] = ConvolutionMode.FULL,
+    stride: int | tuple[int, ...] = 1,
+) -> APyCFixedArray: ...
+@overload
+def correlate(
+    a: APyCFloatArray,
+    v: APyCFloatArray,
+    mode: ConvolutionMode | Literal["full", "same", "valid"] = ConvolutionMode.FULL,
+    stride: int | tuple[int, ...] = 1,
+) -> APyCFloatArray: ...
+
+
+def correlate(
+    a: APyArray,
+    v: APyArray,
+    mode: ConvolutionMode | Literal["full", "same", "valid"] = ConvolutionMode.FULL,
+    stride: int | tuple[int, ...] = 1,
+) -> APyArray:
+    """
+    Return the discrete linear cross-correlation of two arrays.
+
+    The correlation is taken over the last :code:`v.ndim` axes, and any leading axes
+    of `a` are batch axes. For one-dimensional arrays, the result is that of
+    :func:`numpy.correlate`, but `mode` defaults to :class:`~ConvolutionMode.FULL`.
+
+    .. versionadded:: 0.6
+
+    Parameters
+    ----------
+    a : :class:`APyFloatArray` or :class:`APyFixedArray`
+        First array.
+
+    v : :class:`APyFloatArray` or :class:`APyFixedArray`
+        Second array, with at most as many dimensions as `a`.
+
+    mode : :class:`ConvolutionMode` or {'full', 'same', 'valid'}, default: :class:`~ConvolutionMode.FULL`
+        The outputs to keep along each axis, as for :func:`convolve`.
+
+    stride : :class:`int` or :class:`tuple` of :class:`int`, default: 1
+        Step between the kept outputs, either for all axes or one per axis.
+
+    Returns
+    -------
+    correlated : :class:`APyFloatArray` or :class:`APyFixedArray`
+        The correlated array.
+
+    """
+    try:
+        return a.correlate(v, mode=mode, stride=stride)
+    except (TypeError, AttributeError):
+        raise TypeError(f"Cannot correlate {type(a)} with {type(v)}")
+
+
 @overload
 def reshape(a: APyFixedArray, new_shape: tuple[int, ...]) -> APyFixedArray: ...
 @overload
@@ -2432,28 +2572,24 @@ def export_csv(
     if a.ndim > 3 or (a.ndim > 2 and layout != "vunit"):
         raise ValueError(f"Unsupported array dimension {a.ndim} for layout {layout}")
 
-    to_bits_fn = (
-        "_to_signed_bits"
-        if type(a) is APyFixedArray and layout == "vunit"
-        else "to_bits"
-    )
-
     if layout == "vunit":
         if a.ndim == 2:
             a = a.T
         elif a.ndim == 3:
             a = a.transpose((1, 0, 2))
 
-    with Path(fname).open(mode="w", newline="") as f:
-        writer = csv.writer(f, delimiter=delimiter)
-        if a.ndim == 1:
-            writer.writerow(getattr(a, to_bits_fn)())
-        elif a.ndim == 2:
-            for row in a:
-                writer.writerow(getattr(row, to_bits_fn)())
-        elif a.ndim == 3:
-            for depth in a:
-                writer.writerow(getattr(depth.flatten(), to_bits_fn)())
+    # Each depth of a 3-D array is written as a single row
+    if a.ndim == 3:
+        a = a.reshape((a.shape[0], a.shape[1] * a.shape[2]))
+
+    # The bit patterns are formatted in blocks by the native text engine, in parallel
+    # for large arrays. Lines are terminated as by `csv.writer`.
+    with Path(fname).open(mode="wb") as f:
+        if type(a) is APyFixedArray:
+            signed = layout == "vunit"
+            a._write_text(f, a.shape[-1], "dec", delimiter, "\r\n", signed)
+        else:
+            a._write_text(f, a.shape[-1], "dec", delimiter, "\r\n")
 
 
 @overload
@@ -2595,25 +2731,16 @@ def import_csv(
     if layout != "vunit" and vunit_3d_shape is not None:
         raise ValueError("vunit_3d_shape provided while not using 'vunit' layout")
 
-    with Path(fname).open(mode="r", newline="") as f:
-        reader = csv.reader(f, delimiter=delimiter)
-        bit_values = []
-        for row in reader:
-            bit_values_row = [int(bit_value) for bit_value in row]
-            bit_values.append(bit_values_row)
-
-    # Check if 1D or 2D array
-    if len(bit_values) == 1:
-        bit_values = bit_values[0]
-
-    if a_type is APyFixedArray or isinstance(a_type, APyFixedArray):
-        arr = APyFixedArray(
-            bit_values, bits=bits, int_bits=int_bits, frac_bits=frac_bits
-        )
-    else:
-        arr = APyFloatArray.from_bits(
-            bit_values, exp_bits=exp_bits, man_bits=man_bits, bias=bias
-        )
+    # A single row is imported as a 1-D array, multiple rows as a 2-D array
+    with Path(fname).open(mode="rb") as f:
+        if a_type is APyFixedArray or isinstance(a_type, APyFixedArray):
+            arr = APyFixedArray._read_text(
+                f, "dec", delimiter, int_bits=int_bits, frac_bits=frac_bits, bits=bits
+            )
+        else:
+            arr = APyFloatArray._read_text(
+                f, "dec", delimiter, exp_bits=exp_bits, man_bits=man_bits, bias=bias
+            )
 
     if layout == "vunit":
         if vunit_3d_shape is None:
@@ -2626,6 +2753,166 @@ def import_csv(
     return arr
 
 
+def export_mem(
+    a: APyArray, fname: str | Path, radix: Literal["hex", "bin"] = "hex"
+) -> None:
+    """
+    Store the bit values of an array to a memory file.
+
+    The bit values are written as hexadecimal or binary numbers, one value per line,
+    as read by the ``$readmemh`` and ``$readmemb`` system tasks of Verilog and
+    SystemVerilog simulators. Multi-dimensional arrays are written in row-major
+    order. Each value is zero-padded to the full number of bits of the format.
+
+    .. hint::
+        To export a complex-valued array, use separate memory files for real and
+        imaginary parts.
+
+    .. versionadded:: 0.6
+
+    Parameters
+    ----------
+    a : :class:`APyFixedArray` or :class:`APyFloatArray`
+        The array to store the bit values of.
+    fname : :class:`str` or :class:`pathlib.Path`
+        Path to the memory file to store bit values.
+    radix : {"hex", "bin"}, default: "hex"
+        Radix of the stored bit values. Use "hex" for ``$readmemh`` and "bin" for
+        ``$readmemb``.
+
+    See Also
+    --------
+    import_mem
+    export_csv
+
+    Examples
+    --------
+    >>> import apytypes as apy
+    >>> a = apy.fx([1.0, -0.5, 2.25], int_bits=4, frac_bits=2)
+    >>> apy.export_mem(a, "input.mem")
+    >>> apy.export_mem(a, "input_bin.mem", radix="bin")
+    """
+    if type(a) in (APyCFixedArray, APyCFloatArray):
+        raise ValueError("Complex data types are not supported yet")
+
+    if radix not in ("hex", "bin"):
+        raise ValueError(f"Unknown radix: {radix}")
+
+    with Path(fname).open(mode="wb") as f:
+        if type(a) is APyFixedArray:
+            a._write_text(f, 1, radix, None, "\n", False)
+        else:
+            a._write_text(f, 1, radix, None, "\n")
+
+
+@overload
+def import_mem(
+    fname: str | Path,
+    *,
+    radix: Literal["hex", "bin"] = "hex",
+    int_bits: int | None = None,
+    frac_bits: int | None = None,
+    bits: int | None = None,
+    exp_bits: int | None = None,
+    man_bits: int | None = None,
+    bias: int | None = None,
+) -> APyFixedArray: ...
+
+
+@overload
+def import_mem(
+    fname: str | Path,
+    *,
+    radix: Literal["hex", "bin"] = "hex",
+    int_bits: int | None = None,
+    frac_bits: int | None = None,
+    bits: int | None = None,
+    exp_bits: int | None = None,
+    man_bits: int | None = None,
+    bias: int | None = None,
+) -> APyFloatArray: ...
+
+
+def import_mem(
+    fname: str | Path,
+    *,
+    radix: Literal["hex", "bin"] = "hex",
+    int_bits: int | None = None,
+    frac_bits: int | None = None,
+    bits: int | None = None,
+    exp_bits: int | None = None,
+    man_bits: int | None = None,
+    bias: int | None = None,
+) -> APyArray:
+    """
+    Create a 1-D array from a memory file containing bit values.
+
+    The file holds hexadecimal or binary numbers separated by whitespace, as read by
+    the ``$readmemh`` and ``$readmemb`` system tasks of Verilog and SystemVerilog
+    simulators. Comments starting with ``//`` and underscores within numbers are
+    ignored. Bits outside of the format are discarded. Address specifications
+    (``@hh...``), unknown values (``x``), and high-impedance values (``z``) are not
+    supported.
+
+    .. versionadded:: 0.6
+
+    Parameters
+    ----------
+    fname : :class:`str` or :class:`pathlib.Path`
+        Path to the memory file containing bit values.
+    radix : {"hex", "bin"}, default: "hex"
+        Radix of the bit values. Use "hex" for ``$readmemh`` files and "bin" for
+        ``$readmemb`` files.
+    int_bits : :class:`int`, optional
+        Number of fixed-point integer bits.
+    frac_bits : :class:`int`, optional
+        Number of fixed-point fractional bits.
+    bits : :class:`int`, optional
+        Number of fixed-point bits.
+    exp_bits : :class:`int`, optional
+        Number of floating-point exponential bits.
+    man_bits : :class:`int`, optional
+        Number of floating-point mantissa bits.
+    bias : :class:`int`, optional
+        Exponent bias. If not provided, *bias* is ``2**(exp_bits - 1) - 1``.
+
+    Returns
+    -------
+    result : :class:`APyFloatArray` or :class:`APyFixedArray`
+        Array created from the bit values in the memory file.
+
+    See Also
+    --------
+    export_mem
+    import_csv
+
+    Examples
+    --------
+    >>> import apytypes as apy
+    >>> apy.import_mem("input.mem", int_bits=4, frac_bits=2)
+    APyFixedArray([ 4, 62,  9], int_bits=4, frac_bits=2)
+    >>> apy.import_mem("input_bin.mem", radix="bin", int_bits=4, frac_bits=2)
+    APyFixedArray([ 4, 62,  9], int_bits=4, frac_bits=2)
+    """
+    a_type = _determine_array_type(int_bits, frac_bits, bits, exp_bits, man_bits, bias)
+
+    if not a_type:
+        raise ValueError("Could not determine array type from bit-specifiers")
+
+    if radix not in ("hex", "bin"):
+        raise ValueError(f"Unknown radix: {radix}")
+
+    with Path(fname).open(mode="rb") as f:
+        if a_type is APyFixedArray:
+            return APyFixedArray._read_text(
+                f, radix, None, int_bits=int_bits, frac_bits=frac_bits, bits=bits
+            )
+        else:
+            return APyFloatArray._read_text(
+                f, radix, None, exp_bits=exp_bits, man_bits=man_bits, bias=bias
+            )
+
+
 def meshgrid(
     *arrays: APyArray,
     indexing: Literal["xy", "ij"] = "xy",
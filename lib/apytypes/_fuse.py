@@ -0,0 +1,273 @@
+from __future__ import annotations
+
+import itertools
+import math
+from typing import Any
+
+from apytypes._apytypes import (
+    APyCFixedArray,
+    APyCFloatArray,
+    APyFixedArray,
+    APyFloatArray,
+)
+from apytypes.typing import APyArray, APyScalar
+
+_ARRAY_TYPES = (APyFixedArray, APyCFixedArray, APyFloatArray, APyCFloatArray)
+
+
+class Expr:
+    """
+    Lazily evaluated expression of elementwise array arithmetic.
+
+    An :class:`Expr` records a directed acyclic graph of elementwise operations
+    (``+``, ``-``, ``*``, ``/``, unary ``-``, :func:`abs`, and :meth:`cast`) on
+    APyTypes arrays and scalars, without computing any intermediate array. Create
+    expressions using :func:`expr`, and compute them using :meth:`evaluate`.
+
+    .. versionadded:: 0.6
+    """
+
+    __slots__ = ("_args", "_kwargs", "_op")
+
+    def __init__(self, op: str, args: tuple[Any, ...], kwargs: dict[str, Any]):
+        self._op = op
+        self._args = args
+        self._kwargs = kwargs
+
+    @staticmethod
+    def _wrap(value: Any) -> Expr:
+        return value if isinstance(value, Expr) else Expr("leaf", (value,), {})
+
+    def _binary(self, op: str, other: Any, reflected: bool = False) -> Expr:
+        lhs, rhs = (Expr._wrap(other), self) if reflected else (self, Expr._wrap(other))
+        return Expr(op, (lhs, rhs), {})
+
+    def __add__(self, other: Any) -> Expr:
+        return self._binary("add", other)
+
+    def __radd__(self, other: Any) -> Expr:
+        return self._binary("add", other, reflected=True)
+
+    def __sub__(self, other: Any) -> Expr:
+        return self._binary("sub", other)
+
+    def __rsub__(self, other: Any) -> Expr:
+        return self._binary("sub", other, reflected=True)
+
+    def __mul__(self, other: Any) -> Expr:
+        return self._binary("mul", other)
+
+    def __rmul__(self, other: Any) -> Expr:
+        return self._binary("mul", other, reflected=True)
+
+    def __truediv__(self, other: Any) -> Expr:
+        return self._binary("truediv", other)
+
+    def __rtruediv__(self, other: Any) -> Expr:
+        return self._binary("truediv", other, reflected=True)
+
+    def __neg__(self) -> Expr:
+        return Expr("neg", (self,), {})
+
+    def __abs__(self) -> Expr:
+        return Expr("abs", (self,), {})
+
+    def cast(self, *args: Any, **kwargs: Any) -> Expr:
+        """
+        Record a cast of the expression. The arguments are the same as those of the
+        ``cast`` method of the resulting array type, e.g., :func:`APyFixedArray.cast`.
+        """
+        return Expr("cast", (self,), {"args": args, "kwargs": kwargs})
+
+    def evaluate(self, block_size: int = 4096) -> APyArray | APyScalar:
+        """
+        Evaluate the expression.
+
+        The expression is evaluated blockwise, one block of `block_size` elements at a
+        time, so that every intermediate result of a block stays in the cache and no
+        full-size intermediate array is created. The word lengths of all intermediate
+        results follow the rules of the corresponding array operations, so the result
+        is identical to evaluating the expression directly, except for stochastic
+        quantization modes where the random numbers are drawn in a different order.
+
+        Operands of different shapes are broadcast to a common shape. Each block only
+        reads the slices of the operands it needs, so broadcast operands are never
+        expanded to the common shape, and every block is written directly into the
+        result array.
+
+        Parameters
+        ----------
+        block_size : :class:`int`, default: 4096
+            Number of elements evaluated at a time.
+
+        Returns
+        -------
+        :class:`APyFixedArray`, :class:`APyCFixedArray`, :class:`APyFloatArray`, \
+        :class:`APyCFloatArray`, or a scalar if the expression has no array operands
+        """
+        if block_size < 1:
+            raise ValueError("Expr.evaluate: `block_size` must be positive")
+
+        leaves = self._leaves()
+        arrays = [leaf._args[0] for leaf in leaves if _is_array(leaf._args[0])]
+        if not arrays:
+            return self._evaluate({}, {})
+
+        shape = _broadcast_shapes([a.shape for a in arrays])
+        n_items = math.prod(shape)
+        if n_items <= block_size:
+            return self._evaluate({}, {})
+
+        # Blocks span whole trailing axes, a range of indices along the axis `axis`,
+        # and a single index along each leading axis
+        axis, inner = len(shape) - 1, 1
+        while inner * shape[axis] <= block_size:
+            inner *= shape[axis]
+            axis -= 1
+        step = block_size // inner
+
+        # Array operands with missing leading axes get axes of length one, so that
+        # operands are sliced, not broadcast, before evaluating each block
+        array_leaves = {}
+        for leaf in leaves:
+            value = leaf._args[0]
+            if _is_array(value):
+                if value.ndim < len(shape):
+                    new_axes = (1,) * (len(shape) - value.ndim)
+                    value = value.reshape(new_axes + value.shape)
+                array_leaves[id(leaf)] = value
+
+        result = None
+        for outer in itertools.product(*(range(n) for n in shape[:axis])):
+            for start in range(0, shape[axis], step):
+                key = (*outer, slice(start, min(start + step, shape[axis])))
+                block_leaves = {
+                    k: v[_broadcast_key(key, v.shape)] for k, v in array_leaves.items()
+                }
+                block = self._evaluate(block_leaves, {})
+                if result is None:
+                    result = _zeros_like(block, shape)
+                result[key] = block
+        return result
+
+    def _leaves(self) -> list[Expr]:
+        """Return the unique leaves of the expression graph."""
+        leaves, visited, stack = [], set(), [self]
+        while stack:
+            node = stack.pop()
+            if id(node) in visited:
+                continue
+            visited.add(id(node))
+            if node._op == "leaf":
+                leaves.append(node)
+            else:
+                stack.extend(node._args)
+        return leaves
+
+    def _evaluate(self, leaves: dict[int, Any], memo: dict[int, Any]) -> Any:
+        """
+        Evaluate the expression graph, substituting leaves found in `leaves`. Shared
+        sub-expressions are evaluated once, through `memo`.
+        """
+        key = id(self)
+        if key in memo:
+            return memo[key]
+
+        if self._op == "leaf":
+            value = leaves.get(key, self._args[0])
+        else:
+            args = [arg._evaluate(leaves, memo) for arg in self._args]
+            if self._op == "add":
+                value = args[0] + args[1]
+            elif self._op == "sub":
+                value = args[0] - args[1]
+            elif self._op == "mul":
+                value = args[0] * args[1]
+            elif self._op == "truediv":
+                value = args[0] / args[1]
+            elif self._op == "neg":
+                value = -args[0]
+            elif self._op == "abs":
+                value = abs(args[0])
+            else:  # self._op == "cast"
+                value = args[0].cast(*self._kwargs["args"], **self._kwargs["kwargs"])
+
+        memo[key] = value
+        return value
+
+    def __repr__(self) -> str:
+        if self._op == "leaf":
+            value = self._args[0]
+            if _is_array(value):
+                return f"{type(value).__name__}(shape={value.shape})"
+            return repr(value)
+        return f"{self._op}({', '.join(repr(arg) for arg in self._args)})"
+
+
+def _is_array(value: Any) -> bool:
+    return isinstance(value, _ARRAY_TYPES)
+
+
+def _broadcast_key(key: tuple[Any, ...], shape: tuple[int, ...]) -> tuple[Any, ...]:
+    """Adjust a block `key` of the broadcast shape to an operand of shape `shape`."""
+    return tuple(
+        k if dim != 1 else slice(0, 1) if isinstance(k, slice) else 0
+        for k, dim in zip(key, shape)
+    )
+
+
+def _zeros_like(block: APyArray, shape: tuple[int, ...]) -> APyArray:
+    """Create an array of shape `shape` with the same type and format as `block`."""
+    if isinstance(block, (APyFixedArray, APyCFixedArray)):
+        return type(block).zeros(shape, bits=block.bits, int_bits=block.int_bits)
+    return type(block).zeros(shape, block.exp_bits, block.man_bits, block.bias)
+
+
+def _broadcast_shapes(shapes: list[tuple[int, ...]]) -> tuple[int, ...]:
+    """Compute the common shape of `shapes` using NumPy broadcasting rules."""
+    ndim = max(len(shape) for shape in shapes)
+    result = [1] * ndim
+    for shape in shapes:
+        for i, dim in enumerate(shape, start=ndim - len(shape)):
+            if dim != 1:
+                if result[i] not in (1, dim):
+                    raise ValueError(
+                        "Operands could not be broadcast together with shapes: "
+                        + ", ".join(str(s) for s in shapes)
+                    )
+                result[i] = dim
+    return tuple(result)
+
+
+def expr(value: APyArray | APyScalar | int | float) -> Expr:
+    """
+    Start a lazily evaluated expression from an array or scalar.
+
+    Chained array arithmetic, such as ``(a * b + c).cast(...)``, creates a full-size
+    intermediate array for every operation. Wrapping an operand with :func:`expr`
+    instead records the operations, which are then evaluated in a single blockwise
+    pass using :meth:`Expr.evaluate`. The result is identical to that of the direct
+    evaluation, see :meth:`Expr.evaluate`.
+
+    .. versionadded:: 0.6
+
+    Parameters
+    ----------
+    value : :class:`APyFixedArray`, :class:`APyFloatArray`, :class:`APyFixed`, ...
+        The array or scalar to start the expression from.
+
+    Returns
+    -------
+    :class:`Expr`
+
+    Examples
+    --------
+    >>> import apytypes as apy
+    >>> a = apy.fx([1.0, 2.0, 3.0], int_bits=4, frac_bits=2)
+    >>> b = apy.fx([0.5, 0.25, -1.0], int_bits=4, frac_bits=2)
+    >>> c = apy.fx([2.0, 0.75, 4.5], int_bits=4, frac_bits=2)
+    >>> e = (apy.expr(a) * b + c).cast(int_bits=4, frac_bits=1)
+    >>> e.evaluate()
+    APyFixedArray([5, 2, 3], int_bits=4, frac_bits=1)
+    """
+    return Expr._wrap(value)
@@ -0,0 +1,167 @@
+from __future__ import annotations
+
+import json
+import pickle
+import struct
+from pathlib import Path
+from typing import Any
+
+from apytypes._apytypes import (
+    APyCFixedArray,
+    APyCFloatArray,
+    APyFixedArray,
+    APyFloatArray,
+)
+from apytypes.typing import APyArray
+
+# File layout:
+#   * Magic string `_MAGIC`
+#   * Major and minor format version, one byte each
+#   * Header length, little-endian 32-bit unsigned integer
+#   * Header, an ASCII JSON object with the array type, shape, and format, padded with
+#     spaces and terminated by a newline so that the payload is `_ALIGNMENT`-aligned
+#   * Payload, the raw data of the array. Each fixed-point value is stored as its
+#     limbs, sign-extended to a whole number of little-endian 64-bit words, so that
+#     the payload is the same for 32-bit and 64-bit limbs. Floating-point items are
+#     stored as 16-byte records of a little-endian 64-bit mantissa, 32-bit biased
+#     exponent, 8-bit sign, and three zero bytes. Complex items store the real part
+#     before the imaginary part.
+_MAGIC = b"\x93APYTYPES"
+_VERSION = (1, 0)
+_PREAMBLE = struct.Struct(f"<{len(_MAGIC)}sBBI")
+_ALIGNMENT = 64
+
+_ARRAY_TYPES = {
+    t.__name__: t
+    for t in (APyFixedArray, APyCFixedArray, APyFloatArray, APyCFloatArray)
+}
+
+
+def _spec_fields(array_type: type) -> tuple[str, ...]:
+    """Return the names of the format fields of `array_type`."""
+    if array_type in (APyFixedArray, APyCFixedArray):
+        return ("int_bits", "frac_bits")
+    return ("exp_bits", "man_bits", "bias")
+
+
+def save(fname: str | Path, a: APyArray) -> None:
+    """
+    Store an array to a file in the native APyTypes binary format.
+
+    The file holds a short header, with the array type, shape, and format, followed by
+    the raw data of the array. In contrast to :func:`export_csv` and pickling, no
+    per-element conversion is made, so storing and loading is limited by the file
+    system rather than by Python. Files are interchangeable between platforms.
+
+    .. versionadded:: 0.6
+
+    Parameters
+    ----------
+    fname : :class:`str` or :class:`pathlib.Path`
+        Path to the file to store the array in.
+    a : :class:`APyFixedArray`, :class:`APyCFixedArray`, :class:`APyFloatArray`, \
+    or :class:`APyCFloatArray`
+        The array to store.
+
+    See Also
+    --------
+    load
+
+    Examples
+    --------
+    >>> import apytypes as apy
+    >>> a = apy.fx([1.0, -0.5, 2.25], int_bits=4, frac_bits=2)
+    >>> apy.save("array.apy", a)
+    """
+    type_name = type(a).__name__
+    if type_name not in _ARRAY_TYPES:
+        raise TypeError(f"save: unsupported type {type_name}")
+
+    header: dict[str, Any] = {"type": type_name, "shape": list(a.shape)}
+    header.update((field, getattr(a, field)) for field in _spec_fields(type(a)))
+    header_bytes = json.dumps(header).encode("ascii")
+
+    # Pad the header so that the payload is aligned
+    unpadded = _PREAMBLE.size + len(header_bytes) + 1
+    header_bytes += b" " * (-unpadded % _ALIGNMENT) + b"\n"
+
+    with Path(fname).open(mode="wb") as f:
+        f.write(_PREAMBLE.pack(_MAGIC, *_VERSION, len(header_bytes)))
+        f.write(header_bytes)
+        a._write_raw(f)
+
+
+def load(fname: str | Path) -> APyArray:
+    """
+    Load an array from a file in the native APyTypes binary format.
+
+    .. versionadded:: 0.6
+
+    Parameters
+    ----------
+    fname : :class:`str` or :class:`pathlib.Path`
+        Path to a file created by :func:`save`.
+
+    Returns
+    -------
+    :class:`APyFixedArray`, :class:`APyCFixedArray`, :class:`APyFloatArray`, \
+    or :class:`APyCFloatArray`
+
+    See Also
+    --------
+    save
+
+    Examples
+    --------
+    >>> import apytypes as apy
+    >>> a = apy.fx([1.0, -0.5, 2.25], int_bits=4, frac_bits=2)
+    >>> apy.save("array.apy", a)
+    >>> apy.load("array.apy")
+    APyFixedArray([ 4, 62,  9], int_bits=4, frac_bits=2)
+    """
+    with Path(fname).open(mode="rb") as f:
+        preamble = f.read(_PREAMBLE.size)
+        if len(preamble) != _PREAMBLE.size or not preamble.startswith(_MAGIC):
+            raise ValueError(f"load: {fname} is not an APyTypes binary file")
+        _, major, minor, header_len = _PREAMBLE.unpack(preamble)
+        if major != _VERSION[0]:
+            raise ValueError(
+                f"load: unsupported file format version {major}.{minor} in {fname}"
+            )
+
+        header = json.loads(f.read(header_len).decode("ascii"))
+        array_type = _ARRAY_TYPES.get(header["type"])
+        if array_type is None:
+            raise ValueError(f"load: unsupported type {header['type']} in {fname}")
+        spec = {field: header[field] for field in _spec_fields(array_type)}
+
+        # The array is allocated without initialization and filled from the payload
+        prototype = array_type.zeros((0,), **spec)
+        return prototype._from_raw(tuple(header["shape"]), f.read())
+
+
+def _reduce_ex(a: APyArray, protocol: int) -> tuple[Any, ...]:
+    """
+    Reduce an array for pickling with protocol 5 or later.
+
+    The array data is passed as a :class:`pickle.PickleBuffer` of the payload of the
+    native binary format, so that it can be transferred out-of-band, e.g., by
+    :mod:`multiprocessing` or Dask, without being copied into the pickle stream.
+    """
+    type_name = type(a).__name__
+    spec = tuple(getattr(a, field) for field in _spec_fields(type(a)))
+    payload = pickle.PickleBuffer(a._raw_payload())
+    return (_reconstruct, (type_name, spec, a.shape, payload))
+
+
+def _reconstruct(
+    type_name: str, spec: tuple[int, ...], shape: tuple[int, ...], payload: Any
+) -> APyArray:
+    """Reconstruct an array pickled by :func:`_reduce_ex`."""
+    array_type = _ARRAY_TYPES[type_name]
+    spec_kwargs = dict(zip(_spec_fields(array_type), spec, strict=True))
+    with memoryview(payload) as view:
+        if not view.nbytes:
+            return array_type.zeros(shape, **spec_kwargs)
+        prototype = array_type.zeros((0,), **spec_kwargs)
+        return prototype._from_raw(shape, view)
@@ -2,7 +2,15 @@ import math
 
 import pytest
 
-from apytypes import APyCFixed, APyCFixedArray, APyFixed, APyFixedArray, fx
+from apytypes import (
+    APyCFixed,
+    APyCFixedArray,
+    APyFixed,
+    APyFixedArray,
+    OverflowMode,
+    QuantizationMode,
+    fx,
+)
 
 
 def test_prod():
@@ -760,3 +768,42 @@ def test_operation_with_floats():
     assert (_ := (-2.125) * a).is_identical(_ := b * a)
     assert (_ := a / (-2.125)).is_identical(_ := a / b)
     assert (_ := (-2.125) / a).is_identical(_ := b / a)
+
+
+def test_array_fma():
+    a = APyCFixedArray.from_complex(
+        [[x / 8 - 3 + 1j * (x / 4 - 5) for x in range(40)]] * 2, 5, 4
+    )
+    b = APyCFixedArray.from_complex([[x / 16 - 1j * x / 32 for x in range(40)]] * 2, 3, 6)
+    c = APyCFixedArray.from_complex([[1 - x / 4 + 2j for x in range(40)]] * 2, 7, 2)
+
+    modes = [
+        (QuantizationMode.TRN, OverflowMode.WRAP),
+        (QuantizationMode.RND_CONV, OverflowMode.SAT),
+        (QuantizationMode.RND_INF, OverflowMode.WRAP),
+        (QuantizationMode.JAM, OverflowMode.SAT),
+        (QuantizationMode.TRN_ZERO, OverflowMode.NUMERIC_STD),
+    ]
+    for q, o in modes:
+        for int_bits, frac_bits in [(4, 2), (12, 12), (40, 50)]:
+            ref = (a * b + c).cast(int_bits, frac_bits, quantization=q, overflow=o)
+            res = a.fma(b, c, int_bits, frac_bits, quantization=q, overflow=o)
+            assert res.is_identical(ref)
+
+    # Broadcasting
+    row = APyCFixedArray.from_complex([[0.5 * x - 1j for x in range(40)]], 6, 1)
+    ref = (a * row + c[0]).cast(int_bits=8, frac_bits=3)
+    assert a.fma(row, c[0], int_bits=8, frac_bits=3).is_identical(ref)
+
+    # Multi-limb accumulator, with the addend or the product shifted into place
+    w = APyCFixedArray.from_complex([1.5 + 1j, -2.25j, 3.0], int_bits=40, frac_bits=30)
+    for v in [
+        APyCFixedArray.from_complex([0.25j, 1, -3.5 - 2j], int_bits=5, frac_bits=2),
+        APyCFixedArray.from_complex([0.25j, 1, -3.5 - 2j], int_bits=3, frac_bits=70),
+    ]:
+        for q, o in modes:
+            ref = (w * w + v).cast(10, 5, quantization=q, overflow=o)
+            assert w.fma(w, v, 10, 5, quantization=q, overflow=o).is_identical(ref)
+
+    with pytest.raises(ValueError, match=r"APyCFixedArray\.fma: shape mismatch"):
+        _ = w.fma(a, c, int_bits=8, frac_bits=3)
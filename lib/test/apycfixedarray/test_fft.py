@@ -0,0 +1,238 @@
+import math
+import random
+
+import pytest
+
+from apytypes import (
+    APyCFixedArray,
+    APyFixedCastContext,
+    OverflowMode,
+    QuantizationMode,
+)
+
+
+def _twiddle(k: int, n: int, twiddle_bits: int, inverse: bool) -> tuple[int, int]:
+    """Reference twiddle factor, as integers with `twiddle_bits - 2` fractional bits."""
+    quadrant2 = 4 * k > n
+    if quadrant2:
+        k = n // 2 - k
+    octant2 = 8 * k > n
+    if octant2:
+        k = n // 4 - k
+    cos = math.cos(2 * math.pi * k / n)
+    sin = math.sin(2 * math.pi * k / n)
+    if octant2:
+        cos, sin = sin, cos
+    if quadrant2:
+        cos = -cos
+    if not inverse:
+        sin = -sin
+
+    def round_ties_away(v: float) -> int:
+        return int(math.copysign(math.floor(abs(v) * 2 ** (twiddle_bits - 2) + 0.5), v))
+
+    return round_ties_away(cos), round_ties_away(sin)
+
+
+def _quantize(v: int, shift: int, mode: QuantizationMode) -> int:
+    if shift <= 0:
+        return v << -shift
+    floor, rem = v >> shift, v & ((1 << shift) - 1)
+    half = 1 << (shift - 1)
+    if mode == QuantizationMode.TRN:
+        return floor
+    if mode == QuantizationMode.RND:
+        return floor + (rem >= half)
+    if mode == QuantizationMode.RND_CONV:
+        return floor + (rem > half or (rem == half and floor & 1))
+    raise NotImplementedError
+
+
+def _overflow(v: int, bits: int, mode: OverflowMode) -> int:
+    if mode == OverflowMode.SAT:
+        return max(-(1 << (bits - 1)), min((1 << (bits - 1)) - 1, v))
+    v &= (1 << bits) - 1
+    return v - (1 << bits) if v >> (bits - 1) else v
+
+
+def _reference_fft(x, frac_bits, twiddle_bits, stages, inverse):
+    """Reference radix-2 decimation-in-time FFT on integer (real, imag) pairs."""
+    n = len(x)
+    n_stages = n.bit_length() - 1
+    rev = [int(f"{i:0{n_stages}b}"[::-1], 2) if n_stages else 0 for i in range(n)]
+    a = [x[rev[i]] for i in range(n)]
+    tw_frac_bits = twiddle_bits - 2
+    for s, (bits, int_bits, q, v) in enumerate(stages):
+        half = 1 << s
+        shift = frac_bits + tw_frac_bits - (bits - int_bits)
+
+        def cast(re, im, q=q, v=v, bits=bits, shift=shift):
+            return tuple(_overflow(_quantize(t, shift, q), bits, v) for t in (re, im))
+
+        res = [None] * n
+        for j in range(0, n, 2 * half):
+            for k in range(half):
+                wr, wi = _twiddle(k * n // (2 * half), n, twiddle_bits, inverse)
+                (ar, ai), (br, bi) = a[j + k], a[j + k + half]
+                pr, pi = wr * br - wi * bi, wr * bi + wi * br
+                ar, ai = ar << tw_frac_bits, ai << tw_frac_bits
+                res[j + k] = cast(ar + pr, ai + pi)
+                res[j + k + half] = cast(ar - pr, ai - pi)
+        a = res
+        frac_bits = bits - int_bits
+    return a
+
+
+def test_fft_small():
+    x = APyCFixedArray.from_complex([1, 1j, -1, -1j], int_bits=2, frac_bits=2)
+    assert x.fft().is_identical(
+        APyCFixedArray.from_complex([0, 4, 0, 0], int_bits=5, frac_bits=2)
+    )
+    assert x.fft().ifft().is_identical(
+        APyCFixedArray.from_complex([1, 1j, -1, -1j], int_bits=6, frac_bits=4)
+    )
+
+    # Length one transforms are the identity
+    y = APyCFixedArray.from_complex([1 - 2j], int_bits=3, frac_bits=1)
+    assert y.fft().is_identical(y)
+    assert y.ifft().is_identical(y)
+
+
+@pytest.mark.parametrize("n", [1, 2, 4, 8, 32, 128])
+@pytest.mark.parametrize("int_bits", [4, 40])
+def test_fft_numpy(n: int, int_bits: int):
+    np = pytest.importorskip("numpy")
+    rng = np.random.default_rng(n)
+    x = rng.uniform(-1, 1, n) + 1j * rng.uniform(-1, 1, n)
+    a = APyCFixedArray.from_complex(x, int_bits=int_bits, frac_bits=50)
+
+    # With wide stages and twiddle factors, the quantization error is small
+    res = a.fft(twiddle_bits=60)
+    assert res.int_bits == int_bits + max(n.bit_length() - 1, 0) + (n > 1)
+    assert np.allclose(res.to_numpy(), np.fft.fft(a.to_numpy()), atol=1e-12)
+
+    res = a.ifft(twiddle_bits=60)
+    assert np.allclose(res.to_numpy(), np.fft.ifft(a.to_numpy()), atol=1e-12)
+
+    # The round trip recovers the input
+    assert np.allclose(a.fft().ifft().to_numpy(), x, atol=1e-12)
+
+
+@pytest.mark.parametrize("seed", range(8))
+def test_fft_bit_true(seed: int):
+    rng = random.Random(seed)
+    n = 1 << rng.randint(1, 5)
+    n_stages = n.bit_length() - 1
+    bits = rng.choice([6, 20, 64, 100])
+    int_bits = rng.randint(1, bits)
+    twiddle_bits = rng.choice([2, 5, 16, 70])
+    inverse = bool(seed % 2)
+    q_modes = [QuantizationMode.TRN, QuantizationMode.RND, QuantizationMode.RND_CONV]
+    v_modes = [OverflowMode.WRAP, OverflowMode.SAT]
+    stages = []
+    for _ in range(n_stages):
+        stage_bits = rng.choice([5, 12, 64, 90])
+        stage_int_bits = rng.randint(0, stage_bits)
+        stages.append(
+            (stage_bits, stage_int_bits, rng.choice(q_modes), rng.choice(v_modes))
+        )
+
+    x = [
+        tuple(rng.randint(-(1 << (bits - 1)), (1 << (bits - 1)) - 1) for _ in range(2))
+        for _ in range(n)
+    ]
+    mask = (1 << bits) - 1
+    a = APyCFixedArray(
+        [(re & mask, im & mask) for re, im in x], bits=bits, int_bits=int_bits
+    )
+
+    params = {
+        "int_bits": [s[1] for s in stages],
+        "frac_bits": [s[0] - s[1] for s in stages],
+        "quantization": [s[2] for s in stages],
+        "overflow": [s[3] for s in stages],
+        "twiddle_bits": twiddle_bits,
+    }
+    res = a.ifft(**params) if inverse else a.fft(**params)
+
+    ref = _reference_fft(x, bits - int_bits, twiddle_bits, stages, inverse)
+    res_bits, res_int_bits = stages[-1][0], stages[-1][1] - inverse * n_stages
+    mask = (1 << res_bits) - 1
+    assert res.is_identical(
+        APyCFixedArray(
+            [(re & mask, im & mask) for re, im in ref],
+            bits=res_bits,
+            int_bits=res_int_bits,
+        )
+    )
+
+
+def test_fft_stage_parameters():
+    a = APyCFixedArray.from_complex(
+        [1, 2 - 1j, 0.5j, -3, 1 + 1j, 0, -0.25, 2j], int_bits=3, frac_bits=2
+    )
+
+    # A single value applies to all stages
+    res = a.fft(int_bits=8, frac_bits=3, quantization=QuantizationMode.RND_CONV)
+    assert (res.int_bits, res.frac_bits) == (8, 3)
+
+    # Per-stage values, the result is in the format of the last stage
+    res = a.fft(int_bits=[4, 5, 6], frac_bits=[2, 3, 4])
+    assert (res.int_bits, res.frac_bits) == (6, 4)
+    res = a.ifft(int_bits=[4, 5, 6], frac_bits=[2, 3, 4])
+    assert (res.int_bits, res.frac_bits) == (3, 7)
+
+    # Quantization and overflow default to the fixed-point cast context
+    with APyFixedCastContext(QuantizationMode.TRN, OverflowMode.WRAP):
+        trn = a.fft(frac_bits=0, twiddle_bits=10)
+    assert trn.is_identical(
+        a.fft(frac_bits=0, twiddle_bits=10, quantization=QuantizationMode.TRN)
+    )
+
+    # Saturation instead of wrapping
+    b = APyCFixedArray.from_complex([1, 1, 1, 1], int_bits=2, frac_bits=0)
+    assert b.fft(int_bits=2, overflow=OverflowMode.SAT).is_identical(
+        APyCFixedArray.from_complex([1, 0, 0, 0], int_bits=2, frac_bits=0)
+    )
+    assert b.fft(int_bits=2, overflow=OverflowMode.WRAP).is_identical(
+        APyCFixedArray.from_complex([0, 0, 0, 0], int_bits=2, frac_bits=0)
+    )
+
+
+def test_fft_axis():
+    np = pytest.importorskip("numpy")
+    rng = np.random.default_rng(0)
+    x = rng.uniform(-1, 1, (4, 8, 2)) + 1j * rng.uniform(-1, 1, (4, 8, 2))
+    a = APyCFixedArray.from_complex(x, int_bits=2, frac_bits=40)
+
+    for axis in (0, 1, -2, -3):
+        res = a.fft(axis=axis, twiddle_bits=50)
+        assert res.shape == a.shape
+        ref = np.fft.fft(a.to_numpy(), axis=axis)
+        assert np.allclose(res.to_numpy(), ref, atol=1e-9)
+
+    # Each frame is transformed independently
+    frame = a[:, 3, 1].fft(twiddle_bits=50)
+    assert a.fft(axis=0, twiddle_bits=50)[:, 3, 1].is_identical(frame)
+
+
+def test_fft_raises():
+    a = APyCFixedArray.from_complex([1, 2, 3], int_bits=4, frac_bits=0)
+    with pytest.raises(ValueError, match=r"APyCFixedArray.fft: transform length must"):
+        _ = a.fft()
+    with pytest.raises(ValueError, match=r"APyCFixedArray.ifft: transform length must"):
+        _ = a.ifft()
+
+    b = APyCFixedArray.from_complex([[1, 2], [3, 4]], int_bits=4, frac_bits=0)
+    with pytest.raises(IndexError, match=r"APyCFixedArray.fft: axis 2 out of range"):
+        _ = b.fft(axis=2)
+    with pytest.raises(IndexError, match=r"APyCFixedArray.fft: axis -3 out of range"):
+        _ = b.fft(axis=-3)
+
+    c = APyCFixedArray.from_complex([1, 2, 3, 4], int_bits=4, frac_bits=0)
+    with pytest.raises(ValueError, match=r"`int_bits` has 3 values, but the transform"):
+        _ = c.fft(int_bits=[5, 6, 7])
+    with pytest.raises(ValueError, match=r"`twiddle_bits` must be at least 2"):
+        _ = c.fft(twiddle_bits=1)
+    with pytest.raises(ValueError, match=r"stage 1 has a non-positive number of bits"):
+        _ = c.fft(int_bits=[5, 0], frac_bits=0)
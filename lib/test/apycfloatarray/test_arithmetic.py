@@ -1,6 +1,12 @@
 import pytest
 
-from apytypes import APyCFloat, APyCFloatArray, APyFloat, APyFloatArray
+from apytypes import (
+    APyCFloat,
+    APyCFloatArray,
+    APyFloat,
+    APyFloatArray,
+    QuantizationMode,
+)
 
 
 def test_arithmetic_with_apyfloat():
@@ -113,3 +119,78 @@ def test_arrays_dont_crash_on_zero_div():
     b = APyFloat.from_float(0.0, exp_bits=10, man_bits=7)
     _ = a / b
     _ = b / a
+
+
+def test_array_fma():
+    import random
+
+    rng = random.Random(0x5EED)
+
+    def values(scale):
+        return [
+            complex(rng.uniform(-scale, scale), rng.uniform(-scale, scale))
+            for _ in range(1000)
+        ]
+
+    a = APyCFloatArray.from_complex(values(20), 4, 3)
+    b = APyCFloatArray.from_complex(values(2), 4, 3)
+    c = APyCFloatArray.from_complex(values(100), 5, 2)
+
+    # Products and sums of these formats are exact in double precision. Exactly zero
+    # sums are negative when rounding towards negative infinity.
+    exact = [complex(x) * complex(y) + complex(z) for x, y, z in zip(a, b, c)]
+    for q in [
+        QuantizationMode.TIES_EVEN,
+        QuantizationMode.TIES_AWAY,
+        QuantizationMode.TO_ZERO,
+        QuantizationMode.TO_POS,
+        QuantizationMode.TO_NEG,
+        QuantizationMode.JAM,
+    ]:
+        zero = -0.0 if q == QuantizationMode.TO_NEG else 0.0
+        ref = [complex(v.real or zero, v.imag or zero) for v in exact]
+        ref = APyCFloatArray.from_complex(ref, 11, 52)
+        for exp_bits, man_bits in [(4, 3), (5, 2), (8, 7), (3, 1)]:
+            res = a.fma(b, c, exp_bits, man_bits, quantization=q)
+            assert res.is_identical(ref.cast(exp_bits, man_bits, quantization=q))
+
+    with pytest.raises(ValueError, match=r"APyCFloatArray\.fma: shape mismatch"):
+        _ = a.fma(b[:3], c)
+
+
+def test_array_fma_wide():
+    import random
+    from fractions import Fraction
+
+    # Rounding the products first, 1 - 2**-104 to 1, makes the real part zero
+    x = APyCFloatArray.from_complex([1 + 2**-52 + 1j], 11, 52)
+    y = APyCFloatArray.from_complex([1 - 2**-52], 11, 52)
+    z = APyCFloatArray.from_complex([-1.0], 11, 52)
+    res = x.fma(y, z)
+    ref = APyCFloatArray.from_complex([complex(-(2**-104), 1 - 2**-52)], 11, 52)
+    assert res.is_identical(ref)
+    assert (x * y + z)[0].real.is_zero
+
+    # Doubles are rounded to nearest, ties to even, from the exact value
+    rng = random.Random(0xF3A)
+
+    def draw(scale):
+        return [
+            complex(rng.uniform(-4, 4), rng.uniform(-4, 4)) * scale()
+            for _ in range(300)
+        ]
+
+    values = [draw(lambda: 2 ** rng.randint(-40, 40)), draw(lambda: 1), draw(lambda: 1)]
+    a, b, c = (APyCFloatArray.from_complex(v, 11, 52) for v in values)
+
+    def exact(x, y, z):
+        xr, xi = Fraction(x.real), Fraction(x.imag)
+        yr, yi = Fraction(y.real), Fraction(y.imag)
+        zr, zi = Fraction(z.real), Fraction(z.imag)
+        return complex(float(xr * yr - xi * yi + zr), float(xr * yi + xi * yr + zi))
+
+    ref = APyCFloatArray.from_complex([exact(*v) for v in zip(*values)], 11, 52)
+    assert a.fma(b, c, quantization=QuantizationMode.TIES_EVEN).is_identical(ref)
+
+    with pytest.raises(ValueError, match=r"at most 59 mantissa bits are supported"):
+        _ = x.fma(y, z, man_bits=60)
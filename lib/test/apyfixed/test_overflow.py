@@ -20,6 +20,12 @@ def test_overflow_twos_complement(fixed_type, im):
         == 3.0 * im
     )
 
+    # Multi-limb source, single-limb result
+    assert (
+        fixed_type.from_float(300 * im, 200, 0).cast(6, 0, overflow=OverflowMode.WRAP)
+        == -20.0 * im
+    )
+
 
 @pytest.mark.parametrize(
     ("fixed_type", "im"), [(APyFixed, 1), (APyCFixed, 1), (APyCFixed, 1j)]
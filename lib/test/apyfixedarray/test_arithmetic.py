@@ -7,6 +7,7 @@ from apytypes import (
     APyCFixedArray,
     APyFixed,
     APyFixedArray,
+    OverflowMode,
     QuantizationMode,
     fx,
 )
@@ -879,6 +880,76 @@ def test_huge_extending_cast(fixed_array: type[APyCFixedArray], mode: Quantizati
     )
 
 
+@pytest.mark.parametrize(
+    "mode",
+    [
+        QuantizationMode.TRN,
+        QuantizationMode.RND,
+        QuantizationMode.RND_CONV,
+        QuantizationMode.JAM,
+        QuantizationMode.RND_INF,
+    ],
+)
+@pytest.mark.parametrize("overflow", [OverflowMode.WRAP, OverflowMode.SAT])
+@pytest.mark.parametrize(
+    "int_bits, frac_bits",
+    [(3, 2), (2, 5), (5, 0), (-3, 9), (10, -4), (60, 4), (4, 60), (33, 31)],
+)
+def test_array_cast_matches_scalar_cast(
+    mode: QuantizationMode, overflow: OverflowMode, int_bits: int, frac_bits: int
+):
+    # Long enough to exercise both the SIMD body and the scalar tail of the kernels
+    a = APyFixedArray(range(0, 1 << 10, 7), int_bits=5, frac_bits=5)
+    b = a.cast(int_bits, frac_bits, mode, overflow)
+    for i in range(len(a)):
+        ref = a[i].cast(int_bits, frac_bits, mode, overflow)
+        assert b[i].is_identical(ref)
+
+    a = APyFixedArray(range(0, 1 << 64, 0x123456789ABCDEF), int_bits=40, frac_bits=24)
+    b = a.cast(int_bits, frac_bits, mode, overflow)
+    for i in range(len(a)):
+        ref = a[i].cast(int_bits, frac_bits, mode, overflow)
+        assert b[i].is_identical(ref)
+
+
+@pytest.mark.parametrize("fixed_array", [APyFixedArray, APyCFixedArray])
+@pytest.mark.parametrize("n", [1, 2, 3, 5, 40_000])
+def test_multi_limb_to_single_limb_cast(fixed_array: type[APyCFixedArray], n: int):
+    # Four source limbs to one destination limb, also split over the threadpool
+    values = [(i * 7) % 64 - 32 for i in range(n)]
+    a = fixed_array.from_float(values, int_bits=200, frac_bits=0)
+    b = a.cast(6, 0, overflow=OverflowMode.WRAP)
+    assert b.is_identical(fixed_array.from_float(values, int_bits=6, frac_bits=0))
+
+    values = [(i * 7) % 200 - 100 for i in range(n)]
+    a = fixed_array.from_float(values, int_bits=200, frac_bits=0)
+    b = a.cast(6, 0, overflow=OverflowMode.SAT)
+    ref = [max(-32, min(31, v)) for v in values]
+    assert b.is_identical(fixed_array.from_float(ref, int_bits=6, frac_bits=0))
+
+
+@pytest.mark.parametrize("fixed_array", [APyFixedArray, APyCFixedArray])
+@pytest.mark.parametrize("frac_bits", [0, 60, 150])
+def test_long_array_threadpool(fixed_array: type[APyCFixedArray], frac_bits: int):
+    # Long enough for the elementwise operations to be split over the threadpool
+    np = pytest.importorskip("numpy")
+    n = 300_000
+    x = np.arange(n) - n // 2
+    y = np.arange(n)[::-1] % 1000 + 1
+    a = fixed_array.from_float(x, int_bits=20, frac_bits=frac_bits)
+    b = fixed_array.from_float(y, int_bits=12, frac_bits=frac_bits)
+    assert np.all((a + b).to_numpy() == x + y)
+    assert np.all((a - b).to_numpy() == x - y)
+    assert np.all((a * b).to_numpy() == x * y)
+    assert np.all(a.cast(int_bits=25, frac_bits=1).to_numpy() == x)
+    assert np.all(
+        a.cast(int_bits=12, frac_bits=0, overflow=OverflowMode.SAT).to_numpy()
+        == np.clip(x, -(1 << 11), (1 << 11) - 1)
+    )
+    if fixed_array is APyFixedArray:
+        assert np.all(abs(a).to_numpy() == np.abs(x))
+
+
 @pytest.mark.parametrize("fixed_array", [APyFixedArray, APyCFixedArray])
 def test_long_matrix_addition(fixed_array: type[APyCFixedArray]):
     np = pytest.importorskip("numpy")
@@ -1526,3 +1597,35 @@ def test_real_array_complex_scalar(real_int_bits: int, real_frac_bits: int):
             frac_bits=real_int_bits + real_frac_bits,
         )
     )
+
+
+def test_array_fma():
+    a = APyFixedArray.from_float([[x / 8 - 3 for x in range(40)]] * 2, 5, 4)
+    b = APyFixedArray.from_float([[x / 16 for x in range(40)]] * 2, 3, 6)
+    c = APyFixedArray.from_float([[1 - x / 4 for x in range(40)]] * 2, 7, 2)
+
+    modes = [
+        (QuantizationMode.TRN, OverflowMode.WRAP),
+        (QuantizationMode.RND_CONV, OverflowMode.SAT),
+        (QuantizationMode.RND_INF, OverflowMode.WRAP),
+        (QuantizationMode.JAM, OverflowMode.SAT),
+        (QuantizationMode.TRN_ZERO, OverflowMode.NUMERIC_STD),
+    ]
+    for q, o in modes:
+        for int_bits, frac_bits in [(4, 2), (12, 12), (40, 50)]:
+            ref = (a * b + c).cast(int_bits, frac_bits, quantization=q, overflow=o)
+            res = a.fma(b, c, int_bits, frac_bits, quantization=q, overflow=o)
+            assert res.is_identical(ref)
+
+    # Broadcasting
+    row = APyFixedArray.from_float([[0.5 * x for x in range(40)]], 6, 1)
+    ref = (a * row + c[0]).cast(int_bits=8, frac_bits=3)
+    assert a.fma(row, c[0], int_bits=8, frac_bits=3).is_identical(ref)
+
+    # Multi-limb accumulator
+    w = APyFixedArray.from_float([1.5, -2.25, 3.0], int_bits=40, frac_bits=30)
+    ref = (w * w + w).cast(int_bits=10, frac_bits=5)
+    assert w.fma(w, w, int_bits=10, frac_bits=5).is_identical(ref)
+
+    with pytest.raises(ValueError, match=r"APyFixedArray\.fma: shape mismatch"):
+        _ = w.fma(a, c, int_bits=8, frac_bits=3)
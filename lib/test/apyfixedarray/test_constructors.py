@@ -430,3 +430,47 @@ def test_issue_818_mre2(fixed_array: type[APyCFixedArray], int_bits: int, np_dt:
     err_msg = r"APyC?FixedArray\.from_array: zero-dimensional arrays not supported"
     with pytest.raises(ValueError, match=err_msg):
         _ = fixed_array.from_array(np.array(-1, dtype=np_dt), int_bits, frac_bits=0)
+
+
+@pytest.mark.parametrize("dt", ["float64", "float32"])
+@pytest.mark.parametrize("bits", [(10, 4), (64, 20), (20, -6), (100, 40)])
+def test_large_numpy_float_creation(dt: str, bits: tuple[int, int]):
+    # Large enough to be converted using SIMD on several threads
+    np = pytest.importorskip("numpy")
+    rng = np.random.default_rng(4711)
+    anp = rng.normal(scale=1000.0, size=(5, 2000)).astype(dt)
+    anp[0, :8] = [0.5, -0.5, 1.5, -2.5, 1e30, -1e30, 1e-30, 0.0]
+    a = APyFixedArray.from_float(anp, *bits)
+    assert a.is_identical(APyFixedArray.from_float(anp.tolist(), *bits))
+
+    anp[3, 1234] = float("nan")
+    with pytest.raises(ValueError, match="Cannot convert nan to fixed-point"):
+        APyFixedArray.from_float(anp, *bits)
+
+
+@pytest.mark.parametrize("dt", ["int64", "int32", "int8", "uint64", "uint16"])
+@pytest.mark.parametrize("bits", [(10, 4), (64, 70), (30, 40), (100, 40)])
+def test_large_numpy_integer_creation(dt: str, bits: tuple[int, int]):
+    np = pytest.importorskip("numpy")
+    info = np.iinfo(dt)
+    rng = np.random.default_rng(4711)
+    anp = rng.integers(info.min, info.max, size=(5, 2000), dtype=dt, endpoint=True)
+    a = APyFixedArray.from_array(anp, *bits)
+    assert a.is_identical(APyFixedArray.from_float(anp.tolist(), *bits))
+
+
+@pytest.mark.parametrize("bits", [(10, 4), (100, 40)])
+def test_strided_numpy_creation(bits: tuple[int, int]):
+    # Sliced, transposed, Fortran-ordered, and reversed arrays are read in place
+    np = pytest.importorskip("numpy")
+    x = np.arange(-3000, 3000, dtype=np.int64).reshape(20, 300)
+    for a in (x[:, ::2], x.T, np.asfortranarray(x), x[::-3, 7:], x[3:4, ::-1]):
+        ref = APyFixedArray.from_float(a.tolist(), *bits)
+        assert APyFixedArray.from_array(a, *bits).is_identical(ref)
+        assert APyFixedArray.from_float(a / 4, *bits).is_identical(
+            APyFixedArray.from_float((a / 4).tolist(), *bits)
+        )
+        assert APyFixedArray.from_float(a.astype(np.int16), *bits).is_identical(ref)
+        assert APyFixedArray(a, *bits).is_identical(APyFixedArray(a.tolist(), *bits))
+        c = APyFixedArray.from_float(np.zeros(a.shape), *bits)
+        assert (c + a).is_identical(c + ref)
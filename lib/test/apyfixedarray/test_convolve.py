@@ -1,3 +1,5 @@
+import random
+
 import pytest
 
 from apytypes import (
@@ -174,3 +176,56 @@ def test_convolve_accumulator_mode(fx_array: type[APyCFixedArray]):
             assert convolve(a, b).is_identical(
                 fx_array.from_float(result, int_bits=int_bits, frac_bits=frac_bits)
             )
+
+
+@pytest.mark.parametrize("fx_array", [APyFixedArray, APyCFixedArray])
+@pytest.mark.parametrize("mode", ["full", "same", "valid"])
+def test_long_convolve_threadpool(fx_array: type[APyCFixedArray], mode: str):
+    # Long enough for the outputs to be split over the threadpool
+    np = pytest.importorskip("numpy")
+    x = np.arange(20_000) % 23 - 11
+    h = np.arange(33) % 7 - 3
+    a = fx_array.from_float(x, int_bits=70, frac_bits=0)
+    b = fx_array.from_float(h, int_bits=4, frac_bits=0)
+    ref = np.convolve(x, h, mode=mode)
+    assert np.all(convolve(a, b, mode=mode).to_numpy() == ref)
+    assert np.all(convolve(b, a, mode=mode).to_numpy() == ref)
+
+    # Each output only depends on its own window
+    res = convolve(a, b)
+    assert res[1000:1100].is_identical(convolve(a[1000 - 32 : 1100], b, "valid"))
+
+
+@pytest.mark.parametrize("fx_array", [APyFixedArray, APyCFixedArray])
+@pytest.mark.parametrize("int_bits", [10, 60])
+@pytest.mark.parametrize("mode", ["full", "same", "valid"])
+def test_blocked_convolve(fx_array: type[APyCFixedArray], int_bits: int, mode: str):
+    # Outputs overlapping all of the shorter array are evaluated several at a time, for
+    # results of one (`int_bits=10`) and two (`int_bits=60`) limbs
+    rng = random.Random(int_bits)
+    is_complex = fx_array is APyCFixedArray
+
+    def draw(n, bound):
+        def value():
+            return rng.randint(-bound, bound)
+
+        return [complex(value(), value()) if is_complex else value() for _ in range(n)]
+
+    x = draw(53, 2 ** min(int_bits - 2, 45))
+    h = draw(11, 7)
+    full = [0] * (len(x) + len(h) - 1)
+    for i, x_i in enumerate(x):
+        for j, h_j in enumerate(h):
+            full[i + j] += x_i * h_j
+    n_left = {"full": len(h) - 1, "same": len(h) // 2, "valid": 0}[mode]
+    length = {"full": len(full), "same": len(x), "valid": len(x) - len(h) + 1}[mode]
+
+    a = fx_array.from_float(x, int_bits=int_bits, frac_bits=0)
+    b = fx_array.from_float(h, int_bits=4, frac_bits=0)
+    ref = fx_array.from_float(
+        full[len(h) - 1 - n_left :][:length],
+        int_bits=int_bits + 4 + 4 + is_complex,
+        frac_bits=0,
+    )
+    assert convolve(a, b, mode=mode).is_identical(ref)
+    assert convolve(b, a, mode=mode).is_identical(ref)
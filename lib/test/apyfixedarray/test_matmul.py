@@ -540,6 +540,22 @@ def test_matrix_multiplication_threadpool(bits: int):
     assert np.all((array_np @ array_np) == (array_fx @ array_fx).to_numpy())
 
 
+@pytest.mark.parametrize("bits", [19, 30, 64])
+def test_matrix_multiplication_tiled(bits: int):
+    # Matrix-matrix products of single-limb elements use a cache-blocked
+    # implementation. Matrix-vector products do not. The two must be bit-identical.
+    np = pytest.importorskip("numpy")
+    rng = np.random.default_rng(seed=bits)
+    A_np = rng.integers(-(2 ** (bits - 1)), 2 ** (bits - 1), (37, 300), dtype="int64")
+    B_np = rng.integers(-(2 ** (bits - 1)), 2 ** (bits - 1), (300, 133), dtype="int64")
+    A = APyFixedArray(A_np, bits=bits, int_bits=bits // 2)
+    B = APyFixedArray(B_np, bits=bits, int_bits=bits // 3)
+    C = A @ B
+    assert C.shape == (37, 133)
+    for col in range(B.shape[1]):
+        assert C[:, col].is_identical(A @ B[:, col])
+
+
 @pytest.mark.parametrize("int_bits", [20, 40, 200, 2000])
 @pytest.mark.parametrize("frac_bits", [10, 40, 100, 2500])
 @pytest.mark.parametrize("force_complex", [False, True])
@@ -769,6 +769,46 @@ def test_iterator():
     assert next(iterator).is_identical(APyFixed(2, bits=10, int_bits=10))
 
 
+@pytest.mark.parametrize("dt", ["float16", "float32", "float64"])
+@pytest.mark.parametrize("int_bits", [10, 60])
+def test_to_numpy_float_dtypes(dt: str, int_bits: int):
+    # Skip this test if `NumPy` is not present on the machine
+    np = pytest.importorskip("numpy")
+
+    # Large enough to be converted in parallel. All values are exact in double
+    # precision, so NumPy rounds them once to the narrower data types.
+    values = np.arange(-50_000, 50_000) * 2.0**-10
+    fx_arr = APyFixedArray.from_float(values, int_bits=int_bits, frac_bits=10)
+    res = fx_arr.to_numpy(dtype=dt)
+    assert res.dtype == np.dtype(dt)
+    assert np.array_equal(res, values.astype(dt))
+    assert np.array_equal(np.asarray(fx_arr, dtype=dt), values.astype(dt))
+
+    cfx_arr = APyCFixedArray.from_float(values, int_bits=int_bits, frac_bits=10)
+    complex_dt = "complex128" if dt == "float64" else "complex64"
+    res = cfx_arr.to_numpy(dtype=dt)
+    assert res.dtype == np.dtype(complex_dt)
+    assert np.array_equal(res, values.astype(complex_dt))
+
+
+def test_to_numpy_float_dtypes_single_rounding():
+    # Skip this test if `NumPy` is not present on the machine
+    np = pytest.importorskip("numpy")
+
+    # 1 + 2**-24 + 2**-80 rounds to 1 + 2**-23 in single precision, while rounding
+    # through double precision, to 1 + 2**-24, would give 1
+    a = APyFixedArray([(1 << 80) + (1 << 56) + 1], int_bits=2, frac_bits=80)
+    assert a.to_numpy()[0] == 1 + 2**-24
+    assert a.to_numpy(dtype="float32")[0] == np.float32(1 + 2**-23)
+    assert a.to_numpy(dtype="float16")[0] == np.float16(1)
+
+    # Out of range values
+    a = APyFixedArray.from_float([1 << 20, -(1 << 20), 1], int_bits=30, frac_bits=0)
+    assert np.array_equal(
+        a.to_numpy(dtype="float16"), np.array([np.inf, -np.inf, 1], dtype="float16")
+    )
+
+
 @pytest.mark.parametrize("fixed_array", [APyFixedArray, APyCFixedArray])
 def test_len(fixed_array: type[APyCFixedArray]):
     fx_array = fixed_array([1, 2, 3, 4, 5, 6], bits=10, int_bits=10)
@@ -1171,10 +1211,29 @@ def test_to_bits_numpy():
     np = pytest.importorskip("numpy")
 
     #
-    # Numpy currently does not support long fixed-point conversions
+    # Long fixed-point words are split into 64-bit words along an extra dimension
     #
-    with pytest.raises(ValueError, match=r"APyFixedArray::to_bits_ndarray"):
-        APyFixedArray([0], int_bits=100, frac_bits=1000).to_bits(True)
+    a = APyFixedArray([0], int_bits=100, frac_bits=1000)
+    assert a.to_bits(True).shape == (1, 18)
+    assert a.to_bits(True).dtype == np.dtype("uint64")
+
+    for int_bits, frac_bits in [(60, 40), (100, 28), (200, 56)]:
+        bits = int_bits + frac_bits
+        n_words = (bits + 63) // 64
+        values = [0, 1, 2**bits - 1, 2 ** (bits - 1), 3**70 % 2**bits, 12345]
+        a = APyFixedArray(values, int_bits=int_bits, frac_bits=frac_bits)
+        a = a.reshape((2, 3))
+        words = a.to_bits(True)
+        assert words.shape == (2, 3, n_words)
+        assert words.dtype == np.dtype("uint64")
+        assert [
+            sum(int(w) << (64 * k) for k, w in enumerate(element))
+            for element in words.reshape((6, n_words))
+        ] == values
+
+    a = APyFixedArray.from_float([i - 50_000 for i in range(100_000)], 70, 0)
+    words = a.to_bits(True)
+    assert [int(lo) | int(hi) << 64 for lo, hi in words] == a.to_bits()
 
     #
     # Correct Numpy dtypes
@@ -1399,3 +1458,76 @@ def test_real_imag():
     assert a.imag.is_identical(
         APyFixedArray.from_float([0.0, 0.0, 0.0], int_bits=5, frac_bits=4)
     )
+
+
+@pytest.mark.parametrize("fixed_array", [APyFixedArray, APyCFixedArray])
+@pytest.mark.parametrize("bits", [(4, 2), (10, 60), (40, 60)])
+def test_dlpack_round_trip(fixed_array: type[APyCFixedArray], bits: tuple[int, int]):
+    np = pytest.importorskip("numpy")
+    a = fixed_array.from_float(
+        [[1.25, -0.5, 3.0], [-2.75, 0.0, 7.5]], int_bits=bits[0], frac_bits=bits[1]
+    )
+    limbs = np.from_dlpack(a)
+    assert limbs.dtype.kind == "i"
+    assert limbs.shape[:2] == a.shape
+    b = fixed_array.from_dlpack(limbs, int_bits=bits[0], frac_bits=bits[1])
+    assert b.is_identical(a)
+
+
+def test_dlpack_values():
+    np = pytest.importorskip("numpy")
+    a = APyFixedArray.from_float([1.0, -0.5, 2.25], int_bits=4, frac_bits=2)
+    assert np.from_dlpack(a).tolist() == [4, -2, 9]
+
+    c = APyCFixedArray.from_complex([1 + 2j, -0.5j], int_bits=4, frac_bits=2)
+    assert np.from_dlpack(c).tolist() == [[4, 8], [0, -2]]
+
+    # Any integer type is accepted, and bits outside of the format are wrapped
+    b = APyFixedArray.from_dlpack(
+        np.array([4, 254, 9, 64], dtype=np.uint8), int_bits=4, frac_bits=2
+    )
+    assert b.is_identical(APyFixedArray([4, 62, 9, 0], int_bits=4, frac_bits=2))
+
+
+def test_dlpack_shares_data():
+    np = pytest.importorskip("numpy")
+    a = APyFixedArray.from_float([1.0, 2.0, 3.0], int_bits=8, frac_bits=0)
+    b = a.copy()
+    view = np.from_dlpack(a)
+    view[0] = 5
+    assert a.is_identical(APyFixedArray([5, 2, 3], int_bits=8, frac_bits=0))
+    assert b.is_identical(APyFixedArray([1, 2, 3], int_bits=8, frac_bits=0))
+
+
+@pytest.mark.parametrize("fixed_array", [APyFixedArray, APyCFixedArray])
+def test_dlpack_exported_views(fixed_array: type[APyCFixedArray]):
+    # Views of an exported array hold their own copy of only the viewed items
+    np = pytest.importorskip("numpy")
+    a = fixed_array([[1, 2, 3], [4, 5, 6]], int_bits=8, frac_bits=0)
+    view = np.from_dlpack(a)
+    rows = [a[i] for i in range(2)]
+    flat = a.reshape((6,))
+    assert rows[1].is_identical(fixed_array([4, 5, 6], int_bits=8, frac_bits=0))
+    assert np.from_dlpack(rows[1]).shape[0] == 3
+
+    view[1, 0] = 0
+    assert a[1].is_identical(fixed_array([0, 5, 6], int_bits=8, frac_bits=0))
+    assert rows[1].is_identical(fixed_array([4, 5, 6], int_bits=8, frac_bits=0))
+    assert flat.is_identical(fixed_array(range(1, 7), int_bits=8, frac_bits=0))
+
+    seven = fixed_array([7], int_bits=8, frac_bits=0)[0]
+    rows[0][0] = seven
+    flat[1] = seven
+    assert fixed_array.from_dlpack(view, int_bits=8, frac_bits=0).is_identical(
+        fixed_array([[1, 2, 3], [0, 5, 6]], int_bits=8, frac_bits=0)
+    )
+
+
+def test_dlpack_raises():
+    np = pytest.importorskip("numpy")
+    with pytest.raises(ValueError, match=r"APyFixedArray.from_dlpack: expected shape"):
+        APyFixedArray.from_dlpack(np.zeros((3, 5), dtype=np.int64), 70, 0)
+    with pytest.raises(ValueError, match=r"APyCFixedArray.from_dlpack: expected shape"):
+        APyCFixedArray.from_dlpack(np.zeros((3, 3), dtype=np.int64), 10, 0)
+    with pytest.raises(TypeError, match=r"unsupported `dtype`, expecting integer"):
+        APyFixedArray.from_dlpack(np.zeros(3), 10, 0)
@@ -170,3 +170,14 @@ APyFixedArray(
     frac_bits=1000
 )"""
     )
+
+
+def test_array_representation_wide_bit_patterns():
+    # Values with zero-valued chunks of digits in their decimal representation
+    values = [0, 1, 10**19, 10**38 + 7, 2**200 - 1, 10**57 + 10**19, -1, -(2**150)]
+    bit_patterns = [v % 2**210 for v in values]
+    a = APyFixedArray(bit_patterns, int_bits=210, frac_bits=0)
+    assert repr(a).replace("\n", "").replace(" ", "") == (
+        f"APyFixedArray([{','.join(map(str, bit_patterns))}],int_bits=210,frac_bits=0)"
+    )
+    assert is_repr_identical(a.reshape((2, 4)))
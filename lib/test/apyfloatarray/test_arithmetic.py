@@ -1273,3 +1273,135 @@ def test_operation_with_numpy(float_array: type[APyCFloatArray]):
     assert (a - n).is_identical(a - nfp)
     assert (a * n).is_identical(a * nfp)
     assert (a / n).is_identical(a / nfp)
+
+
+@pytest.mark.float_array
+@pytest.mark.parametrize("float_array", [APyFloatArray, APyCFloatArray])
+def test_long_array_threadpool(float_array: type[APyCFloatArray]):
+    # Long enough for the elementwise operations to be split over the threadpool
+    np = pytest.importorskip("numpy")
+    n = 100_000
+    x = (np.arange(n) - n // 2).astype(np.float32)
+    y = (np.arange(n)[::-1] % 1000 + 1).astype(np.float32)
+    a = float_array.from_float(x, exp_bits=8, man_bits=23)
+    b = float_array.from_float(y, exp_bits=8, man_bits=23)
+    assert np.all((a + b).to_numpy() == x + y)
+    assert np.all((a - b).to_numpy() == x - y)
+    assert np.all((a * b).to_numpy() == x * y)
+
+    c = a.cast(exp_bits=5, man_bits=4)
+    for i in [0, 1, n // 3, n // 2, n - 1]:
+        assert c[i].is_identical(a[i].cast(exp_bits=5, man_bits=4))
+
+
+@pytest.mark.float_array
+@pytest.mark.parametrize("fmt", [(4, 3), (5, 2), (8, 7), (5, 10), (8, 23), (3, 28)])
+@pytest.mark.parametrize(
+    "mode", [QuantizationMode.RND_CONV, QuantizationMode.TRN, QuantizationMode.RND]
+)
+def test_array_arithmetic_simd(fmt: tuple[int, int], mode: QuantizationMode):
+    # Add, sub, and mul of small formats with `RND_CONV` or `TRN` use SIMD kernels,
+    # with scalar fallback for special values. They must match the scalar operators.
+    import random
+
+    random.seed(sum(fmt))
+    exp_bits, man_bits = fmt
+    bits = 1 + exp_bits + man_bits
+    n = 1000
+    a = APyFloatArray.from_bits(
+        [random.getrandbits(bits) for _ in range(n)], exp_bits, man_bits
+    )
+    b = APyFloatArray.from_bits(
+        [random.getrandbits(bits) for _ in range(n)], exp_bits, man_bits
+    )
+    c = APyFloatArray.from_bits(
+        [random.getrandbits(bits - 1) for _ in range(n)], exp_bits - 1, man_bits + 1
+    )
+
+    def check(res: APyFloatArray, scalar_res: list[APyFloat]):
+        for r, s in zip(res, scalar_res):
+            assert r.is_identical(s) or (r.is_nan and s.is_nan)
+
+    with APyFloatQuantizationContext(mode):
+        check(a + b, [x + y for x, y in zip(a, b)])
+        check(a - b, [x - y for x, y in zip(a, b)])
+        check(a * b, [x * y for x, y in zip(a, b)])
+        check(a * c, [x * y for x, y in zip(a, c)])
+        check(a + b[7], [x + b[7] for x in a])
+        check(a - b[7], [x - b[7] for x in a])
+        check(a * c[7], [x * c[7] for x in a])
+
+
+@pytest.mark.float_array
+def test_array_fma():
+    import random
+
+    rng = random.Random(0x5EED)
+    n = 2000
+    a = APyFloatArray.from_float([rng.uniform(-20, 20) for _ in range(n)], 4, 3)
+    b = APyFloatArray.from_float([rng.uniform(-2, 2) for _ in range(n)], 4, 3)
+    c = APyFloatArray.from_float([rng.uniform(-100, 100) for _ in range(n)], 5, 2)
+
+    # Products and sums of these formats are exact in double precision
+    exact = [float(x) * float(y) + float(z) for x, y, z in zip(a, b, c)]
+    exact = APyFloatArray.from_float(exact, 11, 52)
+    for q in [
+        QuantizationMode.TIES_EVEN,
+        QuantizationMode.TIES_AWAY,
+        QuantizationMode.TO_ZERO,
+        QuantizationMode.TO_POS,
+        QuantizationMode.TO_NEG,
+        QuantizationMode.JAM,
+    ]:
+        for exp_bits, man_bits in [(4, 3), (5, 2), (8, 7), (3, 1)]:
+            ref = exact.cast(exp_bits, man_bits, quantization=q)
+            res = a.fma(b, c, exp_bits, man_bits, quantization=q)
+            assert res.is_identical(ref)
+
+    # Default format and special values
+    x = APyFloatArray.from_float([float("inf"), 0.0, 1.0, float("nan")], 5, 10)
+    y = APyFloatArray.from_float([0.0, -1.0, 2.0, 1.0], 5, 10)
+    z = APyFloatArray.from_float([1.0, 0.0, -2.0, 1.0], 5, 10)
+    res = x.fma(y, z)
+    assert (res.exp_bits, res.man_bits) == (5, 10)
+    assert res[0].is_nan
+    assert res[1].is_zero and not res[1].sign
+    assert res[2].is_zero and not res[2].sign
+    assert res[3].is_nan
+    res = x.fma(y, z, quantization=QuantizationMode.TO_NEG)
+    assert res[1].is_zero and res[1].sign
+    assert res[2].is_zero and res[2].sign
+
+    with pytest.raises(ValueError, match=r"APyFloatArray\.fma: shape mismatch"):
+        _ = a.fma(x, z)
+
+
+@pytest.mark.float_array
+def test_array_fma_wide():
+    import random
+    from fractions import Fraction
+
+    # Rounding the product first, 1 - 2**-104 to 1, makes the sums zero
+    x = APyFloatArray.from_float([1 + 2**-52, 1 + 2**-30, 2**-1000], 11, 52)
+    y = APyFloatArray.from_float([1 - 2**-52, 1 + 2**-30, 2**-60], 11, 52)
+    z = APyFloatArray.from_float([-1.0, -1.0, 1.0], 11, 52)
+    res = x.fma(y, z)
+    ref = APyFloatArray.from_float([-(2**-104), 2**-29 + 2**-60, 1.0], 11, 52)
+    assert res.is_identical(ref)
+    assert (x * y + z)[0].is_zero
+
+    # Only the sticky bit remains of the tiny product when rounding away from zero
+    res = x.fma(y, z, quantization=QuantizationMode.TO_POS)
+    assert res[2].is_identical(APyFloat.from_float(1 + 2**-52, 11, 52))
+
+    # Doubles are rounded to nearest, ties to even, from the exact value
+    rng = random.Random(0xF3A)
+    values = [[rng.uniform(-4, 4) * 2 ** rng.randint(-40, 40) for _ in range(300)]]
+    values += [[rng.uniform(-4, 4) for _ in range(300)] for _ in range(2)]
+    a, b, c = (APyFloatArray.from_float(v, 11, 52) for v in values)
+    exact = [Fraction(x) * Fraction(y) + Fraction(z) for x, y, z in zip(*values)]
+    ref = APyFloatArray.from_float([float(v) for v in exact], 11, 52)
+    assert a.fma(b, c, quantization=QuantizationMode.TIES_EVEN).is_identical(ref)
+
+    with pytest.raises(ValueError, match=r"at most 59 mantissa bits are supported"):
+        _ = x.fma(y, z, man_bits=60)
@@ -327,3 +327,35 @@ def test_constructor_with_mixed_iterable_raises(float_array: type[APyCFloatArray
     match += "input iterables must be ndarray"
     with pytest.raises(ValueError, match=match):
         _ = float_array(sign, exp, man, exp_bits=5, man_bits=10)
+
+
+@pytest.mark.parametrize("dt", ["float64", "float32", "int64", "uint16"])
+@pytest.mark.parametrize("fmt", [(5, 10), (8, 23), (4, 3), (11, 52), (15, 60)])
+def test_large_numpy_creation(dt: str, fmt: tuple[int, int]):
+    # Large enough to be converted using SIMD on several threads
+    np = pytest.importorskip("numpy")
+    rng = np.random.default_rng(4711)
+    anp = rng.normal(scale=1000.0, size=(5, 2000))
+    anp = (np.abs(anp) if dt == "uint16" else anp).astype(dt)
+    if np.issubdtype(dt, np.floating):
+        anp[0, :8] = [float("inf"), float("nan"), 1e-30, -1e30, 1e-40, -0.0, -1.0, 3]
+    a = APyFloatArray.from_float(anp, *fmt)
+    b = APyFloatArray.from_float(anp.astype(np.float64).tolist(), *fmt)
+    assert a.is_identical(b)
+
+
+def test_strided_numpy_creation():
+    # Sliced, transposed, Fortran-ordered, and reversed arrays are read in place
+    np = pytest.importorskip("numpy")
+    x = np.arange(-3000, 3000, dtype=np.int64).reshape(20, 300)
+    for a in (x[:, ::2], x.T, np.asfortranarray(x), x[::-3, 7:], x[3:4, ::-1]):
+        ref = APyFloatArray.from_float(a.tolist(), 5, 8)
+        assert APyFloatArray.from_array(a, 5, 8).is_identical(ref)
+        assert APyFloatArray.from_float(a.astype(np.float32), 5, 8).is_identical(ref)
+        b = APyFloatArray(a < 0, a & 31, a & 255, 5, 8)
+        assert b.is_identical(
+            APyFloatArray((a < 0).tolist(), (a & 31).tolist(), (a & 255).tolist(), 5, 8)
+        )
+        assert APyFloatArray.from_bits(a & 0x3FFF, 5, 8).is_identical(
+            APyFloatArray.from_bits((a & 0x3FFF).tolist(), 5, 8)
+        )
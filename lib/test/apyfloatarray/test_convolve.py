@@ -119,3 +119,17 @@ def test_multi_limb_convolve_full(float_array: type[APyCFloatArray]):
     assert convolve(b, a, mode="same").is_identical(result_same)
     assert convolve(a, b, mode="valid").is_identical(result_valid)
     assert convolve(b, a, mode="valid").is_identical(result_valid)
+
+
+@pytest.mark.parametrize("float_array", [APyFloatArray, APyCFloatArray])
+@pytest.mark.parametrize("mode", ["full", "same", "valid"])
+def test_long_convolve_threadpool(float_array: type[APyCFloatArray], mode: str):
+    # Long enough for the outputs to be split over the threadpool
+    np = pytest.importorskip("numpy")
+    x = np.arange(20_000) % 23 - 11
+    h = np.arange(33) % 7 - 3
+    a = float_array.from_float(x, exp_bits=8, man_bits=20)
+    b = float_array.from_float(h, exp_bits=6, man_bits=10)
+    ref = np.convolve(x, h, mode=mode)
+    assert np.all(convolve(a, b, mode=mode).to_numpy() == ref)
+    assert np.all(convolve(b, a, mode=mode).to_numpy() == ref)
@@ -8,6 +8,7 @@ from apytypes import (
     APyFixed,
     APyFloat,
     APyFloatArray,
+    APyFloatArrayPlanes,
     QuantizationMode,
 )
 
@@ -476,6 +477,38 @@ def test_iterator():
     assert next(iterator).is_identical(APyFloat.from_float(2, exp_bits=10, man_bits=10))
 
 
+@pytest.mark.float_array
+@pytest.mark.parametrize("dt", ["float16", "float32", "float64"])
+@pytest.mark.parametrize(("exp_bits", "man_bits"), [(8, 30), (11, 52), (15, 60)])
+def test_to_numpy_float_dtypes(dt: str, exp_bits: int, man_bits: int):
+    # Skip this test if `NumPy` is not present on the machine
+    np = pytest.importorskip("numpy")
+
+    # Large enough to be converted in parallel, with zeros, subnormals, and
+    # non-finite values in the middle of the array
+    special = [0.0, -0.0, 2.0**-140, 2.0**-1070, 1e300, np.inf, -np.inf, np.nan]
+    values = np.concatenate(
+        (np.linspace(-1e5, 1e5, 50_000), special, np.geomspace(1e-9, 1e9, 50_000))
+    )
+    fp_arr = APyFloatArray.from_float(values, exp_bits, man_bits)
+    res = fp_arr.to_numpy(dtype=dt)
+    assert res.dtype == np.dtype(dt)
+
+    # Casting to the format of `dt` rounds once, the same as `to_numpy`
+    dt_exp_bits, dt_man_bits = {"float16": (5, 10), "float32": (8, 23)}.get(
+        dt, (11, 52)
+    )
+    expected = fp_arr.cast(dt_exp_bits, dt_man_bits).to_numpy().astype(dt)
+    assert np.array_equal(res, expected, equal_nan=True)
+
+    cfp_arr = APyCFloatArray.from_float(values, exp_bits, man_bits)
+    complex_dt = "complex128" if dt == "float64" else "complex64"
+    res = cfp_arr.to_numpy(dtype=dt)
+    assert res.dtype == np.dtype(complex_dt)
+    if dt != "float16":
+        assert np.array_equal(res.real, expected, equal_nan=True)
+
+
 @pytest.mark.float_array
 @pytest.mark.parametrize("float_array", [APyFloatArray, APyCFloatArray])
 def test_len(float_array: type[APyCFloatArray]):
@@ -2146,3 +2179,73 @@ def test_real_imag():
     assert a.imag.is_identical(
         APyFloatArray.from_float([0.0, 0.0, 0.0], exp_bits=5, man_bits=4)
     )
+
+
+@pytest.mark.float_array
+@pytest.mark.parametrize(
+    ("exp_bits", "man_bits", "nbytes"),
+    [(4, 3, 3), (5, 10, 4), (8, 7, 3), (8, 23, 6), (11, 52, 11), (20, 60, 13)],
+)
+def test_to_planes(exp_bits: int, man_bits: int, nbytes: int):
+    np = pytest.importorskip("numpy")
+    a = APyFloatArray.from_float(
+        [[1.0, -0.25, 3.5], [float("inf"), float("nan"), 0.0]], exp_bits, man_bits
+    )
+    p = a.to_planes()
+    assert p.shape == (2, 3)
+    assert p.exp_bits == exp_bits
+    assert p.man_bits == man_bits
+    assert p.bias == a.bias
+    assert p.nbytes == 6 * nbytes
+    assert p.to_array().is_identical(a)
+    assert np.all(p.sign == np.array([[x.sign for x in row] for row in a]))
+    assert np.all(p.exp == np.array([[x.exp for x in row] for row in a]))
+    assert np.all(p.man == np.array([[x.man for x in row] for row in a]))
+
+    empty = APyFloatArray([], [], [], exp_bits, man_bits)
+    assert empty.to_planes().to_array().is_identical(empty)
+
+
+@pytest.mark.float_array
+def test_planes_from_float_and_zeros():
+    np = pytest.importorskip("numpy")
+    values = np.linspace(-100, 100, 10_001).reshape(73, 137)
+    p = APyFloatArrayPlanes.from_float(values, exp_bits=5, man_bits=10)
+    assert p.shape == (73, 137)
+    assert p.nbytes == 4 * values.size
+    assert p.to_array().is_identical(
+        APyFloatArray.from_float(values, exp_bits=5, man_bits=10)
+    )
+
+    # Strided ndarrays and Python sequences
+    p = APyFloatArrayPlanes.from_float(values.T, exp_bits=8, man_bits=7, bias=100)
+    assert p.to_array().is_identical(
+        APyFloatArray.from_float(values.T, exp_bits=8, man_bits=7, bias=100)
+    )
+    p = APyFloatArrayPlanes.from_float([[1.0, -2.5], [0.0, 3]], exp_bits=4, man_bits=3)
+    assert p.to_array().is_identical(
+        APyFloatArray.from_float([[1.0, -2.5], [0.0, 3]], exp_bits=4, man_bits=3)
+    )
+
+    z = APyFloatArrayPlanes.zeros((3, 5), exp_bits=11, man_bits=52)
+    assert z.to_array().is_identical(APyFloatArray.zeros((3, 5), 11, 52))
+    assert APyFloatArrayPlanes.zeros(4, 4, 3, bias=3).to_array().is_identical(
+        APyFloatArray.zeros(4, 4, 3, bias=3)
+    )
+
+
+@pytest.mark.float_array
+@pytest.mark.parametrize("n", [0, 7, 10_000])
+def test_planes_arithmetic(n: int):
+    np = pytest.importorskip("numpy")
+    x = np.linspace(-50, 50, n)
+    a = APyFloatArray.from_float(x, exp_bits=5, man_bits=6)
+    b = APyFloatArray.from_float(x[::-1] + 0.3, exp_bits=6, man_bits=4)
+    pa, pb = a.to_planes(), b.to_planes()
+    assert isinstance(pa + pb, APyFloatArrayPlanes)
+    assert (pa + pb).to_array().is_identical(a + b)
+    assert (pa - pb).to_array().is_identical(a - b)
+    assert (pa * pb).to_array().is_identical(a * b)
+
+    with pytest.raises(ValueError, match=r"APyFloatArrayPlanes.__add__: shape"):
+        _ = pa + APyFloatArrayPlanes.zeros(n + 1, 5, 6)
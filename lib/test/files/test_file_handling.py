@@ -11,7 +11,9 @@ from apytypes import (
     APyFixedArray,
     APyFloatArray,
     export_csv,
+    export_mem,
     import_csv,
+    import_mem,
 )
 
 
@@ -60,9 +62,6 @@ def test_import_csv():
             vunit_3d_shape=(1, 2, 3),
         )
 
-    # Handling of CSV files are not tested since Python's csv module is used,
-    # this includes missing file raises, testing different delimiters, etc.
-
     arr = import_csv(curr_dir / "apyfixed_bits_1d.csv", bits=71, frac_bits=20)
 
     assert arr.is_identical(
@@ -186,9 +185,6 @@ def test_export_csv(tmp_path):
             layout="vunit",
         )
 
-    # Handling of CSV files are not tested since Python's csv module is used,
-    # this includes missing file raises, testing different delimiters, etc.
-
     arr = APyFixedArray(
         [
             # Large bit patterns, like how .to_bits behaves
@@ -249,6 +245,150 @@ def test_export_csv(tmp_path):
     test_export(arr, "apyfloat_bits_2d.csv")
 
 
+def test_csv_round_trip(tmp_path):
+    """Test exporting and importing CSV files with different delimiters and sizes."""
+    fname = tmp_path / "test.csv"
+
+    arr = APyFixedArray.from_float([[-1.5, 2.25, 7.75], [0.0, -8.0, 3.5]], 4, 2)
+    for delimiter in (",", ";", "\t", "::"):
+        export_csv(arr, fname, delimiter=delimiter)
+        assert import_csv(
+            fname, delimiter=delimiter, int_bits=4, frac_bits=2
+        ).is_identical(arr)
+
+    # Signed values of the VUnit layout
+    export_csv(arr, fname, layout="vunit")
+    assert fname.read_bytes() == b"-6,0\r\n9,-32\r\n31,14\r\n"
+    assert import_csv(
+        fname, int_bits=4, frac_bits=2, layout="vunit"
+    ).is_identical(arr)
+
+    # Multi-limb values
+    arr = APyFixedArray.from_float([-(2.0**100), 2.0**90, -1, 0.25], 130, 2)
+    export_csv(arr, fname, layout="vunit")
+    assert fname.read_text().split(",")[0] == str(-(2**102))
+    assert import_csv(fname, int_bits=130, frac_bits=2).is_identical(arr)
+
+    # Large arrays are formatted and parsed in blocks
+    arr = APyFixedArray.from_float(
+        [(i % 5000) / 4 - 600 for i in range(300_000)], 12, 2
+    ).reshape((3000, 100))
+    export_csv(arr, fname)
+    assert import_csv(fname, int_bits=12, frac_bits=2).is_identical(arr)
+
+    arr = APyFloatArray.from_float([i / 7 for i in range(200_000)], 11, 52)
+    export_csv(arr, fname)
+    assert import_csv(fname, exp_bits=11, man_bits=52).is_identical(arr)
+
+
+def test_csv_raises(tmp_path):
+    """Test importing malformed CSV files."""
+    fname = tmp_path / "test.csv"
+
+    fname.write_text("1, 2, 3\n4, 5\n")
+    with pytest.raises(ValueError, match=r"Line 2: expected 3 values, got 2"):
+        import_csv(fname, int_bits=4, frac_bits=0)
+
+    fname.write_text("1, 2\n\n3, 0x4\n")
+    with pytest.raises(ValueError, match=r"Line 3: invalid value '0x4'"):
+        import_csv(fname, int_bits=4, frac_bits=0)
+
+    fname.write_text("1, , 2\n")
+    with pytest.raises(ValueError, match=r"Line 1: invalid value '<empty>'"):
+        import_csv(fname, int_bits=4, frac_bits=0)
+
+    with pytest.raises(FileNotFoundError):
+        import_csv(tmp_path / "missing.csv", int_bits=4, frac_bits=0)
+
+
+def test_mem_round_trip(tmp_path):
+    """Test exporting and importing `$readmemh`/`$readmemb` memory files."""
+    fname = tmp_path / "test.mem"
+
+    arr = APyFixedArray.from_float([1.0, -0.5, 2.25, -8.0], int_bits=4, frac_bits=2)
+    export_mem(arr, fname)
+    assert fname.read_text() == "04\n3e\n09\n20\n"
+    assert import_mem(fname, int_bits=4, frac_bits=2).is_identical(arr)
+
+    export_mem(arr, fname, radix="bin")
+    assert fname.read_text() == "000100\n111110\n001001\n100000\n"
+    assert import_mem(fname, radix="bin", int_bits=4, frac_bits=2).is_identical(arr)
+
+    # Multi-dimensional arrays are written in row-major order
+    export_mem(arr.reshape((2, 2)), fname)
+    assert import_mem(fname, int_bits=4, frac_bits=2).is_identical(arr)
+
+    # Multi-limb values
+    arr = APyFixedArray.from_float([-(2.0**100), 2.0**90, -1, 0], 130, 2)
+    export_mem(arr, fname)
+    assert fname.read_text().split()[2] == "f" * 32 + "c"
+    assert import_mem(fname, int_bits=130, frac_bits=2).is_identical(arr)
+
+    arr = APyFloatArray.from_float([1.0, -2.5, float("inf"), 1e-300], 20, 61)
+    for radix in ("hex", "bin"):
+        export_mem(arr, fname, radix=radix)
+        assert import_mem(
+            fname, radix=radix, exp_bits=20, man_bits=61
+        ).is_identical(arr)
+
+    arr = APyFloatArray.from_float([1.0, -2.5], 8, 23)
+    export_mem(arr, fname)
+    assert fname.read_text() == "3f800000\nc0200000\n"
+
+    # Large arrays
+    arr = APyFixedArray.from_float([i % 3000 - 1500 for i in range(100_000)], 16, 0)
+    export_mem(arr, fname)
+    assert import_mem(fname, int_bits=16, frac_bits=0).is_identical(arr)
+
+
+def test_import_mem_syntax(tmp_path):
+    """Test comments, whitespace, and underscores in memory files."""
+    fname = tmp_path / "test.mem"
+    fname.write_text("// Header\n0a 0B\t1_f // Comment\n\n  ff\n")
+    assert import_mem(fname, bits=8, int_bits=8).is_identical(
+        APyFixedArray([10, 11, 31, 255], bits=8, int_bits=8)
+    )
+
+    # Bits outside of the format are discarded
+    assert import_mem(fname, bits=4, int_bits=4).is_identical(
+        APyFixedArray([10, 11, 15, 15], bits=4, int_bits=4)
+    )
+
+    fname.write_text("1010\n0_1_1\n")
+    assert import_mem(fname, radix="bin", bits=4, int_bits=4).is_identical(
+        APyFixedArray([10, 3], bits=4, int_bits=4)
+    )
+
+
+def test_mem_raises(tmp_path):
+    """Test invalid arguments and malformed memory files."""
+    fname = tmp_path / "test.mem"
+
+    with pytest.raises(ValueError, match="Complex data types are not supported"):
+        export_mem(APyCFixedArray([0, 1], 4, 3), fname)
+
+    with pytest.raises(ValueError, match="Unknown radix"):
+        export_mem(APyFixedArray([0, 1], 4, 3), fname, radix="dec")
+
+    with pytest.raises(ValueError, match="Could not determine array type"):
+        import_mem(fname, int_bits=4, frac_bits=0, exp_bits=5)
+
+    with pytest.raises(ValueError, match="Unknown radix"):
+        import_mem(fname, radix="oct", int_bits=4, frac_bits=0)
+
+    fname.write_text("01\n@10\n02\n")
+    with pytest.raises(ValueError, match=r"Line 2: invalid value '@10'"):
+        import_mem(fname, int_bits=4, frac_bits=0)
+
+    fname.write_text("01\n0x\n")
+    with pytest.raises(ValueError, match=r"Line 2: invalid value '0x'"):
+        import_mem(fname, int_bits=4, frac_bits=0)
+
+    fname.write_text("01\n12\n")
+    with pytest.raises(ValueError, match=r"Line 2: invalid value '12'"):
+        import_mem(fname, radix="bin", int_bits=4, frac_bits=0)
+
+
 @pytest.mark.skipif(
     not shutil.which("nvc") and not shutil.which("vsim"),
     reason="neither nvc or vunit not found",
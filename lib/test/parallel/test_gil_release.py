@@ -0,0 +1,68 @@
+##
+# Testing of array kernels running concurrently on several Python threads, with the
+# GIL released
+#
+
+import sys
+import threading
+
+import pytest
+
+from apytypes import APyCFixedArray, APyFixedArray, APyFloatArray, QuantizationMode
+
+
+def _run_concurrently(fn, n_threads: int = 4) -> list:
+    results = [None] * n_threads
+
+    def target(i: int):
+        results[i] = fn()
+
+    threads = [threading.Thread(target=target, args=(i,)) for i in range(n_threads)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    return results
+
+
+@pytest.mark.skipif("pyodide" in sys.modules, reason="Can not use threading in Pyodide")
+def test_concurrent_fixed_kernels():
+    a = APyFixedArray.from_float(
+        [[(i * 7 + j) % 17 - 8 for j in range(120)] for i in range(100)], 6, 3
+    )
+    b = APyFixedArray.from_float(
+        [[(i * 3 + j) % 13 - 6 for j in range(90)] for i in range(120)], 5, 4
+    )
+
+    def kernels():
+        return (
+            a @ b,
+            (a + a).cast(int_bits=4, frac_bits=1, quantization=QuantizationMode.RND),
+            a * a - a,
+        )
+
+    reference = kernels()
+    for result in _run_concurrently(kernels):
+        for res, ref in zip(result, reference):
+            assert res.is_identical(ref)
+
+
+@pytest.mark.skipif("pyodide" in sys.modules, reason="Can not use threading in Pyodide")
+def test_concurrent_float_kernels():
+    a = APyFloatArray.from_float(
+        [[(i * 7 + j) % 17 - 8.5 for j in range(120)] for i in range(100)], 5, 6
+    )
+    b = APyFloatArray.from_float(
+        [[(i * 3 + j) % 13 - 6.25 for j in range(90)] for i in range(120)], 6, 5
+    )
+    c = APyCFixedArray.from_complex(
+        [[complex(i - j, j % 5) for j in range(80)] for i in range(80)], 8, 2
+    )
+
+    def kernels():
+        return (a @ b, (a * a + a).cast(exp_bits=4, man_bits=3), c @ c)
+
+    reference = kernels()
+    for result in _run_concurrently(kernels):
+        for res, ref in zip(result, reference):
+            assert res.is_identical(ref)
@@ -1,11 +1,15 @@
 import pytest
 
 from apytypes import (
+    APyBufferPoolContext,
+    APyCFixedArray,
+    APyCFloatArray,
     APyFixed,
     APyFixedAccumulatorContext,
     APyFixedArray,
     APyFixedCastContext,
     APyFloatAccumulatorContext,
+    APyFloatArray,
     APyFloatQuantizationContext,
     OverflowMode,
     QuantizationMode,
@@ -507,3 +511,73 @@ class TestFpQuantizationContext:
         with APyFloatQuantizationContext(QuantizationMode.TO_POS, 123):
             assert get_float_quantization_mode() == QuantizationMode.TO_POS
             assert get_float_quantization_seed() == 123
+
+
+class TestBufferPoolContext:
+    """
+    Results must be unaffected by recycled (and non-zeroed) array storage.
+    """
+
+    @staticmethod
+    def _compute(a, b, c):
+        return [(a * b + c).cast(exp_bits=4, man_bits=3) for _ in range(5)]
+
+    def test_same_results(self):
+        a = APyFloatArray.from_float([[1.0, 2.5, -3.0], [0.5, 0.0, 7.0]], 5, 10)
+        b = APyFloatArray.from_float([[0.25, -1.0, 2.0], [3.0, 1.5, -0.5]], 5, 10)
+        c = APyFloatArray.from_float([[4.0, 0.125, 1.0], [-2.0, 9.0, 0.75]], 5, 10)
+        x = APyFixedArray.from_float([[1.0, -2.25], [3.5, 0.5]], int_bits=5, frac_bits=4)
+
+        reference = self._compute(a, b, c)
+        reference_fx = x * x + x
+        with APyBufferPoolContext():
+            for _ in range(3):
+                results = self._compute(a, b, c)
+                assert all(r.is_identical(ref) for r, ref in zip(results, reference))
+                assert (x * x + x).is_identical(reference_fx)
+
+    @pytest.mark.parametrize("bits", [10, 64, 100, 200])
+    def test_limb_arrays(self, bits: int):
+        def compute(x, y, z):
+            return [
+                x + y,
+                y - x,
+                x * y,
+                -x,
+                ~x if isinstance(x, APyFixedArray) else x,
+                (x * y).cast(int_bits=bits // 2, frac_bits=bits // 3),
+                z + z,
+                z * z,
+                z.cast(exp_bits=5, man_bits=4),
+            ]
+
+        x = APyFixedArray.from_float(
+            [[-1.5, 2.25, 3.0], [-7.75, 0.5, 1]], int_bits=bits // 2, frac_bits=3
+        )
+        y = APyFixedArray.from_float(
+            [[0.125, -3.5, 1.0], [-2.0, 6.0, 1]], int_bits=bits // 3, frac_bits=bits // 4
+        )
+        cx = APyCFixedArray.from_complex(
+            [1 - 2j, -3.5 + 0.5j], int_bits=bits // 2, frac_bits=2
+        )
+        cy = APyCFixedArray.from_complex([0.5j, -1 + 1j], int_bits=bits // 3, frac_bits=3)
+        z = APyCFloatArray.from_complex([1.5 - 2j, 3 + 0.25j], exp_bits=8, man_bits=20)
+
+        reference = compute(x, y, z) + compute(cx, cy, z)[:3]
+        with APyBufferPoolContext():
+            for _ in range(3):
+                # Dirty recycled storage before computing the results again
+                _ = [v * v for v in (x, y, cx, cy, z, -x, ~y)]
+                results = compute(x, y, z) + compute(cx, cy, z)[:3]
+                assert all(r.is_identical(ref) for r, ref in zip(results, reference))
+
+    def test_nested(self):
+        a = APyFloatArray.from_float(list(range(100)), 8, 23)
+        reference = a * a - a
+        with APyBufferPoolContext(max_bytes=0):
+            with APyBufferPoolContext(max_bytes=1 << 20):
+                for _ in range(3):
+                    assert (a * a - a).is_identical(reference)
+            for _ in range(3):
+                assert (a * a - a).is_identical(reference)
+        assert (a * a - a).is_identical(reference)
@@ -0,0 +1,168 @@
+import random
+
+import pytest
+
+from apytypes import (
+    APyCFixedArray,
+    APyCFloatArray,
+    APyFixedArray,
+    APyFloatArray,
+    ConvolutionMode,
+    convolve,
+    convolve2d,
+    correlate,
+)
+
+
+def _convolve2d(a, k):
+    """Full two-dimensional convolution of nested lists."""
+    rows, cols = len(a) + len(k) - 1, len(a[0]) + len(k[0]) - 1
+    res = [[0] * cols for _ in range(rows)]
+    for i, row in enumerate(a):
+        for j, x in enumerate(row):
+            for m, k_row in enumerate(k):
+                for n, y in enumerate(k_row):
+                    res[i + m][j + n] += x * y
+    return res
+
+
+def _tolist(a):
+    """Nested lists of the values of the array `a`."""
+    if a.ndim > 1:
+        return [_tolist(x) for x in a]
+    convert = complex if isinstance(a, (APyCFixedArray, APyCFloatArray)) else float
+    return [convert(x) for x in a]
+
+
+def _select(full, m: int, n: int, mode: str):
+    """Outputs of a one-dimensional full convolution of lengths `m` and `n`."""
+    lo, hi = min(m, n), max(m, n)
+    if mode == "full":
+        return full
+    if mode == "same":
+        return full[(lo - 1) // 2 : (lo - 1) // 2 + hi]
+    return full[lo - 1 : hi]
+
+
+def _array(array, values):
+    if array in (APyFixedArray, APyCFixedArray):
+        return array.from_float(values, int_bits=6, frac_bits=2)
+    return array.from_float(values, exp_bits=8, man_bits=20)
+
+
+@pytest.mark.parametrize(
+    "array", [APyFixedArray, APyCFixedArray, APyFloatArray, APyCFloatArray]
+)
+@pytest.mark.parametrize("mode", ["full", "same", "valid"])
+@pytest.mark.parametrize(("a_shape", "k_shape"), [((5, 4), (2, 3)), ((2, 3), (4, 4))])
+def test_convolve2d(array, mode: str, a_shape, k_shape):
+    rng = random.Random(a_shape[0] + 10 * k_shape[0])
+    a = [[rng.randint(-8, 7) for _ in range(a_shape[1])] for _ in range(a_shape[0])]
+    k = [[rng.randint(-4, 3) for _ in range(k_shape[1])] for _ in range(k_shape[0])]
+    full = _convolve2d(a, k)
+    ref = [
+        _select(row, a_shape[1], k_shape[1], mode)
+        for row in _select(full, a_shape[0], k_shape[0], mode)
+    ]
+
+    res = _array(array, a).convolve2d(_array(array, k), mode=mode)
+    assert _tolist(res) == ref
+    assert convolve2d(_array(array, a), _array(array, k), mode).is_identical(res)
+
+    # Strides keep every `stride`-th output along each axis
+    strided = _array(array, a).convolve2d(_array(array, k), mode=mode, stride=(2, 3))
+    assert _tolist(strided) == [row[::3] for row in ref[::2]]
+    strided = _array(array, a).convolve2d(_array(array, k), mode=mode, stride=2)
+    assert _tolist(strided) == [row[::2] for row in ref[::2]]
+
+
+@pytest.mark.parametrize("array", [APyFixedArray, APyCFixedArray])
+def test_convolve2d_matches_convolve(array):
+    # A single row is the one-dimensional convolution, also in the result format
+    a = array.from_float([[1.25, -3.5, 0.5, 7, 2.25]], int_bits=40, frac_bits=30)
+    k = array.from_float([[0.25, -1.5, 0.75]], int_bits=3, frac_bits=2)
+    for mode in ["full", "same", "valid"]:
+        res = a.convolve2d(k, mode=mode)
+        assert res[0].is_identical(convolve(a[0], k[0], mode=mode))
+        res = k.convolve2d(a, mode=mode)
+        assert res[0].is_identical(convolve(k[0], a[0], mode=mode))
+
+
+@pytest.mark.parametrize(
+    "array", [APyFixedArray, APyCFixedArray, APyFloatArray, APyCFloatArray]
+)
+def test_convolve2d_batch(array):
+    rng = random.Random(3)
+    values = [[rng.randint(-8, 7) for _ in range(5)] for _ in range(4 * 3)]
+    a = _array(array, [values[0:4], values[4:8], values[8:12]])
+    k = _array(array, [[1, -2], [3, 0], [-1, 1]])
+
+    # Each slice along the leading axes is convolved independently
+    res = a.convolve2d(k, mode=ConvolutionMode.VALID, stride=(1, 2))
+    assert res.shape == (3, 2, 2)
+    for b in range(3):
+        ref = a[b].convolve2d(k, mode=ConvolutionMode.VALID, stride=(1, 2))
+        assert res[b].is_identical(ref)
+
+
+@pytest.mark.parametrize(
+    "array", [APyFixedArray, APyCFixedArray, APyFloatArray, APyCFloatArray]
+)
+@pytest.mark.parametrize("mode", ["full", "same", "valid"])
+@pytest.mark.parametrize(("m", "n"), [(7, 3), (3, 7), (4, 4), (6, 1), (4, 5)])
+def test_correlate_matches_numpy(array, mode: str, m: int, n: int):
+    np = pytest.importorskip("numpy")
+    rng = random.Random(m + 10 * n)
+    a = [rng.randint(-8, 7) for _ in range(m)]
+    v = [rng.randint(-8, 7) for _ in range(n)]
+    if array in (APyCFixedArray, APyCFloatArray):
+        a = [x + 1j * rng.randint(-8, 7) for x in a]
+        v = [x + 1j * rng.randint(-8, 7) for x in v]
+    ref = np.correlate(a, v, mode=mode).tolist()
+
+    res = _array(array, a).correlate(_array(array, v), mode=mode)
+    assert _tolist(res) == ref
+    res = correlate(_array(array, a), _array(array, v), mode=mode, stride=2)
+    assert _tolist(res) == ref[::2]
+
+
+def test_correlate_nd():
+    rng = random.Random(5)
+    values = [[rng.randint(-8, 7) for _ in range(6)] for _ in range(5 * 2)]
+    a = APyFixedArray.from_float([values[0:5], values[5:10]], int_bits=5, frac_bits=1)
+    k_values = [[rng.randint(-4, 3) for _ in range(3)] for _ in range(2)]
+    k = APyFixedArray.from_float(k_values, int_bits=4, frac_bits=0)
+    k_reversed = APyFixedArray.from_float(
+        [row[::-1] for row in k_values[::-1]], int_bits=4, frac_bits=0
+    )
+
+    # Correlation is convolution with the kernel reversed along all axes
+    for mode in ["full", "valid"]:
+        assert a.correlate(k, mode=mode).is_identical(a.convolve2d(k_reversed, mode))
+
+    # A three-dimensional kernel convolves all axes
+    res = a.correlate(a, mode="valid")
+    assert res.shape == (1, 1, 1)
+    assert _tolist(res) == [[[sum(x * x for row in values for x in row)]]]
+
+
+def test_raises():
+    a = APyFixedArray.from_float([[1, 2], [3, 4]], int_bits=4, frac_bits=0)
+    with pytest.raises(ValueError, match=r"can only convolve2d 2D arrays"):
+        _ = a.convolve2d(a[0])
+    with pytest.raises(ValueError, match=r"can only convolve2d 2D arrays"):
+        _ = a[0].convolve2d(a)
+    with pytest.raises(ValueError, match=r"at most `self.ndim` dimensions"):
+        _ = a[0].correlate(a)
+    with pytest.raises(ValueError, match=r"`stride` must be a positive integer"):
+        _ = a.convolve2d(a, stride=0)
+    with pytest.raises(ValueError, match=r"`stride` must be a positive integer"):
+        _ = a.correlate(a, stride=(1, 2, 3))
+    with pytest.raises(ValueError, match=r"cannot convolve empty arrays"):
+        _ = a.correlate(APyFixedArray([], int_bits=4, frac_bits=0))
+    with pytest.raises(ValueError, match=r"mode='cool_beans' not in 'full', 'same',"):
+        _ = a.convolve2d(a, mode="cool_beans")
+    with pytest.raises(TypeError, match=r"Cannot convolve2d <class"):
+        _ = convolve2d(a, [[1]])
+    with pytest.raises(TypeError, match=r"Cannot correlate <class"):
+        _ = correlate(a, [[1]])
@@ -0,0 +1,157 @@
+import random
+
+import pytest
+
+from apytypes import (
+    APyCFixedArray,
+    APyCFixedFIR,
+    APyCFloatArray,
+    APyCFloatFIR,
+    APyFixedAccumulatorContext,
+    APyFixedArray,
+    APyFixedFIR,
+    APyFloatArray,
+    APyFloatFIR,
+    QuantizationMode,
+    convolve,
+)
+
+
+def _stream(fir, x, block_sizes):
+    """Filter `x` through `fir` in blocks of the given sizes."""
+    blocks, start = [], 0
+    for size in block_sizes:
+        blocks.append(fir.process(x[start : start + size]))
+        start += size
+    return blocks
+
+
+def _concatenate(blocks):
+    return [v for block in blocks for v in block]
+
+
+@pytest.mark.parametrize(
+    ("fir_type", "array"),
+    [(APyFixedFIR, APyFixedArray), (APyCFixedFIR, APyCFixedArray)],
+)
+@pytest.mark.parametrize(("int_bits", "frac_bits"), [(3, 2), (40, 30)])
+def test_fixed_fir_matches_convolve(fir_type, array, int_bits: int, frac_bits: int):
+    rng = random.Random(int_bits)
+    x_values = [rng.randint(-8, 7) / 4 for _ in range(23)]
+    taps = array.from_float([0.25, -1.5, 0.75, 2, -0.5], int_bits=3, frac_bits=2)
+    x = array.from_float(x_values, int_bits=int_bits, frac_bits=frac_bits)
+    full = convolve(x, taps)
+
+    # Block boundaries are invisible in the output
+    fir = fir_type(taps)
+    blocks = _stream(fir, x, [1, 4, 0, 7, 11])
+    for block, start in zip(blocks, [0, 1, 5, 5, 12], strict=True):
+        assert block.is_identical(full[start : start + len(block)])
+
+
+@pytest.mark.parametrize(
+    ("fir_type", "array"),
+    [(APyFloatFIR, APyFloatArray), (APyCFloatFIR, APyCFloatArray)],
+)
+def test_float_fir_matches_convolve(fir_type, array):
+    taps = array.from_float([0.3, -1.5, 0.7, 2.1], exp_bits=5, man_bits=6)
+    x = array.from_float(
+        [1.25, -3.5, 0.1, 7, 2.2, -0.6, 0.9, 4, -2.5, 1], exp_bits=6, man_bits=8
+    )
+    full = convolve(x, taps)
+
+    fir = fir_type(taps)
+    blocks = _stream(fir, x, [3, 3, 4])
+    assert blocks[0].is_identical(full[0:3])
+    assert blocks[1].is_identical(full[3:6])
+    assert blocks[2].is_identical(full[6:10])
+
+    # Decimation keeps every `M`-th output
+    fir = fir_type(taps, decimation=3)
+    assert _concatenate(_stream(fir, x, [2, 5, 3])) == list(full[0:10:3])
+
+
+@pytest.mark.parametrize("interpolation", [1, 2, 3, 7])
+@pytest.mark.parametrize("decimation", [1, 2, 5])
+def test_fixed_fir_rate_change(interpolation: int, decimation: int):
+    rng = random.Random(interpolation * 10 + decimation)
+    x_values = [rng.randint(-64, 63) / 8 for _ in range(30)]
+    taps_values = [rng.randint(-16, 15) / 16 for _ in range(11)]
+    taps = APyFixedArray.from_float(taps_values, int_bits=1, frac_bits=4)
+    x = APyFixedArray.from_float(x_values, int_bits=4, frac_bits=3)
+
+    # Reference: zero insertion, filtering, and downsampling
+    upsampled = [0.0] * (interpolation * len(x_values))
+    upsampled[::interpolation] = x_values
+    u = APyFixedArray.from_float(upsampled, int_bits=4, frac_bits=3)
+    ref = convolve(u, taps)[: len(upsampled) : decimation]
+
+    fir = APyFixedFIR(taps, decimation=decimation, interpolation=interpolation)
+    blocks = _stream(fir, x, [4, 9, 1, 16])
+    n_terms = -(-len(taps_values) // interpolation)
+    pad_bits = (n_terms - 1).bit_length()
+    for block in blocks:
+        assert block.int_bits == 1 + 4 + pad_bits
+        assert block.frac_bits == 4 + 3
+    assert _concatenate(blocks) == list(ref)
+    assert fir.decimation == decimation
+    assert fir.interpolation == interpolation
+
+
+def test_fixed_fir_accumulator_context():
+    taps = APyFixedArray.from_float([0.3, -0.7, 0.2], int_bits=1, frac_bits=6)
+    x = APyFixedArray.from_float([0.5, -0.25, 0.9, 0.1, -0.8], int_bits=1, frac_bits=7)
+
+    with APyFixedAccumulatorContext(
+        int_bits=3, frac_bits=5, quantization=QuantizationMode.RND
+    ):
+        fir = APyFixedFIR(taps)
+        ref = convolve(x, taps)
+
+    # The context active on creation applies to all blocks
+    blocks = _stream(fir, x, [2, 3])
+    assert blocks[0].is_identical(ref[0:2])
+    assert blocks[1].is_identical(ref[2:5])
+
+
+def test_fir_reset():
+    taps = APyFixedArray.from_float([1, 2, 3], int_bits=3, frac_bits=0)
+    fir = APyFixedFIR(taps)
+    first = fir.process(APyFixedArray.from_float([1, 1], int_bits=4, frac_bits=0))
+    assert [float(v) for v in first] == [1, 3]
+
+    # Without reset, the delay line carries over
+    y = fir.process(APyFixedArray.from_float([0], int_bits=4, frac_bits=0))
+    assert [float(v) for v in y] == [5]
+
+    # After a reset, the stream starts over and the format may change
+    fir.reset()
+    y = fir.process(APyFixedArray.from_float([1, 1], int_bits=5, frac_bits=1))
+    assert [float(v) for v in y] == [1, 3]
+    assert (y.int_bits, y.frac_bits) == (10, 1)
+
+    assert fir.taps.is_identical(taps)
+
+
+def test_fir_raises():
+    taps = APyFixedArray.from_float([1, 2, 3], int_bits=3, frac_bits=0)
+    with pytest.raises(ValueError, match=r"APyFixedFIR: `taps` must be a non-empty"):
+        _ = APyFixedFIR(APyFixedArray.from_float([], int_bits=3, frac_bits=0))
+    with pytest.raises(ValueError, match=r"APyFixedFIR: `taps` must be a non-empty"):
+        _ = APyFixedFIR(APyFixedArray.from_float([[1]], int_bits=3, frac_bits=0))
+    with pytest.raises(ValueError, match=r"must be positive, got 0 and 1"):
+        _ = APyFixedFIR(taps, decimation=0)
+    with pytest.raises(ValueError, match=r"must be positive, got 1 and 0"):
+        _ = APyFixedFIR(taps, interpolation=0)
+
+    fir = APyFixedFIR(taps)
+    with pytest.raises(ValueError, match=r"input must be one-dimensional"):
+        _ = fir.process(APyFixedArray.from_float([[1]], int_bits=3, frac_bits=0))
+    _ = fir.process(APyFixedArray.from_float([1], int_bits=3, frac_bits=0))
+    with pytest.raises(ValueError, match=r"input format differs"):
+        _ = fir.process(APyFixedArray.from_float([1], int_bits=4, frac_bits=0))
+
+    fir = APyFloatFIR(APyFloatArray.from_float([1, 2], exp_bits=5, man_bits=2))
+    _ = fir.process(APyFloatArray.from_float([1], exp_bits=5, man_bits=2))
+    with pytest.raises(ValueError, match=r"APyFloatFIR.process: input format differs"):
+        _ = fir.process(APyFloatArray.from_float([1], exp_bits=5, man_bits=3))
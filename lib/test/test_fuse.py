@@ -0,0 +1,77 @@
+import pytest
+
+import apytypes as apy
+from apytypes import APyFixedArray, APyFloatArray, QuantizationMode
+
+
+def test_fixed_chain():
+    a = APyFixedArray.from_float([[x / 8 - 3 for x in range(50)]] * 3, 5, 4)
+    b = APyFixedArray.from_float([[x / 16 for x in range(50)]] * 3, 3, 6)
+    c = APyFixedArray.from_float([[1 - x / 4 for x in range(50)]] * 3, 7, 2)
+
+    ref = (a * b + c).cast(int_bits=6, frac_bits=3)
+    e = (apy.expr(a) * b + c).cast(int_bits=6, frac_bits=3)
+    for block_size in (1, 7, 64, 150, 4096):
+        assert e.evaluate(block_size=block_size).is_identical(ref)
+
+    # Reflected operators and scalars
+    ref = (2 - a) * 3 / b[0, 1] - abs(-c)
+    e = (2 - apy.expr(a)) * 3 / b[0, 1] - abs(-apy.expr(c))
+    assert e.evaluate(block_size=16).is_identical(ref)
+
+
+def test_float_chain():
+    a = APyFloatArray.from_float([x / 3 - 10 for x in range(100)], 5, 10)
+    b = APyFloatArray.from_float([x * 0.7 for x in range(100)], 8, 7)
+    c = APyFloatArray.from_float([1.5] * 100, 4, 3)
+
+    for qntz in (QuantizationMode.TIES_EVEN, QuantizationMode.TO_ZERO):
+        ref = (a * b - c).cast(exp_bits=4, man_bits=3, quantization=qntz)
+        e = (apy.expr(a) * b - c).cast(exp_bits=4, man_bits=3, quantization=qntz)
+        assert e.evaluate(block_size=9).is_identical(ref)
+
+
+def test_shared_subexpression_and_broadcasting():
+    a = APyFixedArray.from_float([[x - 5 for x in range(10)]] * 4, 6, 2)
+    row = APyFixedArray.from_float([[0.25 * x for x in range(10)]], 3, 3)
+    col = APyFixedArray.from_float([[1], [2], [3], [4]], 4, 0)
+
+    s = apy.expr(a) + row
+    e = s * s - col
+    ref = (a + row) * (a + row) - col
+    res = e.evaluate(block_size=3)
+    assert res.shape == (4, 10)
+    assert res.is_identical(ref)
+
+
+def test_broadcast_blocks():
+    a = APyFloatArray.from_float(
+        [[[i - j + 0.5 * k for k in range(7)] for j in range(5)] for i in range(3)], 6, 9
+    )
+    row = APyFloatArray.from_float([0.25 * k for k in range(7)], 5, 4)
+    col = APyFloatArray.from_float([[[1], [-2], [3], [0.5], [4]]], 7, 3)
+    ref = (a * row - col) * col + a
+    e = (apy.expr(a) * row - col) * col + a
+    for block_size in (1, 3, 7, 8, 20, 35, 36, 104):
+        res = e.evaluate(block_size=block_size)
+        assert res.shape == (3, 5, 7)
+        assert res.is_identical(ref)
+
+    # No operand has the full shape
+    ref = row * col
+    assert (apy.expr(row) * col).evaluate(block_size=4).is_identical(ref)
+
+
+def test_scalar_expression():
+    a = apy.fx(1.25, int_bits=3, frac_bits=2)
+    b = apy.fx(-0.5, int_bits=2, frac_bits=3)
+    assert (apy.expr(a) * b + a).evaluate().is_identical(a * b + a)
+
+
+def test_raises():
+    a = APyFixedArray.from_float([1, 2, 3], 4, 0)
+    b = APyFixedArray.from_float([1, 2], 4, 0)
+    with pytest.raises(ValueError, match=r"could not be broadcast"):
+        (apy.expr(a) + b).evaluate()
+    with pytest.raises(ValueError, match=r"`block_size` must be positive"):
+        (apy.expr(a) + a).evaluate(block_size=0)
@@ -0,0 +1,209 @@
+import random
+
+import pytest
+
+from apytypes import (
+    APyFixedArray,
+    APyFixedIIR,
+    APyFloatArray,
+    APyFloatIIR,
+    OverflowMode,
+    QuantizationMode,
+)
+
+
+def _quantize(v: int, shift: int, quantization: QuantizationMode) -> int:
+    floor, rem = v >> shift, v & ((1 << shift) - 1)
+    half = 1 << (shift - 1)
+    if quantization == QuantizationMode.TRN:
+        return floor
+    if quantization == QuantizationMode.RND:
+        return floor + (rem >= half)
+    if quantization == QuantizationMode.RND_CONV:
+        return floor + (rem > half or (rem == half and floor & 1))
+    raise ValueError(quantization)
+
+
+def _overflow(v: int, bits: int, overflow: OverflowMode) -> int:
+    if overflow == OverflowMode.SAT:
+        return max(-(1 << (bits - 1)), min((1 << (bits - 1)) - 1, v))
+    v &= (1 << bits) - 1
+    return v - (1 << bits) if v >> (bits - 1) else v
+
+
+def _signed(bits: int, width: int) -> int:
+    return bits - (1 << width) if bits >> (width - 1) else bits
+
+
+def _reference(x, x_frac_bits, sections):
+    """Direct form I cascade, computed exactly on integers and quantized once."""
+    signal, frac_bits = x, x_frac_bits
+    for coef, coef_frac_bits, bits, int_bits, quantization, overflow in sections:
+        out_frac_bits = bits - int_bits
+        acc_frac_bits = max(frac_bits, out_frac_bits) + coef_frac_bits
+        y = []
+        for t in range(len(signal)):
+            xs = [signal[t - k] if t >= k else 0 for k in range(3)]
+            ys = [y[t - k] if t >= k else 0 for k in (1, 2)]
+            ff = sum(b * v for b, v in zip(coef[0:3], xs, strict=True))
+            fb = sum(a * v for a, v in zip(coef[4:6], ys, strict=True))
+            acc = (ff << (acc_frac_bits - frac_bits - coef_frac_bits)) - (
+                fb << (acc_frac_bits - out_frac_bits - coef_frac_bits)
+            )
+            v = _quantize(acc, acc_frac_bits - out_frac_bits, quantization)
+            y.append(_overflow(v, bits, overflow))
+        signal, frac_bits = y, out_frac_bits
+    return signal
+
+
+@pytest.mark.parametrize(
+    "quantization",
+    [QuantizationMode.TRN, QuantizationMode.RND, QuantizationMode.RND_CONV],
+)
+@pytest.mark.parametrize("overflow", [OverflowMode.WRAP, OverflowMode.SAT])
+@pytest.mark.parametrize("wide", [False, True])
+def test_fixed_iir_matches_reference(quantization, overflow, wide: bool):
+    rng = random.Random(int(wide))
+    coef_bits, coef_int_bits = (70, 3) if wide else (10, 3)
+    x_bits, x_int_bits = (80, 10) if wide else (8, 2)
+    formats = [(90, 12), (66, 6)] if wide else [(12, 4), (9, 3)]
+
+    sections, sos = [], []
+    for bits, int_bits in formats:
+        bound = 1 << (coef_bits - 2)
+        coef = [rng.randint(-bound, bound) for _ in range(6)]
+        coef[3] = 1 << (coef_bits - coef_int_bits)
+        sections.append(
+            (coef, coef_bits - coef_int_bits, bits, int_bits, quantization, overflow)
+        )
+        sos.append(
+            APyFixedArray(
+                [c % (1 << coef_bits) for c in coef],
+                int_bits=coef_int_bits,
+                frac_bits=coef_bits - coef_int_bits,
+            )
+        )
+
+    x = [rng.randint(-(1 << (x_bits - 1)), (1 << (x_bits - 1)) - 1) for _ in range(25)]
+    ref = _reference(x, x_bits - x_int_bits, sections)
+
+    iir = APyFixedIIR(
+        sos,
+        int_bits=[f[1] for f in formats],
+        frac_bits=[f[0] - f[1] for f in formats],
+        quantization=quantization,
+        overflow=overflow,
+    )
+    assert iir.n_sections == 2
+    x = APyFixedArray(
+        [v % (1 << x_bits) for v in x],
+        int_bits=x_int_bits,
+        frac_bits=x_bits - x_int_bits,
+    )
+    y, start = [], 0
+    for size in [1, 6, 0, 11, 7]:
+        block = iir.process(x[start : start + size])
+        assert (block.bits, block.int_bits) == formats[-1]
+        y += [_signed(v, block.bits) for v in block.to_bits()]
+        start += size
+    assert y == ref
+
+
+def test_fixed_iir_channels():
+    sos = APyFixedArray.from_float(
+        [[0.5, 0.25, 0, 1, -0.75, 0.25], [1, -1, 0.5, 1, 0.5, 0]],
+        int_bits=3,
+        frac_bits=4,
+    )
+    rng = random.Random(1)
+    values = [[rng.randint(-32, 31) / 8 for _ in range(20)] for _ in range(3)]
+    x = APyFixedArray.from_float(values, int_bits=3, frac_bits=3)
+
+    whole = APyFixedIIR(sos, int_bits=5, frac_bits=6).process(x)
+    assert whole.shape == (3, 20)
+
+    # Each row is an independent channel
+    for c in range(3):
+        row = APyFixedIIR(sos, int_bits=5, frac_bits=6).process(x[c])
+        assert row.is_identical(whole[c])
+
+    # Filtering along axis 0 of the transpose, in blocks, gives the same result
+    iir = APyFixedIIR(sos, int_bits=5, frac_bits=6)
+    first = iir.process(x.T[0:8], axis=0)
+    second = iir.process(x.T[8:20], axis=0)
+    assert first.is_identical(whole.T[0:8])
+    assert second.is_identical(whole.T[8:20])
+
+
+def test_float_iir():
+    # With small integer values, all sums are exact
+    sos = APyFloatArray.from_float([[1, 2, 1, 1, -1, 0]], exp_bits=5, man_bits=4)
+    x = APyFloatArray.from_float([1, 0, -2, 3, 0, 0, 1], exp_bits=5, man_bits=4)
+    ref, y = [], 0
+    xs = [0, 0, *(float(v) for v in x)]
+    for t in range(2, len(xs)):
+        y = xs[t] + 2 * xs[t - 1] + xs[t - 2] + y
+        ref.append(y)
+
+    iir = APyFloatIIR(sos, exp_bits=8, man_bits=12)
+    first = iir.process(x[0:3])
+    second = iir.process(x[3:7])
+    assert (first.exp_bits, first.man_bits, first.bias) == (8, 12, 127)
+    assert [float(v) for v in [*first, *second]] == ref
+
+    # Rounding to a short mantissa happens in each section
+    iir = APyFloatIIR([sos[0], sos[0]], exp_bits=[8, 6], man_bits=[12, 2])
+    y = iir.process(x)
+    assert (y.exp_bits, y.man_bits) == (6, 2)
+    assert iir.n_sections == 2
+
+
+def test_iir_reset():
+    sos = APyFixedArray.from_float([[1, 0, 0, 1, -1, 0]], int_bits=2, frac_bits=0)
+    iir = APyFixedIIR(sos, int_bits=6, frac_bits=0)
+    x = APyFixedArray.from_float([1, 1], int_bits=3, frac_bits=0)
+    assert [float(v) for v in iir.process(x)] == [1, 2]
+    assert [float(v) for v in iir.process(x)] == [3, 4]
+
+    # After a reset, the stream starts over and the format may change
+    iir.reset()
+    y = iir.process(APyFixedArray.from_float([[1, 1]], int_bits=4, frac_bits=1))
+    assert y.shape == (1, 2)
+    assert [float(v) for v in y[0]] == [1, 2]
+
+
+def test_iir_raises():
+    sos = APyFixedArray.from_float([[1, 0, 0, 1, 0, 0]], int_bits=3, frac_bits=0)
+    with pytest.raises(ValueError, match=r"`sos` must have shape \(n_sections, 6\)"):
+        _ = APyFixedIIR(sos[0], int_bits=3, frac_bits=0)
+    with pytest.raises(ValueError, match=r"section 0 must have shape \(6,\)"):
+        _ = APyFixedIIR([sos], int_bits=3, frac_bits=0)
+    with pytest.raises(ValueError, match=r"must have at least one section"):
+        _ = APyFixedIIR([], int_bits=3, frac_bits=0)
+    with pytest.raises(ValueError, match=r"coefficient `a0` of section 0 must be one"):
+        _ = APyFixedIIR(
+            APyFixedArray.from_float([[1, 0, 0, 2, 0, 0]], int_bits=3, frac_bits=0),
+            int_bits=3,
+            frac_bits=0,
+        )
+    with pytest.raises(ValueError, match=r"`int_bits` has 2 values, but the filter"):
+        _ = APyFixedIIR(sos, int_bits=[3, 3], frac_bits=0)
+    with pytest.raises(ValueError, match=r"non-positive number of bits"):
+        _ = APyFixedIIR(sos, int_bits=-3, frac_bits=0)
+
+    iir = APyFixedIIR(sos, int_bits=3, frac_bits=0)
+    x = APyFixedArray.from_float([1], int_bits=3, frac_bits=0)
+    with pytest.raises(IndexError, match=r"APyFixedIIR.process: axis 1 out of range"):
+        _ = iir.process(x, axis=1)
+    _ = iir.process(x)
+    with pytest.raises(ValueError, match=r"input format or channel shape differs"):
+        _ = iir.process(APyFixedArray.from_float([1], int_bits=4, frac_bits=0))
+    with pytest.raises(ValueError, match=r"input format or channel shape differs"):
+        _ = iir.process(APyFixedArray.from_float([[1]], int_bits=3, frac_bits=0))
+
+    with pytest.raises(ValueError, match=r"APyFloatIIR"):
+        _ = APyFloatIIR(
+            APyFloatArray.from_float([1, 0, 0, 1, 0, 0], exp_bits=5, man_bits=2),
+            exp_bits=5,
+            man_bits=2,
+        )
@@ -122,3 +122,51 @@ def test_pickle_apyfloatarray(
     )
     pickle_and_writefile(fp_ref, filepath)
     unpickle_and_assert_identical(fp_ref, filepath)
+
+
+PROTOCOL_5_ARRAYS = [
+    APyFixedArray.from_float([[1.25, -0.5, 3.0], [-2.75, 0.0, 7.5]], 5, 3),
+    APyFixedArray.from_float([1e20, -3.125, 1 / 3], 80, 50),
+    APyFixedArray.from_float([-1.0, 2.5, -0.25], 20, 80),
+    APyFixedArray.zeros((2, 0), int_bits=10, frac_bits=2),
+    APyCFixedArray.from_complex([[1 + 2j, -0.5j], [3.25, -1 - 1j]], 6, 2),
+    APyCFixedArray.from_complex([1e15 - 2j, 0.125j, -7], 70, 30),
+    APyFloatArray.from_float([[1.5, -0.0, float("inf")], [1e-8, 3, -2]], 5, 6),
+    APyFloatArray.from_float([1.0, -2.5, 1e300], 11, 52, 1000),
+    APyCFloatArray.from_complex([1 + 2j, -0.5j, float("inf")], 8, 23),
+]
+
+
+@pytest.mark.parametrize("a", PROTOCOL_5_ARRAYS)
+def test_pickle_protocol_5(a):
+    # In-band
+    b = pickle.loads(pickle.dumps(a, protocol=5))
+    assert type(b) is type(a)
+    assert b.is_identical(a)
+
+    # Out-of-band
+    buffers = []
+    data = pickle.dumps(a, protocol=5, buffer_callback=buffers.append)
+    assert len(buffers) == 1
+    b = pickle.loads(data, buffers=buffers)
+    assert type(b) is type(a)
+    assert b.is_identical(a)
+
+
+def test_pickle_protocol_5_out_of_band():
+    a = APyFixedArray.from_float([i / 4 for i in range(100_000)], 20, 2)
+
+    # The data is not serialized into the pickle stream
+    buffers = []
+    data = pickle.dumps(a, protocol=5, buffer_callback=buffers.append)
+    assert len(data) < 1000
+    assert memoryview(buffers[0]).nbytes == 8 * 100_000
+
+    # The buffer is a snapshot, unaffected by modifications of the array
+    b = a.copy()
+    a[0] = APyFixed.from_float(1000, int_bits=20, frac_bits=2)
+    assert pickle.loads(data, buffers=buffers).is_identical(b)
+
+    # Older protocols are unaffected
+    for protocol in (2, 3, 4):
+        assert pickle.loads(pickle.dumps(b, protocol=protocol)).is_identical(b)
@@ -0,0 +1,79 @@
+import pathlib
+
+import pytest
+
+import apytypes as apy
+from apytypes import APyCFixedArray, APyCFloatArray, APyFixedArray, APyFloatArray
+
+ARRAYS = [
+    APyFixedArray.from_float([[1.25, -0.5, 3.0], [-2.75, 0.0, 7.5]], 5, 3),
+    APyFixedArray.from_float([1e20, -3.125, 1 / 3], 80, 50),
+    APyFixedArray.from_float([-1.0, 2.5, -0.25], 20, 80),
+    APyCFixedArray.from_complex([[1 + 2j, -0.5j], [3.25, -1 - 1j]], 6, 2),
+    APyCFixedArray.from_complex([1e15 - 2j, 0.125j, -7], 70, 30),
+    APyFloatArray.from_float(
+        [[1.5, -0.0, float("inf")], [float("nan"), 1e-8, 3]], 5, 6
+    ),
+    APyFloatArray.from_float([1.0, -2.5, 1e300], 11, 52, 1000),
+    APyCFloatArray.from_complex([1 + 2j, -0.5j, float("inf")], 8, 23),
+]
+
+
+@pytest.mark.parametrize("a", ARRAYS)
+def test_save_load(tmp_path: pathlib.Path, a):
+    fname = tmp_path / "array.apy"
+    apy.save(fname, a)
+    b = apy.load(fname)
+    assert type(b) is type(a)
+    assert b.is_identical(a)
+
+
+def test_save_load_large(tmp_path: pathlib.Path):
+    fname = tmp_path / "array.apy"
+    a = APyFixedArray.from_float([(i % 2000) / 8 - 125 for i in range(100_000)], 9, 3)
+    a = a.reshape((100, 1000))
+    apy.save(fname, a)
+    assert apy.load(fname).is_identical(a)
+
+    f = APyFloatArray.from_float([i / 7 for i in range(100_000)], 8, 23)
+    apy.save(fname, f)
+    assert apy.load(fname).is_identical(f)
+
+
+def test_save_load_payload_alignment(tmp_path: pathlib.Path):
+    fname = tmp_path / "array.apy"
+    a = APyFixedArray.from_float([1, 2, 3], 10, 0)
+    apy.save(fname, a)
+    data = fname.read_bytes()
+    assert (len(data) - 24) % 64 == 0
+    assert data[-24:] == bytes([1] + [0] * 7 + [2] + [0] * 7 + [3] + [0] * 7)
+
+
+def test_save_load_payload_words(tmp_path: pathlib.Path):
+    # Each value is sign-extended to whole 64-bit words, independent of the limb size
+    fname = tmp_path / "array.apy"
+    a = APyCFixedArray.from_complex([-1 + 2j], 10, 0)
+    apy.save(fname, a)
+    assert fname.read_bytes()[-16:] == bytes([0xFF] * 8 + [2] + [0] * 7)
+
+    a = APyFixedArray.from_float([-1, 3], 70, 0)
+    apy.save(fname, a)
+    data = fname.read_bytes()
+    assert data[-32:] == bytes([0xFF] * 16 + [3] + [0] * 15)
+    assert apy.load(fname).is_identical(a)
+
+
+def test_load_raises(tmp_path: pathlib.Path):
+    fname = tmp_path / "array.apy"
+    fname.write_bytes(b"not an apytypes file")
+    with pytest.raises(ValueError, match=r"is not an APyTypes binary file"):
+        apy.load(fname)
+
+    a = APyFixedArray.from_float([1, 2, 3], 10, 0)
+    apy.save(fname, a)
+    fname.write_bytes(fname.read_bytes()[:-8])
+    with pytest.raises(ValueError, match=r"expected a payload of 24 bytes, got 16"):
+        apy.load(fname)
+
+    with pytest.raises(TypeError, match=r"save: unsupported type"):
+        apy.save(fname, [1, 2, 3])
@@ -452,3 +452,50 @@ def test_set_item_ndarray_raises(
     msg_re = r"APyC?F[ixedloat]+Array\.__setitem__: boolean key ndim = 0"
     with pytest.raises(IndexError, match=msg_re):
         array[np.array(None, dtype=bool)] = APyArray.from_float([0], wl_arg1, wl_arg2)
+
+
+@pytest.mark.parametrize(
+    ("APyArray", "APyScalar"),
+    [
+        (APyFixedArray, APyFixed),
+        (APyCFixedArray, APyCFixed),
+        (APyFloatArray, APyFloat),
+        (APyCFloatArray, APyCFloat),
+    ],
+)
+def test_set_item_shared_data(
+    APyArray: type[APyCFixedArray], APyScalar: type[APyCFixed]
+):
+    # Slices, reshapes, and copies may share data with their source until mutated.
+    # Mutating either of them must never be visible in the other.
+    array = APyArray.from_float([[1, 2, 3], [4, 5, 6], [7, 8, 9]], 10, 10)
+    zero = APyScalar.from_float(0, 10, 10)
+    ref = APyArray.from_float([[1, 2, 3], [4, 5, 6], [7, 8, 9]], 10, 10)
+
+    row = array[1]
+    rows = array[1:, :]
+    flat = array.reshape((9,))
+    squeezed = array[2:3].squeeze()
+    assert row.is_identical(APyArray.from_float([4, 5, 6], 10, 10))
+    assert rows.is_identical(APyArray.from_float([[4, 5, 6], [7, 8, 9]], 10, 10))
+    assert squeezed.is_identical(APyArray.from_float([7, 8, 9], 10, 10))
+
+    row[0] = zero
+    assert array.is_identical(ref)
+    assert rows.is_identical(APyArray.from_float([[4, 5, 6], [7, 8, 9]], 10, 10))
+    assert row.is_identical(APyArray.from_float([0, 5, 6], 10, 10))
+
+    array[2, 2] = zero
+    assert rows.is_identical(APyArray.from_float([[4, 5, 6], [7, 8, 9]], 10, 10))
+    assert flat.is_identical(APyArray.from_float(list(range(1, 10)), 10, 10))
+    assert squeezed.is_identical(APyArray.from_float([7, 8, 9], 10, 10))
+
+    flat[4] = zero
+    assert array.is_identical(
+        APyArray.from_float([[1, 2, 3], [4, 5, 6], [7, 8, 0]], 10, 10)
+    )
+
+    # Non-contiguous slices
+    assert array[:, 1].is_identical(APyArray.from_float([2, 5, 8], 10, 10))
+    assert array[::2, 1:].is_identical(APyArray.from_float([[2, 3], [8, 0]], 10, 10))
+    assert array[::-1][0].is_identical(APyArray.from_float([7, 8, 0], 10, 10))
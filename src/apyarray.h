@@ -7,32 +7,43 @@
 #define _APYARRAY_H
 
 #include "apybuffer.h"
+#include "apytypes_common.h"
 #include "apytypes_fwd.h"
 #include "apytypes_util.h"
 #include "array_utils.h"
 #include "broadcast.h"
 #include "fmt/format.h"
+#include "ieee754.h"
 
 // Python object access through Nanobind
 #include <nanobind/nanobind.h>
-#include <nanobind/ndarray.h>     // nanobind::ndarray
-#include <nanobind/stl/string.h>  // std::string (with nanobind support)
-#include <nanobind/stl/variant.h> // std::variant (with nanobind support)
-#include <nanobind/stl/vector.h>  // std::vector (with nanobind support)
+#include <nanobind/ndarray.h>       // nanobind::ndarray
+#include <nanobind/stl/optional.h>  // std::optional (with nanobind support)
+#include <nanobind/stl/string.h>    // std::string (with nanobind support)
+#include <nanobind/stl/tuple.h>     // std::tuple (with nanobind support)
+#include <nanobind/stl/variant.h>   // std::variant (with nanobind support)
+#include <nanobind/stl/vector.h>    // std::vector (with nanobind support)
 namespace nb = nanobind;
 
 #include <algorithm>   // std::min_element
 #include <cassert>     // assert
+#include <complex>     // std::complex
 #include <cstddef>     // std::size_t
+#include <cstdint>     // std::int64_t, std::uint64_t, etc...
 #include <functional>  // std::function, std::bind
 #include <iterator>    // std::begin
 #include <optional>    // std::optional
 #include <set>         // std::set
 #include <string>      // std::string
 #include <string_view> // std::string_view
+#include <tuple>       // std::tuple
+#include <type_traits> // std::conditional_t, std::make_signed_t
 #include <utility>     // std::in_place_type
 #include <variant>     // std::variant
 
+//! Floating-point precision of NumPy arrays returned by `to_numpy`
+enum class NumPyFloat { FLOAT16, FLOAT32, FLOAT64 };
+
 /*!
  * APyArray, base class for APyTypes array
  */
@@ -181,6 +192,18 @@ public:
         return cpp_tuple;
     }
 
+    //! Return an array of shape `shape` whose data is the contiguous range of
+    //! elements in `*this` starting at element `elem_offset`. The data is shared with
+    //! `*this` until either array is mutated.
+    ARRAY_TYPE
+    make_view(std::size_t elem_offset, const std::vector<std::size_t>& shape) const
+    {
+        std::size_t nitems = fold_shape(shape);
+        return static_cast<const ARRAY_TYPE*>(this)->create_array(
+            shape, _data.view(elem_offset * _itemsize, nitems * _itemsize)
+        );
+    }
+
     //! Return item from integer index
     std::variant<ARRAY_TYPE, scalar_variant_t<ARRAY_TYPE>>
     get_item_integer(std::ptrdiff_t idx) const
@@ -203,10 +226,8 @@ public:
             // Element stride is the new shape folded over multiplication
             std::size_t element_stride = fold_shape(new_shape);
 
-            ARRAY_TYPE result
-                = static_cast<const ARRAY_TYPE*>(this)->create_array(new_shape);
-            auto src = std::begin(_data) + idx * _itemsize * element_stride;
-            std::copy_n(src, _itemsize * element_stride, std::begin(result._data));
+            // The sub-array is contiguous in `*this`, return a view of it
+            ARRAY_TYPE result = make_view(idx * element_stride, new_shape);
             return RESULT_TYPE(std::in_place_type<ARRAY_TYPE>, result);
         }
     }
@@ -301,6 +322,45 @@ public:
         }
     }
 
+    //! If the items selected by `tuple` form a contiguous range of elements in
+    //! `*this`, return the element offset of that range. This is the case when `tuple`
+    //! is a sequence of integers, optionally followed by one slice with unit step,
+    //! followed only by slices spanning their full dimension.
+    std::optional<std::size_t> contiguous_slice_offset(
+        const std::vector<std::variant<nb::int_, nb::slice>>& tuple,
+        const std::vector<std::size_t>& strides
+    ) const
+    {
+        std::size_t offset = 0;
+        std::size_t dim = 0;
+        for (; dim < tuple.size() && std::holds_alternative<nb::int_>(tuple[dim]);
+             dim++) {
+            auto idx = static_cast<std::ptrdiff_t>(std::get<nb::int_>(tuple[dim]));
+            idx = adjust_integer_index(idx, dim, "__getitem__");
+            offset += idx * strides[dim];
+        }
+        if (dim < tuple.size()) {
+            auto [start, stop, step, len] = std::get<nb::slice>(tuple[dim]).compute(
+                _shape[dim]
+            );
+            if (step != 1 && len > 1) {
+                return std::nullopt;
+            }
+            offset += len ? start * strides[dim] : 0;
+            for (dim++; dim < tuple.size(); dim++) {
+                if (std::holds_alternative<nb::int_>(tuple[dim])) {
+                    return std::nullopt;
+                }
+                auto&& slice = std::get<nb::slice>(tuple[dim]);
+                auto [start, stop, step, len] = slice.compute(_shape[dim]);
+                if (len != _shape[dim] || (step != 1 && len > 1)) {
+                    return std::nullopt;
+                }
+            }
+        }
+        return offset;
+    }
+
     //! Return item(s) from a `std::vector` of `nb::int_` and `nb::slice`. Assumes
     //! that `tuple.size() <= _shape.size()`.
     std::variant<ARRAY_TYPE, scalar_variant_t<ARRAY_TYPE>>
@@ -340,6 +400,11 @@ public:
             /*
              * The result is an array
              */
+            if (auto offset = contiguous_slice_offset(tuple, strides)) {
+                ARRAY_TYPE result = make_view(*offset, result_shape);
+                return RESULT_TYPE(std::in_place_type<ARRAY_TYPE>, result);
+            }
+
             ARRAY_TYPE result
                 = static_cast<const ARRAY_TYPE*>(this)->create_array(result_shape);
 
@@ -873,6 +938,10 @@ public:
             throw nb::value_error(error_msg.c_str());
         }
 
+        if (shape == _shape) {
+            return *static_cast<const ARRAY_TYPE*>(this);
+        }
+
         ARRAY_TYPE result = static_cast<const ARRAY_TYPE*>(this)->create_array(shape);
         broadcast_data_copy(
             _data.begin(), result._data.begin(), _shape, shape, _itemsize
@@ -988,16 +1057,12 @@ public:
         return new_shape_vec;
     }
 
-    //! Return a copy of `*this`, reshaped to `shape`. The returned array will have
-    //! exactly the same data as `*this` but with another shape.
+    //! Return `*this`, reshaped to `shape`. The returned array shares the data of
+    //! `*this` until either array is mutated.
     ARRAY_TYPE reshape(const nb::tuple& shape) const
     {
         std::vector<std::size_t> cpp_shape = try_reshape(shape);
-        ARRAY_TYPE result
-            = static_cast<const ARRAY_TYPE*>(this)->create_array(cpp_shape);
-        std::copy_n(_data.begin(), _data.size(), result._data.begin());
-
-        return result;
+        return make_view(0, cpp_shape);
     }
 
     //! Python exported `reshape` method
@@ -1134,10 +1199,8 @@ public:
             shape = { 1 };
         }
 
-        // Create resulting array and copy the data
-        ARRAY_TYPE result = static_cast<const ARRAY_TYPE*>(this)->create_array(shape);
-        std::copy_n(_data.begin(), _data.size(), result._data.begin());
-        return result;
+        // Create resulting array sharing the data of `*this`
+        return make_view(0, shape);
     }
 
     //! Python exported `swapaxes` method
@@ -1149,6 +1212,11 @@ public:
         std::vector<std::size_t> new_axis(_ndim);
         std::iota(new_axis.begin(), new_axis.end(), 0);
 
+        // Swapping an axis with itself, or two unit-length axes, does not move any data
+        if (_axis1 == _axis2 || (_shape[_axis1] == 1 && _shape[_axis2] == 1)) {
+            return *static_cast<const ARRAY_TYPE*>(this);
+        }
+
         // Swap the specified axes
         std::swap(new_axis[_axis1], new_axis[_axis2]);
 
@@ -1517,45 +1585,63 @@ public:
      * *                       Array string-formatting functions                    * *
      * ****************************************************************************** */
 public:
-    //! Formatter function signature
-    using formatter_t = std::function<std::string(
-        typename vector_type::const_iterator, typename vector_type::const_iterator
+    //! Formatter function signature. The formatter appends the text of one element to
+    //! its last argument.
+    using formatter_t = std::function<void(
+        typename vector_type::const_iterator,
+        typename vector_type::const_iterator,
+        std::string&
     )>;
 
 private:
-    //! Return the padding needed to display the widest (in terms of number of `char`
-    //! characters) in `*this` array.
-    std::size_t _array_format_get_padding(formatter_t formatter) const
+    //! Format all elements of `*this` using `formatter`, back-to-back into a single
+    //! buffer. Returns the buffer and the end offset of each element in it.
+    std::tuple<std::string, std::vector<std::size_t>>
+    _array_format_apply_formatter(const formatter_t& formatter) const
     {
-        std::size_t padding = 0;
+        std::string text;
+        text.reserve(8 * _nitems);
+        std::vector<std::size_t> ends(_nitems);
         for (std::size_t i = 0; i < _nitems; i++) {
-            auto cbegin_it = std::cbegin(_data) + (i + 0) * _itemsize;
-            auto cend_it = std::cbegin(_data) + (i + 1) * _itemsize;
-            padding = std::max(padding, formatter(cbegin_it, cend_it).length());
+            auto cbegin = std::cbegin(_data) + (i + 0) * _itemsize;
+            auto cend = std::cbegin(_data) + (i + 1) * _itemsize;
+            formatter(cbegin, cend, text);
+            ends[i] = text.size();
         }
-        return padding;
+        return std::make_tuple(std::move(text), std::move(ends));
     }
 
-    //! Return a `std::vector<std::string>` of all elements in this vector formatted
-    //! using `formatter`. All elements are right-padded and are equally long
-    std::vector<std::string>
-    _array_format_apply_formatter(formatter_t formatter, std::size_t padding) const
+    //! Return the number of characters of the widest element in `ends`
+    static std::size_t _array_format_get_padding(const std::vector<std::size_t>& ends)
     {
-        // Apply formatter to each element
-        std::vector<std::string> result(_nitems);
-        for (std::size_t i = 0; i < _nitems; i++) {
-            auto cbegin = std::cbegin(_data) + (i + 0) * _itemsize;
-            auto cend = std::cbegin(_data) + (i + 1) * _itemsize;
-            result[i] = fmt::format("{:>{}}", formatter(cbegin, cend), padding);
+        std::size_t padding = 0;
+        for (std::size_t i = 0, begin = 0; i < ends.size(); begin = ends[i++]) {
+            padding = std::max(padding, ends[i] - begin);
         }
+        return padding;
+    }
 
-        return result;
+    //! Return the elements in `text` right-aligned in cells of `padding` characters,
+    //! stored back-to-back in a single buffer
+    static std::string _array_format_pad(
+        const std::string& text,
+        const std::vector<std::size_t>& ends,
+        std::size_t padding
+    )
+    {
+        std::string cells(ends.size() * padding, ' ');
+        for (std::size_t i = 0, begin = 0; i < ends.size(); begin = ends[i++]) {
+            const std::size_t length = ends[i] - begin;
+            text.copy(cells.data() + (i + 1) * padding - length, length, begin);
+        }
+        return cells;
     }
 
-    //! Array formatting heavy-lifting through recursive descending through the axes
+    //! Array formatting heavy-lifting through recursive descending through the axes.
+    //! The elements are read from the `width`-character cells starting at `cbegin`.
     std::vector<std::string> _array_format_recursive_descent(
-        typename std::vector<std::string>::const_iterator cbegin,
-        formatter_t fmt_f,
+        const char* cbegin,
+        std::size_t width,
         std::size_t axis,
         const std::string& indent,
         std::size_t n_cols,
@@ -1572,6 +1658,10 @@ private:
         std::size_t leading_items = is_summary_dim ? edge_items : 0;
         std::size_t trailing_items = is_summary_dim ? edge_items : _shape[axis];
 
+        const auto cell = [&](std::size_t i) {
+            return std::string_view(cbegin + i * width, width);
+        };
+
         bool is_innermost_dim = (axis + 1 == _ndim);
         if (is_innermost_dim) {
             std::vector<std::string> result = { "[" };
@@ -1581,11 +1671,10 @@ private:
                 if (is_insert_newline) {
                     result.emplace_back(" ");
                 }
-                result.back() += cbegin[i] + ", ";
+                result.back().append(cell(i)).append(", ");
             }
             if (leading_items) {
-                std::size_t ljust = cbegin[0].length();
-                result.back() += fmt::format("{:>{}}, ", summary_sep, ljust);
+                result.back() += fmt::format("{:>{}}, ", summary_sep, width);
                 col_cnt++;
             }
             for (std::size_t i = 0; i < trailing_items; i++, col_cnt++) {
@@ -1594,7 +1683,7 @@ private:
                 if (is_insert_newline) {
                     result.emplace_back(" ");
                 }
-                result.back() += cbegin[i + _shape[axis] - trailing_items];
+                result.back().append(cell(i + _shape[axis] - trailing_items));
                 if (is_insert_comma) {
                     result.back() += ", ";
                 }
@@ -1607,9 +1696,9 @@ private:
                 = fold_shape(std::begin(_shape) + axis + 1, std::end(_shape));
 
             for (std::size_t i = 0; i < leading_items; i++) {
-                auto cnext = cbegin + (i * axis_nitems);
+                auto cnext = cbegin + (i * axis_nitems) * width;
                 std::vector<std::string> lines = _array_format_recursive_descent(
-                    cnext, fmt_f, axis + 1, indent + ' ', n_cols, is_summary, edge_items
+                    cnext, width, axis + 1, indent + ' ', n_cols, is_summary, edge_items
                 );
                 for (std::size_t j = 0; j < lines.size(); j++) {
                     const char prefix_char = (i == 0 && j == 0) ? '[' : ' ';
@@ -1630,9 +1719,9 @@ private:
             }
             for (std::size_t i = 0; i < trailing_items; i++) {
                 auto offset = (i + _shape[axis] - trailing_items) * axis_nitems;
-                auto cnext = cbegin + offset;
+                auto cnext = cbegin + offset * width;
                 std::vector<std::string> lines = _array_format_recursive_descent(
-                    cnext, fmt_f, axis + 1, indent + ' ', n_cols, is_summary, edge_items
+                    cnext, width, axis + 1, indent + ' ', n_cols, is_summary, edge_items
                 );
                 for (std::size_t j = 0; j < lines.size(); j++) {
                     const char prefix_char = (offset == 0 && j == 0) ? '[' : ' ';
@@ -1675,23 +1764,25 @@ public:
             return std::make_tuple(VEC_T(formatters.size(), { brackets }), 2 * _ndim);
         }
 
-        // Return necessary padding of elements
+        // Apply formatter to each element, once, and return necessary padding of
+        // elements
+        std::vector<std::tuple<std::string, std::vector<std::size_t>>> texts {};
         std::size_t padding = 0;
         for (auto&& formatter : formatters) {
-            padding = std::max(padding, _array_format_get_padding(formatter));
+            texts.emplace_back(_array_format_apply_formatter(formatter));
+            const std::vector<std::size_t>& ends = std::get<1>(texts.back());
+            padding = std::max(padding, _array_format_get_padding(ends));
         }
 
-        // Apply formatter to each element (each format has length `elements_formatted`)
-        std::vector<std::vector<std::string>> formats {};
-        for (auto&& formatter : formatters) {
-            auto format = _array_format_apply_formatter(formatter, padding);
-            assert(format.size() == _nitems);
-            formats.emplace_back(std::move(format));
+        // Right-align each element in cells of equal width
+        std::vector<std::string> formats {};
+        for (auto&& [text, ends] : texts) {
+            formats.emplace_back(_array_format_pad(text, ends, padding));
         }
         assert(formats.size() == formatters.size());
 
         // Determine number of elements to display on each line (number of columns)
-        std::size_t element_width = formats[0][0].length();
+        std::size_t element_width = padding;
         assert(element_width > 0);
 
         // Determine if summary view should be used
@@ -1707,10 +1798,9 @@ public:
         std::size_t format_len = 0;
         std::vector<std::vector<std::string>> result;
         for (std::size_t i = 0; i < formatters.size(); i++) {
-            auto&& formatter = formatters[i];
             std::vector<std::string> format_lines = _array_format_recursive_descent(
-                std::cbegin(formats[i]),
-                formatter,
+                formats[i].data(),
+                element_width,
                 0,
                 std::string(" "),
                 n_cols,
@@ -1951,6 +2041,460 @@ public:
         return nb::ndarray<CXX_TYPE>(data, _ndim, _shape.data(), owner);
     }
 
+    //! Maximum number of items passed to the block converter of `to_ndarray_blocked`
+    static constexpr std::size_t TO_NDARRAY_BLOCK_SIZE = 256;
+
+    /*!
+     * Convert array into a NumPy `ndarray` of `CXX_TYPE` items with data type `dtype`.
+     * Items `[begin, end)` are converted into `dst` by calling
+     * `convert_block(begin, end, dst)`, at most `TO_NDARRAY_BLOCK_SIZE` items at a
+     * time. Large arrays are converted on the thread pool, so `convert_block` must be
+     * thread-safe and must not throw.
+     */
+    template <typename CXX_TYPE, typename BLOCK_CONVERTER>
+    nb::ndarray<nb::numpy> to_ndarray_blocked(
+        const BLOCK_CONVERTER& convert_block,
+        std::string_view raises_func_name,
+        std::optional<bool> copy = std::nullopt,
+        nb::dlpack::dtype dtype = nb::dtype<CXX_TYPE>()
+    ) const
+    {
+        if (!copy.value_or(true)) {
+            std::string err_msg = fmt::format(
+                "{}.{}: APyTypes arrays can only be copied",
+                ARRAY_TYPE::ARRAY_NAME,
+                raises_func_name
+            );
+            throw nb::value_error(err_msg.c_str());
+        }
+
+        // Dynamically allocate data to be passed to Python
+        CXX_TYPE* data = new CXX_TYPE[_nitems];
+
+        // Convert all internal data, one block at a time
+        const ARRAY_TYPE& self = *static_cast<const ARRAY_TYPE*>(this);
+        const bool use_threadpool
+            = self.is_elementwise_with_threadpool_justified(_nitems);
+        threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+            for (std::size_t i = begin; i < end; i += TO_NDARRAY_BLOCK_SIZE) {
+                const std::size_t n = std::min(TO_NDARRAY_BLOCK_SIZE, end - i);
+                convert_block(i, i + n, data + i);
+            }
+        });
+
+        // Delete `data` when the owner Python capsule expires
+        nb::capsule owner(data, [](void* p) noexcept { delete[] (CXX_TYPE*)p; });
+
+        return nb::ndarray<nb::numpy>(
+            data, _ndim, _shape.data(), owner, /*strides=*/nullptr, dtype
+        );
+    }
+
+    /*!
+     * Convert array into a NumPy `ndarray` with the floating-point precision of the
+     * `dtype` argument of `to_numpy`. Items `[begin, end)` are converted by calling
+     * `convert_block(begin, end, dst)`, where `dst` points to `double`, `float`, or
+     * half-precision bit patterns in `std::uint16_t`. For complex-valued arrays, the
+     * real and imaginary parts are interleaved in `dst`, and single precision is used
+     * in place of half precision, which NumPy does not support for complex numbers.
+     */
+    template <bool IS_COMPLEX, typename BLOCK_CONVERTER>
+    nb::ndarray<nb::numpy> to_numpy_floats(
+        const BLOCK_CONVERTER& convert_block,
+        const std::optional<nb::object>& dtype,
+        std::optional<bool> copy
+    ) const
+    {
+        const NumPyFloat precision = numpy_float_from_dtype(dtype);
+        if constexpr (IS_COMPLEX) {
+            if (precision == NumPyFloat::FLOAT64) {
+                using complex_t = std::complex<double>;
+                const auto convert = [&](auto begin, auto end, complex_t* dst) {
+                    convert_block(begin, end, reinterpret_cast<double*>(dst));
+                };
+                return to_ndarray_blocked<complex_t>(convert, "to_numpy", copy);
+            } else {
+                using complex_t = std::complex<float>;
+                const auto convert = [&](auto begin, auto end, complex_t* dst) {
+                    convert_block(begin, end, reinterpret_cast<float*>(dst));
+                };
+                return to_ndarray_blocked<complex_t>(convert, "to_numpy", copy);
+            }
+        } else {
+            switch (precision) {
+            case NumPyFloat::FLOAT16:
+                return to_ndarray_blocked<std::uint16_t>(
+                    convert_block,
+                    "to_numpy",
+                    copy,
+                    { std::uint8_t(nb::dlpack::dtype_code::Float), 16, 1 }
+                );
+            case NumPyFloat::FLOAT32:
+                return to_ndarray_blocked<float>(convert_block, "to_numpy", copy);
+            default:
+                return to_ndarray_blocked<double>(convert_block, "to_numpy", copy);
+            }
+        }
+    }
+
+    /*!
+     * Return the floating-point precision of `to_numpy` for the NumPy `dtype`
+     * argument. Floating-point and complex types give the precision of their (real)
+     * items, while all other types give `NumPyFloat::FLOAT64`.
+     */
+    static NumPyFloat numpy_float_from_dtype(const std::optional<nb::object>& dtype)
+    {
+        if (!dtype || dtype->is_none()) {
+            return NumPyFloat::FLOAT64;
+        }
+
+        nb::object np_dtype = nb::module_::import_("numpy").attr("dtype")(*dtype);
+        const std::string kind = nb::cast<std::string>(np_dtype.attr("kind"));
+        std::size_t itemsize = nb::cast<std::size_t>(np_dtype.attr("itemsize"));
+        if (kind == "c") {
+            itemsize /= 2;
+        } else if (kind != "f") {
+            return NumPyFloat::FLOAT64;
+        }
+
+        switch (itemsize) {
+        case 2:
+            return NumPyFloat::FLOAT16;
+        case 4:
+            return NumPyFloat::FLOAT32;
+        default:
+            return NumPyFloat::FLOAT64;
+        }
+    }
+
+    /*!
+     * Export the data of the Python array object `self` through the DLPack protocol
+     * (`__dlpack__`). The data is exported without a copy, unless `copy` is set, as an
+     * ndarray of `U` with `ARRAY_TYPE::dlpack_item_shape()` appended to the shape.
+     * Only CPU export is supported, so `stream` must be `None`.
+     */
+    template <typename U>
+    static nb::object python_dlpack(
+        nb::handle self,
+        const nb::object& stream,
+        const nb::object& max_version,
+        const std::optional<std::tuple<int, int>>& dl_device,
+        std::optional<bool> copy
+    )
+    {
+        constexpr int DL_DEVICE_CPU = 1;
+        if (!stream.is_none()) {
+            throw nb::buffer_error(
+                fmt::format(
+                    "{}.__dlpack__: `stream` must be None", ARRAY_TYPE::ARRAY_NAME
+                )
+                    .c_str()
+            );
+        }
+        if (dl_device && *dl_device != std::tuple<int, int>(DL_DEVICE_CPU, 0)) {
+            throw nb::buffer_error(
+                fmt::format(
+                    "{}.__dlpack__: only export to the CPU is supported",
+                    ARRAY_TYPE::ARRAY_NAME
+                )
+                    .c_str()
+            );
+        }
+
+        // A copy shares its data until it is exported, which makes the data unique
+        nb::object owner = copy.value_or(false)
+            ? nb::cast(ARRAY_TYPE(nb::cast<const ARRAY_TYPE&>(self)))
+            : nb::borrow(self);
+        ARRAY_TYPE& array = nb::cast<ARRAY_TYPE&>(owner);
+        nb::object view = nb::cast(
+            array.template get_ndarray_view<U>(owner, array.dlpack_item_shape())
+        );
+        if (max_version.is_none()) {
+            return view.attr("__dlpack__")();
+        }
+        return view.attr("__dlpack__")(nb::arg("max_version") = max_version);
+    }
+
+    /*!
+     * Copy the data of an ndarray, laid out as exported by `python_dlpack`, into
+     * `*this`. The ndarray must be of integer type and have the shape of `*this`
+     * followed by `ARRAY_TYPE::dlpack_item_shape()`, and reside in CPU memory. Each
+     * ndarray element is converted to a `T`, sign-extended if the ndarray type is
+     * signed.
+     */
+    void set_data_from_dlpack(const nb::ndarray<>& ndarray)
+    {
+        if (ndarray.device_type() != nb::device::cpu::value) {
+            throw nb::buffer_error(
+                fmt::format(
+                    "{}.from_dlpack: only import from the CPU is supported",
+                    ARRAY_TYPE::ARRAY_NAME
+                )
+                    .c_str()
+            );
+        }
+
+        const ARRAY_TYPE& self = *static_cast<const ARRAY_TYPE*>(this);
+        const std::vector<std::size_t> item_shape = self.dlpack_item_shape();
+        std::vector<std::size_t> expected_shape = _shape;
+        expected_shape.insert(
+            std::end(expected_shape), std::begin(item_shape), std::end(item_shape)
+        );
+        std::vector<std::size_t> shape(ndarray.ndim());
+        for (std::size_t i = 0; i < ndarray.ndim(); i++) {
+            shape[i] = ndarray.shape(i);
+        }
+        if (shape != expected_shape) {
+            throw nb::value_error(
+                fmt::format(
+                    "{}.from_dlpack: expected shape {}, got {}",
+                    ARRAY_TYPE::ARRAY_NAME,
+                    tuple_string_from_vec(expected_shape),
+                    tuple_string_from_vec(shape)
+                )
+                    .c_str()
+            );
+        }
+
+        auto copy_from = [&](auto type_tag) {
+            using INT_TYPE = decltype(type_tag);
+            if (ndarray.dtype() != nb::dtype<INT_TYPE>()) {
+                return false;
+            }
+            using WIDE_TYPE = std::conditional_t<
+                std::is_signed_v<INT_TYPE>,
+                std::make_signed_t<T>,
+                std::make_unsigned_t<T>>;
+            T* dst = _data.data();
+            NDArrayReader<INT_TYPE>(ndarray).for_each([&](std::size_t i, INT_TYPE v) {
+                dst[i] = T(WIDE_TYPE(v));
+            });
+            return true;
+        };
+        if (copy_from(std::int64_t {}) || copy_from(std::int32_t {})
+            || copy_from(std::int16_t {}) || copy_from(std::int8_t {})
+            || copy_from(std::uint64_t {}) || copy_from(std::uint32_t {})
+            || copy_from(std::uint16_t {}) || copy_from(std::uint8_t {})) {
+            return;
+        }
+        throw nb::type_error(
+            fmt::format(
+                "{}.from_dlpack: unsupported `dtype`, expecting integer",
+                ARRAY_TYPE::ARRAY_NAME
+            )
+                .c_str()
+        );
+    }
+
+    /* ****************************************************************************** *
+     * *                   Native binary file format payload                        * *
+     * ****************************************************************************** */
+
+    /*!
+     * Number of limbs of each fixed-point scalar (real or imaginary part) of the array,
+     * the unit of the native binary file format payload of fixed-point arrays
+     */
+    std::size_t raw_scalar_limbs() const noexcept
+    {
+        return bits_to_limbs(static_cast<const ARRAY_TYPE*>(this)->bits());
+    }
+
+    /*!
+     * Number of bytes in the payload of the native binary file format (see
+     * `apytypes/_io.py`). Each fixed-point scalar is stored as little-endian 64-bit
+     * words, sign-extended, so that files are interchangeable between 32-bit and
+     * 64-bit limb builds. Floating-point items are stored as
+     * `RAW_FLOAT_RECORD_BYTES`-byte records, see `raw_from_float_data`.
+     */
+    std::size_t raw_nbytes() const noexcept
+    {
+        if constexpr (std::is_same_v<T, APyFloatData>) {
+            return RAW_FLOAT_RECORD_BYTES * _data.size();
+        } else {
+            const std::size_t scalar_limbs = raw_scalar_limbs();
+            const std::size_t n_scalars = _data.size() / scalar_limbs;
+            return sizeof(T) * raw_padded_limbs(scalar_limbs) * n_scalars;
+        }
+    }
+
+    //! Test if the native binary file format payload is the array storage itself
+    bool is_raw_payload_storage() const noexcept
+    {
+        if constexpr (std::is_same_v<T, APyFloatData> || !is_little_endian()) {
+            return false;
+        } else {
+            return raw_nbytes() == sizeof(T) * _data.size();
+        }
+    }
+
+    //! Write the native binary file format payload of the array to the binary Python
+    //! file object `file`
+    void python_write_raw(const nb::object& file) const
+    {
+        nb::object write = file.attr("write");
+        auto write_bytes = [&](const std::uint8_t* data, std::size_t n) {
+            nb::object view = nb::steal(PyMemoryView_FromMemory(
+                (char*)data, Py_ssize_t(n), PyBUF_READ
+            ));
+            write(view);
+        };
+
+        // Little-endian 64-bit limbs are written directly from the array storage. Any
+        // other layout is encoded, one block at a time.
+        if (is_raw_payload_storage()) {
+            const std::size_t n = _data.size() * sizeof(T);
+            write_bytes(reinterpret_cast<const std::uint8_t*>(_data.data()), n);
+            return;
+        }
+
+        constexpr std::size_t BLOCK_ITEMS = std::size_t(1) << 16;
+        std::vector<std::uint8_t> block;
+        if constexpr (std::is_same_v<T, APyFloatData>) {
+            for (std::size_t i = 0; i < _data.size(); i += BLOCK_ITEMS) {
+                const std::size_t n = std::min(BLOCK_ITEMS, _data.size() - i);
+                block.resize(RAW_FLOAT_RECORD_BYTES * n);
+                raw_from_float_data(_data.data() + i, n, block.data());
+                write_bytes(block.data(), block.size());
+            }
+        } else {
+            const std::size_t scalar_limbs = raw_scalar_limbs();
+            const std::size_t n_scalars = _data.size() / scalar_limbs;
+            const std::size_t scalar_bytes = sizeof(T) * raw_padded_limbs(scalar_limbs);
+            for (std::size_t i = 0; i < n_scalars; i += BLOCK_ITEMS) {
+                const std::size_t n = std::min(BLOCK_ITEMS, n_scalars - i);
+                block.resize(scalar_bytes * n);
+                raw_from_limbs(
+                    _data.data() + i * scalar_limbs, n, scalar_limbs, block.data()
+                );
+                write_bytes(block.data(), block.size());
+            }
+        }
+    }
+
+    /*!
+     * Set the data of the array from a native binary file format payload, e.g., the
+     * contents of a file or a pickled buffer. Large payloads are decoded on the thread
+     * pool, with the GIL released.
+     */
+    void python_read_raw(
+        const nb::ndarray<const std::uint8_t, nb::ndim<1>, nb::c_contig>& payload
+    )
+    {
+        if (payload.shape(0) != raw_nbytes()) {
+            throw nb::value_error(
+                fmt::format(
+                    "{}: expected a payload of {} bytes, got {}",
+                    ARRAY_TYPE::ARRAY_NAME,
+                    raw_nbytes(),
+                    payload.shape(0)
+                )
+                    .c_str()
+            );
+        }
+        const std::uint8_t* src = payload.data();
+        T* dst = _data.data();
+        const ARRAY_TYPE& self = *static_cast<const ARRAY_TYPE*>(this);
+        const bool use_threadpool
+            = self.is_elementwise_with_threadpool_justified(_data.size());
+        if constexpr (std::is_same_v<T, APyFloatData>) {
+            threadpool_chunked_for(use_threadpool, _data.size(), [&](auto b, auto e) {
+                raw_to_float_data(src + RAW_FLOAT_RECORD_BYTES * b, e - b, dst + b);
+            });
+        } else {
+            const std::size_t scalar_limbs = raw_scalar_limbs();
+            const std::size_t scalar_bytes = sizeof(T) * raw_padded_limbs(scalar_limbs);
+            const std::size_t n_scalars = _data.size() / scalar_limbs;
+            threadpool_chunked_for(use_threadpool, n_scalars, [&](auto b, auto e) {
+                raw_to_limbs(
+                    src + scalar_bytes * b, e - b, scalar_limbs, dst + scalar_limbs * b
+                );
+            });
+        }
+    }
+
+    /*!
+     * Create an array of shape `python_shape`, with the format of `*this`, from a
+     * native binary file format payload. The storage is allocated uninitialized, as
+     * it is fully overwritten by the payload.
+     */
+    ARRAY_TYPE python_from_raw(
+        const PyShapeParam_t& python_shape,
+        const nb::ndarray<const std::uint8_t, nb::ndim<1>, nb::c_contig>& payload
+    ) const
+    {
+        std::vector<std::size_t> shape = cpp_shape_from_python_shape_like(python_shape);
+        ARRAY_TYPE result = static_cast<const ARRAY_TYPE*>(this)->create_array(
+            shape, vector_type(fold_shape(shape) * _itemsize, cow_no_init)
+        );
+        result.python_read_raw(payload);
+        return result;
+    }
+
+    /*!
+     * Return the native binary file format payload of the array as a read-only
+     * one-dimensional buffer, used for pickling with protocol 5. When the payload is
+     * the array storage itself (little-endian 64-bit words of fixed-point limbs), the
+     * buffer is a zero-copy view of a copy-on-write snapshot of the storage, so it is
+     * unaffected by later modifications of the array. Otherwise, the payload is
+     * encoded once into a new buffer.
+     */
+    nb::ndarray<const std::uint8_t, nb::ndim<1>> python_raw_payload() const
+    {
+        std::size_t shape[1] = { raw_nbytes() };
+        if (is_raw_payload_storage()) {
+            auto* snapshot = new vector_type(_data);
+            nb::capsule owner(snapshot, [](void* p) noexcept {
+                delete static_cast<vector_type*>(p);
+            });
+            const T* data = std::as_const(*snapshot).data();
+            return nb::ndarray<const std::uint8_t, nb::ndim<1>>(
+                reinterpret_cast<const std::uint8_t*>(data), 1, shape, owner
+            );
+        }
+
+        auto* payload = new std::vector<std::uint8_t>(raw_nbytes());
+        nb::capsule owner(payload, [](void* p) noexcept {
+            delete static_cast<std::vector<std::uint8_t>*>(p);
+        });
+        const T* src = _data.data();
+        std::uint8_t* dst = payload->data();
+        const ARRAY_TYPE& self = *static_cast<const ARRAY_TYPE*>(this);
+        const bool use_threadpool
+            = self.is_elementwise_with_threadpool_justified(_data.size());
+        if constexpr (std::is_same_v<T, APyFloatData>) {
+            threadpool_chunked_for(use_threadpool, _data.size(), [&](auto b, auto e) {
+                raw_from_float_data(src + b, e - b, dst + RAW_FLOAT_RECORD_BYTES * b);
+            });
+        } else {
+            const std::size_t scalar_limbs = raw_scalar_limbs();
+            const std::size_t scalar_bytes = sizeof(T) * raw_padded_limbs(scalar_limbs);
+            const std::size_t n_scalars = _data.size() / scalar_limbs;
+            threadpool_chunked_for(use_threadpool, n_scalars, [&](auto b, auto e) {
+                raw_from_limbs(
+                    src + scalar_limbs * b, e - b, scalar_limbs, dst + scalar_bytes * b
+                );
+            });
+        }
+        return nb::ndarray<const std::uint8_t, nb::ndim<1>>(
+            payload->data(), 1, shape, owner
+        );
+    }
+
+    /*!
+     * Python `__reduce_ex__`. With pickle protocol 5 or later, the array data is
+     * passed as a `pickle.PickleBuffer` (see `python_raw_payload`), which can be
+     * transferred out-of-band without being copied into the pickle stream. Older
+     * protocols pickle the state returned by `__getstate__`.
+     */
+    static nb::object python_reduce_ex(nb::handle self, int protocol)
+    {
+        if (protocol < 5) {
+            nb::handle object_type = reinterpret_cast<PyObject*>(&PyBaseObject_Type);
+            return object_type.attr("__reduce_ex__")(self, protocol);
+        }
+        return nb::module_::import_("apytypes._io").attr("_reduce_ex")(self, protocol);
+    }
+
     //! Copy array
     ARRAY_TYPE python_copy() const { return *static_cast<const ARRAY_TYPE*>(this); }
 
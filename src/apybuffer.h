@@ -10,15 +10,18 @@
 // https://docs.python.org/3/c-api/intro.html#include-files
 #include <Python.h>
 
+#include "apytypes_cow_vector.h"
 #include "apytypes_util.h"
 
 // Python object access through Nanobind
 #include <nanobind/nanobind.h>
+#include <nanobind/ndarray.h>     // nanobind::ndarray
 #include <nanobind/stl/variant.h> // std::variant (with nanobind support)
 namespace nb = nanobind;
 
 #include <cstddef>     // std::ptrdiff_t
 #include <cstdlib>     // std::malloc
+#include <iterator>    // std::begin, std::end
 #include <memory>      // std::allocator
 #include <type_traits> // std::true_type
 #include <vector>      // std::vector
@@ -79,8 +82,9 @@ template <
 class APyBuffer {
 
 public:
-    // The underlying vector type
-    using vector_type = std::vector<T, Allocator>;
+    // The underlying vector type. Copies of an `APyBuffer` share their data until
+    // either one of them is mutated (copy-on-write).
+    using vector_type = CowVector<T, Allocator>;
 
     //! APyBuffers are to be inherited from. All fields and constructors are protected.
 protected:
@@ -111,6 +115,9 @@ protected:
     //! Return a Python Buffer structure compatible with the Buffer Protocol
     Py_buffer get_py_buffer()
     {
+        // The exported data may be written to through the buffer. It must not be
+        // shared with any other buffer, neither now nor in the future.
+        _data.mark_exported();
         _strides = strides_from_shape(_shape, _itemsize * sizeof(T));
         return Py_buffer {
             (void*)_data.data(),             // void       *buf
@@ -127,6 +134,23 @@ protected:
         };
     }
 
+    //! Return an ndarray viewing the underlying data reinterpreted as `U`, with
+    //! `item_shape` appended to the array shape. The ndarray keeps `owner` alive. As
+    //! for the Buffer Protocol, the data may be written to through the ndarray, so it
+    //! is never shared with any other buffer.
+    template <typename U>
+    nb::ndarray<U>
+    get_ndarray_view(nb::handle owner, const std::vector<std::size_t>& item_shape)
+    {
+        static_assert(sizeof(U) == sizeof(T));
+        _data.mark_exported();
+        std::vector<std::size_t> shape = _shape;
+        shape.insert(std::end(shape), std::begin(item_shape), std::end(item_shape));
+        return nb::ndarray<U>(
+            reinterpret_cast<U*>(_data.data()), shape.size(), shape.data(), owner
+        );
+    }
+
     //! Resize the underlying buffer without touching its data. Narrowing the buffer
     //! will result in loss of data.
     void buffer_resize(const std::vector<std::size_t> shape, std::size_t itemsize)
@@ -172,6 +196,9 @@ public:
     //! Return a pointer to the underlying data vector
     T* data() noexcept { return _data.data(); }
     const T* data() const noexcept { return _data.data(); }
+
+    //! Return the underlying data vector, for iterating over it without a copy
+    const vector_type& read_data() const noexcept { return _data; }
 };
 
 #endif // _APYBUFFER_H
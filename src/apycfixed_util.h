@@ -4,7 +4,10 @@
 #include "apytypes_util.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <utility>
+#include <vector>
 
 static APY_INLINE void complex_multiplication_1_1_2(
     apy_limb_t* res, const apy_limb_t* src0, const apy_limb_t* src1
@@ -1086,19 +1089,255 @@ private:
     mutable ScratchVector<apy_limb_t, 16> prod_imm;
 };
 
-template <typename RANDOM_ACCESS_IT> struct ComplexFixedPointToDouble {
-    FixedPointToDouble<RANDOM_ACCESS_IT> converter;
-    std::size_t n_limbs;
-    ComplexFixedPointToDouble(const APyFixedSpec& spec)
-        : converter(spec)
-        , n_limbs { bits_to_limbs(spec.bits) }
+/* ********************************************************************************** *
+ * *                  Complex-valued fixed-point Fourier transform                  * *
+ * ********************************************************************************** */
+
+//! Output format, quantization, and overflow of a butterfly stage of
+//! `ComplexFixedPointFFT`
+struct FixedPointFFTStage {
+    APyFixedSpec spec;
+    QuantizationMode quantization;
+    OverflowMode overflow;
+};
+
+/*!
+ * Bit-true radix-2 decimation-in-time fast Fourier transform of `n` complex-valued
+ * fixed-point items, with `n` a power of two. In stage `s`, each butterfly computes
+ * `a + w * b` and `a - w * b` exactly, and the results are then cast to the format of
+ * `stages[s]`. The twiddle factors `w` have two integer bits and `twiddle_bits` bits
+ * in total, and are rounded once from double precision.
+ */
+class ComplexFixedPointFFT {
+public:
+    using It = APyBuffer<apy_limb_t>::vector_type::iterator;
+    using CIt = APyBuffer<apy_limb_t>::vector_type::const_iterator;
+
+    //! Scratch memory of a transform. Create one per thread with `make_workspace()`.
+    struct Workspace {
+        std::vector<apy_limb_t> src, dst, wide;
+        ScratchVector<apy_limb_t, 16> prod, prod_imm;
+        ScratchVector<apy_limb_t, 8> op1_abs, op2_abs;
+    };
+
+    ComplexFixedPointFFT(
+        std::size_t n,
+        const APyFixedSpec& src_spec,
+        std::vector<FixedPointFFTStage> stages,
+        int twiddle_bits,
+        bool inverse
+    )
+        : n { n }
+        , src_spec { src_spec }
+        , stages { std::move(stages) }
+        , tw_limbs { bits_to_limbs(twiddle_bits) }
+        , tw_frac_bits { twiddle_bits - 2 }
     {
+        assert(n > 0 && (n & (n - 1)) == 0);
+        assert(twiddle_bits >= 2);
+
+        // Bit-reversal permutation of the input
+        const std::size_t log2_n = bit_width(n) - 1;
+        assert(this->stages.size() == log2_n);
+        bit_reversed.resize(n);
+        for (std::size_t i = 0; i < n; i++) {
+            std::size_t rev = 0;
+            for (std::size_t b = 0; b < log2_n; b++) {
+                rev |= ((i >> b) & 1) << (log2_n - 1 - b);
+            }
+            bit_reversed[i] = rev;
+        }
+
+        // Twiddle factors `exp(-2 * pi * i * k / n)`, or `exp(2 * pi * i * k / n)` for
+        // the inverse transform, for `k < n / 2`
+        twiddles.resize(n / 2 * 2 * tw_limbs);
+        const unsigned shift
+            = (APY_LIMB_SIZE_BITS - twiddle_bits) & (APY_LIMB_SIZE_BITS - 1);
+        for (std::size_t k = 0; k < n / 2; k++) {
+            const auto [cos, sin] = unit_circle(k, n);
+            const double parts[2] = { cos, inverse ? sin : -sin };
+            for (std::size_t p = 0; p < 2; p++) {
+                auto dst = std::begin(twiddles) + (2 * k + p) * tw_limbs;
+                if (tw_limbs == 1) {
+                    *dst = fixed_point_from_double_single_limb(
+                        parts[p], tw_frac_bits, shift
+                    );
+                } else {
+                    fixed_point_from_double(
+                        parts[p], dst, dst + tw_limbs, twiddle_bits, /*int_bits=*/2
+                    );
+                }
+            }
+        }
+
+        // Stage formats and casts from the exact butterfly results
+        APyFixedSpec spec = src_spec;
+        max_limbs = bits_to_limbs(spec.bits);
+        max_wide_limbs = 0;
+        for (const FixedPointFFTStage& stage : this->stages) {
+            const std::size_t limbs = bits_to_limbs(spec.bits);
+            const std::size_t wide_limbs = limbs + tw_limbs + 1;
+            const int wide_bits = int(wide_limbs * APY_LIMB_SIZE_BITS);
+            const int wide_frac_bits = spec.bits - spec.int_bits + tw_frac_bits;
+            const APyFixedSpec wide_spec { wide_bits, wide_bits - wide_frac_bits };
+            casts.emplace_back(
+                wide_spec, stage.spec, stage.quantization, stage.overflow
+            );
+            spec = stage.spec;
+            max_limbs = std::max(max_limbs, bits_to_limbs(spec.bits));
+            max_wide_limbs = std::max(max_wide_limbs, wide_limbs);
+        }
+        max_op_limbs = std::max(max_limbs, tw_limbs);
     }
-    std::complex<double> operator()(RANDOM_ACCESS_IT begin, RANDOM_ACCESS_IT) const
+
+    //! Format of the transformed items
+    APyFixedSpec dst_spec() const
+    {
+        return stages.empty() ? src_spec : stages.back().spec;
+    }
+
+    Workspace make_workspace() const
     {
-        return std::complex<double>(
-            converter(begin + 0 * n_limbs, begin + 1 * n_limbs),
-            converter(begin + 1 * n_limbs, begin + 2 * n_limbs)
-        );
+        return {
+            std::vector<apy_limb_t>(2 * n * max_limbs),
+            std::vector<apy_limb_t>(2 * n * max_limbs),
+            std::vector<apy_limb_t>(2 * n * max_wide_limbs),
+            ScratchVector<apy_limb_t, 16>(2 * max_wide_limbs),
+            ScratchVector<apy_limb_t, 16>(2 * max_wide_limbs),
+            ScratchVector<apy_limb_t, 8>(max_op_limbs),
+            ScratchVector<apy_limb_t, 8>(max_op_limbs),
+        };
     }
+
+    //! Transform the `n` items at `src`, `stride` items apart, into the `n` items at
+    //! `dst`, `stride` items apart, in the format of `dst_spec()`
+    void operator()(CIt src, It dst, std::size_t stride, Workspace& ws) const
+    {
+        // Gather the input in bit-reversed order
+        std::size_t limbs = bits_to_limbs(src_spec.bits);
+        for (std::size_t i = 0; i < n; i++) {
+            std::copy_n(
+                src + i * stride * 2 * limbs,
+                2 * limbs,
+                std::begin(ws.src) + bit_reversed[i] * 2 * limbs
+            );
+        }
+
+        for (std::size_t s = 0; s < stages.size(); s++) {
+            butterflies(std::size_t(1) << s, limbs, ws);
+            casts[s](std::cbegin(ws.wide), std::begin(ws.dst), 2 * n);
+            std::swap(ws.src, ws.dst);
+            limbs = bits_to_limbs(stages[s].spec.bits);
+        }
+
+        // Scatter the result
+        for (std::size_t i = 0; i < n; i++) {
+            std::copy_n(
+                std::cbegin(ws.src) + i * 2 * limbs,
+                2 * limbs,
+                dst + i * stride * 2 * limbs
+            );
+        }
+    }
+
+private:
+    //! Cosine and sine of `2 * pi * k / n`, for `k < n / 2`. The angle is reduced to
+    //! the first octant, so that symmetric twiddle factors are exact negations or swaps
+    //! of each other, and factors on the axes are exact.
+    static std::pair<double, double> unit_circle(std::size_t k, std::size_t n)
+    {
+        constexpr double PI = 3.14159265358979323846;
+        const bool is_second_quadrant = 4 * k > n;
+        if (is_second_quadrant) {
+            k = n / 2 - k;
+        }
+        const bool is_second_octant = 8 * k > n;
+        if (is_second_octant) {
+            k = n / 4 - k;
+        }
+        const double angle = 2 * PI * double(k) / double(n);
+        double cos = std::cos(angle);
+        double sin = std::sin(angle);
+        if (is_second_octant) {
+            std::swap(cos, sin);
+        }
+        return { is_second_quadrant ? -cos : cos, sin };
+    }
+
+    //! Evaluate the butterflies of the stage combining transforms of length `half`,
+    //! from items of `limbs` limbs per part in `ws.src`, into exact results in
+    //! `ws.wide`
+    void butterflies(std::size_t half, std::size_t limbs, Workspace& ws) const
+    {
+        const std::size_t wide_limbs = limbs + tw_limbs + 1;
+        const std::size_t tw_step = n / (2 * half);
+        apy_limb_t* prod = ws.prod.data();
+        for (std::size_t j = 0; j < n; j += 2 * half) {
+            for (std::size_t k = 0; k < half; k++) {
+                const apy_limb_t* a = ws.src.data() + (j + k) * 2 * limbs;
+                const apy_limb_t* b = ws.src.data() + (j + k + half) * 2 * limbs;
+                const apy_limb_t* w = twiddles.data() + k * tw_step * 2 * tw_limbs;
+                apy_limb_t* sum = ws.wide.data() + (j + k) * 2 * wide_limbs;
+                apy_limb_t* diff = ws.wide.data() + (j + k + half) * 2 * wide_limbs;
+
+                // Exact product `w * b`
+                if (limbs == 1 && tw_limbs == 1) {
+                    apy_limb_t res[4];
+                    complex_multiplication_1_1_2(res, b, w);
+                    for (std::size_t p = 0; p < 2; p++) {
+                        prod[3 * p + 0] = res[2 * p + 0];
+                        prod[3 * p + 1] = res[2 * p + 1];
+                        const bool is_negative
+                            = limb_vector_is_negative(res + 2 * p, res + 2 * p + 2);
+                        prod[3 * p + 2] = is_negative ? apy_limb_t(-1) : apy_limb_t(0);
+                    }
+                } else {
+                    complex_fixed_point_product(
+                        b,
+                        w,
+                        prod,
+                        limbs,
+                        tw_limbs,
+                        wide_limbs,
+                        std::begin(ws.op1_abs),
+                        std::begin(ws.op2_abs),
+                        std::begin(ws.prod_imm)
+                    );
+                }
+
+                // `a` aligned to the binary point of the product, then `a +- w * b`
+                for (std::size_t p = 0; p < 2; p++) {
+                    _cast_no_quantize_no_overflow(
+                        a + p * limbs,
+                        a + (p + 1) * limbs,
+                        diff + p * wide_limbs,
+                        diff + (p + 1) * wide_limbs,
+                        unsigned(tw_frac_bits)
+                    );
+                    apy_addition_same_length(
+                        sum + p * wide_limbs,
+                        diff + p * wide_limbs,
+                        prod + p * wide_limbs,
+                        wide_limbs
+                    );
+                    apy_subtraction_same_length(
+                        diff + p * wide_limbs,
+                        diff + p * wide_limbs,
+                        prod + p * wide_limbs,
+                        wide_limbs
+                    );
+                }
+            }
+        }
+    }
+
+    std::size_t n;
+    APyFixedSpec src_spec;
+    std::vector<FixedPointFFTStage> stages;
+    std::vector<FixedPointCast> casts;
+    std::vector<std::size_t> bit_reversed;
+    std::vector<apy_limb_t> twiddles;
+    std::size_t tw_limbs;
+    int tw_frac_bits;
+    std::size_t max_limbs, max_wide_limbs, max_op_limbs;
 };
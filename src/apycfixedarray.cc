@@ -6,8 +6,10 @@
 #include "apycfixed.h"
 #include "apycfixed_util.h"
 #include "apycfixedarray.h"
+#include "apyconvolve.h"
 #include "apyfixed_util.h"
 #include "apyfixedarray.h"
+#include "apyfloat_util.h"
 #include "apytypes_common.h"
 #include "apytypes_fwd.h"
 #include "apytypes_intrinsics.h"
@@ -29,10 +31,12 @@ namespace nb = nanobind;
 #include <algorithm>   // std::copy, std::max, std::transform, etc...
 #include <cstddef>     // std::size_t
 #include <cstdint>     // std::int16, std::int32, std::int64, etc...
+#include <functional>  // std::function
 #include <optional>    // std::optional
 #include <set>         // std::set
 #include <stdexcept>   // std::length_error
 #include <string>      // std::string
+#include <string_view> // std::string_view
 #include <type_traits> // std::remove_cv_t
 #include <variant>     // std::variant
 #include <vector>      // std::vector, std::swap
@@ -110,6 +114,19 @@ APyCFixedArray::APyCFixedArray(
 {
 }
 
+APyCFixedArray::APyCFixedArray(
+    cow_no_init_t, const std::vector<std::size_t>& shape, int bits, int int_bits
+)
+    : APyArray(
+          shape,
+          2 * bits_to_limbs(bits),
+          vector_type(fold_shape(shape) * 2 * bits_to_limbs(bits), cow_no_init)
+      )
+    , _bits { bits }
+    , _int_bits { int_bits }
+{
+}
+
 APyCFixedArray::APyCFixedArray(
     const std::vector<std::size_t>& shape, int bits, int int_bits, vector_type&& v
 )
@@ -161,29 +178,38 @@ APyCFixedArray::_apycfixedarray_base_add_sub(const APyCFixedArray& rhs) const
     const int res_bits = res_int_bits + res_frac_bits;
 
     // Resulting vector
-    APyCFixedArray result(_shape, res_bits, res_int_bits);
+    APyCFixedArray result(cow_no_init, _shape, res_bits, res_int_bits);
+
+    // Addition and subtraction are evaluated independently on the real and imaginary
+    // parts, so the work is split over the `2 * _nitems` scalar parts
+    const std::size_t n_parts = 2 * _nitems;
+    const bool use_threadpool = is_elementwise_with_threadpool_justified(_nitems);
 
     // Special case #1: Operands and result fit in single limb
     if (unsigned(res_bits) <= APY_LIMB_SIZE_BITS) {
         if (frac_bits() == rhs.frac_bits()) {
             // Operands have equally many fractional bits.
-            simd_op {}(
-                _data.begin(),
-                rhs._data.begin(),
-                result._data.begin(),
-                result._data.size()
-            );
+            threadpool_chunked_for(use_threadpool, n_parts, [&](auto begin, auto end) {
+                simd_op {}(
+                    _data.begin() + begin,
+                    rhs._data.begin() + begin,
+                    result._data.begin() + begin,
+                    end - begin
+                );
+            });
         } else {
             auto rhs_shift_amount = unsigned(res_frac_bits - rhs.frac_bits());
             auto lhs_shift_amount = unsigned(res_frac_bits - frac_bits());
-            simd_shift_op {}(
-                _data.begin(),
-                rhs._data.begin(),
-                result._data.begin(),
-                lhs_shift_amount,
-                rhs_shift_amount,
-                result._data.size()
-            );
+            threadpool_chunked_for(use_threadpool, n_parts, [&](auto begin, auto end) {
+                simd_shift_op {}(
+                    _data.begin() + begin,
+                    rhs._data.begin() + begin,
+                    result._data.begin() + begin,
+                    lhs_shift_amount,
+                    rhs_shift_amount,
+                    end - begin
+                );
+            });
         }
         return result; // early exit
     }
@@ -221,19 +247,22 @@ APyCFixedArray::_apycfixedarray_base_add_sub(const APyCFixedArray& rhs) const
             src1_ptr = _data.data();
             src2_ptr = result._data.data();
         }
-        for (std::size_t i = 0; i < result._data.size(); i += result._itemsize / 2) {
-            ripple_carry_op {}(
-                result._data.data() + i, // dst
-                src1_ptr + i,            // src1
-                src2_ptr + i,            // src2
-                result._itemsize / 2     // limb vector length
-            );
-        }
+        const std::size_t n_limbs = result._itemsize / 2;
+        threadpool_chunked_for(use_threadpool, n_parts, [&](auto begin, auto end) {
+            for (std::size_t i = begin * n_limbs; i < end * n_limbs; i += n_limbs) {
+                ripple_carry_op {}(
+                    result._data.data() + i, // dst
+                    src1_ptr + i,            // src1
+                    src2_ptr + i,            // src2
+                    n_limbs                  // limb vector length
+                );
+            }
+        });
         return result; // early exit
     }
 
     // Most general case: Works in any situation, but is slowest
-    APyCFixedArray imm(_shape, res_bits, res_int_bits);
+    APyCFixedArray imm(cow_no_init, _shape, res_bits, res_int_bits);
     _cast_no_quantize_no_overflow(
         std::begin(_data),          // src
         std::begin(result._data),   // dst
@@ -252,14 +281,17 @@ APyCFixedArray::_apycfixedarray_base_add_sub(const APyCFixedArray& rhs) const
     );
 
     // Perform ripple-carry operation for each element
-    for (std::size_t i = 0; i < result._data.size(); i += result._itemsize / 2) {
-        ripple_carry_op {}(
-            result._data.data() + i, // dst
-            result._data.data() + i, // src1
-            imm._data.data() + i,    // src2
-            result._itemsize / 2     // limb vector length
-        );
-    }
+    const std::size_t n_limbs = result._itemsize / 2;
+    threadpool_chunked_for(use_threadpool, n_parts, [&](auto begin, auto end) {
+        for (std::size_t i = begin * n_limbs; i < end * n_limbs; i += n_limbs) {
+            ripple_carry_op {}(
+                result._data.data() + i, // dst
+                result._data.data() + i, // src1
+                imm._data.data() + i,    // src2
+                n_limbs                  // limb vector length
+            );
+        }
+    });
     return result;
 }
 
@@ -486,16 +518,19 @@ APyCFixedArray APyCFixedArray::operator*(const APyCFixedArray& rhs) const
     const int res_bits = res_int_bits + res_frac_bits;
 
     // Resulting `APyCFixedArray` fixed-point tensor
-    APyCFixedArray result(_shape, res_bits, res_int_bits);
+    APyCFixedArray result(cow_no_init, _shape, res_bits, res_int_bits);
+    const bool use_threadpool = is_elementwise_with_threadpool_justified(_nitems);
 
     // Single limb specialization
     if (unsigned(res_bits) <= APY_LIMB_SIZE_BITS) {
-        simd::vector_mul_complex(
-            std::begin(_data),        // src1
-            std::begin(rhs._data),    // src2
-            std::begin(result._data), // dst
-            result._data.size()       // elements
-        );
+        threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+            simd::vector_mul_complex(
+                std::begin(_data) + 2 * begin,        // src1
+                std::begin(rhs._data) + 2 * begin,    // src2
+                std::begin(result._data) + 2 * begin, // dst
+                2 * (end - begin)                     // elements
+            );
+        });
         return result; // early exit
     }
 
@@ -544,24 +579,26 @@ APyCFixedArray APyCFixedArray::operator*(const APyCFixedArray& rhs) const
     std::size_t src1_limbs = _itemsize / 2;
     std::size_t src2_limbs = rhs._itemsize / 2;
     std::size_t scratch_size = 2 + 3 * src1_limbs + 3 * src2_limbs;
-    ScratchVector<apy_limb_t, 64> scratch(scratch_size);
-    auto op1_abs_begin = std::begin(scratch);
-    auto op2_abs_begin = op1_abs_begin + src1_limbs;
-    auto prod_imm_begin = op2_abs_begin + src2_limbs;
+    threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+        ScratchVector<apy_limb_t, 64> scratch(scratch_size);
+        auto op1_abs_begin = std::begin(scratch);
+        auto op2_abs_begin = op1_abs_begin + src1_limbs;
+        auto prod_imm_begin = op2_abs_begin + src2_limbs;
 
-    for (std::size_t i = 0; i < result._nitems; i++) {
-        complex_fixed_point_product(
-            std::begin(_data) + i * _itemsize,               // src1
-            std::begin(rhs._data) + i * rhs._itemsize,       // src2
-            std::begin(result._data) + i * result._itemsize, // dst
-            src1_limbs,                                      // src1_limbs
-            src2_limbs,                                      // src2_limbs
-            result._itemsize / 2,                            // dst_limbs
-            op1_abs_begin,                                   // op1_abs
-            op2_abs_begin,                                   // op2_abs
-            prod_imm_begin                                   // prod_imm
-        );
-    }
+        for (std::size_t i = begin; i < end; i++) {
+            complex_fixed_point_product(
+                std::begin(_data) + i * _itemsize,               // src1
+                std::begin(rhs._data) + i * rhs._itemsize,       // src2
+                std::begin(result._data) + i * result._itemsize, // dst
+                src1_limbs,                                      // src1_limbs
+                src2_limbs,                                      // src2_limbs
+                result._itemsize / 2,                            // dst_limbs
+                op1_abs_begin,                                   // op1_abs
+                op2_abs_begin,                                   // op2_abs
+                prod_imm_begin                                   // prod_imm
+            );
+        }
+    });
 
     return result;
 }
@@ -2324,15 +2361,13 @@ template ComparissonArray APyCFixedArray::operator!=(const APyCFixed& rhs) const
 
 std::string APyCFixedArray::repr() const
 {
-    const auto formatter = [bits = _bits](auto cbegin_it, auto cend_it) -> std::string {
+    const auto formatter = [bits = _bits](auto cbegin_it, auto cend_it, auto& out) {
         std::size_t itemsize = std::distance(cbegin_it, cend_it);
         auto creal_it = cbegin_it;
         auto cimag_it = cbegin_it + itemsize / 2;
 
-        std::vector<apy_limb_t> real_data(itemsize / 2);
-        std::vector<apy_limb_t> imag_data(itemsize / 2);
-        std::copy(creal_it, creal_it + itemsize / 2, std::begin(real_data));
-        std::copy(cimag_it, cimag_it + itemsize / 2, std::begin(imag_data));
+        ScratchVector<apy_limb_t, 8> real_data(creal_it, creal_it + itemsize / 2);
+        ScratchVector<apy_limb_t, 8> imag_data(cimag_it, cimag_it + itemsize / 2);
 
         // Zero sign bits outside of bit-range
         if (bits % APY_LIMB_SIZE_BITS) {
@@ -2340,11 +2375,11 @@ std::string APyCFixedArray::repr() const
             real_data.back() &= and_mask;
             imag_data.back() &= and_mask;
         }
-        return fmt::format(
-            "({}, {})",
-            bcds_to_string(double_dabble(real_data)),
-            bcds_to_string(double_dabble(imag_data))
-        );
+        out += '(';
+        limb_vector_to_decimal(out, real_data.data(), real_data.size());
+        out += ", ";
+        limb_vector_to_decimal(out, imag_data.data(), imag_data.size());
+        out += ')';
     };
 
     auto&& kw_args = { fmt::format("int_bits={}", int_bits()),
@@ -2353,16 +2388,19 @@ std::string APyCFixedArray::repr() const
     return array_repr({ formatter }, kw_args);
 }
 
-nb::ndarray<nb::numpy, std::complex<double>> APyCFixedArray::to_numpy(
+nb::ndarray<nb::numpy> APyCFixedArray::to_numpy(
     std::optional<nb::object> dtype, std::optional<bool> copy
 ) const
 {
-    (void)dtype;
-
-    ComplexFixedPointToDouble<vector_const_iterator> converter(spec());
-    return nb::ndarray<nb::numpy, std::complex<double>>(
-        to_ndarray<std::complex<double>>(converter, "to_numpy", copy)
-    );
+    // Each item holds the limbs of its real part followed by those of its imaginary
+    // part, so the parts are converted as consecutive real-valued items
+    const APyFixedSpec src_spec = spec();
+    const apy_limb_t* src = _data.data();
+    const auto convert_block = [&](std::size_t begin, std::size_t end, auto* dst) {
+        const std::size_t n_parts = 2 * (end - begin);
+        fixed_point_to_floats(src + begin * _itemsize, n_parts, src_spec, dst);
+    };
+    return to_numpy_floats</*IS_COMPLEX=*/true>(convert_block, dtype, copy);
 }
 
 std::variant<
@@ -2523,28 +2561,192 @@ APyCFixedArray APyCFixedArray::cast(
     const auto quantization_mode = quantization.value_or(cast_option.quantization);
     const auto overflow_mode = overflow.value_or(cast_option.overflow);
 
-    // The new result array (`bit_specifier_sanitize()` called in constructor)
+    // The cast functor, with quantization and overflow resolved once for all parts
+    const FixedPointCast caster(
+        spec(), { new_bits, new_int_bits }, quantization_mode, overflow_mode
+    );
+
+    // The new result array
     std::size_t result_limbs = bits_to_limbs(new_bits);
-    std::size_t pad_limbs = bits_to_limbs(std::max(new_bits, _bits)) - result_limbs;
-    APyCFixedArray::vector_type result_data(_nitems * 2 * result_limbs + pad_limbs);
+    APyCFixedArray::vector_type result_data(_nitems * 2 * result_limbs, cow_no_init);
+
+    // Do the casting on the `2 * _nitems` real and imaginary parts
+    const bool use_threadpool = is_elementwise_with_threadpool_justified(_nitems)
+        && !is_stochastic_quantization(quantization_mode);
+    threadpool_chunked_for(use_threadpool, 2 * _nitems, [&](auto begin, auto end) {
+        caster(
+            std::cbegin(_data) + begin * (_itemsize / 2),
+            std::begin(result_data) + begin * result_limbs,
+            end - begin
+        );
+    });
 
-    // Do the casting: `fixed_point_cast_unsafe` is safe to use because of `pad_limbs`
-    for (std::size_t i = 0; i < 2 * _nitems; i++) {
-        fixed_point_cast_unsafe(
-            std::begin(_data) + (i + 0) * _itemsize / 2,
-            std::begin(_data) + (i + 1) * _itemsize / 2,
-            std::begin(result_data) + (i + 0) * result_limbs,
-            std::begin(result_data) + (i + 1) * result_limbs + pad_limbs,
-            _bits,
-            _int_bits,
-            new_bits,
-            new_int_bits,
-            quantization_mode,
-            overflow_mode
+    return APyCFixedArray(_shape, new_bits, new_int_bits, std::move(result_data));
+}
+
+APyCFixedArray APyCFixedArray::fma(
+    const APyCFixedArray& b,
+    const APyCFixedArray& c,
+    std::optional<int> int_bits,
+    std::optional<int> frac_bits,
+    std::optional<QuantizationMode> quantization,
+    std::optional<OverflowMode> overflow,
+    std::optional<int> bits
+) const
+{
+    if (_shape != b._shape || _shape != c._shape) {
+        auto&& new_shape = smallest_broadcastable_shape(_shape, b._shape);
+        if (new_shape.size()) {
+            new_shape = smallest_broadcastable_shape(new_shape, c._shape);
+        }
+        if (new_shape.size() == 0) {
+            throw std::length_error(
+                fmt::format(
+                    "APyCFixedArray.fma: shape mismatch, self.shape={}, b.shape={}, "
+                    "c.shape={}",
+                    tuple_string_from_vec(_shape),
+                    tuple_string_from_vec(b._shape),
+                    tuple_string_from_vec(c._shape)
+                )
+            );
+        }
+        return broadcast_to(new_shape).fma(
+            b.broadcast_to(new_shape),
+            c.broadcast_to(new_shape),
+            int_bits,
+            frac_bits,
+            quantization,
+            overflow,
+            bits
         );
     }
 
-    result_data.resize(_nitems * 2 * result_limbs);
+    // Full-precision format of `*this * b + c`, the same as used by the operators
+    const int prod_bits = _bits + b._bits + 1;
+    const int prod_int_bits = _int_bits + b._int_bits + 1;
+    const int acc_frac_bits = std::max(prod_bits - prod_int_bits, c.frac_bits());
+    const int acc_int_bits = std::max(prod_int_bits, c._int_bits) + 1;
+    const int acc_bits = acc_int_bits + acc_frac_bits;
+
+    // Sanitize the input (bit-specifier validity tested in `bits_from_optional()`)
+    const auto [new_bits, new_int_bits]
+        = bits_from_optional_cast(bits, int_bits, frac_bits, acc_bits, acc_int_bits);
+
+    const APyFixedCastOption cast_option = get_fixed_cast_mode();
+    const auto quantization_mode = quantization.value_or(cast_option.quantization);
+    const auto overflow_mode = overflow.value_or(cast_option.overflow);
+    const FixedPointCast caster(
+        { acc_bits, acc_int_bits },
+        { new_bits, new_int_bits },
+        quantization_mode,
+        overflow_mode
+    );
+
+    // The new result array
+    std::size_t result_limbs = bits_to_limbs(new_bits);
+    APyCFixedArray::vector_type result_data(_nitems * 2 * result_limbs, cow_no_init);
+
+    /*
+     * (a + bi)(c + di) + (e + fi) = (ac - bd + e) + (ad + bc + f)i
+     *
+     * Accumulate one block at a time into a small scratch vector, and quantize the
+     * real and imaginary parts of the block into the result.
+     */
+    constexpr std::size_t BLOCK_SIZE = 256;
+    const unsigned prod_shift = unsigned(acc_frac_bits - (prod_bits - prod_int_bits));
+    const unsigned c_shift = unsigned(acc_frac_bits - c.frac_bits());
+    const std::size_t src1_limbs = _itemsize / 2;
+    const std::size_t src2_limbs = b._itemsize / 2;
+    const std::size_t src3_limbs = c._itemsize / 2;
+    const std::size_t prod_limbs = bits_to_limbs(prod_bits);
+    const std::size_t acc_limbs = bits_to_limbs(acc_bits);
+    const bool use_threadpool = is_elementwise_with_threadpool_justified(_nitems)
+        && !is_stochastic_quantization(quantization_mode);
+
+    if (acc_limbs == 1) {
+        // Single-limb accumulator
+        threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+            const std::size_t block = std::min<std::size_t>(BLOCK_SIZE, end - begin);
+            APyCFixedArray::vector_type acc(2 * block);
+            auto acc_it = std::begin(acc);
+            for (std::size_t i = begin; i < end; i += BLOCK_SIZE) {
+                const std::size_t n = std::min<std::size_t>(BLOCK_SIZE, end - i);
+                auto src1 = std::cbegin(_data) + 2 * i;
+                auto src2 = std::cbegin(b._data) + 2 * i;
+                auto src3 = std::cbegin(c._data) + 2 * i;
+                for (std::size_t j = 0; j < 2 * n; j += 2) {
+                    apy_limb_t re = src1[j] * src2[j] - src1[j + 1] * src2[j + 1];
+                    apy_limb_t im = src1[j] * src2[j + 1] + src1[j + 1] * src2[j];
+                    acc_it[j + 0] = (re << prod_shift) + (src3[j + 0] << c_shift);
+                    acc_it[j + 1] = (im << prod_shift) + (src3[j + 1] << c_shift);
+                }
+                caster(
+                    std::cbegin(acc),
+                    std::begin(result_data) + 2 * i * result_limbs,
+                    2 * n
+                );
+            }
+        });
+        return APyCFixedArray(_shape, new_bits, new_int_bits, std::move(result_data));
+    }
+
+    // Multi-limb accumulator. The products are aligned with the addends by widening
+    // casts, after which they are added limb by limb.
+    const std::size_t scratch_size = 2 + 3 * src1_limbs + 3 * src2_limbs;
+    threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+        const std::size_t block = std::min<std::size_t>(BLOCK_SIZE, end - begin);
+        APyCFixedArray::vector_type prod(2 * block * prod_limbs, cow_no_init);
+        APyCFixedArray::vector_type acc(2 * block * acc_limbs, cow_no_init);
+        APyCFixedArray::vector_type addend(2 * block * acc_limbs, cow_no_init);
+        ScratchVector<apy_limb_t, 64> scratch(scratch_size);
+        auto op1_abs_begin = std::begin(scratch);
+        auto op2_abs_begin = op1_abs_begin + src1_limbs;
+        auto prod_imm_begin = op2_abs_begin + src2_limbs;
+        for (std::size_t i = begin; i < end; i += BLOCK_SIZE) {
+            const std::size_t n = std::min<std::size_t>(BLOCK_SIZE, end - i);
+            for (std::size_t j = 0; j < n; j++) {
+                complex_fixed_point_product(
+                    std::cbegin(_data) + (i + j) * _itemsize,     // src1
+                    std::cbegin(b._data) + (i + j) * b._itemsize, // src2
+                    std::begin(prod) + 2 * j * prod_limbs,        // dst
+                    src1_limbs,                                   // src1_limbs
+                    src2_limbs,                                   // src2_limbs
+                    prod_limbs,                                   // dst_limbs
+                    op1_abs_begin,                                // op1_abs
+                    op2_abs_begin,                                // op2_abs
+                    prod_imm_begin                                // prod_imm
+                );
+            }
+            _cast_no_quantize_no_overflow(
+                std::cbegin(prod), // src
+                std::begin(acc),   // dst
+                prod_limbs,        // src_limbs
+                acc_limbs,         // dst_limbs
+                2 * n,             // n_items
+                prod_shift         // left_shift_amount
+            );
+            _cast_no_quantize_no_overflow(
+                std::cbegin(c._data) + i * c._itemsize, // src
+                std::begin(addend),                     // dst
+                src3_limbs,                             // src_limbs
+                acc_limbs,                              // dst_limbs
+                2 * n,                                  // n_items
+                c_shift                                 // left_shift_amount
+            );
+            for (std::size_t k = 0; k < 2 * n * acc_limbs; k += acc_limbs) {
+                apy_add_n_functor<> {}(
+                    acc.data() + k,    // dst
+                    acc.data() + k,    // src1
+                    addend.data() + k, // src2
+                    acc_limbs          // limb vector length
+                );
+            }
+            caster(
+                std::cbegin(acc), std::begin(result_data) + 2 * i * result_limbs, 2 * n
+            );
+        }
+    });
+
     return APyCFixedArray(_shape, new_bits, new_int_bits, std::move(result_data));
 }
 
@@ -2987,17 +3189,52 @@ APyCFixedArray APyCFixedArray::from_bits(
     return APyCFixedArray(bit_pattern_sequence, int_bits, frac_bits, bits);
 }
 
+APyCFixedArray APyCFixedArray::from_dlpack(
+    const nb::ndarray<>& ndarray,
+    std::optional<int> int_bits,
+    std::optional<int> frac_bits,
+    std::optional<int> bits
+)
+{
+    // Real and imaginary parts are along an additional dimension, and multi-limb parts
+    // have their limbs along yet another, innermost, dimension
+    const int res_bits = bits_from_optional(bits, int_bits, frac_bits);
+    const std::size_t item_ndim = bits_to_limbs(res_bits) > 1 ? 2 : 1;
+    if (ndarray.ndim() <= item_ndim) {
+        throw nb::value_error(
+            "APyCFixedArray.from_dlpack: zero-dimensional arrays not supported"
+        );
+    }
+    std::vector<std::size_t> shape(ndarray.ndim() - item_ndim);
+    for (std::size_t i = 0; i < shape.size(); i++) {
+        shape[i] = ndarray.shape(i);
+    }
+
+    APyCFixedArray result(shape, int_bits, frac_bits, bits);
+    result.set_data_from_dlpack(ndarray);
+    const std::size_t part_size = result._itemsize / 2;
+    for (std::size_t i = 0; i < 2 * result._nitems; i++) {
+        auto it = std::begin(result._data) + i * part_size;
+        _overflow_twos_complement(it, it + part_size, result._bits, result._int_bits);
+    }
+    return result;
+}
+
 std::string APyCFixedArray::to_string_dec() const
 {
     FixedPointToDouble<vector_const_iterator> converter(spec());
-    const auto formatter = [&](auto cbegin_it, auto cend_it) -> std::string {
+    const auto formatter = [&](auto cbegin_it, auto cend_it, auto& out) {
         auto imag_begin = cbegin_it + _itemsize / 2;
         double real_as_double = converter(cbegin_it, imag_begin);
         double imag_as_double = converter(imag_begin, cend_it);
         if (imag_as_double < 0) {
-            return fmt::format("{}{}j", real_as_double, imag_as_double);
+            fmt::format_to(
+                std::back_inserter(out), "{}{}j", real_as_double, imag_as_double
+            );
         } else {
-            return fmt::format("{}+{}j", real_as_double, imag_as_double);
+            fmt::format_to(
+                std::back_inserter(out), "{}+{}j", real_as_double, imag_as_double
+            );
         }
     };
 
@@ -3381,6 +3618,8 @@ APyCFixedArray::rmatmul(const APyFixedArray& lhs) const
 
             const bool use_threadpool
                 = is_mac_with_threadpool_justified(M * N * res_cols);
+            const GILRelease gil_release(M * N * res_cols);
+            const auto pool_lock = lock_thread_pool(use_threadpool);
             const std::size_t n_threads
                 = use_threadpool ? thread_pool.get_thread_count() : 1;
 
@@ -3620,6 +3859,7 @@ APyCFixed APyCFixedArray::checked_inner_product(
     auto inner_product
         = ComplexFixedPointInnerProduct(spec(), rhs.spec(), res_arr.spec(), mode);
 
+    const GILRelease gil_release(_nitems);
     inner_product(
         std::begin(_data),         // src1
         std::begin(rhs._data),     // src2
@@ -3648,6 +3888,7 @@ APyCFixed APyCFixedArray::checked_inner_product(
     auto inner_product
         = ComplexRealFixedPointInnerProduct(spec(), rhs.spec(), res_arr.spec(), mode);
 
+    const GILRelease gil_release(_nitems);
     inner_product(
         std::begin(_data),         // src1
         std::begin(rhs._data),     // src2
@@ -3686,6 +3927,8 @@ APyCFixedArray APyCFixedArray::checked_2d_matmul(
     }
 
     const bool use_threadpool = is_mac_with_threadpool_justified(M * N * res_cols);
+    const GILRelease gil_release(M * N * res_cols);
+    const auto pool_lock = lock_thread_pool(use_threadpool);
     const std::size_t n_threads = use_threadpool ? thread_pool.get_thread_count() : 1;
 
     // Resulting tensor
@@ -3764,6 +4007,8 @@ APyCFixedArray APyCFixedArray::checked_2d_matmul(
     }
 
     const bool use_threadpool = is_mac_with_threadpool_justified(M * N * res_cols);
+    const GILRelease gil_release(M * N * res_cols);
+    const auto pool_lock = lock_thread_pool(use_threadpool);
     const std::size_t n_threads = use_threadpool ? thread_pool.get_thread_count() : 1;
 
     APyCFixedArray res(res_shape, res_bits, res_int_bits);
@@ -3841,52 +4086,187 @@ APyCFixedArray APyCFixedArray::convolve(
     const APyCFixedArray* a = swap ? &other : this;
     const APyCFixedArray* b = &b_cpy;
 
-    // Get convolution properties from the convolution mode
-    auto [len, n_left, n_right] = get_conv_lengths(conv_mode, a, b);
+    // Split the outputs over the thread pool, one inner product per output
+    return convolve_1d(*a, std::cbegin(a->_data), *b, std::cbegin(b->_data), conv_mode);
+}
 
-    // Compute resulting bit specification
-    int pad_bits = b->_shape[0] ? bit_width(b->_shape[0] - 1) : 0;
-    int res_bits = 1 + a->bits() + b->bits() + pad_bits;
-    int res_int_bits = 1 + a->int_bits() + b->int_bits() + pad_bits;
-    std::optional<APyFixedAccumulatorOption> acc = get_accumulator_mode_fixed();
-    if (acc.has_value()) {
-        res_bits = acc->bits;
-        res_int_bits = acc->int_bits;
+//! Perform a two-dimensional convolution with `other` using `mode`
+APyCFixedArray APyCFixedArray::convolve2d(
+    const APyCFixedArray& other,
+    const ConvolutionMode conv_mode,
+    const PyShapeParam_t& stride
+) const
+{
+    if (ndim() < 2 || other.ndim() != 2) {
+        auto msg = fmt::format(
+            "can only convolve2d 2D arrays, or batches of them "
+            "(lhs.ndim = {}, rhs.ndim = {})",
+            ndim(),
+            other.ndim()
+        );
+        throw nanobind::value_error(msg.c_str());
     }
+    return convolve_nd(*this, other, conv_mode, stride, false, "convolve2d");
+}
 
-    APyCFixedArray res({ len }, res_bits, res_int_bits);
+//! Perform a correlation with `other` using `mode`
+APyCFixedArray APyCFixedArray::correlate(
+    const APyCFixedArray& other,
+    const ConvolutionMode conv_mode,
+    const PyShapeParam_t& stride
+) const
+{
+    return convolve_nd(*this, other, conv_mode, stride, true, "correlate");
+}
 
-    auto inner_product
-        = ComplexFixedPointInnerProduct(a->spec(), b->spec(), res.spec(), acc);
+//! Resolve a per-stage parameter of `APyCFixedArray::fft` into one value per stage
+template <typename T>
+static std::vector<T> fft_stage_values(
+    const std::optional<FFTStageParam_t<T>>& param,
+    std::size_t n_stages,
+    std::string_view name,
+    std::string_view param_name,
+    const std::function<T(std::size_t)>& default_value
+)
+{
+    std::vector<T> result(n_stages);
+    if (!param.has_value()) {
+        for (std::size_t s = 0; s < n_stages; s++) {
+            result[s] = default_value(s);
+        }
+    } else if (std::holds_alternative<T>(*param)) {
+        std::fill(std::begin(result), std::end(result), std::get<T>(*param));
+    } else {
+        const std::vector<T>& values = std::get<std::vector<T>>(*param);
+        if (values.size() != n_stages) {
+            std::string msg = fmt::format(
+                "APyCFixedArray.{}: `{}` has {} values, but the transform has {} "
+                "stages",
+                name,
+                param_name,
+                values.size(),
+                n_stages
+            );
+            throw nb::value_error(msg.c_str());
+        }
+        result = values;
+    }
+    return result;
+}
 
-    // Loop working variables
-    std::size_t n = b->_shape[0] - n_left;
-    auto dst = std::begin(res._data);
-    auto src1 = std::cbegin(a->_data);
-    auto src2 = std::cbegin(b->_data) + n_left * b->_itemsize;
+APyCFixedArray APyCFixedArray::fft(
+    int axis,
+    const std::optional<FFTStageParam_t<int>>& int_bits,
+    const std::optional<FFTStageParam_t<int>>& frac_bits,
+    const std::optional<FFTStageParam_t<QuantizationMode>>& quantization,
+    const std::optional<FFTStageParam_t<OverflowMode>>& overflow,
+    std::optional<int> twiddle_bits,
+    bool inverse
+) const
+{
+    const std::string_view name = inverse ? "ifft" : "fft";
+    const int ndim = int(_ndim);
+    if (axis < -ndim || axis >= ndim) {
+        std::string msg = fmt::format(
+            "APyCFixedArray.{}: axis {} out of range (ndim = {})", name, axis, _ndim
+        );
+        throw nb::index_error(msg.c_str());
+    }
+    const std::size_t ax = std::size_t(axis < 0 ? axis + ndim : axis);
 
-    // `b` limits length of the inner product length
-    for (std::size_t i = 0; i < n_left; i++) {
-        inner_product(src1, src2, dst, n);
-        src2 -= b->_itemsize;
-        dst += res._itemsize;
-        n++;
+    const std::size_t n = _shape[ax];
+    if (n == 0 || (n & (n - 1)) != 0) {
+        std::string msg = fmt::format(
+            "APyCFixedArray.{}: transform length must be a power of two, got {}",
+            name,
+            n
+        );
+        throw nb::value_error(msg.c_str());
     }
 
-    // full inner product length
-    for (std::size_t i = 0; i < a->_shape[0] - b->_shape[0] + 1; i++) {
-        inner_product(src1, src2, dst, n);
-        src1 += a->_itemsize;
-        dst += res._itemsize;
+    const int tw_bits = twiddle_bits.value_or(std::max(_bits, 2));
+    if (tw_bits < 2) {
+        std::string msg = fmt::format(
+            "APyCFixedArray.{}: `twiddle_bits` must be at least 2, got {}",
+            name,
+            tw_bits
+        );
+        throw nb::value_error(msg.c_str());
     }
 
-    // `a` limits length of the inner product length
-    for (std::size_t i = 0; i < n_right; i++) {
-        n--;
-        inner_product(src1, src2, dst, n);
-        src1 += a->_itemsize;
-        dst += res._itemsize;
+    // Resolve the format, quantization, and overflow of each stage. By default, each
+    // stage adds one integer bit, which is enough for the transform to never overflow.
+    const std::size_t n_stages = bit_width(n) - 1;
+    const APyFixedCastOption cast_option = get_fixed_cast_mode();
+    const auto stage_int_bits = fft_stage_values<int>(
+        int_bits, n_stages, name, "int_bits", [&](std::size_t s) {
+            return _int_bits + int(s) + 2;
+        }
+    );
+    const auto stage_frac_bits = fft_stage_values<int>(
+        frac_bits, n_stages, name, "frac_bits", [&](std::size_t) {
+            return this->frac_bits();
+        }
+    );
+    const auto stage_quantization = fft_stage_values<QuantizationMode>(
+        quantization, n_stages, name, "quantization", [&](std::size_t) {
+            return cast_option.quantization;
+        }
+    );
+    const auto stage_overflow = fft_stage_values<OverflowMode>(
+        overflow, n_stages, name, "overflow", [&](std::size_t) {
+            return cast_option.overflow;
+        }
+    );
+
+    std::vector<FixedPointFFTStage> stages;
+    bool is_stochastic = false;
+    for (std::size_t s = 0; s < n_stages; s++) {
+        const int bits = stage_int_bits[s] + stage_frac_bits[s];
+        if (bits <= 0) {
+            std::string msg = fmt::format(
+                "APyCFixedArray.{}: stage {} has a non-positive number of bits ({})",
+                name,
+                s,
+                bits
+            );
+            throw nb::value_error(msg.c_str());
+        }
+        stages.push_back({ { bits, stage_int_bits[s] },
+                           stage_quantization[s],
+                           stage_overflow[s] });
+        is_stochastic |= is_stochastic_quantization(stage_quantization[s]);
     }
 
+    const ComplexFixedPointFFT transform(
+        n, spec(), std::move(stages), tw_bits, inverse
+    );
+
+    // The inverse transform is scaled by `1 / n` by moving the binary point
+    const APyFixedSpec dst_spec = transform.dst_spec();
+    const int res_int_bits
+        = inverse ? dst_spec.int_bits - int(n_stages) : dst_spec.int_bits;
+    APyCFixedArray res(_shape, dst_spec.bits, res_int_bits);
+
+    // Each frame is a transform of `n` items, `inner` items apart
+    const std::size_t inner = strides_from_shape(_shape)[ax];
+    const std::size_t n_frames = _nitems / n;
+    const std::size_t res_itemsize = res._itemsize;
+
+    const bool use_threadpool
+        = is_mac_with_threadpool_justified(_nitems * n_stages) && !is_stochastic;
+    threadpool_chunked_for(use_threadpool, n_frames, [&](auto begin, auto end) {
+        auto workspace = transform.make_workspace();
+        for (std::size_t f = begin; f < end; f++) {
+            const std::size_t first = (f / inner) * n * inner + f % inner;
+            transform(
+                std::cbegin(_data) + first * _itemsize,
+                std::begin(res._data) + first * res_itemsize,
+                inner,
+                workspace
+            );
+        }
+    });
+
     return res;
 }
@@ -15,6 +15,14 @@
 #include <nanobind/stl/variant.h> // std::variant (with nanobind support)
 namespace nb = nanobind;
 
+#include <optional> // std::optional
+#include <variant>  // std::variant
+#include <vector>   // std::vector
+
+//! A per-stage parameter of `APyCFixedArray::fft`: either a single value for all
+//! stages, or one value per stage
+template <typename T> using FFTStageParam_t = std::variant<T, std::vector<T>>;
+
 class APyCFixedArray : public APyArray<apy_limb_t, APyCFixedArray> {
 
     /* ****************************************************************************** *
@@ -62,6 +70,12 @@ public:
         return APyCFixedArray(shape, _bits, _int_bits);
     }
 
+    APyCFixedArray
+    create_array(const std::vector<std::size_t>& shape, vector_type&& data) const
+    {
+        return APyCFixedArray(shape, _bits, _int_bits, std::move(data));
+    }
+
     static APyCFixedArray
     create_array_static(const std::vector<std::size_t>& shape, const APyCFixed& fix)
     {
@@ -83,12 +97,27 @@ public:
     //! Return the bit specification
     APY_INLINE APyFixedSpec spec() const noexcept { return { _bits, _int_bits }; }
 
+    //! Shape of the real and imaginary limbs of each item, when exported through
+    //! DLPack
+    std::vector<std::size_t> dlpack_item_shape() const
+    {
+        const std::size_t limbs = _itemsize / 2;
+        return limbs > 1 ? std::vector<std::size_t> { 2, limbs }
+                         : std::vector<std::size_t> { 2 };
+    }
+
     //! Test if using threadpool is justified based on number of multiply-accumulate
     bool is_mac_with_threadpool_justified(std::size_t n_mac) const noexcept
     {
         return n_mac >= thread_pool_settings.apycfixedarray.n_mac_threshold;
     }
 
+    //! Test if using threadpool is justified based on number of elementwise operations
+    bool is_elementwise_with_threadpool_justified(std::size_t n_elem) const noexcept
+    {
+        return n_elem >= thread_pool_settings.apycfixedarray.n_elem_threshold;
+    }
+
     /* ****************************************************************************** *
      * *                          Python constructors                               * *
      * ****************************************************************************** */
@@ -115,6 +144,12 @@ public:
         const std::vector<std::size_t>& shape, int bits, int int_bits
     );
 
+    //! Constructor: specify only shape and word-length. The data is left unspecified
+    //! and every limb must be written before it is read.
+    explicit APyCFixedArray(
+        cow_no_init_t, const std::vector<std::size_t>& shape, int bits, int int_bits
+    );
+
     //! Constructor: specify shape and word-length and steal the data from vector
     explicit APyCFixedArray(
         const std::vector<std::size_t>& shape, int bits, int int_bits, vector_type&& v
@@ -221,6 +256,16 @@ public:
     //! Perform a linear convolution with `other` using `mode`
     APyCFixedArray convolve(const APyCFixedArray& other, ConvolutionMode mode) const;
 
+    //! Perform a two-dimensional convolution with `other` over the last two axes
+    APyCFixedArray convolve2d(
+        const APyCFixedArray& other, ConvolutionMode mode, const PyShapeParam_t& stride
+    ) const;
+
+    //! Perform a correlation with `other` over the last `other.ndim()` axes
+    APyCFixedArray correlate(
+        const APyCFixedArray& other, ConvolutionMode mode, const PyShapeParam_t& stride
+    ) const;
+
     /* ****************************************************************************** *
      * *                          Public member functions                           * *
      * ****************************************************************************** */
@@ -239,7 +284,7 @@ public:
     std::string repr() const;
 
     //! Convert to a NumPy array
-    nb::ndarray<nb::numpy, std::complex<double>> to_numpy(
+    nb::ndarray<nb::numpy> to_numpy(
         std::optional<nb::object> dtype = std::nullopt,
         std::optional<bool> copy = std::nullopt
     ) const;
@@ -289,6 +334,21 @@ public:
         std::optional<int> bits = std::nullopt
     ) const;
 
+    /*!
+     * Fused multiply-add, evaluating `*this * b + c` into a full-precision accumulator
+     * and casting the accumulator to the new format, quantizing and overflowing the
+     * real and imaginary parts only once.
+     */
+    APyCFixedArray fma(
+        const APyCFixedArray& b,
+        const APyCFixedArray& c,
+        std::optional<int> int_bits = std::nullopt,
+        std::optional<int> frac_bits = std::nullopt,
+        std::optional<QuantizationMode> quantization = std::nullopt,
+        std::optional<OverflowMode> overflow = std::nullopt,
+        std::optional<int> bits = std::nullopt
+    ) const;
+
     //! Python pickling
     std::tuple<int, int, std::vector<std::size_t>, std::vector<std::uint64_t>>
     python_pickle() const;
@@ -306,6 +366,20 @@ public:
     //! Return Hermitian transpose
     APyCFixedArray hermitian_transpose() const;
 
+    //! Bit-true radix-2 fast Fourier transform along `axis`, or its inverse if
+    //! `inverse` is set. The format, quantization, and overflow of each butterfly stage
+    //! are given per stage or for all stages.
+    APyCFixedArray fft(
+        int axis = -1,
+        const std::optional<FFTStageParam_t<int>>& int_bits = std::nullopt,
+        const std::optional<FFTStageParam_t<int>>& frac_bits = std::nullopt,
+        const std::optional<FFTStageParam_t<QuantizationMode>>& quantization
+        = std::nullopt,
+        const std::optional<FFTStageParam_t<OverflowMode>>& overflow = std::nullopt,
+        std::optional<int> twiddle_bits = std::nullopt,
+        bool inverse = false
+    ) const;
+
     /* ****************************************************************************** *
      * *                           Static array creation                            * *
      * ****************************************************************************** */
@@ -346,6 +420,15 @@ public:
         std::optional<int> bits = std::nullopt
     );
 
+    //! Create an `APyCFixedArray` from the limbs of a DLPack-compatible array, laid out
+    //! as exported by `__dlpack__`
+    static APyCFixedArray from_dlpack(
+        const nb::ndarray<>& ndarray,
+        std::optional<int> int_bits = std::nullopt,
+        std::optional<int> frac_bits = std::nullopt,
+        std::optional<int> bits = std::nullopt
+    );
+
     /* ****************************************************************************** *
      *                           Conversion to other types                            *
      * ****************************************************************************** */
@@ -9,9 +9,12 @@
 #include <nanobind/operators.h>
 #include <nanobind/stl/complex.h>
 #include <nanobind/stl/optional.h>
+#include <nanobind/stl/tuple.h>
+#include <nanobind/stl/vector.h>
 
 namespace nb = nanobind;
 
+#include <tuple>
 #include <type_traits>
 
 /*
@@ -209,6 +212,19 @@ void bind_cfixed_array(nb::module_& m)
          */
         .def("__getstate__", &APyCFixedArray::python_pickle)
         .def("__setstate__", &APyCFixedArray::python_unpickle)
+        .def("__reduce_ex__", &APyCFixedArray::python_reduce_ex, nb::arg("protocol"))
+
+        /*
+         * Native binary file format payload (see `apytypes.save` and `apytypes.load`)
+         */
+        .def("_write_raw", &APyCFixedArray::python_write_raw, nb::arg("file"))
+        .def(
+            "_from_raw",
+            &APyCFixedArray::python_from_raw,
+            nb::arg("shape"),
+            nb::arg("payload")
+        )
+        .def("_raw_payload", &APyCFixedArray::python_raw_payload)
 
         /*
          * Arithmetic operations
@@ -417,10 +433,20 @@ void bind_cfixed_array(nb::module_& m)
             The returned array has the same `shape` and values as `self`. This
             method rounds away from infinity on ties.
 
+            If `dtype` is :class:`numpy.complex64`, or a single- or half-precision
+            floating-point type, a :class:`numpy.complex64` array is returned instead,
+            with the real and imaginary parts rounded once, to nearest with ties to
+            even. Other values of `dtype` give a :class:`numpy.complex128` array. Large
+            arrays are converted in parallel.
+
+            .. versionchanged:: 0.6
+                A :class:`numpy.complex64` array is returned for the corresponding
+                `dtype`.
+
             Parameters
             ----------
-            dtype : :py:class:`numpy.dtype`
-                The desired data type of the output array. This parameter is currently ignored.
+            dtype : :py:class:`numpy.dtype`, optional
+                The desired floating-point data type of the output array.
             copy : :class:`bool`
                 Whether to copy the data or not. Must be :code:`True` or :code:`None`.
 
@@ -716,6 +742,52 @@ void bind_cfixed_array(nb::module_& m)
             :class:`APyCFixedArray`
             )pbdoc"
         )
+        .def(
+            "fma",
+            &APyCFixedArray::fma,
+            nb::arg("b"),
+            nb::arg("c"),
+            nb::arg("int_bits") = nb::none(),
+            nb::arg("frac_bits") = nb::none(),
+            nb::arg("quantization") = nb::none(),
+            nb::arg("overflow") = nb::none(),
+            nb::arg("bits") = nb::none(),
+            R"pbdoc(
+            Fused multiply-add, ``self * b + c``, with a single cast of the result.
+
+            The products and sums are evaluated in full precision, using the same word
+            lengths as ``self * b + c``. The real and imaginary parts are then quantized
+            and overflowed once into the new format. The result is identical to
+            ``(self * b + c).cast(int_bits, frac_bits, quantization, overflow, bits)``,
+            but no intermediate arrays are created.
+
+            Exactly two of three bit-specifiers (`bits`, `int_bits`, `frac_bits`) must
+            be set.
+
+            .. versionadded:: 0.6
+
+            Parameters
+            ----------
+            b : :class:`APyCFixedArray`
+                The array to multiply with.
+            c : :class:`APyCFixedArray`
+                The array to add to the product.
+            int_bits : :class:`int`, optional
+                Number of integer bits in the result.
+            frac_bits : :class:`int`, optional
+                Number of fractional bits in the result.
+            quantization : :class:`QuantizationMode`, optional
+                Quantization mode to use in the cast.
+            overflow : :class:`OverflowMode`, optional
+                Overflowing mode to use in the cast.
+            bits : :class:`int`, optional
+                Total number of bits in the result.
+
+            Returns
+            -------
+            :class:`APyCFixedArray`
+            )pbdoc"
+        )
         .def(
             "broadcast_to",
             &APyCFixedArray::broadcast_to_python,
@@ -779,6 +851,285 @@ void bind_cfixed_array(nb::module_& m)
             nb::arg("other"),
             nb::arg("mode") = "full"
         )
+        .def(
+            "convolve2d",
+            &APyCFixedArray::convolve2d,
+            nb::arg("other"),
+            nb::arg("mode") = ConvolutionMode::FULL,
+            nb::arg("stride") = 1,
+            R"pbdoc(
+            Return the two-dimensional discrete linear convolution with another array.
+
+            The convolution is taken over the last two axes. The array `other` must be
+            two-dimensional, and any leading axes of `self` are batch axes: each
+            two-dimensional slice of `self` is convolved with `other`. Along each of the
+            two axes, `mode` selects the outputs as for :func:`convolve`. With `stride`,
+            only every `stride`-th output is computed, as in a strided convolutional
+            layer.
+
+            The result format is that of :func:`convolve`, with the length of the
+            shorter array replaced by the largest number of products of an output. An
+            active :class:`APyFixedAccumulatorContext` sets the result format instead.
+
+            .. versionadded:: 0.6
+
+            Parameters
+            ----------
+            other : :class:`APyCFixedArray`
+                The two-dimensional array to convolve with.
+            mode : :class:`ConvolutionMode` or {'full', 'same', 'valid'}, default: :class:`~ConvolutionMode.FULL`
+                The outputs to keep along each axis, see :func:`convolve`.
+            stride : :class:`int` or :class:`tuple` of :class:`int`, default: 1
+                Step between the kept outputs, either for both axes or one per axis.
+
+            Returns
+            -------
+            convolved : :class:`APyCFixedArray`
+                The convolved array.
+            )pbdoc"
+        )
+        .def(
+            "convolve2d",
+            [](const APyCFixedArray& self,
+               const APyCFixedArray& other,
+               const std::string& mode,
+               const PyShapeParam_t& stride) {
+                return self.convolve2d(other, get_conv_mode(mode), stride);
+            },
+            nb::arg("other"),
+            nb::arg("mode") = "full",
+            nb::arg("stride") = 1
+        )
+        .def(
+            "correlate",
+            &APyCFixedArray::correlate,
+            nb::arg("other"),
+            nb::arg("mode") = ConvolutionMode::FULL,
+            nb::arg("stride") = 1,
+            R"pbdoc(
+            Return the discrete linear cross-correlation with another array.
+
+            The correlation is taken over the last :code:`other.ndim` axes, and any
+            leading axes of `self` are batch axes. For one-dimensional arrays, the
+            result is that of :func:`numpy.correlate`, but `mode` defaults to
+            :class:`~ConvolutionMode.FULL`. The correlation is the convolution with the
+            conjugate of `other`, reversed along all axes. The conjugate has one more
+            integer bit than `other`, and so has the result.
+
+            With a `stride`, only every `stride`-th output is computed, as in a strided
+            convolutional layer. A correlation with the kernel of a convolutional layer
+            in :class:`~ConvolutionMode.VALID` mode sums over its input channels.
+
+            The result format is that of :func:`convolve`, with the length of the
+            shorter array replaced by the largest number of products of an output. An
+            active :class:`APyFixedAccumulatorContext` sets the result format instead.
+
+            .. versionadded:: 0.6
+
+            Parameters
+            ----------
+            other : :class:`APyCFixedArray`
+                The array to correlate with.
+            mode : :class:`ConvolutionMode` or {'full', 'same', 'valid'}, default: :class:`~ConvolutionMode.FULL`
+                The outputs to keep along each axis, see :func:`convolve`. With
+                :class:`~ConvolutionMode.SAME`, the outputs are centered as for
+                :func:`numpy.correlate`.
+            stride : :class:`int` or :class:`tuple` of :class:`int`, default: 1
+                Step between the kept outputs, either for all axes or one per axis.
+
+            Returns
+            -------
+            correlated : :class:`APyCFixedArray`
+                The correlated array.
+            )pbdoc"
+        )
+        .def(
+            "correlate",
+            [](const APyCFixedArray& self,
+               const APyCFixedArray& other,
+               const std::string& mode,
+               const PyShapeParam_t& stride) {
+                return self.correlate(other, get_conv_mode(mode), stride);
+            },
+            nb::arg("other"),
+            nb::arg("mode") = "full",
+            nb::arg("stride") = 1
+        )
+        .def(
+            "fft",
+            [](const APyCFixedArray& self,
+               int axis,
+               const std::optional<FFTStageParam_t<int>>& int_bits,
+               const std::optional<FFTStageParam_t<int>>& frac_bits,
+               const std::optional<FFTStageParam_t<QuantizationMode>>& quantization,
+               const std::optional<FFTStageParam_t<OverflowMode>>& overflow,
+               std::optional<int> twiddle_bits) {
+                return self.fft(
+                    axis, int_bits, frac_bits, quantization, overflow, twiddle_bits
+                );
+            },
+            nb::arg("axis") = -1,
+            nb::arg("int_bits") = nb::none(),
+            nb::arg("frac_bits") = nb::none(),
+            nb::arg("quantization") = nb::none(),
+            nb::arg("overflow") = nb::none(),
+            nb::arg("twiddle_bits") = nb::none(),
+            R"pbdoc(
+            Compute the bit-true discrete Fourier transform using a radix-2 fast
+            Fourier transform.
+
+            The transform is evaluated as :code:`log2(N)` stages of decimation-in-time
+            butterflies, as in a hardware implementation. In each stage, the butterfly
+            outputs :code:`a + w * b` and :code:`a - w * b` are computed exactly and are
+            then quantized and overflowed to the format of the stage. The twiddle
+            factors :code:`w = exp(-2j * pi * k / N)` are rounded once, to the nearest
+            value with ties away from zero.
+
+            .. versionadded:: 0.6
+
+            Parameters
+            ----------
+            axis : :class:`int`, default: -1
+                Axis along which to transform. The length along the axis must be a
+                power of two.
+            int_bits : :class:`int` or :class:`list` of :class:`int`, optional
+                Number of integer bits of the result of each butterfly stage, either
+                for all stages or as one value per stage. Defaults to the integer bits
+                of the input plus one bit per stage, plus one, which never overflows.
+            frac_bits : :class:`int` or :class:`list` of :class:`int`, optional
+                Number of fractional bits of the result of each butterfly stage, either
+                for all stages or as one value per stage. Defaults to the fractional
+                bits of the input.
+            quantization : :class:`QuantizationMode` or :class:`list` of \
+            :class:`QuantizationMode`, optional
+                Quantization mode of each butterfly stage. Defaults to the quantization
+                mode of the current :func:`set_fixed_cast_mode` context.
+            overflow : :class:`OverflowMode` or :class:`list` of \
+            :class:`OverflowMode`, optional
+                Overflow mode of each butterfly stage. Defaults to the overflow mode of
+                the current :func:`set_fixed_cast_mode` context.
+            twiddle_bits : :class:`int`, optional
+                Total number of bits of the twiddle factors, of which two are integer
+                bits. Must be at least two. Defaults to the number of bits of the input,
+                or two, whichever is larger.
+
+            Returns
+            -------
+            :class:`APyCFixedArray`
+                The transformed array, in the format of the last stage.
+
+            Raises
+            ------
+            :class:`ValueError`
+                If the length along `axis` is not a power of two, or if the length of a
+                per-stage list is not :code:`log2(N)`.
+            :class:`IndexError`
+                If `axis` is out of range.
+
+            See Also
+            --------
+            ifft
+
+            Examples
+            --------
+            >>> import apytypes as apy
+            >>> x = apy.APyCFixedArray.from_complex(
+            ...     [1, 1j, -1, -1j], int_bits=2, frac_bits=2
+            ... )
+            >>> x.fft()
+            APyCFixedArray([ (0, 0), (16, 0),  (0, 0),  (0, 0)], int_bits=5, frac_bits=2)
+            )pbdoc"
+        )
+        .def(
+            "ifft",
+            [](const APyCFixedArray& self,
+               int axis,
+               const std::optional<FFTStageParam_t<int>>& int_bits,
+               const std::optional<FFTStageParam_t<int>>& frac_bits,
+               const std::optional<FFTStageParam_t<QuantizationMode>>& quantization,
+               const std::optional<FFTStageParam_t<OverflowMode>>& overflow,
+               std::optional<int> twiddle_bits) {
+                return self.fft(
+                    axis,
+                    int_bits,
+                    frac_bits,
+                    quantization,
+                    overflow,
+                    twiddle_bits,
+                    /* inverse = */ true
+                );
+            },
+            nb::arg("axis") = -1,
+            nb::arg("int_bits") = nb::none(),
+            nb::arg("frac_bits") = nb::none(),
+            nb::arg("quantization") = nb::none(),
+            nb::arg("overflow") = nb::none(),
+            nb::arg("twiddle_bits") = nb::none(),
+            R"pbdoc(
+            Compute the bit-true inverse discrete Fourier transform using a radix-2
+            fast Fourier transform.
+
+            The butterfly stages are evaluated as in :func:`fft`, using the conjugate
+            twiddle factors :code:`w = exp(2j * pi * k / N)`. The scaling by
+            :code:`1 / N` is exact: the binary point of the result is moved
+            :code:`log2(N)` bits to the left.
+
+            .. versionadded:: 0.6
+
+            Parameters
+            ----------
+            axis : :class:`int`, default: -1
+                Axis along which to transform. The length along the axis must be a
+                power of two.
+            int_bits : :class:`int` or :class:`list` of :class:`int`, optional
+                Number of integer bits of the result of each butterfly stage, either
+                for all stages or as one value per stage. Defaults to the integer bits
+                of the input plus one bit per stage, plus one, which never overflows.
+            frac_bits : :class:`int` or :class:`list` of :class:`int`, optional
+                Number of fractional bits of the result of each butterfly stage, either
+                for all stages or as one value per stage. Defaults to the fractional
+                bits of the input.
+            quantization : :class:`QuantizationMode` or :class:`list` of \
+            :class:`QuantizationMode`, optional
+                Quantization mode of each butterfly stage. Defaults to the quantization
+                mode of the current :func:`set_fixed_cast_mode` context.
+            overflow : :class:`OverflowMode` or :class:`list` of \
+            :class:`OverflowMode`, optional
+                Overflow mode of each butterfly stage. Defaults to the overflow mode of
+                the current :func:`set_fixed_cast_mode` context.
+            twiddle_bits : :class:`int`, optional
+                Total number of bits of the twiddle factors, of which two are integer
+                bits. Must be at least two. Defaults to the number of bits of the input,
+                or two, whichever is larger.
+
+            Returns
+            -------
+            :class:`APyCFixedArray`
+                The transformed array, with :code:`log2(N)` fewer integer bits than the
+                last stage.
+
+            Raises
+            ------
+            :class:`ValueError`
+                If the length along `axis` is not a power of two, or if the length of a
+                per-stage list is not :code:`log2(N)`.
+            :class:`IndexError`
+                If `axis` is out of range.
+
+            See Also
+            --------
+            fft
+
+            Examples
+            --------
+            >>> import apytypes as apy
+            >>> x = apy.APyCFixedArray.from_complex(
+            ...     [1, 1j, -1, -1j], int_bits=2, frac_bits=2
+            ... )
+            >>> x.fft().ifft()
+            APyCFixedArray([  (16, 0),   (0, 16), (1008, 0), (0, 1008)], int_bits=6, frac_bits=4)
+            )pbdoc"
+        )
         .def(
             "squeeze",
             &APyCFixedArray::squeeze,
@@ -1298,6 +1649,47 @@ void bind_cfixed_array(nb::module_& m)
             :class:`APyCFixedArray`
             )pbdoc"
         )
+        .def_static(
+            "from_dlpack",
+            &APyCFixedArray::from_dlpack,
+            nb::arg("x"),
+            nb::arg("int_bits") = nb::none(),
+            nb::arg("frac_bits") = nb::none(),
+            nb::arg("bits") = nb::none(),
+            R"pbdoc(
+            Create an :class:`APyCFixedArray` object from limbs in a DLPack-compatible
+            array.
+
+            The limbs are laid out as exported by :func:`__dlpack__`, with the real and
+            imaginary parts along an additional dimension of size two. For single-limb
+            formats (at most 64 bits on 64-bit platforms), `x` holds the bit pattern of
+            each part, and may be of any integer type. For multi-limb formats, yet
+            another innermost dimension holds the limbs of each part, least significant
+            limb first. Bits outside of the format are discarded by wrapping. Exactly
+            two of the three bit-specifiers (`bits`, `int_bits`, `frac_bits`) must be
+            set.
+
+            Only arrays in CPU memory can be imported, other devices raise
+            :class:`BufferError`.
+
+            .. versionadded:: 0.6
+
+            Parameters
+            ----------
+            x : object
+                DLPack-compatible array, e.g., a NumPy array or a PyTorch tensor.
+            int_bits : :class:`int`, optional
+                Number of integer bits in the created fixed-point tensor.
+            frac_bits : :class:`int`, optional
+                Number of fractional bits in the created fixed-point tensor.
+            bits : :class:`int`, optional
+                Total number of bits in the created fixed-point tensor.
+
+            Returns
+            -------
+            :class:`APyCFixedArray`
+            )pbdoc"
+        )
         .def_static(
             "zeros",
             &APyCFixedArray::zeros,
@@ -1553,6 +1945,57 @@ void bind_cfixed_array(nb::module_& m)
             nb::arg("dtype") = nb::none(),
             nb::arg("copy") = nb::none()
         )
+        .def(
+            "__dlpack__",
+            &APyCFixedArray::python_dlpack<apy_limb_signed_t>,
+            nb::kw_only(),
+            nb::arg("stream") = nb::none(),
+            nb::arg("max_version") = nb::none(),
+            nb::arg("dl_device") = nb::none(),
+            nb::arg("copy") = nb::none(),
+            R"pbdoc(
+            Export the underlying limbs through the DLPack protocol.
+
+            The limbs are exported without a copy, unless `copy` is :code:`True`, as
+            signed integers of the limb size (64 bits on 64-bit platforms). An
+            additional dimension of size two holds the real and imaginary parts of each
+            element. For single-limb arrays (at most 64 bits), each part is the two's
+            complement bit pattern of the value, sign-extended to the full limb. For
+            multi-limb arrays, yet another innermost dimension holds the limbs of each
+            part, least significant limb first.
+
+            The unsigned bit patterns of :func:`to_bits` are the exported values modulo
+            ``2**bits``. They are not exported without a copy, as the limbs are stored
+            sign-extended, but ``to_bits(numpy=True)`` returns them in a NumPy array,
+            which in turn supports DLPack.
+
+            .. versionadded:: 0.6
+
+            Examples
+            --------
+            >>> import apytypes as apy
+            >>> import numpy as np
+            >>> a = apy.APyCFixedArray.from_complex(
+            ...     [1 + 2j, -0.5j], int_bits=4, frac_bits=2
+            ... )
+            >>> np.from_dlpack(a)
+            array([[ 4,  8],
+                   [ 0, -2]])
+
+            See Also
+            --------
+            from_dlpack
+            )pbdoc"
+        )
+        .def(
+            "__dlpack_device__",
+            [](const APyCFixedArray&) { return std::make_tuple(1, 0); },
+            R"pbdoc(
+            Return the DLPack device of the array, which is always the CPU.
+
+            .. versionadded:: 0.6
+            )pbdoc"
+        )
 
         ;
 
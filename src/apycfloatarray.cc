@@ -1,6 +1,7 @@
 #include "apycfloatarray.h"
 #include "apycfixed.h"
 #include "apycfloat_util.h"
+#include "apyconvolve.h"
 #include "apyfloat_util.h"
 #include "apyfloatarray.h"
 #include "apytypes_common.h"
@@ -13,7 +14,8 @@
 #include <nanobind/stl/complex.h> // std::complex<double> (with nanobind support)
 #include <nanobind/stl/variant.h> // std::variant (with nanobind support)
 
-#include <cmath> // std::isnan, std::signbit
+#include <algorithm> // std::max
+#include <cmath>     // std::isnan, std::signbit
 #include <initializer_list>
 #include <optional>
 #include <utility>
@@ -35,6 +37,36 @@ APyCFloatArray::APyCFloatArray(
 {
 }
 
+APyCFloatArray::APyCFloatArray(
+    cow_no_init_t,
+    const std::vector<std::size_t>& shape,
+    std::uint8_t exp_bits,
+    std::uint8_t man_bits,
+    exp_t bias
+)
+    : APyArray(
+          shape, /* itemsize= */ 2, vector_type(2 * fold_shape(shape), cow_no_init)
+      )
+    , exp_bits(exp_bits)
+    , man_bits(man_bits)
+    , bias(bias)
+{
+}
+
+APyCFloatArray::APyCFloatArray(
+    const std::vector<std::size_t>& shape,
+    std::uint8_t exp_bits,
+    std::uint8_t man_bits,
+    exp_t bias,
+    vector_type&& v
+)
+    : APyArray(shape, /* itemsize= */ 2, std::move(v))
+    , exp_bits(exp_bits)
+    , man_bits(man_bits)
+    , bias(bias)
+{
+}
+
 APyCFloatArray::APyCFloatArray(const APyFloatArray& rhs)
     : APyArray(rhs._shape, /* itemsize= */ 2)
     , exp_bits(rhs.get_exp_bits())
@@ -682,16 +714,20 @@ bool APyCFloatArray::_check_and_set_man_bits_from_ndarray(
 
 std::string APyCFloatArray::repr() const
 {
-    const auto sign_fmt = [](auto cbegin_it, auto) -> std::string {
+    const auto sign_fmt = [](auto cbegin_it, auto, auto& out) {
         int real_sign = int(cbegin_it->sign);
         int imag_sign = int((cbegin_it + 1)->sign);
-        return fmt::format("({}, {})", real_sign, imag_sign);
+        fmt::format_to(std::back_inserter(out), "({}, {})", real_sign, imag_sign);
     };
-    const auto exp_fmt = [](auto cbegin_it, auto) -> std::string {
-        return fmt::format("({}, {})", cbegin_it->exp, (cbegin_it + 1)->exp);
+    const auto exp_fmt = [](auto cbegin_it, auto, auto& out) {
+        fmt::format_to(
+            std::back_inserter(out), "({}, {})", cbegin_it->exp, (cbegin_it + 1)->exp
+        );
     };
-    const auto man_fmt = [](auto cbegin_it, auto) -> std::string {
-        return fmt::format("({}, {})", cbegin_it->man, (cbegin_it + 1)->man);
+    const auto man_fmt = [](auto cbegin_it, auto, auto& out) {
+        fmt::format_to(
+            std::back_inserter(out), "({}, {})", cbegin_it->man, (cbegin_it + 1)->man
+        );
     };
 
     std::initializer_list<formatter_t> formatters { sign_fmt, exp_fmt, man_fmt };
@@ -805,10 +841,10 @@ nb::list APyCFloatArray::to_bits_python_recursive_descent(
 
 std::string APyCFloatArray::to_string_dec() const
 {
-    const auto formatter = [spec = spec()](auto cbegin_it, auto) -> std::string {
+    const auto formatter = [spec = spec()](auto cbegin_it, auto, auto& out) {
         const APyFloatData& re = *(cbegin_it + 0);
         const APyFloatData& im = *(cbegin_it + 1);
-        return complex_floating_point_to_str_dec(re, im, spec);
+        out += complex_floating_point_to_str_dec(re, im, spec);
     };
 
     return array_format(formatter, 88, false);
@@ -826,16 +862,16 @@ std::string APyCFloatArray::to_string(int base) const
     }
 }
 
-nb::ndarray<nb::numpy, std::complex<double>> APyCFloatArray::to_numpy(
+nb::ndarray<nb::numpy> APyCFloatArray::to_numpy(
     std::optional<nb::object> dtype, std::optional<bool> copy
 ) const
 {
-    (void)dtype;
-
-    ComplexFloatingPointToDouble<vector_const_iterator> converter(spec());
-    return nb::ndarray<nb::numpy, std::complex<double>>(
-        to_ndarray<std::complex<double>>(converter, "to_numpy", copy)
-    );
+    const APyFloatSpec src_spec = spec();
+    const APyFloatData* src = _data.data();
+    const auto convert_block = [&](std::size_t begin, std::size_t end, auto* dst) {
+        floating_point_to_floats(src + 2 * begin, 2 * (end - begin), src_spec, dst);
+    };
+    return to_numpy_floats</*IS_COMPLEX=*/true>(convert_block, dtype, copy);
 }
 
 bool APyCFloatArray::is_identical(const nb::object& other, bool ignore_zero_sign) const
@@ -899,9 +935,10 @@ void APyCFloatArray::python_unpickle(
 APyCFloatArray APyCFloatArray::conj() const
 {
     APyCFloatArray res = *this;
+    APyFloatData* res_data = res._data.data(); // copy-on-write once, outside loop
     VECTORIZE_LOOP
     for (std::size_t i = 0; i < _nitems; i++) {
-        res._data[2 * i + 1].sign ^= true;
+        res_data[2 * i + 1].sign ^= true;
     }
     return res;
 }
@@ -910,9 +947,10 @@ APyCFloatArray APyCFloatArray::conj() const
 APyCFloatArray APyCFloatArray::hermitian_transpose() const
 {
     APyCFloatArray res = transpose(std::nullopt);
+    APyFloatData* res_data = res._data.data(); // copy-on-write once, outside loop
     VECTORIZE_LOOP
     for (std::size_t i = 0; i < _nitems; i++) {
-        res._data[2 * i + 1].sign ^= true;
+        res_data[2 * i + 1].sign ^= true;
     }
     return res;
 }
@@ -953,11 +991,19 @@ APyCFloatArray APyCFloatArray::operator+(const APyCFloatArray& rhs) const
     const std::uint8_t res_man_bits = std::max(man_bits, rhs.man_bits);
     const exp_t res_bias = calc_bias(res_exp_bits, spec(), rhs.spec());
     const QuantizationMode& qntz = get_float_quantization_mode();
-    APyCFloatArray res(_shape, res_exp_bits, res_man_bits, res_bias);
+    APyCFloatArray res(cow_no_init, _shape, res_exp_bits, res_man_bits, res_bias);
 
     // Perform addition
     auto add = FloatingPointAdder<>(spec(), rhs.spec(), res.spec(), qntz);
-    add(&_data[0], &rhs._data[0], &res._data[0], 2 * res._nitems);
+    floating_point_elementwise<1, 1, 1>(
+        add,
+        &_data[0],
+        &rhs._data[0],
+        &res._data[0],
+        2 * res._nitems,
+        qntz,
+        is_elementwise_with_threadpool_justified(res._nitems)
+    );
 
     return res;
 }
@@ -968,11 +1014,19 @@ APyCFloatArray APyCFloatArray::operator+(const APyCFloat& rhs) const
     const std::uint8_t res_man_bits = std::max(man_bits, rhs.man_bits);
     const exp_t res_bias = calc_bias(res_exp_bits, spec(), rhs.spec());
     const QuantizationMode& qntz = get_float_quantization_mode();
-    APyCFloatArray res(_shape, res_exp_bits, res_man_bits, res_bias);
+    APyCFloatArray res(cow_no_init, _shape, res_exp_bits, res_man_bits, res_bias);
 
     // Perform addition
     auto add = ComplexFloatingPointAdder<1, 0, 1>(spec(), rhs.spec(), res.spec(), qntz);
-    add(&_data[0], &rhs._data[0], &res._data[0], res._nitems);
+    floating_point_elementwise<1, 0, 1, 2>(
+        add,
+        &_data[0],
+        &rhs._data[0],
+        &res._data[0],
+        res._nitems,
+        qntz,
+        is_elementwise_with_threadpool_justified(res._nitems)
+    );
     return res;
 }
 
@@ -988,11 +1042,19 @@ APyCFloatArray APyCFloatArray::operator-(const APyCFloatArray& rhs) const
     const std::uint8_t res_man_bits = std::max(man_bits, rhs.man_bits);
     const exp_t res_bias = calc_bias(res_exp_bits, spec(), rhs.spec());
     const QuantizationMode& qntz = get_float_quantization_mode();
-    APyCFloatArray res(_shape, res_exp_bits, res_man_bits, res_bias);
+    APyCFloatArray res(cow_no_init, _shape, res_exp_bits, res_man_bits, res_bias);
 
     // Perform subtraction
     auto sub = FloatingPointSubtractor<>(spec(), rhs.spec(), res.spec(), qntz);
-    sub(&_data[0], &rhs._data[0], &res._data[0], 2 * res._nitems);
+    floating_point_elementwise<1, 1, 1>(
+        sub,
+        &_data[0],
+        &rhs._data[0],
+        &res._data[0],
+        2 * res._nitems,
+        qntz,
+        is_elementwise_with_threadpool_justified(res._nitems)
+    );
 
     return res;
 }
@@ -1003,11 +1065,19 @@ APyCFloatArray APyCFloatArray::operator-(const APyCFloat& rhs) const
     const std::uint8_t res_man_bits = std::max(man_bits, rhs.man_bits);
     const exp_t res_bias = calc_bias(res_exp_bits, spec(), rhs.spec());
     const QuantizationMode& qntz = get_float_quantization_mode();
-    APyCFloatArray res(_shape, res_exp_bits, res_man_bits, res_bias);
+    APyCFloatArray res(cow_no_init, _shape, res_exp_bits, res_man_bits, res_bias);
 
     // Perform subtraction
     ComplexFloatingPointSubtractor<1, 0, 1> sub(spec(), rhs.spec(), res.spec(), qntz);
-    sub(&_data[0], &rhs._data[0], &res._data[0], res._nitems);
+    floating_point_elementwise<1, 0, 1, 2>(
+        sub,
+        &_data[0],
+        &rhs._data[0],
+        &res._data[0],
+        res._nitems,
+        qntz,
+        is_elementwise_with_threadpool_justified(res._nitems)
+    );
     return res;
 }
 
@@ -1026,11 +1096,19 @@ APyCFloatArray APyCFloatArray::rsub(const APyCFloat& lhs) const
     const std::uint8_t res_man_bits = std::max(man_bits, lhs.get_man_bits());
     const exp_t res_bias = calc_bias(res_exp_bits, spec(), lhs.spec());
     const QuantizationMode& qntz = get_float_quantization_mode();
-    APyCFloatArray res(_shape, res_exp_bits, res_man_bits, res_bias);
+    APyCFloatArray res(cow_no_init, _shape, res_exp_bits, res_man_bits, res_bias);
 
     // Perform subtraction
     ComplexFloatingPointSubtractor<0, 1, 1> sub(lhs.spec(), spec(), res.spec(), qntz);
-    sub(&lhs._data[0], &_data[0], &res._data[0], _nitems);
+    floating_point_elementwise<0, 1, 1, 2>(
+        sub,
+        &lhs._data[0],
+        &_data[0],
+        &res._data[0],
+        _nitems,
+        qntz,
+        is_elementwise_with_threadpool_justified(_nitems)
+    );
 
     return res;
 }
@@ -1045,11 +1123,19 @@ APyCFloatArray APyCFloatArray::operator*(const APyCFloatArray& rhs) const
     const std::uint8_t res_man_bits = std::max(man_bits, rhs.man_bits);
     const exp_t res_bias = calc_bias(res_exp_bits, spec(), rhs.spec());
     const QuantizationMode& qntz = get_float_quantization_mode();
-    APyCFloatArray res(_shape, res_exp_bits, res_man_bits, res_bias);
+    APyCFloatArray res(cow_no_init, _shape, res_exp_bits, res_man_bits, res_bias);
 
     // Perform multiplication
     auto mul = ComplexFloatingPointMultiplier<>(spec(), rhs.spec(), res.spec(), qntz);
-    mul(&_data[0], &rhs._data[0], &res._data[0], res._nitems);
+    floating_point_elementwise<1, 1, 1, 2>(
+        mul,
+        &_data[0],
+        &rhs._data[0],
+        &res._data[0],
+        res._nitems,
+        qntz,
+        is_elementwise_with_threadpool_justified(res._nitems)
+    );
 
     return res;
 }
@@ -1060,12 +1146,20 @@ APyCFloatArray APyCFloatArray::operator*(const APyCFloat& rhs) const
     const std::uint8_t res_man_bits = std::max(man_bits, rhs.man_bits);
     const exp_t res_bias = calc_bias(res_exp_bits, spec(), rhs.spec());
     const QuantizationMode& qntz = get_float_quantization_mode();
-    APyCFloatArray res(_shape, res_exp_bits, res_man_bits, res_bias);
+    APyCFloatArray res(cow_no_init, _shape, res_exp_bits, res_man_bits, res_bias);
 
     // Perform multiplication
     auto mul
         = ComplexFloatingPointMultiplier<1, 0, 1>(spec(), rhs.spec(), res.spec(), qntz);
-    mul(&_data[0], &rhs._data[0], &res._data[0], res._nitems);
+    floating_point_elementwise<1, 0, 1, 2>(
+        mul,
+        &_data[0],
+        &rhs._data[0],
+        &res._data[0],
+        res._nitems,
+        qntz,
+        is_elementwise_with_threadpool_justified(res._nitems)
+    );
 
     return res;
 }
@@ -1080,11 +1174,19 @@ APyCFloatArray APyCFloatArray::operator/(const APyCFloatArray& rhs) const
     const std::uint8_t res_man_bits = std::max(man_bits, rhs.man_bits);
     const exp_t res_bias = calc_bias(res_exp_bits, spec(), rhs.spec());
     const QuantizationMode& qntz = get_float_quantization_mode();
-    APyCFloatArray res(_shape, res_exp_bits, res_man_bits, res_bias);
+    APyCFloatArray res(cow_no_init, _shape, res_exp_bits, res_man_bits, res_bias);
 
     // Perform division
     auto div = ComplexFloatingPointDivider<>(spec(), rhs.spec(), res.spec(), qntz);
-    div(&_data[0], &rhs._data[0], &res._data[0], res._nitems);
+    floating_point_elementwise<1, 1, 1, 2>(
+        div,
+        &_data[0],
+        &rhs._data[0],
+        &res._data[0],
+        res._nitems,
+        qntz,
+        is_elementwise_with_threadpool_justified(res._nitems)
+    );
 
     return res;
 }
@@ -1095,11 +1197,19 @@ APyCFloatArray APyCFloatArray::operator/(const APyCFloat& rhs) const
     const std::uint8_t res_man_bits = std::max(man_bits, rhs.man_bits);
     const exp_t res_bias = calc_bias(res_exp_bits, spec(), rhs.spec());
     const QuantizationMode& qntz = get_float_quantization_mode();
-    APyCFloatArray res(_shape, res_exp_bits, res_man_bits, res_bias);
+    APyCFloatArray res(cow_no_init, _shape, res_exp_bits, res_man_bits, res_bias);
 
     // Perform subtraction
     ComplexFloatingPointDivider<1, 0, 1> div(spec(), rhs.spec(), res.spec(), qntz);
-    div(&_data[0], &rhs._data[0], &res._data[0], res._nitems);
+    floating_point_elementwise<1, 0, 1, 2>(
+        div,
+        &_data[0],
+        &rhs._data[0],
+        &res._data[0],
+        res._nitems,
+        qntz,
+        is_elementwise_with_threadpool_justified(res._nitems)
+    );
     return res;
 }
 
@@ -1109,11 +1219,19 @@ APyCFloatArray APyCFloatArray::rdiv(const APyCFloat& lhs) const
     const std::uint8_t res_man_bits = std::max(man_bits, lhs.get_man_bits());
     const exp_t res_bias = calc_bias(res_exp_bits, spec(), lhs.spec());
     const QuantizationMode& qntz = get_float_quantization_mode();
-    APyCFloatArray res(_shape, res_exp_bits, res_man_bits, res_bias);
+    APyCFloatArray res(cow_no_init, _shape, res_exp_bits, res_man_bits, res_bias);
 
     // Perform division
     ComplexFloatingPointDivider<0, 1, 1> div(lhs.spec(), spec(), res.spec(), qntz);
-    div(&lhs._data[0], &_data[0], &res._data[0], _nitems);
+    floating_point_elementwise<0, 1, 1, 2>(
+        div,
+        &lhs._data[0],
+        &_data[0],
+        &res._data[0],
+        _nitems,
+        qntz,
+        is_elementwise_with_threadpool_justified(_nitems)
+    );
 
     return res;
 }
@@ -1152,6 +1270,119 @@ template ComparissonArray APyCFloatArray::operator!=(const APyCFloat& rhs) const
  * *                             Other member functions                             * *
  * ********************************************************************************** */
 
+APyCFloatArray APyCFloatArray::fma(
+    const APyCFloatArray& b,
+    const APyCFloatArray& c,
+    std::optional<int> new_exp_bits,
+    std::optional<int> new_man_bits,
+    std::optional<exp_t> new_bias,
+    std::optional<QuantizationMode> quantization
+) const
+{
+    if (_shape != b._shape || _shape != c._shape) {
+        auto&& new_shape = smallest_broadcastable_shape(_shape, b._shape);
+        if (new_shape.size()) {
+            new_shape = smallest_broadcastable_shape(new_shape, c._shape);
+        }
+        if (new_shape.size() == 0) {
+            throw std::length_error(
+                fmt::format(
+                    "APyCFloatArray.fma: shape mismatch, self.shape={}, b.shape={}, "
+                    "c.shape={}",
+                    tuple_string_from_vec(_shape),
+                    tuple_string_from_vec(b._shape),
+                    tuple_string_from_vec(c._shape)
+                )
+            );
+        }
+        return broadcast_to(new_shape).fma(
+            b.broadcast_to(new_shape),
+            c.broadcast_to(new_shape),
+            new_exp_bits,
+            new_man_bits,
+            new_bias,
+            quantization
+        );
+    }
+
+    const int res_exp_bits
+        = new_exp_bits.value_or(std::max({ exp_bits, b.exp_bits, c.exp_bits }));
+    const int res_man_bits
+        = new_man_bits.value_or(std::max({ man_bits, b.man_bits, c.man_bits }));
+    check_exponent_format(res_exp_bits, "APyCFloatArray.fma");
+    check_mantissa_format(res_man_bits, "APyCFloatArray.fma");
+    if (unsigned(res_man_bits + 2) > _MAN_LIMIT_BITS) {
+        throw std::domain_error(
+            fmt::format(
+                "APyCFloatArray.fma: at most {} mantissa bits are supported in the "
+                "result, got man_bits={}",
+                _MAN_LIMIT_BITS - 2,
+                res_man_bits
+            )
+        );
+    }
+    if (unsigned(res_exp_bits + 1) > _EXP_LIMIT_BITS) {
+        throw std::domain_error(
+            fmt::format(
+                "APyCFloatArray.fma: at most {} exponent bits are supported in the "
+                "result, got exp_bits={}",
+                _EXP_LIMIT_BITS - 1,
+                res_exp_bits
+            )
+        );
+    }
+    const exp_t res_bias = new_bias.value_or(APyFloat::ieee_bias(res_exp_bits));
+    const APyFloatSpec res_spec
+        = { std::uint8_t(res_exp_bits), std::uint8_t(res_man_bits), res_bias };
+    const QuantizationMode qntz = quantization.value_or(get_float_quantization_mode());
+    const auto qntz_func = get_qntz_func(qntz);
+
+    APyCFloatArray result(
+        cow_no_init, _shape, res_spec.exp_bits, res_spec.man_bits, res_spec.bias
+    );
+
+    /*
+     * (x0 + x1i)(y0 + y1i) + (z0 + z1i) = (x0y0 - x1y1 + z0) + (x0y1 + x1y0 + z1)i
+     *
+     * Each part is a sum of two products and an addend, which is evaluated exactly and
+     * rounded once.
+     */
+    const bool use_threadpool = is_elementwise_with_threadpool_justified(_nitems)
+        && !is_stochastic_quantization(qntz);
+    threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const APyFloatData* x = &_data[2 * i];
+            const APyFloatData* y = &b._data[2 * i];
+            const APyFloatData* z = &c._data[2 * i];
+            const APyFloatData neg_y1 = { !y[1].sign, y[1].exp, y[1].man };
+            result._data[2 * i + 0] = floating_point_sum_of_products<2>(
+                { x[0], x[1] },
+                spec(),
+                { y[0], neg_y1 },
+                b.spec(),
+                z[0],
+                c.spec(),
+                res_spec,
+                qntz,
+                qntz_func
+            );
+            result._data[2 * i + 1] = floating_point_sum_of_products<2>(
+                { x[0], x[1] },
+                spec(),
+                { y[1], y[0] },
+                b.spec(),
+                z[1],
+                c.spec(),
+                res_spec,
+                qntz,
+                qntz_func
+            );
+        }
+    });
+
+    return result;
+}
+
 APyCFloatArray APyCFloatArray::cast(
     std::optional<int> new_exp_bits,
     std::optional<int> new_man_bits,
@@ -1209,70 +1440,78 @@ APyCFloatArray APyCFloatArray::_cast(
         return *this;
     }
 
-    APyCFloatArray result(_shape, new_exp_bits, new_man_bits, new_bias);
+    APyCFloatArray result(cow_no_init, _shape, new_exp_bits, new_man_bits, new_bias);
 
     const exp_t SRC_MAX_EXP = (1ULL << exp_bits) - 1;
     const exp_t DST_MAX_EXP = (1ULL << new_exp_bits) - 1;
     const int SPEC_MAN_BITS_DELTA = new_man_bits - man_bits;
     const std::int64_t BIAS_DELTA = std::int64_t(bias) - std::int64_t(new_bias);
+    bool use_threadpool = is_elementwise_with_threadpool_justified(_nitems);
 
     // If longer word lengths, use simpler/faster method
     if (new_exp_bits >= exp_bits && new_man_bits >= man_bits) {
-        for (std::size_t i = 0; i < _data.size(); i++) {
-            result._data[i] = array_floating_point_cast_no_quant(
-                _data[i],
-                spec(),
-                SRC_MAX_EXP,
-                DST_MAX_EXP,
-                SPEC_MAN_BITS_DELTA,
-                BIAS_DELTA
-            );
-        }
+        threadpool_chunked_for(use_threadpool, _data.size(), [&](auto begin, auto end) {
+            for (std::size_t i = begin; i < end; i++) {
+                result._data[i] = array_floating_point_cast_no_quant(
+                    _data[i],
+                    spec(),
+                    SRC_MAX_EXP,
+                    DST_MAX_EXP,
+                    SPEC_MAN_BITS_DELTA,
+                    BIAS_DELTA
+                );
+            }
+        });
         return result;
     }
 
+    use_threadpool &= !is_stochastic_quantization(quantization);
     const auto quantization_func = get_qntz_func(quantization);
     const man_t SRC_LEADING_ONE = (1ULL << man_bits);
     const man_t DST_LEADING_ONE = (1ULL << new_man_bits);
     const man_t SRC_HIDDEN_ONE = (1ULL << man_bits);
 
     if (SPEC_MAN_BITS_DELTA >= 0) {
-        for (std::size_t i = 0; i < _data.size(); i++) {
-            result._data[i] = array_floating_point_cast_pos_man_delta(
-                _data[i],
-                spec(),
-                result.spec(),
-                quantization,
-                quantization_func,
-                SRC_MAX_EXP,
-                DST_MAX_EXP,
-                SRC_LEADING_ONE,
-                DST_LEADING_ONE,
-                SPEC_MAN_BITS_DELTA,
-                SRC_HIDDEN_ONE,
-                BIAS_DELTA
-            );
-        }
+        threadpool_chunked_for(use_threadpool, _data.size(), [&](auto begin, auto end) {
+            for (std::size_t i = begin; i < end; i++) {
+                result._data[i] = array_floating_point_cast_pos_man_delta(
+                    _data[i],
+                    spec(),
+                    result.spec(),
+                    quantization,
+                    quantization_func,
+                    SRC_MAX_EXP,
+                    DST_MAX_EXP,
+                    SRC_LEADING_ONE,
+                    DST_LEADING_ONE,
+                    SPEC_MAN_BITS_DELTA,
+                    SRC_HIDDEN_ONE,
+                    BIAS_DELTA
+                );
+            }
+        });
     } else {
         const int SPEC_MAN_BITS_DELTA_REV = -SPEC_MAN_BITS_DELTA;
         const man_t FINAL_STICKY = (1ULL << (SPEC_MAN_BITS_DELTA_REV - 1)) - 1;
-        for (std::size_t i = 0; i < _data.size(); i++) {
-            result._data[i] = array_floating_point_cast_neg_man_delta(
-                _data[i],
-                spec(),
-                result.spec(),
-                quantization,
-                quantization_func,
-                SRC_MAX_EXP,
-                DST_MAX_EXP,
-                SRC_LEADING_ONE,
-                DST_LEADING_ONE,
-                SPEC_MAN_BITS_DELTA_REV,
-                SRC_HIDDEN_ONE,
-                FINAL_STICKY,
-                BIAS_DELTA
-            );
-        }
+        threadpool_chunked_for(use_threadpool, _data.size(), [&](auto begin, auto end) {
+            for (std::size_t i = begin; i < end; i++) {
+                result._data[i] = array_floating_point_cast_neg_man_delta(
+                    _data[i],
+                    spec(),
+                    result.spec(),
+                    quantization,
+                    quantization_func,
+                    SRC_MAX_EXP,
+                    DST_MAX_EXP,
+                    SRC_LEADING_ONE,
+                    DST_LEADING_ONE,
+                    SPEC_MAN_BITS_DELTA_REV,
+                    SRC_HIDDEN_ONE,
+                    FINAL_STICKY,
+                    BIAS_DELTA
+                );
+            }
+        });
     }
 
     return result;
@@ -1627,6 +1866,7 @@ APyCFloat APyCFloatArray::checked_inner_product(const APyCFloatArray& rhs) const
         = ComplexFloatingPointInnerProduct(spec(), rhs.spec(), result.spec(), qntz);
 
     // dst = A x b
+    const GILRelease gil_release(_shape[0]);
     APyFloatData sum[2] = {};
     inner_product(
         &_data[0],     // src1, a: [1 x N]
@@ -1672,6 +1912,8 @@ APyCFloatArray APyCFloatArray::checked_2d_matmul(const APyCFloatArray& rhs) cons
 
     // Determine if threadpool should be used or not.
     const bool use_threadpool = is_mac_with_threadpool_justified(M * N * res_cols);
+    const GILRelease gil_release(M * N * res_cols);
+    const auto pool_lock = lock_thread_pool(use_threadpool);
     const std::size_t n_threads = use_threadpool ? thread_pool.get_thread_count() : 1;
 
     // Resulting tensor
@@ -1755,61 +1997,35 @@ APyCFloatArray APyCFloatArray::convolve(
     const APyCFloatArray* a = swap ? &rhs : this;
     const APyCFloatArray* b = &b_cpy;
 
-    // Extract convolution properties
-    auto [len, n_left, n_right] = get_conv_lengths(conv_mode, a, b);
-
-    // Create result vector
-    const std::optional<APyFloatAccumulatorOption> mode = get_accumulator_mode_float();
-    const QuantizationMode& qntz
-        = mode.has_value() ? mode->quantization : get_float_quantization_mode();
-    std::uint8_t res_exp_bits;
-    std::uint8_t res_man_bits;
-    exp_t res_bias;
-    if (mode.has_value()) {
-        res_exp_bits = mode->exp_bits;
-        res_man_bits = mode->man_bits;
-        res_bias = mode->bias.has_value() ? *mode->bias : ieee_bias(res_exp_bits);
-    } else {
-        res_exp_bits = std::max(exp_bits, rhs.exp_bits);
-        res_man_bits = std::max(man_bits, rhs.man_bits);
-        res_bias = calc_bias(res_exp_bits, spec(), rhs.spec());
-    }
-    APyCFloatArray result({ len }, res_exp_bits, res_man_bits, res_bias);
-
-    // Loop working variables
-    std::size_t n = b->_shape[0] - n_left;
-    auto dst = std::begin(result._data);
-    auto src1 = std::cbegin(a->_data);
-    auto src2 = std::cbegin(b->_data) + 2 * n_left;
-
-    const APyFloatSpec& lhs_spec = swap ? rhs.spec() : spec();
-    const APyFloatSpec& rhs_spec = swap ? spec() : rhs.spec();
-    const APyFloatSpec& res_spec = result.spec();
-    auto inner_product
-        = ComplexFloatingPointInnerProduct(lhs_spec, rhs_spec, res_spec, qntz);
-
-    // `b` limits length of the inner product length
-    for (std::size_t i = 0; i < n_left; i++) {
-        inner_product(&*src1, &*src2, &*dst, n);
-        src2 -= 2;
-        dst += 2;
-        n++;
-    }
-
-    // full inner product length
-    for (std::size_t i = 0; i < a->_shape[0] - b->_shape[0] + 1; i++) {
-        inner_product(&*src1, &*src2, &*dst, n);
-        src1 += 2;
-        dst += 2;
-    }
+    // Split the outputs over the thread pool, one inner product per output
+    return convolve_1d(*a, std::cbegin(a->_data), *b, std::cbegin(b->_data), conv_mode);
+}
 
-    // `a` limits length of the inner product length
-    for (std::size_t i = 0; i < n_right; i++) {
-        n--;
-        inner_product(&*src1, &*src2, &*dst, n);
-        src1 += 2;
-        dst += 2;
+//! Perform a two-dimensional convolution with `other` using `mode`
+APyCFloatArray APyCFloatArray::convolve2d(
+    const APyCFloatArray& other,
+    const ConvolutionMode conv_mode,
+    const PyShapeParam_t& stride
+) const
+{
+    if (ndim() < 2 || other.ndim() != 2) {
+        auto msg = fmt::format(
+            "can only convolve2d 2D arrays, or batches of them "
+            "(lhs.ndim = {}, rhs.ndim = {})",
+            ndim(),
+            other.ndim()
+        );
+        throw nanobind::value_error(msg.c_str());
     }
+    return convolve_nd(*this, other, conv_mode, stride, false, "convolve2d");
+}
 
-    return result;
+//! Perform a correlation with `other` using `mode`
+APyCFloatArray APyCFloatArray::correlate(
+    const APyCFloatArray& other,
+    const ConvolutionMode conv_mode,
+    const PyShapeParam_t& stride
+) const
+{
+    return convolve_nd(*this, other, conv_mode, stride, true, "correlate");
 }
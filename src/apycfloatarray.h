@@ -57,6 +57,26 @@ public:
         std::optional<exp_t> bias = std::nullopt
     );
 
+    //! Constructor specifying only the shape and format of the array, leaving the
+    //! elements unspecified. Every element must be written before it is read.
+    APyCFloatArray(
+        cow_no_init_t,
+        const std::vector<std::size_t>& shape,
+        std::uint8_t exp_bits,
+        std::uint8_t man_bits,
+        exp_t bias
+    );
+
+    //! Constructor specifying the shape and format of the array, stealing the data
+    //! from vector
+    APyCFloatArray(
+        const std::vector<std::size_t>& shape,
+        std::uint8_t exp_bits,
+        std::uint8_t man_bits,
+        exp_t bias,
+        vector_type&& v
+    );
+
     explicit APyCFloatArray(const APyFloatArray& rhs);
 
     /* ****************************************************************************** *
@@ -74,6 +94,12 @@ public:
         return APyCFloatArray(shape, exp_bits, man_bits, bias);
     }
 
+    APyCFloatArray
+    create_array(const std::vector<std::size_t>& shape, vector_type&& data) const
+    {
+        return APyCFloatArray(shape, exp_bits, man_bits, bias, std::move(data));
+    }
+
     static APyCFloatArray
     create_array_static(const std::vector<std::size_t>& shape, const APyCFloat& fp)
     {
@@ -106,6 +132,12 @@ public:
         return n_mac >= thread_pool_settings.apycfloatarray.n_mac_threshold;
     }
 
+    //! Test if using threadpool is justified based on number of elementwise operations
+    bool is_elementwise_with_threadpool_justified(std::size_t n_elem) const noexcept
+    {
+        return n_elem >= thread_pool_settings.apycfloatarray.n_elem_threshold;
+    }
+
     /* ****************************************************************************** *
      * *                        Arithmetic member functions                         * *
      * ****************************************************************************** */
@@ -189,6 +221,16 @@ public:
     //! Perform a linear convolution with `other` using `mode`
     APyCFloatArray convolve(const APyCFloatArray& other, ConvolutionMode mode) const;
 
+    //! Perform a two-dimensional convolution with `other` over the last two axes
+    APyCFloatArray convolve2d(
+        const APyCFloatArray& other, ConvolutionMode mode, const PyShapeParam_t& stride
+    ) const;
+
+    //! Perform a correlation with `other` over the last `other.ndim()` axes
+    APyCFloatArray correlate(
+        const APyCFloatArray& other, ConvolutionMode mode, const PyShapeParam_t& stride
+    ) const;
+
     /* ****************************************************************************** *
      * *                          Public member functions                           * *
      * ****************************************************************************** */
@@ -220,7 +262,7 @@ public:
     ) const;
 
     //! Convert to a NumPy array
-    nanobind::ndarray<nanobind::numpy, std::complex<double>> to_numpy(
+    nanobind::ndarray<nanobind::numpy> to_numpy(
         std::optional<nb::object> dtype = std::nullopt,
         std::optional<bool> copy = std::nullopt
     ) const;
@@ -383,6 +425,17 @@ private:
      * *                           Other member functions                           * *
      * ****************************************************************************** */
 public:
+    //! Fused multiply-add, `*this * b + c`, with the real and imaginary parts of the
+    //! result each rounded once to the new format
+    APyCFloatArray fma(
+        const APyCFloatArray& b,
+        const APyCFloatArray& c,
+        std::optional<int> exp_bits = std::nullopt,
+        std::optional<int> man_bits = std::nullopt,
+        std::optional<exp_t> bias = std::nullopt,
+        std::optional<QuantizationMode> quantization = std::nullopt
+    ) const;
+
     //! Return a copy of the tensor with the elements resized.
     APyCFloatArray cast(
         std::optional<int> exp_bits,
@@ -148,6 +148,19 @@ void bind_cfloat_array(nb::module_& m)
          */
         .def("__getstate__", &APyCFloatArray::python_pickle)
         .def("__setstate__", &APyCFloatArray::python_unpickle)
+        .def("__reduce_ex__", &APyCFloatArray::python_reduce_ex, nb::arg("protocol"))
+
+        /*
+         * Native binary file format payload (see `apytypes.save` and `apytypes.load`)
+         */
+        .def("_write_raw", &APyCFloatArray::python_write_raw, nb::arg("file"))
+        .def(
+            "_from_raw",
+            &APyCFloatArray::python_from_raw,
+            nb::arg("shape"),
+            nb::arg("payload")
+        )
+        .def("_raw_payload", &APyCFloatArray::python_raw_payload)
 
         /*
          * Arithmetic operations
@@ -1023,12 +1036,22 @@ void bind_cfloat_array(nb::module_& m)
             Return array as a :class:`numpy.ndarray` of :class:`numpy.complex128`.
 
             The returned array has the same `shape` and values as `self`. This
-            method rounds away from infinity on ties.
+            method rounds to nearest with ties to even.
+
+            If `dtype` is :class:`numpy.complex64`, or a single- or half-precision
+            floating-point type, a :class:`numpy.complex64` array is returned instead,
+            with the real and imaginary parts rounded once. Other values of `dtype`
+            give a :class:`numpy.complex128` array. Large arrays are converted in
+            parallel.
+
+            .. versionchanged:: 0.6
+                A :class:`numpy.complex64` array is returned for the corresponding
+                `dtype`.
 
             Parameters
             ----------
-            dtype : :py:class:`numpy.dtype`
-                The desired data type of the output array. This parameter is currently ignored.
+            dtype : :py:class:`numpy.dtype`, optional
+                The desired floating-point data type of the output array.
             copy : :class:`bool`
                 Whether to copy the data or not. Must be :code:`True` or :code:`None`.
 
@@ -1095,6 +1118,52 @@ void bind_cfloat_array(nb::module_& m)
             )pbdoc"
         )
 
+        .def(
+            "fma",
+            &APyCFloatArray::fma,
+            nb::arg("b"),
+            nb::arg("c"),
+            nb::arg("exp_bits") = nb::none(),
+            nb::arg("man_bits") = nb::none(),
+            nb::arg("bias") = nb::none(),
+            nb::arg("quantization") = nb::none(),
+            R"pbdoc(
+            Fused multiply-add, ``self * b + c``, with a single rounding.
+
+            The real and imaginary parts of the product and sum are evaluated exactly
+            and rounded once into the new format. Stochastic quantization modes round
+            the sums with two extra mantissa bits.
+
+            .. versionadded:: 0.6
+
+            Parameters
+            ----------
+            b : :class:`APyCFloatArray`
+                The array to multiply with.
+            c : :class:`APyCFloatArray`
+                The array to add to the product.
+            exp_bits : :class:`int`, optional
+                Number of exponent bits in the result. If not provided, the largest
+                number of exponent bits of the operands is used.
+            man_bits : :class:`int`, optional
+                Number of mantissa bits in the result. If not provided, the largest
+                number of mantissa bits of the operands is used.
+            bias : :class:`int`, optional
+                Bias used in the result. If not provided, *bias* is ``2**(exp_bits - 1) - 1``.
+            quantization : :class:`QuantizationMode`, optional.
+                Quantization mode to use. If None, use the global quantization mode.
+
+            Returns
+            -------
+            :class:`APyCFloatArray`
+
+            Raises
+            ------
+            :class:`ValueError`
+                If the result has more than 59 mantissa bits or more than 29 exponent
+                bits.
+            )pbdoc"
+        )
         .def(
             "cast",
             &APyCFloatArray::cast,
@@ -1552,6 +1621,109 @@ void bind_cfloat_array(nb::module_& m)
             nb::arg("other"),
             nb::arg("mode") = "full"
         )
+        .def(
+            "convolve2d",
+            &APyCFloatArray::convolve2d,
+            nb::arg("other"),
+            nb::arg("mode") = ConvolutionMode::FULL,
+            nb::arg("stride") = 1,
+            R"pbdoc(
+            Return the two-dimensional discrete linear convolution with another array.
+
+            The convolution is taken over the last two axes. The array `other` must be
+            two-dimensional, and any leading axes of `self` are batch axes: each
+            two-dimensional slice of `self` is convolved with `other`. Along each of the
+            two axes, `mode` selects the outputs as for :func:`convolve`. With `stride`,
+            only every `stride`-th output is computed, as in a strided convolutional
+            layer.
+
+            The result format is that of :func:`convolve`. The products of each output
+            are accumulated in index order of the array with the most items, as for
+            :func:`convolve`.
+
+            .. versionadded:: 0.6
+
+            Parameters
+            ----------
+            other : :class:`APyCFloatArray`
+                The two-dimensional array to convolve with.
+            mode : :class:`ConvolutionMode` or {'full', 'same', 'valid'}, default: :class:`~ConvolutionMode.FULL`
+                The outputs to keep along each axis, see :func:`convolve`.
+            stride : :class:`int` or :class:`tuple` of :class:`int`, default: 1
+                Step between the kept outputs, either for both axes or one per axis.
+
+            Returns
+            -------
+            convolved : :class:`APyCFloatArray`
+                The convolved array.
+            )pbdoc"
+        )
+        .def(
+            "convolve2d",
+            [](const APyCFloatArray& self,
+               const APyCFloatArray& other,
+               const std::string& mode,
+               const PyShapeParam_t& stride) {
+                return self.convolve2d(other, get_conv_mode(mode), stride);
+            },
+            nb::arg("other"),
+            nb::arg("mode") = "full",
+            nb::arg("stride") = 1
+        )
+        .def(
+            "correlate",
+            &APyCFloatArray::correlate,
+            nb::arg("other"),
+            nb::arg("mode") = ConvolutionMode::FULL,
+            nb::arg("stride") = 1,
+            R"pbdoc(
+            Return the discrete linear cross-correlation with another array.
+
+            The correlation is taken over the last :code:`other.ndim` axes, and any
+            leading axes of `self` are batch axes. For one-dimensional arrays, the
+            result is that of :func:`numpy.correlate`, but `mode` defaults to
+            :class:`~ConvolutionMode.FULL`. The correlation is the convolution with the
+            conjugate of `other`, reversed along all axes.
+
+            With a `stride`, only every `stride`-th output is computed, as in a strided
+            convolutional layer. A correlation with the kernel of a convolutional layer
+            in :class:`~ConvolutionMode.VALID` mode sums over its input channels.
+
+            The result format is that of :func:`convolve`. The products of each output
+            are accumulated in index order of the array with the most items, as for
+            :func:`convolve`.
+
+            .. versionadded:: 0.6
+
+            Parameters
+            ----------
+            other : :class:`APyCFloatArray`
+                The array to correlate with.
+            mode : :class:`ConvolutionMode` or {'full', 'same', 'valid'}, default: :class:`~ConvolutionMode.FULL`
+                The outputs to keep along each axis, see :func:`convolve`. With
+                :class:`~ConvolutionMode.SAME`, the outputs are centered as for
+                :func:`numpy.correlate`.
+            stride : :class:`int` or :class:`tuple` of :class:`int`, default: 1
+                Step between the kept outputs, either for all axes or one per axis.
+
+            Returns
+            -------
+            correlated : :class:`APyCFloatArray`
+                The correlated array.
+            )pbdoc"
+        )
+        .def(
+            "correlate",
+            [](const APyCFloatArray& self,
+               const APyCFloatArray& other,
+               const std::string& mode,
+               const PyShapeParam_t& stride) {
+                return self.correlate(other, get_conv_mode(mode), stride);
+            },
+            nb::arg("other"),
+            nb::arg("mode") = "full",
+            nb::arg("stride") = 1
+        )
         .def(
             "conj",
             &APyCFloatArray::conj,
@@ -0,0 +1,290 @@
+#include "apyconvolve.h"
+#include "apycfixedarray.h"
+#include "apycfloatarray.h"
+#include "apyfir.h"
+#include "apyfixedarray.h"
+#include "apyfloatarray.h"
+#include "apytypes_common.h"
+#include "apytypes_util.h"
+#include "array_utils.h"
+
+#include <fmt/format.h>
+
+#include <nanobind/nanobind.h>
+
+#include <algorithm>   // std::min, std::max, std::copy_n, std::fill, std::any_of
+#include <cstddef>     // std::size_t
+#include <iterator>    // std::begin, std::cbegin
+#include <type_traits> // std::is_same_v
+#include <vector>      // std::vector
+
+namespace nb = nanobind;
+
+//! Copy of the items of `x`, with the items of each of its `n_slices` slices reversed
+template <typename ARRAY_TYPE>
+static std::vector<typename ARRAY_TYPE::vector_type::value_type>
+reversed_slices(const ARRAY_TYPE& x, std::size_t n_slices)
+{
+    using traits = FIRTraits<ARRAY_TYPE>;
+    const std::size_t itemsize = traits::itemsize(x.spec());
+    const std::size_t n_limbs = fold_shape(x.shape()) * itemsize;
+    std::vector<typename ARRAY_TYPE::vector_type::value_type> data(
+        x.data(), x.data() + n_limbs
+    );
+    if (n_slices) {
+        const std::size_t slice_limbs = n_limbs / n_slices;
+        for (std::size_t i = 0; i < n_slices; i++) {
+            auto slice = std::begin(data) + i * slice_limbs;
+            multi_limb_reverse(slice, slice + slice_limbs, itemsize);
+        }
+    }
+    return data;
+}
+
+template <typename ARRAY_TYPE>
+ARRAY_TYPE convolve_nd(
+    const ARRAY_TYPE& a,
+    const ARRAY_TYPE& b,
+    ConvolutionMode mode,
+    const PyShapeParam_t& stride,
+    bool is_correlation,
+    std::string_view func_name
+)
+{
+    using traits = FIRTraits<ARRAY_TYPE>;
+    using T = typename ARRAY_TYPE::vector_type::value_type;
+    using inner_product_type = typename traits::inner_product_type;
+    using spec_type = typename traits::spec_type;
+    constexpr bool IS_COMPLEX = std::is_same_v<ARRAY_TYPE, APyCFixedArray>
+        || std::is_same_v<ARRAY_TYPE, APyCFloatArray>;
+
+    const std::size_t n_axes = b.ndim();
+    if (n_axes == 0 || a.ndim() < n_axes) {
+        auto msg = fmt::format(
+            "{}.{}: `other` must have at least one and at most `self.ndim` dimensions "
+            "(self.ndim = {}, other.ndim = {})",
+            ARRAY_TYPE::ARRAY_NAME,
+            func_name,
+            a.ndim(),
+            b.ndim()
+        );
+        throw nb::value_error(msg.c_str());
+    }
+
+    std::vector<std::size_t> step = cpp_shape_from_python_shape_like(stride);
+    if (step.size() == 1) {
+        step.assign(n_axes, step[0]);
+    }
+    if (step.size() != n_axes || std::any_of(step.begin(), step.end(), [](auto s) {
+            return s == 0;
+        })) {
+        auto msg = fmt::format(
+            "{}.{}: `stride` must be a positive integer or a tuple of {} positive "
+            "integers",
+            ARRAY_TYPE::ARRAY_NAME,
+            func_name,
+            n_axes
+        );
+        throw nb::value_error(msg.c_str());
+    }
+
+    // The leading axes of `a` are batch axes
+    const std::size_t n_batch_axes = a.ndim() - n_axes;
+    const std::vector<std::size_t> batch_shape(
+        a.shape().begin(), a.shape().begin() + n_batch_axes
+    );
+    const std::vector<std::size_t> a_shape(
+        a.shape().begin() + n_batch_axes, a.shape().end()
+    );
+    const std::vector<std::size_t>& b_shape = b.shape();
+    if (fold_shape(a_shape) == 0 || fold_shape(b_shape) == 0) {
+        auto msg = fmt::format(
+            "{}.{}: cannot convolve empty arrays (self.shape = {}, other.shape = {})",
+            ARRAY_TYPE::ARRAY_NAME,
+            func_name,
+            tuple_string_from_vec(a.shape()),
+            tuple_string_from_vec(b.shape())
+        );
+        throw nb::value_error(msg.c_str());
+    }
+
+    // Along each axis, outputs `k` at full-convolution index `offset + k * step`
+    std::vector<std::size_t> res_shape = batch_shape;
+    std::vector<std::size_t> out_len(n_axes), offset(n_axes);
+    std::size_t max_terms = 1;
+    for (std::size_t d = 0; d < n_axes; d++) {
+        const std::size_t M = a_shape[d];
+        const std::size_t N = b_shape[d];
+        const std::size_t lo = std::min(M, N);
+        const std::size_t hi = std::max(M, N);
+        std::size_t len;
+        switch (mode) {
+        case ConvolutionMode::FULL:
+            len = M + N - 1;
+            offset[d] = 0;
+            break;
+        case ConvolutionMode::SAME:
+            // Centered as for one-dimensional `convolve` and `numpy.correlate`
+            len = hi;
+            offset[d] = is_correlation && M < N ? M / 2 : (lo - 1) / 2;
+            break;
+        case ConvolutionMode::VALID:
+            len = hi - lo + 1;
+            offset[d] = lo - 1;
+            break;
+        default:
+            throw nb::value_error("Unknown convolution mode. Did you pass an 'int'?");
+        }
+        out_len[d] = (len + step[d] - 1) / step[d];
+        res_shape.push_back(out_len[d]);
+        max_terms *= lo;
+    }
+
+    // Correlation is convolution with the reversed, and conjugated, `b`
+    ARRAY_TYPE b_conj = b;
+    if constexpr (IS_COMPLEX) {
+        if (is_correlation) {
+            b_conj = b.conj();
+        }
+    }
+    const std::vector<T> b_data = reversed_slices(b_conj, is_correlation ? 1 : 0);
+
+    // The operand with the most items is the signal, which is gathered in index order,
+    // and the other is the kernel, which is stored reversed. As for `convolve`, the
+    // products are accumulated from the first to the last item of the signal window.
+    const std::size_t n_batch = fold_shape(batch_shape);
+    const bool swap = fold_shape(a_shape) < fold_shape(b_shape);
+    const spec_type s_spec = swap ? b_conj.spec() : a.spec();
+    const spec_type k_spec = swap ? a.spec() : b_conj.spec();
+    const std::size_t s_itemsize = traits::itemsize(s_spec);
+    const std::size_t k_itemsize = traits::itemsize(k_spec);
+    const std::vector<std::size_t>& s_shape = swap ? b_shape : a_shape;
+    const std::vector<std::size_t>& k_shape = swap ? a_shape : b_shape;
+    const std::vector<std::size_t> s_stride = strides_from_shape(s_shape);
+    const std::vector<std::size_t> k_stride = strides_from_shape(k_shape);
+    const std::size_t k_items = fold_shape(k_shape);
+    const std::size_t s_batch_limbs = swap ? 0 : fold_shape(s_shape) * s_itemsize;
+    const std::size_t k_batch_limbs = swap ? k_items * k_itemsize : 0;
+
+    // Unless the operands are swapped, the signal is read directly from `a`
+    std::vector<T> s_data, k_data;
+    if (swap) {
+        s_data = b_data;
+        k_data = reversed_slices(a, n_batch);
+    } else {
+        k_data = b_data;
+        multi_limb_reverse(std::begin(k_data), std::end(k_data), k_itemsize);
+    }
+    const auto s_begin = swap ? std::cbegin(s_data) : std::cbegin(a.read_data());
+
+    const auto ctx = traits::context();
+    const spec_type res_spec = traits::result_spec(s_spec, k_spec, max_terms, ctx);
+    const std::size_t res_itemsize = traits::itemsize(res_spec);
+    const inner_product_type inner_product_proto
+        = traits::make_inner_product(s_spec, k_spec, res_spec, ctx);
+
+    const std::size_t n_out = fold_shape(res_shape);
+    const std::size_t n_grid = fold_shape(out_len);
+    const std::size_t last = n_axes - 1;
+    const bool use_threadpool = n_out * max_terms >= traits::n_mac_threshold()
+        && !traits::is_stochastic(ctx);
+    return traits::make_result(res_shape, res_spec, [&](auto dst) {
+        const GILRelease gil_release(n_out * max_terms);
+        threadpool_chunked_for(use_threadpool, n_out, [&](auto begin, auto end) {
+            // Each worker uses its own copy of the inner product and its own patches
+            const inner_product_type inner_product = inner_product_proto;
+            std::vector<T> s_patch(max_terms * s_itemsize);
+            std::vector<T> k_patch(max_terms * k_itemsize);
+            std::vector<std::size_t> start(n_axes), ext(n_axes), pos(n_axes);
+            for (std::size_t o = begin; o < end; o++) {
+                // The window of the output in the signal, and in the reversed kernel
+                std::size_t rem = o % n_grid;
+                std::size_t s_offset = (o / n_grid) * s_batch_limbs;
+                std::size_t k_offset = (o / n_grid) * k_batch_limbs;
+                std::size_t n_terms = 1;
+                for (std::size_t d = n_axes; d-- > 0;) {
+                    const std::size_t f = offset[d] + (rem % out_len[d]) * step[d];
+                    rem /= out_len[d];
+                    start[d] = f + 1 > k_shape[d] ? f + 1 - k_shape[d] : 0;
+                    ext[d] = std::min(s_shape[d] - 1, f) + 1 - start[d];
+                    s_offset += start[d] * s_stride[d] * s_itemsize;
+                    const std::size_t k_start = k_shape[d] - 1 + start[d] - f;
+                    k_offset += k_start * k_stride[d] * k_itemsize;
+                    n_terms *= ext[d];
+                }
+
+                auto src1 = s_begin + s_offset;
+                auto src2 = std::cbegin(k_data) + k_offset;
+                const std::size_t run = ext[last];
+                if (n_terms != run) {
+                    // Gather the window row by row, the kernel only on partial overlap
+                    const bool gather_kernel = n_terms != k_items;
+                    std::fill(std::begin(pos), std::end(pos), 0);
+                    for (std::size_t r = 0; r < n_terms / run; r++) {
+                        std::size_t s_row = 0, k_row = 0;
+                        for (std::size_t d = 0; d < last; d++) {
+                            s_row += pos[d] * s_stride[d] * s_itemsize;
+                            k_row += pos[d] * k_stride[d] * k_itemsize;
+                        }
+                        std::copy_n(
+                            src1 + s_row,
+                            run * s_itemsize,
+                            std::begin(s_patch) + r * run * s_itemsize
+                        );
+                        if (gather_kernel) {
+                            std::copy_n(
+                                src2 + k_row,
+                                run * k_itemsize,
+                                std::begin(k_patch) + r * run * k_itemsize
+                            );
+                        }
+                        for (std::size_t d = last; d-- > 0;) {
+                            if (++pos[d] < ext[d]) {
+                                break;
+                            }
+                            pos[d] = 0;
+                        }
+                    }
+                    src1 = std::cbegin(s_patch);
+                    if (gather_kernel) {
+                        src2 = std::cbegin(k_patch);
+                    }
+                }
+                traits::dot(inner_product, src1, src2, dst + o * res_itemsize, n_terms);
+            }
+        });
+    });
+}
+
+template APyFixedArray convolve_nd(
+    const APyFixedArray&,
+    const APyFixedArray&,
+    ConvolutionMode,
+    const PyShapeParam_t&,
+    bool,
+    std::string_view
+);
+template APyCFixedArray convolve_nd(
+    const APyCFixedArray&,
+    const APyCFixedArray&,
+    ConvolutionMode,
+    const PyShapeParam_t&,
+    bool,
+    std::string_view
+);
+template APyFloatArray convolve_nd(
+    const APyFloatArray&,
+    const APyFloatArray&,
+    ConvolutionMode,
+    const PyShapeParam_t&,
+    bool,
+    std::string_view
+);
+template APyCFloatArray convolve_nd(
+    const APyCFloatArray&,
+    const APyCFloatArray&,
+    ConvolutionMode,
+    const PyShapeParam_t&,
+    bool,
+    std::string_view
+);
@@ -0,0 +1,131 @@
+/*
+ * Convolution and correlation of APyTypes arrays. The convolution is evaluated
+ * directly from the inner products of the array type, with the outputs split in
+ * contiguous blocks over the thread pool. In more than one dimension, the overlapping
+ * window of each kept output is first gathered into a contiguous patch (im2col), one
+ * patch at a time per worker.
+ */
+
+#ifndef _APYCONVOLVE_H
+#define _APYCONVOLVE_H
+
+#include "apyfir.h"
+#include "apytypes_common.h"
+#include "apytypes_util.h"
+#include "array_utils.h"
+
+#include <algorithm>   // std::clamp, std::min
+#include <cstddef>     // std::size_t
+#include <iterator>    // std::next
+#include <string_view> // std::string_view
+#include <tuple>       // std::get
+
+/*!
+ * One-dimensional convolution of `a` with `b`, for the `convolve` method of the array
+ * types. `a` is the longer array, with its items at `a_it`, and `b` is the reversed
+ * copy of the shorter one, with its items at `b_it`. The outputs kept by `mode` are
+ * split in contiguous blocks over the thread pool, so that each worker makes a single
+ * pass over its part of `a` while `b` stays in cache. Each output is one inner
+ * product, accumulated from the first to the last overlapping item of `a`, so the
+ * result does not depend on the number of threads. Where the array type supports it
+ * (exact fixed-point inner products of single-limb items), the outputs overlapping
+ * all of `b` are evaluated several at a time, in a single pass over `b` per block.
+ */
+template <typename ARRAY_TYPE, typename CIT>
+ARRAY_TYPE convolve_1d(
+    const ARRAY_TYPE& a, CIT a_it, const ARRAY_TYPE& b, CIT b_it, ConvolutionMode mode
+)
+{
+    using traits = FIRTraits<ARRAY_TYPE>;
+    using inner_product_type = typename traits::inner_product_type;
+    using spec_type = typename traits::spec_type;
+
+    const auto conv_lengths = get_conv_lengths(mode, &a, &b);
+    const std::size_t len = std::get<0>(conv_lengths);
+    const std::size_t n_left = std::get<1>(conv_lengths);
+    const std::size_t a_len = a.shape()[0];
+    const std::size_t b_len = b.shape()[0];
+    const std::size_t a_itemsize = traits::itemsize(a.spec());
+    const std::size_t b_itemsize = traits::itemsize(b.spec());
+
+    const auto ctx = traits::context();
+    const spec_type res_spec = traits::result_spec(a.spec(), b.spec(), b_len, ctx);
+    const std::size_t res_itemsize = traits::itemsize(res_spec);
+    const inner_product_type inner_product_proto
+        = traits::make_inner_product(a.spec(), b.spec(), res_spec, ctx);
+
+    // Output `k` is output `k + first` of the full convolution
+    const std::size_t first = b_len - 1 - n_left;
+    const std::size_t n_mac = len * b_len;
+    const bool use_threadpool
+        = n_mac >= traits::n_mac_threshold() && !traits::is_stochastic(ctx);
+    return traits::make_result({ len }, res_spec, [&](auto dst) {
+        const GILRelease gil_release(n_mac);
+        threadpool_chunked_for(use_threadpool, len, [&](auto begin, auto end) {
+            // Each worker uses its own copy of the inner product and its scratch data
+            const inner_product_type inner_product = inner_product_proto;
+            auto dot = [&](std::size_t k) {
+                const std::size_t f = k + first;
+                const std::size_t start = f < b_len ? 0 : f + 1 - b_len;
+                const std::size_t n = std::min(f, a_len - 1) + 1 - start;
+                traits::dot(
+                    inner_product,
+                    std::next(a_it, start * a_itemsize),
+                    std::next(b_it, (b_len - 1 + start - f) * b_itemsize),
+                    dst + k * res_itemsize,
+                    n
+                );
+            };
+
+            std::size_t k = begin;
+            if constexpr (traits::HAS_BLOCKED_CONVOLUTION) {
+                // Outputs `[n_left, n_left + a_len - b_len]` overlap all of `b`
+                const auto blocked = traits::make_blocked_convolution(
+                    a.spec(), b.spec(), res_spec, ctx
+                );
+                if (blocked.has_value()) {
+                    const std::size_t full_begin = std::clamp(n_left, begin, end);
+                    const std::size_t full_end
+                        = std::clamp(n_left + a_len - b_len + 1, full_begin, end);
+                    for (; k < full_begin; k++) {
+                        dot(k);
+                    }
+                    if (full_begin < full_end) {
+                        (*blocked)(
+                            std::next(a_it, (full_begin - n_left) * a_itemsize),
+                            b_it,
+                            dst + full_begin * res_itemsize,
+                            b_len,
+                            full_end - full_begin
+                        );
+                        k = full_end;
+                    }
+                }
+            }
+            for (; k < end; k++) {
+                dot(k);
+            }
+        });
+    });
+}
+
+/*!
+ * Convolve (or, with `is_correlation`, correlate) `a` with `b` over the last
+ * `b.ndim()` axes of `a`, keeping every `stride`-th output along each of these axes.
+ * The leading axes of `a` are batch axes, each slice along them is convolved with `b`
+ * independently. Along each convolved axis, `mode` selects the outputs as for the
+ * one-dimensional `convolve`. Correlation convolves with the reversed, and for
+ * complex-valued arrays conjugated, `b`. Throws `nb::value_error` on incompatible
+ * shapes or an invalid `stride`, with `func_name` in the message.
+ */
+template <typename ARRAY_TYPE>
+ARRAY_TYPE convolve_nd(
+    const ARRAY_TYPE& a,
+    const ARRAY_TYPE& b,
+    ConvolutionMode mode,
+    const PyShapeParam_t& stride,
+    bool is_correlation,
+    std::string_view func_name
+);
+
+#endif // _APYCONVOLVE_H
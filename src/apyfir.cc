@@ -0,0 +1,163 @@
+#include "apyfir.h"
+#include "apytypes_common.h"
+#include "apytypes_util.h"
+
+#include <fmt/format.h>
+
+#include <nanobind/nanobind.h>
+
+#include <algorithm> // std::copy_n
+#include <cstddef>   // std::size_t
+#include <iterator>  // std::begin, std::end
+
+namespace nb = nanobind;
+
+template <typename ARRAY_TYPE>
+FIRFilter<ARRAY_TYPE>::FIRFilter(
+    const ARRAY_TYPE& taps, std::size_t decimation, std::size_t interpolation
+)
+    : _taps { taps }
+    , _decimation { decimation }
+    , _interpolation { interpolation }
+    , _context { traits::context() }
+    , _next { 0 }
+{
+    if (taps.ndim() != 1 || taps.shape()[0] == 0) {
+        auto msg = fmt::format(
+            "{}: `taps` must be a non-empty one-dimensional array", traits::NAME
+        );
+        throw nb::value_error(msg.c_str());
+    }
+    if (decimation == 0 || interpolation == 0) {
+        auto msg = fmt::format(
+            "{}: `decimation` and `interpolation` must be positive, got {} and {}",
+            traits::NAME,
+            decimation,
+            interpolation
+        );
+        throw nb::value_error(msg.c_str());
+    }
+
+    // Split the taps into `L` polyphase components, each stored in reverse order so
+    // that the inner products run over the delay line from the oldest sample
+    const std::size_t n_taps = taps.shape()[0];
+    const std::size_t L = interpolation;
+    const std::size_t itemsize = traits::itemsize(taps.spec());
+    const T* taps_data = taps.data();
+    _phase_taps.resize(n_taps * itemsize);
+    _phase_offset.resize(L);
+    _phase_length.resize(L);
+    std::size_t offset = 0;
+    for (std::size_t p = 0; p < L; p++) {
+        const std::size_t n = p < n_taps ? (n_taps - p + L - 1) / L : 0;
+        for (std::size_t i = 0; i < n; i++) {
+            std::copy_n(
+                taps_data + (p + (n - 1 - i) * L) * itemsize,
+                itemsize,
+                std::begin(_phase_taps) + (offset + i) * itemsize
+            );
+        }
+        _phase_offset[p] = offset;
+        _phase_length[p] = n;
+        offset += n;
+    }
+    _history = _phase_length[0] - 1;
+}
+
+template <typename ARRAY_TYPE>
+void FIRFilter<ARRAY_TYPE>::initialize(const spec_type& in_spec)
+{
+    _in_spec = in_spec;
+    _res_spec = traits::result_spec(in_spec, _taps.spec(), _phase_length[0], _context);
+    _in_itemsize = traits::itemsize(in_spec);
+    _res_itemsize = traits::itemsize(_res_spec);
+    _inner_product.emplace(
+        traits::make_inner_product(in_spec, _taps.spec(), _res_spec, _context)
+    );
+
+    // The stream is preceded by zeros
+    _delay_line.assign(_history * _in_itemsize, T {});
+}
+
+template <typename ARRAY_TYPE>
+ARRAY_TYPE FIRFilter<ARRAY_TYPE>::process(const ARRAY_TYPE& x)
+{
+    if (x.ndim() != 1) {
+        auto msg = fmt::format(
+            "{}.process: input must be one-dimensional (ndim = {})",
+            traits::NAME,
+            x.ndim()
+        );
+        throw nb::value_error(msg.c_str());
+    }
+    if (!_in_spec.has_value()) {
+        initialize(x.spec());
+    } else if (!traits::same_spec(*_in_spec, x.spec())) {
+        auto msg = fmt::format(
+            "{}.process: input format differs from that of the previous blocks, use "
+            "`reset()` to change the input format",
+            traits::NAME
+        );
+        throw nb::value_error(msg.c_str());
+    }
+
+    // Append the block to the delay line
+    const std::size_t n_in = x.shape()[0];
+    _delay_line.resize((_history + n_in) * _in_itemsize);
+    std::copy_n(
+        x.data(),
+        n_in * _in_itemsize,
+        std::begin(_delay_line) + _history * _in_itemsize
+    );
+
+    // Outputs at upsampled times `_next`, `_next + M`, ..., before `L * n_in`
+    const std::size_t L = _interpolation;
+    const std::size_t M = _decimation;
+    const std::size_t n_up = L * n_in;
+    const std::size_t n_out = n_up > _next ? (n_up - _next + M - 1) / M : 0;
+    const std::size_t next = _next;
+    const std::size_t taps_itemsize = traits::itemsize(_taps.spec());
+
+    const bool use_threadpool = n_out * _phase_length[0] >= traits::n_mac_threshold()
+        && !traits::is_stochastic(_context);
+    ARRAY_TYPE result = traits::make_result({ n_out }, _res_spec, [&](auto dst) {
+        const GILRelease gil_release(n_out * _phase_length[0]);
+        threadpool_chunked_for(use_threadpool, n_out, [&](auto begin, auto end) {
+            // Each worker uses its own copy of the inner product and its scratch data
+            const inner_product_type inner_product = *_inner_product;
+            for (std::size_t k = begin; k < end; k++) {
+                const std::size_t t = next + k * M;
+                const std::size_t j = t / L;
+                const std::size_t p = t % L;
+                const std::size_t n = _phase_length[p];
+                traits::dot(
+                    inner_product,
+                    std::cbegin(_delay_line) + (_history + j + 1 - n) * _in_itemsize,
+                    std::cbegin(_phase_taps) + _phase_offset[p] * taps_itemsize,
+                    dst + k * _res_itemsize,
+                    n
+                );
+            }
+        });
+    });
+    _next = next + n_out * M - n_up;
+
+    // Keep the last `_history` samples for the next block
+    _delay_line.erase(
+        std::begin(_delay_line), std::begin(_delay_line) + n_in * _in_itemsize
+    );
+    return result;
+}
+
+template <typename ARRAY_TYPE> void FIRFilter<ARRAY_TYPE>::reset() noexcept
+{
+    _next = 0;
+    _in_spec.reset();
+    _inner_product.reset();
+    _delay_line.clear();
+}
+
+template class FIRFilter<APyFixedArray>;
+template class FIRFilter<APyCFixedArray>;
+template class FIRFilter<APyFloatArray>;
+template class FIRFilter<APyCFloatArray>;
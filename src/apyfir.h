@@ -0,0 +1,340 @@
+/*
+ * Stateful streaming FIR filters. A filter holds its taps, pre-reversed and split
+ * into polyphase components, together with the accumulator format and the delay line,
+ * so that an endless sample stream can be filtered one block at a time without any
+ * per-block setup. Interpolation by `L` and decimation by `M` are evaluated in
+ * polyphase form: only the outputs that are kept are computed, and the zeros inserted
+ * by the upsampler are never multiplied. The arithmetic is that of
+ * `FixedPointInnerProduct` and its floating-point and complex-valued counterparts.
+ */
+
+#ifndef _APYFIR_H
+#define _APYFIR_H
+
+#include "apycfixed_util.h"
+#include "apycfixedarray.h"
+#include "apycfloat_util.h"
+#include "apycfloatarray.h"
+#include "apyfixed_util.h"
+#include "apyfixedarray.h"
+#include "apyfloat_util.h"
+#include "apyfloatarray.h"
+#include "apytypes_common.h"
+#include "apytypes_fwd.h"
+#include "apytypes_intrinsics.h"
+#include "apytypes_util.h"
+
+#include <algorithm>   // std::max
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint8_t
+#include <iterator>    // std::begin
+#include <optional>    // std::optional
+#include <string_view> // std::string_view
+#include <utility>     // std::move
+#include <vector>      // std::vector
+
+//! Formats and arithmetic of the FIR filters over arrays of type `ARRAY_TYPE`
+template <typename ARRAY_TYPE> struct FIRTraits;
+
+//! Common traits of the real- and complex-valued fixed-point FIR filters
+template <typename ARRAY_TYPE, typename INNER_PRODUCT, bool IS_COMPLEX>
+struct FixedPointFIRTraits {
+    using inner_product_type = INNER_PRODUCT;
+    using spec_type = APyFixedSpec;
+    using context_type = std::optional<APyFixedAccumulatorOption>;
+
+    static std::size_t itemsize(const spec_type& spec)
+    {
+        return (1 + IS_COMPLEX) * bits_to_limbs(spec.bits);
+    }
+
+    static context_type context() { return get_accumulator_mode_fixed(); }
+
+    static bool is_stochastic(const context_type& acc)
+    {
+        return acc.has_value() && is_stochastic_quantization(acc->quantization);
+    }
+
+    static bool same_spec(const spec_type& a, const spec_type& b)
+    {
+        return a.bits == b.bits && a.int_bits == b.int_bits;
+    }
+
+    //! Format of a sum of `n_terms` products. A complex-valued product needs one more
+    //! integer bit than a real-valued one.
+    static spec_type result_spec(
+        const spec_type& in_spec,
+        const spec_type& taps_spec,
+        std::size_t n_terms,
+        const context_type& acc
+    )
+    {
+        if (acc.has_value()) {
+            return { acc->bits, acc->int_bits };
+        }
+        int pad_bits = IS_COMPLEX + int(bit_width(n_terms - 1));
+        return { in_spec.bits + taps_spec.bits + pad_bits,
+                 in_spec.int_bits + taps_spec.int_bits + pad_bits };
+    }
+
+    static inner_product_type make_inner_product(
+        const spec_type& in_spec,
+        const spec_type& taps_spec,
+        const spec_type& res_spec,
+        const context_type& acc
+    )
+    {
+        return inner_product_type(in_spec, taps_spec, res_spec, acc);
+    }
+
+    //! Create an array of shape `shape`, written by `fill(dst_it)`
+    template <typename F>
+    static ARRAY_TYPE make_result(
+        const std::vector<std::size_t>& shape, const spec_type& spec, const F& fill
+    )
+    {
+        typename ARRAY_TYPE::vector_type data(
+            fold_shape(shape) * itemsize(spec), cow_no_init
+        );
+        fill(std::begin(data));
+        return ARRAY_TYPE(shape, spec.bits, spec.int_bits, std::move(data));
+    }
+
+    template <typename CIT, typename IT>
+    static void dot(
+        const inner_product_type& inner_product,
+        CIT src1,
+        CIT src2,
+        IT dst,
+        std::size_t n
+    )
+    {
+        inner_product(src1, src2, dst, n);
+    }
+
+    //! Exact inner products of single-limb items may evaluate several convolution
+    //! outputs per pass over the taps (see `make_blocked_convolution`). Products of
+    //! multi-limb items go through scratch vectors, at a cost that outweighs reloading
+    //! the taps, and accumulator contexts quantize each product, so those convolutions
+    //! keep one output per pass.
+    static constexpr bool HAS_BLOCKED_CONVOLUTION = true;
+
+    //! Blocked convolution kernel for these formats, if supported
+    static std::optional<FixedPointBlockedConvolution<IS_COMPLEX>>
+    make_blocked_convolution(
+        const spec_type& in_spec,
+        const spec_type& taps_spec,
+        const spec_type& res_spec,
+        const context_type& acc
+    )
+    {
+        using blocked_type = FixedPointBlockedConvolution<IS_COMPLEX>;
+        const std::size_t res_limbs = bits_to_limbs(res_spec.bits);
+        const std::size_t in_limbs = bits_to_limbs(in_spec.bits);
+        const std::size_t taps_limbs = bits_to_limbs(taps_spec.bits);
+        if (!blocked_type::is_supported(in_limbs, taps_limbs, res_limbs, acc)) {
+            return std::nullopt;
+        }
+        return blocked_type(res_limbs);
+    }
+};
+
+template <>
+struct FIRTraits<APyFixedArray>
+    : FixedPointFIRTraits<APyFixedArray, FixedPointInnerProduct, false> {
+    static constexpr auto NAME = std::string_view("APyFixedFIR");
+    static std::size_t n_mac_threshold()
+    {
+        return thread_pool_settings.apyfixedarray.n_mac_threshold;
+    }
+};
+
+template <>
+struct FIRTraits<APyCFixedArray>
+    : FixedPointFIRTraits<APyCFixedArray, ComplexFixedPointInnerProduct, true> {
+    static constexpr auto NAME = std::string_view("APyCFixedFIR");
+    static std::size_t n_mac_threshold()
+    {
+        return thread_pool_settings.apycfixedarray.n_mac_threshold;
+    }
+};
+
+//! Accumulator context of the floating-point FIR filters
+struct FloatFIRContext {
+    std::optional<APyFloatAccumulatorOption> acc_mode;
+    QuantizationMode quantization;
+};
+
+//! Common traits of the real- and complex-valued floating-point FIR filters
+template <typename ARRAY_TYPE, typename INNER_PRODUCT, bool IS_COMPLEX>
+struct FloatingPointFIRTraits {
+    using inner_product_type = INNER_PRODUCT;
+    using spec_type = APyFloatSpec;
+    using context_type = FloatFIRContext;
+
+    static std::size_t itemsize(const spec_type&) { return 1 + IS_COMPLEX; }
+
+    static context_type context()
+    {
+        std::optional<APyFloatAccumulatorOption> acc = get_accumulator_mode_float();
+        QuantizationMode qntz
+            = acc.has_value() ? acc->quantization : get_float_quantization_mode();
+        return { acc, qntz };
+    }
+
+    static bool is_stochastic(const context_type& ctx)
+    {
+        return is_stochastic_quantization(ctx.quantization);
+    }
+
+    static bool same_spec(const spec_type& a, const spec_type& b) { return a == b; }
+
+    static spec_type result_spec(
+        const spec_type& in_spec,
+        const spec_type& taps_spec,
+        std::size_t /* n_terms */,
+        const context_type& ctx
+    )
+    {
+        if (ctx.acc_mode.has_value()) {
+            const APyFloatAccumulatorOption& acc = *ctx.acc_mode;
+            return { acc.exp_bits,
+                     acc.man_bits,
+                     acc.bias.has_value() ? *acc.bias : ieee_bias(acc.exp_bits) };
+        }
+        std::uint8_t exp_bits = std::max(in_spec.exp_bits, taps_spec.exp_bits);
+        std::uint8_t man_bits = std::max(in_spec.man_bits, taps_spec.man_bits);
+        return { exp_bits, man_bits, calc_bias(exp_bits, in_spec, taps_spec) };
+    }
+
+    static inner_product_type make_inner_product(
+        const spec_type& in_spec,
+        const spec_type& taps_spec,
+        const spec_type& res_spec,
+        const context_type& ctx
+    )
+    {
+        return inner_product_type(in_spec, taps_spec, res_spec, ctx.quantization);
+    }
+
+    //! Create an array of shape `shape`, written by `fill(dst_ptr)`
+    template <typename F>
+    static ARRAY_TYPE make_result(
+        const std::vector<std::size_t>& shape, const spec_type& spec, const F& fill
+    )
+    {
+        ARRAY_TYPE result(shape, spec.exp_bits, spec.man_bits, spec.bias);
+        fill(result.data());
+        return result;
+    }
+
+    template <typename CIT>
+    static void dot(
+        const inner_product_type& inner_product,
+        CIT src1,
+        CIT src2,
+        APyFloatData* dst,
+        std::size_t n
+    )
+    {
+        inner_product(&*src1, &*src2, dst, n);
+    }
+
+    //! Each convolution output is one inner product
+    static constexpr bool HAS_BLOCKED_CONVOLUTION = false;
+};
+
+template <>
+struct FIRTraits<APyFloatArray>
+    : FloatingPointFIRTraits<APyFloatArray, FloatingPointInnerProduct, false> {
+    static constexpr auto NAME = std::string_view("APyFloatFIR");
+    static std::size_t n_mac_threshold()
+    {
+        return thread_pool_settings.apyfloatarray.n_mac_threshold;
+    }
+};
+
+template <>
+struct FIRTraits<APyCFloatArray>
+    : FloatingPointFIRTraits<APyCFloatArray, ComplexFloatingPointInnerProduct, true> {
+    static constexpr auto NAME = std::string_view("APyCFloatFIR");
+    static std::size_t n_mac_threshold()
+    {
+        return thread_pool_settings.apycfloatarray.n_mac_threshold;
+    }
+};
+
+/*!
+ * Streaming FIR filter with taps `h` of length `K`, interpolation factor `L`, and
+ * decimation factor `M`. The output stream is `y[m] = sum_k h[k] * u[m * M - k]`,
+ * where `u` is the input stream upsampled by `L` through zero insertion. Without an
+ * accumulator context, the output format is wide enough to never overflow, just as for
+ * `convolve`. Products are accumulated from the oldest to the newest sample. The input
+ * format is set by the first block after construction or `reset()`.
+ */
+template <typename ARRAY_TYPE> class FIRFilter {
+public:
+    using traits = FIRTraits<ARRAY_TYPE>;
+    using T = typename ARRAY_TYPE::vector_type::value_type;
+    using inner_product_type = typename traits::inner_product_type;
+    using spec_type = typename traits::spec_type;
+    using context_type = typename traits::context_type;
+
+    //! Create a filter from one-dimensional `taps`. The accumulator context active on
+    //! construction is used for all blocks. Throws `nb::value_error` on invalid taps
+    //! or rate-change factors.
+    FIRFilter(
+        const ARRAY_TYPE& taps, std::size_t decimation, std::size_t interpolation
+    );
+
+    //! Filter the next one-dimensional block `x` of the input stream. Throws
+    //! `nb::value_error` if `x` is not one-dimensional or if its format differs from
+    //! that of the previous blocks.
+    ARRAY_TYPE process(const ARRAY_TYPE& x);
+
+    //! Clear the delay line and the input format
+    void reset() noexcept;
+
+    const ARRAY_TYPE& taps() const noexcept { return _taps; }
+    std::size_t decimation() const noexcept { return _decimation; }
+    std::size_t interpolation() const noexcept { return _interpolation; }
+
+private:
+    //! Set up the delay line and the inner product for input format `in_spec`
+    void initialize(const spec_type& in_spec);
+
+    ARRAY_TYPE _taps;
+    std::size_t _decimation;
+    std::size_t _interpolation;
+    context_type _context;
+
+    //! Time-reversed polyphase components of the taps. Component `p` holds taps `p`,
+    //! `p + L`, `p + 2L`, ..., in reverse order, starting at item `_phase_offset[p]`.
+    std::vector<T> _phase_taps;
+    std::vector<std::size_t> _phase_offset;
+    std::vector<std::size_t> _phase_length;
+
+    //! Number of past input samples needed by the longest polyphase component
+    std::size_t _history;
+
+    //! Upsampled-time index of the next output, relative to the start of the next block
+    std::size_t _next;
+
+    //! Input and output formats, and the item sizes of the input and output
+    std::optional<spec_type> _in_spec;
+    spec_type _res_spec;
+    std::size_t _in_itemsize;
+    std::size_t _res_itemsize;
+
+    //! The last `_history` input samples, followed by the current block
+    std::vector<T> _delay_line;
+
+    std::optional<inner_product_type> _inner_product;
+};
+
+using FixedPointFIR = FIRFilter<APyFixedArray>;
+using ComplexFixedPointFIR = FIRFilter<APyCFixedArray>;
+using FloatingPointFIR = FIRFilter<APyFloatArray>;
+using ComplexFloatingPointFIR = FIRFilter<APyCFloatArray>;
+
+#endif // _APYFIR_H
@@ -0,0 +1,179 @@
+#include "apyfir.h"
+
+#include <nanobind/nanobind.h>
+
+#include <cstddef> // std::size_t
+
+namespace nb = nanobind;
+
+/*
+ * Bind the methods shared by all the FIR filter classes
+ */
+template <typename ARRAY_TYPE>
+static void bind_fir_class(nb::module_& m, const char* name, const char* doc)
+{
+    using FIR = FIRFilter<ARRAY_TYPE>;
+    nb::class_<FIR>(m, name, doc)
+        .def(
+            nb::init<const ARRAY_TYPE&, std::size_t, std::size_t>(),
+            nb::arg("taps"),
+            nb::kw_only(),
+            nb::arg("decimation") = 1,
+            nb::arg("interpolation") = 1
+        )
+        .def("process", &FIR::process, nb::arg("x"), R"pbdoc(
+            Filter the next block of the input stream.
+
+            The delay line carries over between blocks, so filtering a stream block by
+            block gives the same result as filtering it all at once. Blocks may have
+            any length, including zero. The format of the first block after creation
+            or :func:`reset` sets the input format of the filter.
+
+            Parameters
+            ----------
+            x : one-dimensional array
+                The next block of input samples.
+
+            Returns
+            -------
+            out : array of the same type as `x`
+                The output samples of the block. With decimation, the number of
+                outputs may vary between blocks.
+
+            Raises
+            ------
+            :class:`ValueError`
+                If `x` is not one-dimensional or if its format differs from that of
+                the previous blocks.
+            )pbdoc")
+        .def("reset", &FIR::reset, R"pbdoc(
+            Clear the delay line and the input format.
+
+            The next block is filtered as the start of a new stream.
+            )pbdoc")
+        .def_prop_ro(
+            "taps",
+            [](const FIR& fir) -> ARRAY_TYPE { return fir.taps(); },
+            R"pbdoc(
+            Copy of the filter taps.
+            )pbdoc"
+        )
+        .def_prop_ro("decimation", &FIR::decimation, R"pbdoc(
+            Decimation factor.
+
+            Returns
+            -------
+            :class:`int`
+            )pbdoc")
+        .def_prop_ro("interpolation", &FIR::interpolation, R"pbdoc(
+            Interpolation factor.
+
+            Returns
+            -------
+            :class:`int`
+            )pbdoc");
+}
+
+void bind_fir(nb::module_& m)
+{
+    bind_fir_class<APyFixedArray>(m, "APyFixedFIR", R"pbdoc(
+        Streaming FIR filter for :class:`APyFixedArray` sample streams.
+
+        The filter holds its taps, pre-arranged for the inner products, and a delay
+        line, so that an endless stream can be filtered one block at a time without
+        any per-block setup. The stream is upsampled by `interpolation` through zero
+        insertion, filtered, and downsampled by `decimation`. The rate change is
+        evaluated in polyphase form: only the kept outputs are computed and the
+        inserted zeros are never multiplied.
+
+        The output format is that of :func:`APyFixedArray.convolve`, with the number
+        of taps replaced by the number of products of each output,
+        ``ceil(len(taps) / interpolation)``. The accumulator context active when the
+        filter is created, if any, is used for all blocks, see
+        :class:`APyFixedAccumulatorContext`.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        taps : :class:`APyFixedArray`
+            One-dimensional array of filter taps.
+        decimation : :class:`int`, default: 1
+            Decimation factor.
+        interpolation : :class:`int`, default: 1
+            Interpolation factor.
+
+        Examples
+        --------
+        >>> import apytypes as apy
+        >>> taps = apy.fx([0.25, 0.5, 0.25], int_bits=1, frac_bits=2)
+        >>> fir = apy.APyFixedFIR(taps)
+        >>> fir.process(apy.fx([1, 0], int_bits=2, frac_bits=0))
+        APyFixedArray([1, 2], int_bits=5, frac_bits=2)
+        >>> fir.process(apy.fx([0, 0], int_bits=2, frac_bits=0))
+        APyFixedArray([1, 0], int_bits=5, frac_bits=2)
+
+        Decimation by two only computes every other output
+
+        >>> fir = apy.APyFixedFIR(taps, decimation=2)
+        >>> fir.process(apy.fx([1, 0, 0, 0], int_bits=2, frac_bits=0))
+        APyFixedArray([1, 1], int_bits=5, frac_bits=2)
+        )pbdoc");
+
+    bind_fir_class<APyCFixedArray>(m, "APyCFixedFIR", R"pbdoc(
+        Streaming FIR filter for :class:`APyCFixedArray` sample streams.
+
+        Works as :class:`APyFixedFIR`, with complex-valued taps and samples. The output
+        format is that of :func:`APyCFixedArray.convolve`, with the number of taps
+        replaced by the number of products of each output.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        taps : :class:`APyCFixedArray`
+            One-dimensional array of filter taps.
+        decimation : :class:`int`, default: 1
+            Decimation factor.
+        interpolation : :class:`int`, default: 1
+            Interpolation factor.
+        )pbdoc");
+
+    bind_fir_class<APyFloatArray>(m, "APyFloatFIR", R"pbdoc(
+        Streaming FIR filter for :class:`APyFloatArray` sample streams.
+
+        Works as :class:`APyFixedFIR`, with floating-point taps and samples. The
+        output format is that of :func:`APyFloatArray.convolve`. The products of each
+        output are accumulated from the oldest to the newest sample. The accumulator
+        context, or else the quantization mode, active when the filter is created is
+        used for all blocks.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        taps : :class:`APyFloatArray`
+            One-dimensional array of filter taps.
+        decimation : :class:`int`, default: 1
+            Decimation factor.
+        interpolation : :class:`int`, default: 1
+            Interpolation factor.
+        )pbdoc");
+
+    bind_fir_class<APyCFloatArray>(m, "APyCFloatFIR", R"pbdoc(
+        Streaming FIR filter for :class:`APyCFloatArray` sample streams.
+
+        Works as :class:`APyFloatFIR`, with complex-valued taps and samples.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        taps : :class:`APyCFloatArray`
+            One-dimensional array of filter taps.
+        decimation : :class:`int`, default: 1
+            Decimation factor.
+        interpolation : :class:`int`, default: 1
+            Interpolation factor.
+        )pbdoc");
+}
@@ -20,6 +20,7 @@
 #include <array>
 #include <cassert>
 #include <cstdint>    // std::int64_t
+#include <cstdlib>    // std::abs
 #include <functional> // std::bind, std::function, std::placeholders
 #include <iterator>   // std::begin
 #include <optional>   // std::optional
@@ -590,9 +591,9 @@ static APY_INLINE void _overflow_twos_complement(
 )
 {
     (void)int_bits;
-    (void)it_begin;
+    (void)it_end;
     if (bits % APY_LIMB_SIZE_BITS) {
-        RANDOM_ACCESS_ITERATOR ms_limb_it = std::prev(it_end);
+        RANDOM_ACCESS_ITERATOR ms_limb_it = it_begin + bits_to_limbs(bits) - 1;
         unsigned shift_amount = APY_LIMB_SIZE_BITS - (bits % APY_LIMB_SIZE_BITS);
         *ms_limb_it = apy_limb_signed_t(*ms_limb_it << shift_amount) >> shift_amount;
     }
@@ -859,6 +860,227 @@ static APY_INLINE void _cast_no_quantize_no_overflow(
     }
 }
 
+/*!
+ * Array-wide fixed-point cast functor. The quantization mode and overflow mode are
+ * resolved once, on construction, rather than for each element. Single-limb casts with
+ * `TRN`, `RND`, `RND_CONV`, or `JAM` and with `WRAP` or `SAT` are evaluated using the
+ * SIMD cast kernels. The functor never writes outside of the `n_items` destination
+ * elements, so disjoint element ranges can be cast concurrently.
+ */
+struct FixedPointCast {
+    explicit FixedPointCast(
+        const APyFixedSpec& src_spec,
+        const APyFixedSpec& dst_spec,
+        QuantizationMode q_mode,
+        OverflowMode v_mode
+    )
+        : src_spec { src_spec }
+        , dst_spec { dst_spec }
+        , src_limbs { bits_to_limbs(src_spec.bits) }
+        , dst_limbs { bits_to_limbs(dst_spec.bits) }
+        , ext_limbs { bits_to_limbs(std::max(src_spec.bits, dst_spec.bits)) }
+        , left_shift_amount { (dst_spec.bits - dst_spec.int_bits)
+                              - (src_spec.bits - src_spec.int_bits) }
+    {
+        // Specialization #1: widening cast, no quantization and no overflow possible.
+        // Jamming always sets the least significant bit, so it can not take this path.
+        if (left_shift_amount >= 0 && dst_spec.int_bits >= src_spec.int_bits
+            && q_mode != QuantizationMode::JAM) {
+            f = &FixedPointCast::cast_no_quantize_no_overflow;
+            return;
+        }
+
+        // Specialization #2: single-limb source and destination, SIMD cast kernels
+        bool is_single_limb = src_limbs == 1 && dst_limbs == 1;
+        bool is_short_shift
+            = unsigned(std::abs(left_shift_amount)) < APY_LIMB_SIZE_BITS;
+        bool is_simd_overflow
+            = v_mode == OverflowMode::WRAP || v_mode == OverflowMode::SAT;
+        if (is_single_limb && is_short_shift && is_simd_overflow) {
+            saturate = v_mode == OverflowMode::SAT;
+            switch (q_mode) {
+            case QuantizationMode::TRN:
+                simd_f = &simd::vector_cast_trn;
+                break;
+            case QuantizationMode::RND:
+                simd_f = &simd::vector_cast_rnd;
+                break;
+            case QuantizationMode::RND_CONV:
+                simd_f = &simd::vector_cast_rnd_conv;
+                break;
+            case QuantizationMode::JAM:
+                simd_f = &simd::vector_cast_jam;
+                break;
+            default:
+                simd_f = nullptr;
+                break;
+            }
+            if (simd_f) {
+                f = &FixedPointCast::cast_simd;
+                return;
+            }
+        }
+
+        // General case: resolve the quantization and overflow functions once
+        f = &FixedPointCast::cast_general;
+        switch (q_mode) {
+        case QuantizationMode::TRN:
+            quantize_f = &_quantize_trn<It>;
+            break;
+        case QuantizationMode::TRN_INF:
+            quantize_f = &_quantize_trn_inf<It>;
+            break;
+        case QuantizationMode::TRN_ZERO:
+            quantize_f = &_quantize_trn_zero<It>;
+            break;
+        case QuantizationMode::TRN_MAG:
+            quantize_f = &_quantize_trn_mag<It>;
+            break;
+        case QuantizationMode::TRN_AWAY:
+            quantize_f = &_quantize_trn_away<It>;
+            break;
+        case QuantizationMode::RND:
+            quantize_f = &_quantize_rnd<It>;
+            break;
+        case QuantizationMode::RND_ZERO:
+            quantize_f = &_quantize_rnd_zero<It>;
+            break;
+        case QuantizationMode::RND_INF:
+            quantize_f = &_quantize_rnd_inf<It>;
+            break;
+        case QuantizationMode::RND_MIN_INF:
+            quantize_f = &_quantize_rnd_min_inf<It>;
+            break;
+        case QuantizationMode::RND_CONV:
+            quantize_f = &_quantize_rnd_conv<It>;
+            break;
+        case QuantizationMode::RND_CONV_ODD:
+            quantize_f = &_quantize_rnd_conv_odd<It>;
+            break;
+        case QuantizationMode::JAM:
+            quantize_f = &_quantize_jam<It>;
+            break;
+        case QuantizationMode::JAM_UNBIASED:
+            quantize_f = &_quantize_jam_unbiased<It>;
+            break;
+        case QuantizationMode::STOCH_EQUAL:
+            quantize_f = [](It begin, It end, int b, int ib, int new_b, int new_ib) {
+                _quantize_stoch_equal(begin, end, b, ib, new_b, new_ib, rnd64_fx);
+            };
+            break;
+        case QuantizationMode::STOCH_WEIGHTED:
+            quantize_f = [](It begin, It end, int b, int ib, int new_b, int new_ib) {
+                _quantize_stoch_weighted(begin, end, b, ib, new_b, new_ib, rnd64_fx);
+            };
+            break;
+        default:
+            APYTYPES_UNREACHABLE();
+        }
+
+        switch (v_mode) {
+        case OverflowMode::WRAP:
+            overflow_f = &_overflow_twos_complement<It>;
+            break;
+        case OverflowMode::SAT:
+            overflow_f = &_overflow_saturate<It>;
+            break;
+        case OverflowMode::NUMERIC_STD:
+            overflow_f = &_overflow_numeric_std<It>;
+            break;
+        default:
+            throw NotImplementedException(
+                fmt::format(
+                    "Not implemented: FixedPointCast: with mode: {}",
+                    "unknown (did you pass `int` as `OverflowMode`?)"
+                )
+            );
+        }
+    }
+
+    using It = APyBuffer<apy_limb_t>::vector_type::iterator;
+    using CIt = APyBuffer<apy_limb_t>::vector_type::const_iterator;
+
+    //! Cast `n_items` consecutive elements from `src` into `dst`
+    void operator()(CIt src, It dst, std::size_t n_items) const
+    {
+        if (n_items) {
+            std::invoke(f, this, src, dst, n_items);
+        }
+    }
+
+private:
+    void cast_no_quantize_no_overflow(CIt src, It dst, std::size_t n_items) const
+    {
+        _cast_no_quantize_no_overflow(
+            src, dst, src_limbs, dst_limbs, n_items, unsigned(left_shift_amount)
+        );
+    }
+
+    void cast_simd(CIt src, It dst, std::size_t n_items) const
+    {
+        assert(src_limbs == 1 && dst_limbs == 1);
+        simd_f(src, dst, left_shift_amount, unsigned(dst_spec.bits), saturate, n_items);
+    }
+
+    void cast_general(CIt src, It dst, std::size_t n_items) const
+    {
+        // Quantization and overflow operate on `ext_limbs` limbs, which may extend past
+        // the end of a destination element. Each such element spills into the
+        // following, not yet written, elements. The last elements, whose spill would
+        // reach past the destination range, are cast through a scratch vector.
+        const std::size_t pad_limbs = ext_limbs - dst_limbs;
+        const std::size_t n_tail
+            = std::min(n_items, (pad_limbs + dst_limbs - 1) / dst_limbs);
+        const std::size_t n_direct = n_items - n_tail;
+        for (std::size_t i = 0; i < n_direct; i++) {
+            cast_single(
+                src + i * src_limbs,
+                dst + (i + 0) * dst_limbs,
+                dst + (i + 1) * dst_limbs + pad_limbs
+            );
+        }
+        if (n_tail) {
+            APyBuffer<apy_limb_t>::vector_type scratch(ext_limbs);
+            for (std::size_t i = n_direct; i < n_items; i++) {
+                cast_single(src + i * src_limbs, scratch.begin(), scratch.end());
+                std::copy_n(scratch.begin(), dst_limbs, dst + i * dst_limbs);
+            }
+        }
+    }
+
+    void cast_single(CIt src, It dst_begin, It dst_end) const
+    {
+        // Copy data into the result region and sign extend
+        limb_vector_copy_sign_extend(src, src + src_limbs, dst_begin, dst_end);
+
+        // First perform quantization, then perform overflowing
+        quantize_f(
+            dst_begin,
+            dst_end,
+            src_spec.bits,
+            src_spec.int_bits,
+            dst_spec.bits,
+            dst_spec.int_bits
+        );
+        overflow_f(dst_begin, dst_end, dst_spec.bits, dst_spec.int_bits);
+    }
+
+    // Pointer `f` to the correct cast function based on the limb lengths and modes
+    void (FixedPointCast::*f)(CIt src, It dst, std::size_t n_items) const;
+
+    // Resolved SIMD cast kernel
+    void (*simd_f)(CIt, It, int, unsigned, bool, std::size_t) = nullptr;
+    bool saturate = false;
+
+    // Resolved quantization and overflow functions for the general case
+    void (*quantize_f)(It, It, int, int, int, int) = nullptr;
+    void (*overflow_f)(It, It, int, int) = nullptr;
+
+    APyFixedSpec src_spec, dst_spec;
+    std::size_t src_limbs, dst_limbs, ext_limbs;
+    int left_shift_amount;
+};
+
 /* ********************************************************************************** *
  * *     Fixed-point iterator based arithmetic functions with multi-limb support    * *
  * ********************************************************************************** */
@@ -1294,6 +1516,322 @@ private:
     mutable ScratchVector<apy_limb_t, 16> product;
 };
 
+/* ********************************************************************************** *
+ * *                 Cache-blocked fixed-point matrix multiplication                 * *
+ * ********************************************************************************** */
+
+/*!
+ * Cache-blocked matrix multiplication `C = A x B` of single-limb fixed-point matrices,
+ * for results of one or two limbs without an accumulator context. The matrices are
+ * split into blocks of `KC` inner-dimension elements. Each block of `A` is packed into
+ * row panels of `simd::MATMUL_PANEL_ROWS` rows and each block of `B` into a
+ * contiguous [ `KC` x `NC` ] panel, which are then multiplied using register-blocked
+ * micro-kernels. As the accumulation is exact modulo the width of the result, the
+ * result is bit-identical to that of `FixedPointInnerProduct`.
+ */
+struct FixedPointTiledMatmul {
+    //! Rows of `A` in each block
+    static constexpr std::size_t MC = 64;
+    //! Inner-dimension elements in each block. A packed panel of `A` (4 x `KC`) fits
+    //! in L1 cache, and a packed panel of `B` (`KC` x `NC`) fits in L2 cache.
+    static constexpr std::size_t KC = 256;
+    //! Columns of `B` in each block
+    static constexpr std::size_t NC = 128;
+
+    //! Test if the tiled matrix multiplication supports the specified limb lengths
+    static bool is_supported(
+        std::size_t src1_limbs,
+        std::size_t src2_limbs,
+        std::size_t dst_limbs,
+        const std::optional<APyFixedAccumulatorOption>& acc_mode
+    )
+    {
+        if (acc_mode.has_value() || src1_limbs != 1 || src2_limbs != 1) {
+            return false;
+        }
+#if (COMPILER_LIMB_SIZE == 64) && !defined(__SIZEOF_INT128__)
+        // No double-limb integer type available for the two-limb micro-kernel
+        return dst_limbs == 1;
+#else
+        return dst_limbs == 1 || dst_limbs == 2;
+#endif
+    }
+
+    explicit FixedPointTiledMatmul(std::size_t dst_limbs)
+        : dst_limbs { dst_limbs }
+    {
+        assert(dst_limbs == 1 || dst_limbs == 2);
+    }
+
+    //! Compute `dst = A x B`, where A (src1): [ `M` x `N` ], B (src2): [ `N` x `P` ].
+    //! `dst` must be zero-initialized.
+    void operator()(
+        const apy_limb_t* src1,
+        const apy_limb_t* src2,
+        apy_limb_t* dst,
+        std::size_t M,
+        std::size_t N,
+        std::size_t P,
+        bool use_threadpool
+    ) const
+    {
+        const std::size_t m_blocks = (M + MC - 1) / MC;
+        const std::size_t p_blocks = (P + NC - 1) / NC;
+
+        // Each task computes one [ `MC` x `NC` ] block of `dst`
+        auto matmul_task = [&](std::size_t block_begin, std::size_t block_end) {
+            constexpr std::size_t MR = simd::MATMUL_PANEL_ROWS;
+            std::vector<apy_limb_t> a_packed(((MC + MR - 1) / MR) * MR * KC);
+            std::vector<apy_limb_t> b_packed(KC * NC);
+            for (std::size_t block = block_begin; block < block_end; block++) {
+                const std::size_t ic = (block / p_blocks) * MC;
+                const std::size_t jc = (block % p_blocks) * NC;
+                const std::size_t mc = std::min(MC, M - ic);
+                const std::size_t nc = std::min(NC, P - jc);
+                for (std::size_t pc = 0; pc < N; pc += KC) {
+                    const std::size_t kc = std::min(KC, N - pc);
+                    pack_a(src1, N, ic, mc, pc, kc, a_packed.data());
+                    pack_b(src2, P, pc, kc, jc, nc, b_packed.data());
+                    apy_limb_t* c = dst + dst_limbs * (ic * P + jc);
+                    if (dst_limbs == 1) {
+                        simd::matrix_multiply_accumulate_packed(
+                            c, P, a_packed.data(), b_packed.data(), mc, nc, kc
+                        );
+                    } else {
+                        matrix_multiply_accumulate_packed_two_limb(
+                            c, P, a_packed.data(), b_packed.data(), mc, nc, kc
+                        );
+                    }
+                }
+            }
+        };
+
+        threadpool_chunked_for(use_threadpool, m_blocks * p_blocks, matmul_task);
+    }
+
+private:
+    //! Pack the block [ `ic`, `ic + mc` ) x [ `pc`, `pc + kc` ) of row-major `A`, with
+    //! `N` columns, into zero-padded column-major panels of `MATMUL_PANEL_ROWS` rows
+    static void pack_a(
+        const apy_limb_t* A,
+        std::size_t N,
+        std::size_t ic,
+        std::size_t mc,
+        std::size_t pc,
+        std::size_t kc,
+        apy_limb_t* a_packed
+    )
+    {
+        constexpr std::size_t MR = simd::MATMUL_PANEL_ROWS;
+        for (std::size_t i = 0; i < mc; i += MR) {
+            const std::size_t mr = std::min(MR, mc - i);
+            apy_limb_t* panel = a_packed + i * kc;
+            for (std::size_t r = 0; r < mr; r++) {
+                const apy_limb_t* row = A + (ic + i + r) * N + pc;
+                for (std::size_t k = 0; k < kc; k++) {
+                    panel[k * MR + r] = row[k];
+                }
+            }
+            for (std::size_t r = mr; r < MR; r++) {
+                for (std::size_t k = 0; k < kc; k++) {
+                    panel[k * MR + r] = 0;
+                }
+            }
+        }
+    }
+
+    //! Pack the block [ `pc`, `pc + kc` ) x [ `jc`, `jc + nc` ) of row-major `B`, with
+    //! `P` columns, into a contiguous row-major panel
+    static void pack_b(
+        const apy_limb_t* B,
+        std::size_t P,
+        std::size_t pc,
+        std::size_t kc,
+        std::size_t jc,
+        std::size_t nc,
+        apy_limb_t* b_packed
+    )
+    {
+        for (std::size_t k = 0; k < kc; k++) {
+            std::copy_n(B + (pc + k) * P + jc, nc, b_packed + k * nc);
+        }
+    }
+
+    //! Two-limb result version of `simd::matrix_multiply_accumulate_packed`. Each
+    //! product of two single-limb elements is exact in a double-limb integer.
+    static void matrix_multiply_accumulate_packed_two_limb(
+        apy_limb_t* dst,
+        std::size_t dst_stride,
+        const apy_limb_t* a_packed,
+        const apy_limb_t* b_packed,
+        std::size_t m,
+        std::size_t n,
+        std::size_t k
+    )
+    {
+#if (COMPILER_LIMB_SIZE == 64) && defined(__SIZEOF_INT128__)
+        using dlimb_t = unsigned __int128;
+        using dlimb_signed_t = __int128;
+#elif (COMPILER_LIMB_SIZE == 32)
+        using dlimb_t = std::uint64_t;
+        using dlimb_signed_t = std::int64_t;
+#endif
+#if (COMPILER_LIMB_SIZE == 32) || defined(__SIZEOF_INT128__)
+        constexpr std::size_t MR = simd::MATMUL_PANEL_ROWS;
+        for (std::size_t i = 0; i < m; i += MR) {
+            const apy_limb_t* a = a_packed + i * k;
+            const std::size_t mr = std::min(MR, m - i);
+            for (std::size_t j = 0; j < n; j++) {
+                dlimb_t acc[MR] = {};
+                for (std::size_t p = 0; p < k; p++) {
+                    const apy_limb_signed_t b = b_packed[p * n + j];
+                    for (std::size_t r = 0; r < MR; r++) {
+                        const apy_limb_signed_t a_r = a[p * MR + r];
+                        acc[r] += dlimb_t(dlimb_signed_t(a_r) * dlimb_signed_t(b));
+                    }
+                }
+                for (std::size_t r = 0; r < mr; r++) {
+                    apy_limb_t* c = dst + 2 * ((i + r) * dst_stride + j);
+                    dlimb_t sum = (dlimb_t(c[1]) << APY_LIMB_SIZE_BITS) | c[0];
+                    sum += acc[r];
+                    c[0] = apy_limb_t(sum);
+                    c[1] = apy_limb_t(sum >> APY_LIMB_SIZE_BITS);
+                }
+            }
+        }
+#else
+        (void)dst, (void)dst_stride, (void)a_packed, (void)b_packed;
+        (void)m, (void)n, (void)k;
+        assert(false && "two-limb tiled matmul unsupported on this compiler");
+#endif
+    }
+
+    std::size_t dst_limbs;
+};
+
+/* ********************************************************************************** *
+ * *                  Register-blocked fixed-point convolution                      * *
+ * ********************************************************************************** */
+
+/*!
+ * Register-blocked one-dimensional convolution of single-limb real-valued or (with
+ * `IS_COMPLEX`) complex-valued fixed-point items, for results of one or two limbs
+ * without an accumulator context. Output `i` is the inner product of the `n` items
+ * starting at item `i` of `src1` with the `n` items of `src2`. `BLOCK` consecutive
+ * outputs are accumulated together in a single pass over `src2`, so each item of
+ * `src2` is loaded once per block rather than once per output. As the accumulation is
+ * exact modulo the width of the result, the result is bit-identical to that of
+ * `FixedPointInnerProduct` and `ComplexFixedPointInnerProduct`.
+ */
+template <bool IS_COMPLEX> struct FixedPointBlockedConvolution {
+    //! Number of outputs accumulated together
+    static constexpr std::size_t BLOCK = 8;
+
+    //! Test if the blocked convolution supports the specified limb lengths
+    static bool is_supported(
+        std::size_t src1_limbs,
+        std::size_t src2_limbs,
+        std::size_t dst_limbs,
+        const std::optional<APyFixedAccumulatorOption>& acc_mode
+    )
+    {
+        if (acc_mode.has_value() || src1_limbs != 1 || src2_limbs != 1) {
+            return false;
+        }
+#if (COMPILER_LIMB_SIZE == 64) && !defined(__SIZEOF_INT128__)
+        // No double-limb integer type available for two-limb results
+        return dst_limbs == 1;
+#else
+        return dst_limbs == 1 || dst_limbs == 2;
+#endif
+    }
+
+    explicit FixedPointBlockedConvolution(std::size_t dst_limbs)
+        : dst_limbs { dst_limbs }
+    {
+        assert(dst_limbs == 1 || dst_limbs == 2);
+    }
+
+    //! Compute the `n_out` outputs, each an inner product of `n` items, into `dst`
+    template <typename CIT, typename IT>
+    void operator()(CIT src1, CIT src2, IT dst, std::size_t n, std::size_t n_out) const
+    {
+        if (dst_limbs == 1) {
+            convolve<apy_limb_t>(src1, src2, dst, n, n_out);
+        } else {
+#if (COMPILER_LIMB_SIZE == 64) && defined(__SIZEOF_INT128__)
+            convolve<unsigned __int128>(src1, src2, dst, n, n_out);
+#elif (COMPILER_LIMB_SIZE == 32)
+            convolve<std::uint64_t>(src1, src2, dst, n, n_out);
+#else
+            (void)src1, (void)src2, (void)dst, (void)n, (void)n_out;
+            assert(false && "two-limb blocked convolution unsupported by compiler");
+#endif
+        }
+    }
+
+private:
+    //! Limbs of each item
+    static constexpr std::size_t ITEM_LIMBS = 1 + IS_COMPLEX;
+
+    //! Evaluate the outputs in blocks of `BLOCK`, followed by the remaining outputs one
+    //! at a time. The unsigned accumulator type `ACC_TYPE` is one or two limbs wide.
+    template <typename ACC_TYPE, typename CIT, typename IT>
+    static void convolve(CIT src1, CIT src2, IT dst, std::size_t n, std::size_t n_out)
+    {
+        constexpr std::size_t DST_ITEM_LIMBS
+            = ITEM_LIMBS * sizeof(ACC_TYPE) / sizeof(apy_limb_t);
+        std::size_t i = 0;
+        for (; i + BLOCK <= n_out; i += BLOCK) {
+            convolve_block<BLOCK, ACC_TYPE>(
+                src1 + i * ITEM_LIMBS, src2, dst + i * DST_ITEM_LIMBS, n
+            );
+        }
+        for (; i < n_out; i++) {
+            convolve_block<1, ACC_TYPE>(
+                src1 + i * ITEM_LIMBS, src2, dst + i * DST_ITEM_LIMBS, n
+            );
+        }
+    }
+
+    //! Evaluate `M` consecutive outputs. The sign-extended limbs are multiplied and
+    //! accumulated in `ACC_TYPE`, which wraps around exactly as two's complement.
+    template <std::size_t M, typename ACC_TYPE, typename CIT, typename IT>
+    static void convolve_block(CIT src1, CIT src2, IT dst, std::size_t n)
+    {
+        auto ext = [](apy_limb_t limb) { return ACC_TYPE(apy_limb_signed_t(limb)); };
+        ACC_TYPE acc[M][ITEM_LIMBS] = {};
+        for (std::size_t k = 0; k < n; k++) {
+            const ACC_TYPE b_re = ext(src2[ITEM_LIMBS * k]);
+            if constexpr (IS_COMPLEX) {
+                const ACC_TYPE b_im = ext(src2[ITEM_LIMBS * k + 1]);
+                for (std::size_t r = 0; r < M; r++) {
+                    const ACC_TYPE a_re = ext(src1[ITEM_LIMBS * (r + k)]);
+                    const ACC_TYPE a_im = ext(src1[ITEM_LIMBS * (r + k) + 1]);
+                    acc[r][0] += a_re * b_re - a_im * b_im;
+                    acc[r][1] += a_re * b_im + a_im * b_re;
+                }
+            } else {
+                for (std::size_t r = 0; r < M; r++) {
+                    acc[r][0] += ext(src1[r + k]) * b_re;
+                }
+            }
+        }
+
+        constexpr std::size_t ACC_LIMBS = sizeof(ACC_TYPE) / sizeof(apy_limb_t);
+        for (std::size_t r = 0; r < M; r++) {
+            for (std::size_t p = 0; p < ITEM_LIMBS; p++) {
+                for (std::size_t l = 0; l < ACC_LIMBS; l++) {
+                    dst[(r * ITEM_LIMBS + p) * ACC_LIMBS + l]
+                        = apy_limb_t(acc[r][p] >> (l * APY_LIMB_SIZE_BITS));
+                }
+            }
+        }
+    }
+
+    std::size_t dst_limbs;
+};
+
 /* ********************************************************************************** *
  * *                       Fixed-point to and from other types                      * *
  * ********************************************************************************** */
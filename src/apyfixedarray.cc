@@ -5,14 +5,17 @@
 #include "apybuffer.h"
 #include "apycfixed_util.h"
 #include "apycfixedarray.h"
+#include "apyconvolve.h"
 #include "apyfixed.h"
 #include "apyfixed_util.h"
 #include "apyfixedarray.h"
+#include "apyfloat_util.h"
 #include "apytypes_common.h"
 #include "apytypes_fwd.h"
 #include "apytypes_intrinsics.h"
 #include "apytypes_mp.h"
 #include "apytypes_simd.h"
+#include "apytypes_text_io.h"
 #include "apytypes_thread_pool.h"
 #include "apytypes_util.h"
 #include "array_utils.h"
@@ -26,17 +29,20 @@
 namespace nb = nanobind;
 
 // Standard header includes
-#include <algorithm> // std::copy, std::max, std::transform, etc...
-#include <cstddef>   // std::size_t
-#include <cstdint>   // std::int16, std::int32, std::int64, etc...
-#include <iterator>  // std::iterator
-#include <optional>  // std::optional
-#include <set>       // std::set
-#include <stdexcept> // std::length_error
-#include <string>    // std::string
-#include <utility>   // std::move, std::in_place_type
-#include <variant>   // std::variant
-#include <vector>    // std::vector, std::swap
+#include <algorithm>   // std::copy, std::max, std::transform, etc...
+#include <atomic>      // std::atomic
+#include <cmath>       // std::isfinite
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::int16, std::int32, std::int64, etc...
+#include <iterator>    // std::iterator
+#include <optional>    // std::optional
+#include <set>         // std::set
+#include <stdexcept>   // std::length_error
+#include <string>      // std::string
+#include <type_traits> // std::is_same_v, std::is_signed_v
+#include <utility>     // std::move, std::in_place_type
+#include <variant>     // std::variant
+#include <vector>      // std::vector, std::swap
 
 #include <fmt/format.h>
 
@@ -59,7 +65,7 @@ APyFixedArray::APyFixedArray(
 {
     // Specialized initialization for NDArray
     if (nb::isinstance<nb::ndarray<>>(bit_pattern_sequence)) {
-        auto ndarray = nb::cast<nb::ndarray<nb::c_contig>>(bit_pattern_sequence);
+        auto ndarray = nb::cast<nb::ndarray<>>(bit_pattern_sequence);
         _set_bits_from_ndarray(ndarray);
         return; // initialization completed
     }
@@ -92,6 +98,19 @@ APyFixedArray::APyFixedArray(
 {
 }
 
+APyFixedArray::APyFixedArray(
+    cow_no_init_t, const std::vector<std::size_t>& shape, int bits, int int_bits
+)
+    : APyArray(
+          shape,
+          bits_to_limbs(bits),
+          vector_type(fold_shape(shape) * bits_to_limbs(bits), cow_no_init)
+      )
+    , _bits { bits }
+    , _int_bits { int_bits }
+{
+}
+
 APyFixedArray::APyFixedArray(
     const std::vector<std::size_t>& shape, int bits, int int_bits, vector_type&& v
 )
@@ -127,29 +146,34 @@ APyFixedArray::_apyfixedarray_base_add_sub(const APyFixedArray& rhs) const
     const int res_bits = res_int_bits + res_frac_bits;
 
     // Resulting vector
-    APyFixedArray result(_shape, res_bits, res_int_bits);
+    APyFixedArray result(cow_no_init, _shape, res_bits, res_int_bits);
+    const bool use_threadpool = is_elementwise_with_threadpool_justified(_nitems);
 
     // Special case #1: Operands and result fit in single limb
     if (unsigned(res_bits) <= APY_LIMB_SIZE_BITS) {
         if (frac_bits() == rhs.frac_bits()) {
             // Operands have equally many fractional bits.
-            simd_op {}(
-                _data.begin(),
-                rhs._data.begin(),
-                result._data.begin(),
-                result._data.size()
-            );
+            threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+                simd_op {}(
+                    _data.begin() + begin,
+                    rhs._data.begin() + begin,
+                    result._data.begin() + begin,
+                    end - begin
+                );
+            });
         } else {
             auto rhs_shift_amount = unsigned(res_frac_bits - rhs.frac_bits());
             auto lhs_shift_amount = unsigned(res_frac_bits - frac_bits());
-            simd_shift_op {}(
-                _data.begin(),
-                rhs._data.begin(),
-                result._data.begin(),
-                lhs_shift_amount,
-                rhs_shift_amount,
-                result._data.size()
-            );
+            threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+                simd_shift_op {}(
+                    _data.begin() + begin,
+                    rhs._data.begin() + begin,
+                    result._data.begin() + begin,
+                    lhs_shift_amount,
+                    rhs_shift_amount,
+                    end - begin
+                );
+            });
         }
         return result; // early exit
     }
@@ -189,28 +213,33 @@ APyFixedArray::_apyfixedarray_base_add_sub(const APyFixedArray& rhs) const
         }
         // Two-limb specialization
         if (result._itemsize == 2) {
-            for (std::size_t i = 0; i < result._data.size(); i += 2) {
-                two_limb_op {}(
-                    result._data.data() + i, // dst
-                    src1_ptr + i,            // src1
-                    src2_ptr + i             // src2
-                );
-            }
+            threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+                for (std::size_t i = 2 * begin; i < 2 * end; i += 2) {
+                    two_limb_op {}(
+                        result._data.data() + i, // dst
+                        src1_ptr + i,            // src1
+                        src2_ptr + i             // src2
+                    );
+                }
+            });
         } else {
-            for (std::size_t i = 0; i < result._data.size(); i += result._itemsize) {
-                ripple_carry_op {}(
-                    result._data.data() + i, // dst
-                    src1_ptr + i,            // src1
-                    src2_ptr + i,            // src2
-                    result._itemsize         // limb vector length
-                );
-            }
+            const std::size_t n_limbs = result._itemsize;
+            threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+                for (std::size_t i = begin * n_limbs; i < end * n_limbs; i += n_limbs) {
+                    ripple_carry_op {}(
+                        result._data.data() + i, // dst
+                        src1_ptr + i,            // src1
+                        src2_ptr + i,            // src2
+                        n_limbs                  // limb vector length
+                    );
+                }
+            });
         }
         return result; // early exit
     }
 
     // Most general case: Works in any situation, but is slowest
-    APyFixedArray imm(_shape, res_bits, res_int_bits);
+    APyFixedArray imm(cow_no_init, _shape, res_bits, res_int_bits);
     _cast_no_quantize_no_overflow(
         std::begin(_data),               // src
         std::begin(result._data),        // dst
@@ -229,14 +258,17 @@ APyFixedArray::_apyfixedarray_base_add_sub(const APyFixedArray& rhs) const
     );
 
     // Perform ripple-carry operation for each element
-    for (std::size_t i = 0; i < result._data.size(); i += result._itemsize) {
-        ripple_carry_op {}(
-            result._data.data() + i, // dst
-            result._data.data() + i, // src1
-            imm._data.data() + i,    // src2
-            result._itemsize         // limb vector length
-        );
-    }
+    const std::size_t n_limbs = result._itemsize;
+    threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+        for (std::size_t i = begin * n_limbs; i < end * n_limbs; i += n_limbs) {
+            ripple_carry_op {}(
+                result._data.data() + i, // dst
+                result._data.data() + i, // src1
+                imm._data.data() + i,    // src2
+                n_limbs                  // limb vector length
+            );
+        }
+    });
     return result;
 }
 
@@ -398,7 +430,7 @@ APyFixedArray APyFixedArray::rsub(const APyFixed& lhs) const
     const int res_bits = res_int_bits + res_frac_bits;
 
     // Adjust binary point
-    APyFixedArray result(_shape, res_bits, res_int_bits);
+    APyFixedArray result(cow_no_init, _shape, res_bits, res_int_bits);
     _cast_no_quantize_no_overflow(
         std::begin(_data),          // src
         std::begin(result._data),   // dst
@@ -453,64 +485,75 @@ APyFixedArray APyFixedArray::operator*(const APyFixedArray& rhs) const
     const int res_bits = bits() + rhs.bits();
 
     // Resulting `APyFixedArray` fixed-point tensor
-    APyFixedArray result(_shape, res_bits, res_int_bits);
+    APyFixedArray result(cow_no_init, _shape, res_bits, res_int_bits);
+    const bool use_threadpool = is_elementwise_with_threadpool_justified(_nitems);
 
     if (unsigned(res_bits) <= APY_LIMB_SIZE_BITS) {
         // Special case #1: The resulting number of bits fit in a single limb
-        simd::vector_mul(
-            std::begin(_data),        // src1
-            std::begin(rhs._data),    // src2
-            std::begin(result._data), // dst
-            result._data.size()       // elements
-        );
+        threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+            simd::vector_mul(
+                std::begin(_data) + begin,        // src1
+                std::begin(rhs._data) + begin,    // src2
+                std::begin(result._data) + begin, // dst
+                end - begin                       // elements
+            );
+        });
     } else if (
         unsigned(bits()) <= APY_LIMB_SIZE_BITS
         && unsigned(rhs.bits()) <= APY_LIMB_SIZE_BITS
     ) {
         // Special case #2: Both arguments are single limb, result two limbs
-        VECTORIZE_LOOP
-        for (std::size_t i = 0; i < _nitems; i++) {
-            auto [high, low] = long_signed_mult(_data[i], rhs._data[i]);
-            result._data[i * 2 + 1] = high;
-            result._data[i * 2 + 0] = low;
-        }
+        threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+            VECTORIZE_LOOP
+            for (std::size_t i = begin; i < end; i++) {
+                auto [high, low] = long_signed_mult(_data[i], rhs._data[i]);
+                result._data[i * 2 + 1] = high;
+                result._data[i * 2 + 0] = low;
+            }
+        });
     } else if (unsigned(res_bits) <= 2 * APY_LIMB_SIZE_BITS) {
         // Special case #3: The resulting number of bits fit in two limbs.
         if (unsigned(bits()) <= APY_LIMB_SIZE_BITS) {
             // Left-hand side is single limb, right-hand side is two limbs
-            VECTORIZE_LOOP
-            for (std::size_t i = 0; i < _nitems; i++) {
-                auto [high, low]
-                    = long_signed_unsigned_mult(_data[i], rhs._data[i * 2]);
-                auto high2 = (apy_limb_signed_t)_data[i]
-                    * (apy_limb_signed_t)rhs._data[i * 2 + 1];
-                result._data[i * 2 + 0] = low;
-                result._data[i * 2 + 1] = high + high2;
-            }
+            threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+                VECTORIZE_LOOP
+                for (std::size_t i = begin; i < end; i++) {
+                    auto [high, low]
+                        = long_signed_unsigned_mult(_data[i], rhs._data[i * 2]);
+                    auto high2 = (apy_limb_signed_t)_data[i]
+                        * (apy_limb_signed_t)rhs._data[i * 2 + 1];
+                    result._data[i * 2 + 0] = low;
+                    result._data[i * 2 + 1] = high + high2;
+                }
+            });
         } else {
             assert(unsigned(rhs.bits()) <= APY_LIMB_SIZE_BITS);
             // Left-hand side is two limbs, right-hand side is single limb
-            VECTORIZE_LOOP
-            for (std::size_t i = 0; i < _nitems; i++) {
-                auto [high, low]
-                    = long_signed_unsigned_mult(rhs._data[i], _data[i * 2]);
-                auto high2 = (apy_limb_signed_t)_data[i * 2 + 1]
-                    * (apy_limb_signed_t)rhs._data[i];
-                result._data[i * 2 + 0] = low;
-                result._data[i * 2 + 1] = high + high2;
-            }
+            threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+                VECTORIZE_LOOP
+                for (std::size_t i = begin; i < end; i++) {
+                    auto [high, low]
+                        = long_signed_unsigned_mult(rhs._data[i], _data[i * 2]);
+                    auto high2 = (apy_limb_signed_t)_data[i * 2 + 1]
+                        * (apy_limb_signed_t)rhs._data[i];
+                    result._data[i * 2 + 0] = low;
+                    result._data[i * 2 + 1] = high + high2;
+                }
+            });
         }
     } else {
         // General case: This always works but is slower than the special cases.
-        fixed_point_hadamard_product(
-            std::begin(_data),        // src1
-            std::begin(rhs._data),    // src2
-            std::begin(result._data), // dst
-            _itemsize,                // src1_limbs
-            rhs._itemsize,            // src2_limbs
-            result._itemsize,         // dst_limbs
-            _nitems                   // n_items
-        );
+        threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+            fixed_point_hadamard_product(
+                std::begin(_data) + begin * _itemsize,               // src1
+                std::begin(rhs._data) + begin * rhs._itemsize,       // src2
+                std::begin(result._data) + begin * result._itemsize, // dst
+                _itemsize,                                           // src1_limbs
+                rhs._itemsize,                                       // src2_limbs
+                result._itemsize,                                    // dst_limbs
+                end - begin                                          // n_items
+            );
+        });
     }
 
     return result;
@@ -803,16 +846,19 @@ APyFixedArray APyFixedArray::operator/(const APyFixedArray& rhs) const
     const int res_frac_bits = frac_bits() + rhs.int_bits();
     const int res_bits = res_int_bits + res_frac_bits;
     APyFixedArray result(_shape, res_bits, res_int_bits);
+    const bool use_threadpool = is_elementwise_with_threadpool_justified(_nitems);
 
     // Special case #1: The resulting number of bits fit in a single limb
     if (unsigned(res_bits) <= APY_LIMB_SIZE_BITS) {
-        simd::vector_shift_div_signed(
-            std::begin(_data),        // src1 (numerator)
-            std::begin(rhs._data),    // src2 (denominator)
-            std::begin(result._data), // dst
-            rhs.bits(),               // numerator shift amount
-            _data.size()              // vector elements
-        );
+        threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+            simd::vector_shift_div_signed(
+                std::begin(_data) + begin,        // src1 (numerator)
+                std::begin(rhs._data) + begin,    // src2 (denominator)
+                std::begin(result._data) + begin, // dst
+                rhs.bits(),                       // numerator shift amount
+                end - begin                       // vector elements
+            );
+        });
         return result; // early exit
     }
 
@@ -932,9 +978,9 @@ APyFixedArray APyFixedArray::operator/(const APyFixedArray& rhs) const
     }
 #endif
 
-    // General case: This always works but is slower than the special cases.
-    ScratchVector<apy_limb_t, 16> scratch(result._itemsize + rhs._itemsize);
-
+    // General case: This always works but is slower than the special cases. All
+    // denominators are tested for zero up front, so that the (possibly threaded)
+    // division loop never throws.
     for (std::size_t i = 0; i < _nitems; i++) {
         if (limb_vector_is_zero(
                 std::begin(rhs._data) + (i + 0) * rhs._itemsize,
@@ -943,17 +989,23 @@ APyFixedArray APyFixedArray::operator/(const APyFixedArray& rhs) const
             PyErr_SetString(PyExc_ZeroDivisionError, "fixed-point division by zero");
             throw nb::python_error();
         }
-        fixed_point_division_generic(
-            std::begin(result._data) + i * result._itemsize,
-            std::begin(_data) + (i + 0) * _itemsize,
-            std::begin(_data) + (i + 1) * _itemsize,
-            std::begin(rhs._data) + (i + 0) * rhs._itemsize,
-            std::begin(rhs._data) + (i + 1) * rhs._itemsize,
-            rhs.bits(),
-            result._itemsize,
-            scratch
-        );
     }
+
+    threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+        ScratchVector<apy_limb_t, 16> scratch(result._itemsize + rhs._itemsize);
+        for (std::size_t i = begin; i < end; i++) {
+            fixed_point_division_generic(
+                std::begin(result._data) + i * result._itemsize,
+                std::begin(_data) + (i + 0) * _itemsize,
+                std::begin(_data) + (i + 1) * _itemsize,
+                std::begin(rhs._data) + (i + 0) * rhs._itemsize,
+                std::begin(rhs._data) + (i + 1) * rhs._itemsize,
+                rhs.bits(),
+                result._itemsize,
+                scratch
+            );
+        }
+    });
     return result;
 }
 
@@ -1743,52 +1795,37 @@ APyFixedArray APyFixedArray::convolve(
     const APyFixedArray* a = swap ? &other : this;
     const APyFixedArray* b = &b_cpy;
 
-    // Get convolution properties from the convolution mode
-    auto [len, n_left, n_right] = get_conv_lengths(conv_mode, a, b);
-
-    int pad_bits = b->_shape[0] ? bit_width(b->_shape[0] - 1) : 0;
-    int res_bits = a->bits() + b->bits() + pad_bits;
-    int res_int_bits = a->int_bits() + b->int_bits() + pad_bits;
-    std::optional<APyFixedAccumulatorOption> acc = get_accumulator_mode_fixed();
-    if (acc.has_value()) {
-        res_bits = acc->bits;
-        res_int_bits = acc->int_bits;
-    }
-
-    APyFixedArray res({ len }, res_bits, res_int_bits);
-
-    auto inner_product = FixedPointInnerProduct(a->spec(), b->spec(), res.spec(), acc);
-
-    // Loop working variables
-    std::size_t n = b->_shape[0] - n_left;
-    auto dst = std::begin(res._data);
-    auto src1 = std::cbegin(a->_data);
-    auto src2 = std::cbegin(b->_data) + n_left * b->_itemsize;
-
-    // `b` limits length of the inner product length
-    for (std::size_t i = 0; i < n_left; i++) {
-        inner_product(src1, src2, dst, n);
-        src2 -= b->_itemsize;
-        dst += res._itemsize;
-        n++;
-    }
-
-    // full inner product length
-    for (std::size_t i = 0; i < a->_shape[0] - b->_shape[0] + 1; i++) {
-        inner_product(src1, src2, dst, n);
-        src1 += a->_itemsize;
-        dst += res._itemsize;
-    }
+    // Split the outputs over the thread pool, one inner product per output
+    return convolve_1d(*a, std::cbegin(a->_data), *b, std::cbegin(b->_data), conv_mode);
+}
 
-    // `a` limits length of the inner product length
-    for (std::size_t i = 0; i < n_right; i++) {
-        n--;
-        inner_product(src1, src2, dst, n);
-        src1 += a->_itemsize;
-        dst += res._itemsize;
+//! Perform a two-dimensional convolution with `other` using `mode`
+APyFixedArray APyFixedArray::convolve2d(
+    const APyFixedArray& other,
+    const ConvolutionMode conv_mode,
+    const PyShapeParam_t& stride
+) const
+{
+    if (ndim() < 2 || other.ndim() != 2) {
+        auto msg = fmt::format(
+            "can only convolve2d 2D arrays, or batches of them "
+            "(lhs.ndim = {}, rhs.ndim = {})",
+            ndim(),
+            other.ndim()
+        );
+        throw nanobind::value_error(msg.c_str());
     }
+    return convolve_nd(*this, other, conv_mode, stride, false, "convolve2d");
+}
 
-    return res;
+//! Perform a correlation with `other` using `mode`
+APyFixedArray APyFixedArray::correlate(
+    const APyFixedArray& other,
+    const ConvolutionMode conv_mode,
+    const PyShapeParam_t& stride
+) const
+{
+    return convolve_nd(*this, other, conv_mode, stride, true, "correlate");
 }
 
 std::variant<APyFixedArray, APyFixed>
@@ -1843,16 +1880,15 @@ APyFixedArray::min(const std::optional<PyShapeParam_t>& py_axis) const
 
 std::string APyFixedArray::repr() const
 {
-    const auto formatter = [bits = _bits](auto cbegin_it, auto cend_it) -> std::string {
-        std::vector<apy_limb_t> data(std::distance(cbegin_it, cend_it));
-        std::copy(cbegin_it, cend_it, std::begin(data));
+    const auto formatter = [bits = _bits](auto cbegin_it, auto cend_it, auto& out) {
+        ScratchVector<apy_limb_t, 8> data(cbegin_it, cend_it);
 
         // Zero sign bits outside of bit-range
         if (bits % APY_LIMB_SIZE_BITS) {
             apy_limb_t and_mask = (apy_limb_t(1) << (bits % APY_LIMB_SIZE_BITS)) - 1;
             data.back() &= and_mask;
         }
-        return bcds_to_string(double_dabble(data));
+        limb_vector_to_decimal(out, data.data(), data.size());
     };
     return array_repr(
         { formatter },
@@ -1864,9 +1900,9 @@ std::string APyFixedArray::repr() const
 std::string APyFixedArray::to_string_dec() const
 {
     FixedPointToDouble<vector_const_iterator> converter(spec());
-    const auto formatter = [&](auto cbegin_it, auto cend_it) -> std::string {
+    const auto formatter = [&](auto cbegin_it, auto cend_it, auto& out) {
         double fixed_as_double = converter(cbegin_it, cend_it);
-        return fmt::format("{}", fixed_as_double);
+        fmt::format_to(std::back_inserter(out), "{}", fixed_as_double);
     };
 
     return array_format(formatter, 88, false);
@@ -1891,16 +1927,24 @@ APyFixedArray APyFixedArray::abs() const
 
     // Resulting `APyFixedArray` fixed-point tensor
     APyFixedArray result(_shape, res_bits, res_int_bits);
+    const bool use_threadpool = is_elementwise_with_threadpool_justified(_nitems);
     if (unsigned(res_bits) <= APY_LIMB_SIZE_BITS) {
-        simd::vector_abs(result._data.begin(), _data.begin(), _data.size());
+        threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+            simd::vector_abs(
+                result._data.begin() + begin, _data.begin() + begin, end - begin
+            );
+        });
         return result;
     }
-    auto it_begin = _data.begin();
-    for (std::size_t i = 0; i < _nitems; i++) {
-        auto it_end = it_begin + _itemsize;
-        limb_vector_abs(it_begin, it_end, result._data.begin() + i * result._itemsize);
-        it_begin = it_end;
-    }
+    threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+        for (std::size_t i = begin; i < end; i++) {
+            auto it_begin = _data.begin() + i * _itemsize;
+            auto it_end = it_begin + _itemsize;
+            limb_vector_abs(
+                it_begin, it_end, result._data.begin() + i * result._itemsize
+            );
+        }
+    });
     return result;
 }
 
@@ -1911,7 +1955,7 @@ APyFixedArray APyFixedArray::operator-() const
     const int res_bits = _bits + 1;
 
     // Resulting `APyFixedArray` fixed-point tensor
-    APyFixedArray result(_shape, res_bits, res_int_bits);
+    APyFixedArray result(cow_no_init, _shape, res_bits, res_int_bits);
     /*
      * Specialization #1: Single limb `src` and `dst`
      */
@@ -1964,7 +2008,7 @@ APyFixedArray APyFixedArray::operator-() const
 APyFixedArray APyFixedArray::operator~() const
 {
     // Resulting `APyFixedArray` fixed-point tensor
-    APyFixedArray result(_shape, _bits, _int_bits);
+    APyFixedArray result(cow_no_init, _shape, _bits, _int_bits);
     simd::vector_not(result._data.begin(), _data.begin(), _itemsize * _nitems);
     return result;
 }
@@ -2000,11 +2044,16 @@ APyFixedArray::to_bits(bool numpy) const
                 std::in_place_type<nb::ndarray<nb::numpy, std::uint32_t>>,
                 to_bits_ndarray<nb::numpy, std::uint32_t>()
             );
-        } else {
+        } else if (bits() <= 64) {
             return RESULT_TYPE(
                 std::in_place_type<nb::ndarray<nb::numpy, std::uint64_t>>,
                 to_bits_ndarray<nb::numpy, std::uint64_t>()
             );
+        } else {
+            return RESULT_TYPE(
+                std::in_place_type<nb::ndarray<nb::numpy, std::uint64_t>>,
+                to_bits_ndarray_words()
+            );
         }
     } else {
         auto it = std::cbegin(_data);
@@ -2101,21 +2150,52 @@ nb::ndarray<NB_ARRAY_TYPE, INT_TYPE> APyFixedArray::to_bits_ndarray() const
     );
 }
 
+nb::ndarray<nb::numpy, std::uint64_t> APyFixedArray::to_bits_ndarray_words() const
+{
+    // The words of each element are laid out along an additional, innermost, dimension
+    const std::size_t n_words = (std::size_t(_bits) + 63) / 64;
+    std::vector<std::size_t> shape = _shape;
+    shape.push_back(n_words);
+
+    std::uint64_t* result_data = new std::uint64_t[_nitems * n_words];
+    const unsigned top_bits = unsigned(_bits % 64);
+    const std::uint64_t top_mask
+        = top_bits ? (std::uint64_t(1) << top_bits) - 1 : ~std::uint64_t(0);
+    const apy_limb_t* src = _data.data();
+    const bool use_threadpool = is_elementwise_with_threadpool_justified(_nitems);
+    threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+        for (std::size_t i = begin; i < end; i++) {
+            std::uint64_t* words = result_data + i * n_words;
+            limbs_to_words(src + i * _itemsize, _itemsize, words, n_words);
+            words[n_words - 1] &= top_mask;
+        }
+    });
+
+    // Delete `result_data` when the `owner` capsule expires
+    nb::capsule owner(result_data, [](void* p) noexcept {
+        delete[] (std::uint64_t*)p;
+    });
+
+    return nb::ndarray<nb::numpy, std::uint64_t>(
+        result_data, shape.size(), shape.data(), owner
+    );
+}
+
 nb::list APyFixedArray::to_signed_bits() const
 {
     auto it = std::cbegin(_data);
     return to_bits_python_recursive_descent(0, it, true);
 }
 
-nb::ndarray<nb::numpy, double>
+nb::ndarray<nb::numpy>
 APyFixedArray::to_numpy(std::optional<nb::object> dtype, std::optional<bool> copy) const
 {
-    (void)dtype;
-
-    FixedPointToDouble<vector_const_iterator> converter(spec());
-    return nb::ndarray<nb::numpy, double>(
-        to_ndarray<double>(converter, "to_numpy", copy)
-    );
+    const APyFixedSpec src_spec = spec();
+    const apy_limb_t* src = _data.data();
+    const auto convert_block = [&](std::size_t begin, std::size_t end, auto* dst) {
+        fixed_point_to_floats(src + begin * _itemsize, end - begin, src_spec, dst);
+    };
+    return to_numpy_floats</*IS_COMPLEX=*/false>(convert_block, dtype, copy);
 }
 
 APyFixedArray APyFixedArray::cast(
@@ -2134,28 +2214,119 @@ APyFixedArray APyFixedArray::cast(
     const auto quantization_mode = quantization.value_or(cast_option.quantization);
     const auto overflow_mode = overflow.value_or(cast_option.overflow);
 
-    // The new result array (`bit_specifier_sanitize()` called in constructor)
+    // The cast functor, with quantization and overflow resolved once for all elements
+    const FixedPointCast caster(
+        spec(), { new_bits, new_int_bits }, quantization_mode, overflow_mode
+    );
+
+    // The new result array
     std::size_t result_limbs = bits_to_limbs(new_bits);
-    std::size_t pad_limbs = bits_to_limbs(std::max(new_bits, _bits)) - result_limbs;
-    APyFixedArray::vector_type result_data(_nitems * result_limbs + pad_limbs);
+    APyFixedArray::vector_type result_data(_nitems * result_limbs, cow_no_init);
+
+    // Do the casting
+    const bool use_threadpool = is_elementwise_with_threadpool_justified(_nitems)
+        && !is_stochastic_quantization(quantization_mode);
+    threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+        caster(
+            std::cbegin(_data) + begin * _itemsize,
+            std::begin(result_data) + begin * result_limbs,
+            end - begin
+        );
+    });
 
-    // Do the casting: `fixed_point_cast_unsafe` is safe to use because of `pad_limbs`
-    for (std::size_t i = 0; i < _nitems; i++) {
-        fixed_point_cast_unsafe(
-            std::begin(_data) + (i + 0) * _itemsize,
-            std::begin(_data) + (i + 1) * _itemsize,
-            std::begin(result_data) + (i + 0) * result_limbs,
-            std::begin(result_data) + (i + 1) * result_limbs + pad_limbs,
-            _bits,
-            _int_bits,
-            new_bits,
-            new_int_bits,
-            quantization_mode,
-            overflow_mode
+    return APyFixedArray(_shape, new_bits, new_int_bits, std::move(result_data));
+}
+
+APyFixedArray APyFixedArray::fma(
+    const APyFixedArray& b,
+    const APyFixedArray& c,
+    std::optional<int> int_bits,
+    std::optional<int> frac_bits,
+    std::optional<QuantizationMode> quantization,
+    std::optional<OverflowMode> overflow,
+    std::optional<int> bits
+) const
+{
+    if (_shape != b._shape || _shape != c._shape) {
+        auto&& new_shape = smallest_broadcastable_shape(_shape, b._shape);
+        if (new_shape.size()) {
+            new_shape = smallest_broadcastable_shape(new_shape, c._shape);
+        }
+        if (new_shape.size() == 0) {
+            throw std::length_error(
+                fmt::format(
+                    "APyFixedArray.fma: shape mismatch, self.shape={}, b.shape={}, "
+                    "c.shape={}",
+                    tuple_string_from_vec(_shape),
+                    tuple_string_from_vec(b._shape),
+                    tuple_string_from_vec(c._shape)
+                )
+            );
+        }
+        return broadcast_to(new_shape).fma(
+            b.broadcast_to(new_shape),
+            c.broadcast_to(new_shape),
+            int_bits,
+            frac_bits,
+            quantization,
+            overflow,
+            bits
         );
     }
 
-    result_data.resize(_nitems * result_limbs);
+    // Full-precision format of `*this * b + c`, the same as used by the operators
+    const int prod_bits = _bits + b._bits;
+    const int prod_int_bits = _int_bits + b._int_bits;
+    const int acc_frac_bits = std::max(prod_bits - prod_int_bits, c.frac_bits());
+    const int acc_int_bits = std::max(prod_int_bits, c._int_bits) + 1;
+    const int acc_bits = acc_int_bits + acc_frac_bits;
+
+    if (unsigned(acc_bits) > APY_LIMB_SIZE_BITS) {
+        // Multi-limb accumulator, evaluate through the array operators
+        return (*this * b + c).cast(int_bits, frac_bits, quantization, overflow, bits);
+    }
+
+    // Sanitize the input (bit-specifier validity tested in `bits_from_optional()`)
+    const auto [new_bits, new_int_bits]
+        = bits_from_optional_cast(bits, int_bits, frac_bits, acc_bits, acc_int_bits);
+
+    const APyFixedCastOption cast_option = get_fixed_cast_mode();
+    const auto quantization_mode = quantization.value_or(cast_option.quantization);
+    const auto overflow_mode = overflow.value_or(cast_option.overflow);
+    const FixedPointCast caster(
+        { acc_bits, acc_int_bits },
+        { new_bits, new_int_bits },
+        quantization_mode,
+        overflow_mode
+    );
+
+    // The new result array
+    std::size_t result_limbs = bits_to_limbs(new_bits);
+    APyFixedArray::vector_type result_data(_nitems * result_limbs, cow_no_init);
+
+    // Single-limb accumulator. Accumulate one block at a time into a small scratch
+    // vector, and quantize the block into the result.
+    constexpr std::size_t BLOCK_SIZE = 256;
+    const unsigned prod_shift = unsigned(acc_frac_bits - (prod_bits - prod_int_bits));
+    const unsigned c_shift = unsigned(acc_frac_bits - c.frac_bits());
+    const bool use_threadpool = is_elementwise_with_threadpool_justified(_nitems)
+        && !is_stochastic_quantization(quantization_mode);
+    threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+        APyFixedArray::vector_type acc(std::min<std::size_t>(BLOCK_SIZE, end - begin));
+        auto acc_it = std::begin(acc);
+        for (std::size_t i = begin; i < end; i += BLOCK_SIZE) {
+            const std::size_t n = std::min<std::size_t>(BLOCK_SIZE, end - i);
+            auto src1 = std::cbegin(_data) + i;
+            auto src2 = std::cbegin(b._data) + i;
+            auto src3 = std::cbegin(c._data) + i;
+            VECTORIZE_LOOP
+            for (std::size_t j = 0; j < n; j++) {
+                acc_it[j] = ((src1[j] * src2[j]) << prod_shift) + (src3[j] << c_shift);
+            }
+            caster(std::cbegin(acc), std::begin(result_data) + i * result_limbs, n);
+        }
+    });
+
     return APyFixedArray(_shape, new_bits, new_int_bits, std::move(result_data));
 }
 
@@ -2182,6 +2353,55 @@ void APyFixedArray::python_unpickle(
     new (apyfixedarray) APyFixedArray(new_fx);
 }
 
+void APyFixedArray::python_write_text(
+    const nb::object& file,
+    std::size_t columns,
+    std::string_view radix,
+    const std::optional<std::string>& delimiter,
+    const std::string& line_end,
+    bool is_signed
+) const
+{
+    const auto format = TextFormat::from_python(radix, delimiter, line_end, is_signed);
+    const std::size_t n_words = bits_to_words(_bits);
+    const apy_limb_t* src = _data.data();
+    auto get_words = [&](std::size_t i, std::uint64_t* words) {
+        limbs_to_words(src + i * _itemsize, _itemsize, words, n_words);
+    };
+    write_bit_patterns(file, _nitems, columns, _bits, format, get_words);
+}
+
+APyFixedArray APyFixedArray::python_read_text(
+    const nb::object& file,
+    std::string_view radix,
+    const std::optional<std::string>& delimiter,
+    std::optional<int> int_bits,
+    std::optional<int> frac_bits,
+    std::optional<int> bits
+)
+{
+    const int res_bits = bits_from_optional(bits, int_bits, frac_bits);
+    const int res_int_bits = int_bits.has_value() ? *int_bits : *bits - *frac_bits;
+    const auto format = TextFormat::from_python(radix, delimiter);
+    const std::size_t n_words = bits_to_words(res_bits);
+    const BitPatternTable table = read_bit_patterns(file, n_words, format);
+
+    APyFixedArray result(table.shape(format), int_bits, frac_bits, bits);
+    const std::size_t itemsize = result._itemsize;
+    const std::uint64_t* src = table.words.data();
+    apy_limb_t* dst = result._data.data();
+    const std::size_t n = result._nitems;
+    const bool use_threadpool = result.is_elementwise_with_threadpool_justified(n);
+    threadpool_chunked_for(use_threadpool, n, [&](auto begin, auto end) {
+        for (std::size_t i = begin; i < end; i++) {
+            apy_limb_t* item = dst + i * itemsize;
+            words_to_limbs(src + i * n_words, n_words, item, itemsize);
+            _overflow_twos_complement(item, item + itemsize, res_bits, res_int_bits);
+        }
+    });
+    return result;
+}
+
 /* ********************************************************************************** *
  * *                      Static conversion from other types                          *
  * ********************************************************************************** */
@@ -2195,7 +2415,7 @@ APyFixedArray APyFixedArray::from_numbers(
 {
     if (nb::isinstance<nb::ndarray<>>(number_seq)) {
         // Sequence is NDArray. Initialize using `from_array`
-        auto ndarray = nb::cast<nb::ndarray<nb::c_contig>>(number_seq);
+        auto ndarray = nb::cast<nb::ndarray<>>(number_seq);
         return from_array(ndarray, int_bits, frac_bits, bits);
     }
 
@@ -2279,7 +2499,7 @@ APyFixedArray APyFixedArray::from_numbers(
 }
 
 APyFixedArray APyFixedArray::from_array(
-    const nb::ndarray<nb::c_contig>& ndarray,
+    const nb::ndarray<>& ndarray,
     std::optional<int> int_bits,
     std::optional<int> frac_bits,
     std::optional<int> bits
@@ -2301,6 +2521,37 @@ APyFixedArray APyFixedArray::from_array(
     return result;
 }
 
+APyFixedArray APyFixedArray::from_dlpack(
+    const nb::ndarray<>& ndarray,
+    std::optional<int> int_bits,
+    std::optional<int> frac_bits,
+    std::optional<int> bits
+)
+{
+    // Multi-limb items have their limbs along an additional, innermost, dimension
+    const int res_bits = bits_from_optional(bits, int_bits, frac_bits);
+    const std::size_t item_ndim = bits_to_limbs(res_bits) > 1 ? 1 : 0;
+    if (ndarray.ndim() <= item_ndim) {
+        throw nb::value_error(
+            "APyFixedArray.from_dlpack: zero-dimensional arrays not supported"
+        );
+    }
+    std::vector<std::size_t> shape(ndarray.ndim() - item_ndim);
+    for (std::size_t i = 0; i < shape.size(); i++) {
+        shape[i] = ndarray.shape(i);
+    }
+
+    APyFixedArray result(shape, int_bits, frac_bits, bits);
+    result.set_data_from_dlpack(ndarray);
+    for (std::size_t i = 0; i < result._nitems; i++) {
+        auto it = std::begin(result._data) + i * result._itemsize;
+        _overflow_twos_complement(
+            it, it + result._itemsize, result._bits, result._int_bits
+        );
+    }
+    return result;
+}
+
 /* ****************************************************************************** *
  *                    Static methods for creating arrays                          *
  * ****************************************************************************** */
@@ -2445,6 +2696,8 @@ APyFixed APyFixedArray::_checked_inner_product(
     auto inner_product
         = FixedPointInnerProduct(spec(), rhs.spec(), res_arr.spec(), mode);
 
+    const GILRelease gil_release(_nitems);
+
     inner_product(
         std::begin(_data),         // src1
         std::begin(rhs._data),     // src2
@@ -2483,13 +2736,37 @@ APyFixedArray APyFixedArray::_checked_2d_matmul(
         res_int_bits = mode->int_bits;
     }
 
-    // Determine if threadpool should be used or not.
+    // Determine if threadpool should be used or not. The GIL is released for the
+    // remainder of the product.
     const bool use_threadpool = is_mac_with_threadpool_justified(M * N * res_cols);
+    const GILRelease gil_release(M * N * res_cols);
+    const auto pool_lock = lock_thread_pool(use_threadpool);
     const std::size_t n_threads = use_threadpool ? thread_pool.get_thread_count() : 1;
 
     // Resulting tensor
     APyFixedArray res(res_shape, res_bits, res_int_bits);
 
+    // Use the cache-blocked matrix multiplication for matrix-matrix products of
+    // single-limb elements
+    const bool is_matrix_product
+        = M >= simd::MATMUL_PANEL_ROWS && res_cols >= simd::MATMUL_PANEL_ROWS;
+    if (is_matrix_product
+        && FixedPointTiledMatmul::is_supported(
+            _itemsize, rhs._itemsize, res._itemsize, mode
+        )) {
+        FixedPointTiledMatmul tiled_matmul(res._itemsize);
+        tiled_matmul(
+            _data.data(),     // src1, A: [M x N]
+            rhs._data.data(), // src2, B: [N x res_cols]
+            res._data.data(), // dst
+            M,
+            N,
+            res_cols,
+            use_threadpool
+        );
+        return res;
+    }
+
     // Specialized inner product functor
     FixedPointInnerProduct inner_product(spec(), rhs.spec(), res.spec(), mode);
     FixedPointInnerProduct* inner_product_ptr = &inner_product;
@@ -2540,18 +2817,17 @@ APyFixedArray APyFixedArray::_checked_2d_matmul(
     return res;
 }
 
-void APyFixedArray::_set_bits_from_ndarray(const nb::ndarray<nb::c_contig>& ndarray)
+void APyFixedArray::_set_bits_from_ndarray(const nb::ndarray<>& ndarray)
 {
 #define CHECK_AND_SET_BITS_FROM_NPTYPE(__TYPE__)                                       \
     do {                                                                               \
         if (ndarray.dtype() == nb::dtype<__TYPE__>()) {                                \
-            auto ndarray_view = ndarray.view<__TYPE__, nb::ndim<1>>();                 \
-            for (std::size_t i = 0; i < ndarray.size(); i++) {                         \
+            NDArrayReader<__TYPE__>(ndarray).for_each([&](std::size_t i, __TYPE__ v) { \
                 apy_limb_t data;                                                       \
                 if constexpr (std::is_signed<__TYPE__>::value) {                       \
-                    data = static_cast<apy_limb_signed_t>(ndarray_view.data()[i]);     \
+                    data = static_cast<apy_limb_signed_t>(v);                          \
                 } else {                                                               \
-                    data = static_cast<apy_limb_t>(ndarray_view.data()[i]);            \
+                    data = static_cast<apy_limb_t>(v);                                 \
                 }                                                                      \
                 _data[i * _itemsize] = data;                                           \
                 if (_itemsize >= 2) {                                                  \
@@ -2561,7 +2837,7 @@ void APyFixedArray::_set_bits_from_ndarray(const nb::ndarray<nb::c_contig>& ndar
                         apy_limb_signed_t(data) < 0 ? -1 : 0                           \
                     );                                                                 \
                 }                                                                      \
-            }                                                                          \
+            });                                                                        \
             return; /* Conversion completed, exit `_set_bits_from_ndarray()` */        \
         }                                                                              \
     } while (0)
@@ -2590,32 +2866,144 @@ void APyFixedArray::_set_bits_from_ndarray(const nb::ndarray<nb::c_contig>& ndar
     );
 }
 
-void APyFixedArray::_set_values_from_ndarray(const nb::ndarray<nb::c_contig>& ndarray)
+template <typename FLOAT_TYPE>
+void APyFixedArray::_set_values_from_floats(const NDArrayReader<FLOAT_TYPE>& src)
+{
+    constexpr std::size_t BLOCK_SIZE = 256;
+    const int _frac_bits = frac_bits();
+    const unsigned limb_shift_val
+        = (APY_LIMB_SIZE_BITS - bits()) & (APY_LIMB_SIZE_BITS - 1);
+    const bool use_simd
+        = APY_LIMB_SIZE_BITS == 64 && _itemsize == 1 && std::abs(_frac_bits) <= 1000;
+    const auto dst = std::begin(_data);
+
+    // Non-finite values are flagged rather than thrown, as `threadpool_chunked_for`
+    // must not throw
+    std::atomic<bool> all_finite = true;
+    auto convert = [&](std::size_t i, double value) {
+        if (!std::isfinite(value)) {
+            all_finite.store(false, std::memory_order_relaxed);
+        } else if (_itemsize == 1) {
+            dst[i] = fixed_point_from_double_single_limb(
+                value, _frac_bits, limb_shift_val
+            );
+        } else {
+            fixed_point_from_double(
+                value,
+                dst + (i + 0) * _itemsize,
+                dst + (i + 1) * _itemsize,
+                _bits,
+                _int_bits
+            );
+        }
+    };
+
+    const bool use_threadpool = is_elementwise_with_threadpool_justified(_nitems);
+    threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+        FLOAT_TYPE buffer[BLOCK_SIZE];
+        std::size_t fallback_idx[BLOCK_SIZE];
+        for (std::size_t i = begin; i < end; i += BLOCK_SIZE) {
+            const std::size_t n = std::min(BLOCK_SIZE, end - i);
+            const FLOAT_TYPE* block_src = src.read(i, n, buffer);
+            if (!use_simd) {
+                for (std::size_t j = 0; j < n; j++) {
+                    convert(i + j, static_cast<double>(block_src[j]));
+                }
+                continue;
+            }
+
+            auto* block_dst = reinterpret_cast<std::uint64_t*>(&dst[i]);
+            std::size_t n_fallback;
+            if constexpr (std::is_same_v<FLOAT_TYPE, double>) {
+                n_fallback = simd::fixed_point_from_double(
+                    block_dst, block_src, n, _frac_bits, unsigned(_bits), fallback_idx
+                );
+            } else {
+                n_fallback = simd::fixed_point_from_float(
+                    block_dst, block_src, n, _frac_bits, unsigned(_bits), fallback_idx
+                );
+            }
+            for (std::size_t j = 0; j < n_fallback; j++) {
+                const std::size_t k = fallback_idx[j];
+                convert(i + k, static_cast<double>(block_src[k]));
+            }
+        }
+    });
+
+    if (!all_finite) {
+        // Report the first non-finite value
+        FLOAT_TYPE buffer[BLOCK_SIZE];
+        for (std::size_t i = 0; i < _nitems; i += BLOCK_SIZE) {
+            const std::size_t n = std::min(BLOCK_SIZE, _nitems - i);
+            const FLOAT_TYPE* block_src = src.read(i, n, buffer);
+            const FLOAT_TYPE* it = std::find_if(
+                block_src, block_src + n, [](FLOAT_TYPE v) { return !std::isfinite(v); }
+            );
+            if (it != block_src + n) {
+                throw std::domain_error(
+                    fmt::format(
+                        "Cannot convert {} to fixed-point", static_cast<double>(*it)
+                    )
+                );
+            }
+        }
+    }
+}
+
+template <typename INT_TYPE>
+void APyFixedArray::_set_values_from_integers(const NDArrayReader<INT_TYPE>& src)
+{
+    constexpr std::size_t BLOCK_SIZE = 256;
+    const bool use_simd = APY_LIMB_SIZE_BITS == 64 && _itemsize == 1;
+    const auto dst = std::begin(_data);
+
+    const bool use_threadpool = is_elementwise_with_threadpool_justified(_nitems);
+    threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+        INT_TYPE buffer[BLOCK_SIZE];
+        std::uint64_t wide_buffer[BLOCK_SIZE];
+        for (std::size_t i = begin; i < end; i += BLOCK_SIZE) {
+            const std::size_t n = std::min(BLOCK_SIZE, end - i);
+            const INT_TYPE* block_src = src.read(i, n, buffer);
+            if (!use_simd) {
+                for (std::size_t j = 0; j < n; j++) {
+                    fixed_point_from_integer(
+                        block_src[j],
+                        dst + (i + j + 0) * _itemsize,
+                        dst + (i + j + 1) * _itemsize,
+                        _bits,
+                        _int_bits
+                    );
+                }
+                continue;
+            }
+
+            // Narrower integers are sign- or zero-extended to 64 bits
+            const std::uint64_t* wide_src = wide_buffer;
+            if constexpr (sizeof(INT_TYPE) == sizeof(std::uint64_t)) {
+                wide_src = reinterpret_cast<const std::uint64_t*>(block_src);
+            } else {
+                for (std::size_t j = 0; j < n; j++) {
+                    wide_buffer[j] = std::uint64_t(block_src[j]);
+                }
+            }
+            simd::fixed_point_from_integer(
+                reinterpret_cast<std::uint64_t*>(&dst[i]),
+                wide_src,
+                n,
+                frac_bits(),
+                unsigned(_bits),
+                std::is_signed_v<INT_TYPE>
+            );
+        }
+    });
+}
+
+void APyFixedArray::_set_values_from_ndarray(const nb::ndarray<>& ndarray)
 {
 #define CHECK_AND_SET_VALUES_FROM_FLOAT_NPTYPE(__TYPE__)                               \
     do {                                                                               \
         if (ndarray.dtype() == nb::dtype<__TYPE__>()) {                                \
-            auto view = ndarray.view<__TYPE__, nb::ndim<1>>();                         \
-            if (_itemsize == 1) {                                                      \
-                unsigned limb_shift_val                                                \
-                    = (APY_LIMB_SIZE_BITS - bits()) & (APY_LIMB_SIZE_BITS - 1);        \
-                int _frac_bits = frac_bits();                                          \
-                for (std::size_t i = 0; i < ndarray.size(); i++) {                     \
-                    _data[i] = fixed_point_from_double_single_limb(                    \
-                        view.data()[i], _frac_bits, limb_shift_val                     \
-                    );                                                                 \
-                }                                                                      \
-            } else { /* _itemsize > 1 */                                               \
-                for (std::size_t i = 0; i < ndarray.size(); i++) {                     \
-                    fixed_point_from_double(                                           \
-                        static_cast<double>(view.data()[i]),                           \
-                        std::begin(_data) + (i + 0) * _itemsize,                       \
-                        std::begin(_data) + (i + 1) * _itemsize,                       \
-                        _bits,                                                         \
-                        _int_bits                                                      \
-                    );                                                                 \
-                }                                                                      \
-            }                                                                          \
+            _set_values_from_floats(NDArrayReader<__TYPE__>(ndarray));                 \
             return; /* Conversion completed, exit `_set_values_from_ndarray()` */      \
         }                                                                              \
     } while (0)
@@ -2623,16 +3011,7 @@ void APyFixedArray::_set_values_from_ndarray(const nb::ndarray<nb::c_contig>& nd
 #define CHECK_AND_SET_VALUES_FROM_INT_NPTYPE(__TYPE__)                                 \
     do {                                                                               \
         if (ndarray.dtype() == nb::dtype<__TYPE__>()) {                                \
-            auto ndarray_view = ndarray.view<__TYPE__, nb::ndim<1>>();                 \
-            for (std::size_t i = 0; i < ndarray.size(); i++) {                         \
-                fixed_point_from_integer(                                              \
-                    static_cast<__TYPE__>(ndarray_view.data()[i]),                     \
-                    std::begin(_data) + (i + 0) * _itemsize,                           \
-                    std::begin(_data) + (i + 1) * _itemsize,                           \
-                    _bits,                                                             \
-                    _int_bits                                                          \
-                );                                                                     \
-            }                                                                          \
+            _set_values_from_integers(NDArrayReader<__TYPE__>(ndarray));               \
             return; /* Conversion completed, exit `_set_values_from_ndarray()` */      \
         }                                                                              \
     } while (0)
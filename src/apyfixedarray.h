@@ -70,6 +70,12 @@ public:
         return APyFixedArray(shape, _bits, _int_bits);
     }
 
+    APyFixedArray
+    create_array(const std::vector<std::size_t>& shape, vector_type&& data) const
+    {
+        return APyFixedArray(shape, _bits, _int_bits, std::move(data));
+    }
+
     static APyFixedArray
     create_array_static(const std::vector<std::size_t>& shape, const APyFixed& fix)
     {
@@ -91,12 +97,25 @@ public:
     //! Return the bit specification
     APY_INLINE APyFixedSpec spec() const noexcept { return { _bits, _int_bits }; }
 
+    //! Shape of the limbs of each item, when exported through DLPack
+    std::vector<std::size_t> dlpack_item_shape() const
+    {
+        return _itemsize > 1 ? std::vector<std::size_t> { _itemsize }
+                             : std::vector<std::size_t> {};
+    }
+
     //! Test if using threadpool is justified based on number of multiply-accumulate
     bool is_mac_with_threadpool_justified(std::size_t n_mac) const noexcept
     {
         return n_mac >= thread_pool_settings.apyfixedarray.n_mac_threshold;
     }
 
+    //! Test if using threadpool is justified based on number of elementwise operations
+    bool is_elementwise_with_threadpool_justified(std::size_t n_elem) const noexcept
+    {
+        return n_elem >= thread_pool_settings.apyfixedarray.n_elem_threshold;
+    }
+
     /* ****************************************************************************** *
      * *                          Python constructors                               * *
      * ****************************************************************************** */
@@ -123,6 +142,12 @@ public:
         const std::vector<std::size_t>& shape, int bits, int int_bits
     );
 
+    //! Constructor: specify only shape and word-length. The data is left unspecified
+    //! and every limb must be written before it is read.
+    explicit APyFixedArray(
+        cow_no_init_t, const std::vector<std::size_t>& shape, int bits, int int_bits
+    );
+
     //! Constructor: specify shape and word-length and steal the data from vector
     explicit APyFixedArray(
         const std::vector<std::size_t>& shape, int bits, int int_bits, vector_type&& v
@@ -227,6 +252,16 @@ public:
     //! Perform a linear convolution with `other` using `mode`
     APyFixedArray convolve(const APyFixedArray& other, ConvolutionMode mode) const;
 
+    //! Perform a two-dimensional convolution with `other` over the last two axes
+    APyFixedArray convolve2d(
+        const APyFixedArray& other, ConvolutionMode mode, const PyShapeParam_t& stride
+    ) const;
+
+    //! Perform a correlation with `other` over the last `other.ndim()` axes
+    APyFixedArray correlate(
+        const APyFixedArray& other, ConvolutionMode mode, const PyShapeParam_t& stride
+    ) const;
+
     //! Sum over one or more axes.
     std::variant<APyFixedArray, APyFixed>
     sum(const std::optional<PyShapeParam_t>& axis = std::nullopt) const;
@@ -274,6 +309,11 @@ public:
     template <typename NB_ARRAY_TYPE, typename INT_TYPE>
     nb::ndarray<NB_ARRAY_TYPE, INT_TYPE> to_bits_ndarray() const;
 
+    //! Create an (N+1)-dimensional array containing the bit-patterns of elements wider
+    //! than 64 bits, as 64-bit words, least significant word first, along the innermost
+    //! dimension
+    nb::ndarray<nb::numpy, std::uint64_t> to_bits_ndarray_words() const;
+
     //! Create a nested Python list containing bit-patterns as Python integers.
     nb::list to_bits_python_recursive_descent(
         std::size_t dim,
@@ -285,7 +325,7 @@ public:
     nb::list to_signed_bits() const;
 
     //! Convert to a NumPy array
-    nanobind::ndarray<nanobind::numpy, double> to_numpy(
+    nanobind::ndarray<nanobind::numpy> to_numpy(
         std::optional<nb::object> dtype = std::nullopt,
         std::optional<bool> copy = std::nullopt
     ) const;
@@ -315,6 +355,21 @@ public:
         std::optional<int> bits = std::nullopt
     ) const;
 
+    /*!
+     * Fused multiply-add, evaluating `*this * b + c` into a full-precision accumulator
+     * and casting the accumulator to the new format, quantizing and overflowing only
+     * once.
+     */
+    APyFixedArray fma(
+        const APyFixedArray& b,
+        const APyFixedArray& c,
+        std::optional<int> int_bits = std::nullopt,
+        std::optional<int> frac_bits = std::nullopt,
+        std::optional<QuantizationMode> quantization = std::nullopt,
+        std::optional<OverflowMode> overflow = std::nullopt,
+        std::optional<int> bits = std::nullopt
+    ) const;
+
     //! Python pickling
     std::tuple<int, int, std::vector<std::size_t>, std::vector<std::uint64_t>>
     python_pickle() const;
@@ -326,6 +381,30 @@ public:
             tuple<int, int, std::vector<std::size_t>, std::vector<std::uint64_t>>& state
     );
 
+    //! Write the bit patterns of the array as text to the binary Python file object
+    //! `file`, `columns` values per line (see `apytypes_text_io.h`)
+    void python_write_text(
+        const nb::object& file,
+        std::size_t columns,
+        std::string_view radix,
+        const std::optional<std::string>& delimiter,
+        const std::string& line_end,
+        bool is_signed
+    ) const;
+
+    //! Read an `APyFixedArray` from bit patterns in the text of the binary Python file
+    //! object `file`. Delimited text gives a two-dimensional array with one row per
+    //! line, or a one-dimensional array for a single line. Whitespace-separated text
+    //! gives a one-dimensional array.
+    static APyFixedArray python_read_text(
+        const nb::object& file,
+        std::string_view radix,
+        const std::optional<std::string>& delimiter,
+        std::optional<int> int_bits = std::nullopt,
+        std::optional<int> frac_bits = std::nullopt,
+        std::optional<int> bits = std::nullopt
+    );
+
     /* ****************************************************************************** *
      * *                     Static conversion from other types                     * *
      * ****************************************************************************** */
@@ -341,7 +420,16 @@ public:
 
     //! Create an `APyFixedArray` tensor object initialized with values from an ndarray
     static APyFixedArray from_array(
-        const nb::ndarray<nb::c_contig>& double_seq,
+        const nb::ndarray<>& double_seq,
+        std::optional<int> int_bits = std::nullopt,
+        std::optional<int> frac_bits = std::nullopt,
+        std::optional<int> bits = std::nullopt
+    );
+
+    //! Create an `APyFixedArray` from the limbs of a DLPack-compatible array, laid out
+    //! as exported by `__dlpack__`
+    static APyFixedArray from_dlpack(
+        const nb::ndarray<>& ndarray,
         std::optional<int> int_bits = std::nullopt,
         std::optional<int> frac_bits = std::nullopt,
         std::optional<int> bits = std::nullopt
@@ -438,17 +526,27 @@ private:
 
     /*!
      * Set the underlying bit values of `*this` from a NDArray object of integers. This
-     * member function assumes that the shape of `*this` and `ndarray` are equal.
+     * member function assumes that the shape of `*this` and `ndarray` are equal. The
+     * ndarray may have arbitrary strides.
      */
-    void _set_bits_from_ndarray(const nb::ndarray<nb::c_contig>& ndarray);
+    void _set_bits_from_ndarray(const nb::ndarray<>& ndarray);
 
     /*!
      * Set the values of `*this` from a NDArray object of floats/integers. This member
-     * function assumes that the shape of `*this` and `ndarray` are equal. The elements
-     * in `ndarray` are explicitly converted to `double` before being copied into
-     * `*this`.
+     * function assumes that the shape of `*this` and `ndarray` are equal. The ndarray
+     * may have arbitrary strides, and is read in C order without an intermediate copy.
      */
-    void _set_values_from_ndarray(const nb::ndarray<nb::c_contig>& ndarray);
+    void _set_values_from_ndarray(const nb::ndarray<>& ndarray);
+
+    //! Set the values of `*this` from the floating-point values read by `src`.
+    //! Single-limb arrays are converted using SIMD, and large arrays in parallel.
+    template <typename FLOAT_TYPE>
+    void _set_values_from_floats(const NDArrayReader<FLOAT_TYPE>& src);
+
+    //! Set the values of `*this` from the integers read by `src`. Single-limb arrays
+    //! are converted using SIMD, and large arrays in parallel.
+    template <typename INT_TYPE>
+    void _set_values_from_integers(const NDArrayReader<INT_TYPE>& src);
 };
 
 #endif // _APYFIXEDARRAY_H
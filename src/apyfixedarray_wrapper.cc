@@ -10,9 +10,13 @@
 #include <nanobind/operators.h>
 #include <nanobind/stl/complex.h>
 #include <nanobind/stl/optional.h>
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/string_view.h>
+#include <nanobind/stl/tuple.h>
 #include <nanobind/stl/variant.h>
 
 #include <functional>
+#include <tuple>
 #include <type_traits>
 
 namespace nb = nanobind;
@@ -66,9 +70,7 @@ static auto L_OP(const APyFixedArray& lhs, const R_TYPE& rhs)
         return OP()(lhs, APyFixed::from_double(rhs, lhs.int_bits(), lhs.frac_bits()));
     } else if constexpr (std::is_same_v<remove_cvref_t<R_TYPE>, APyFixed>) {
         return OP()(lhs, rhs);
-    } else if constexpr (
-        std::is_same_v<remove_cvref_t<R_TYPE>, nb::ndarray<nb::c_contig>>
-    ) {
+    } else if constexpr (std::is_same_v<remove_cvref_t<R_TYPE>, nb::ndarray<>>) {
         return OP()(
             lhs, APyFixedArray::from_array(rhs, lhs.int_bits(), lhs.frac_bits())
         );
@@ -146,6 +148,44 @@ void bind_fixed_array(nb::module_& m)
          */
         .def("__getstate__", &APyFixedArray::python_pickle)
         .def("__setstate__", &APyFixedArray::python_unpickle)
+        .def("__reduce_ex__", &APyFixedArray::python_reduce_ex, nb::arg("protocol"))
+
+        /*
+         * Native binary file format payload (see `apytypes.save` and `apytypes.load`)
+         */
+        .def("_write_raw", &APyFixedArray::python_write_raw, nb::arg("file"))
+        .def(
+            "_from_raw",
+            &APyFixedArray::python_from_raw,
+            nb::arg("shape"),
+            nb::arg("payload")
+        )
+        .def("_raw_payload", &APyFixedArray::python_raw_payload)
+
+        /*
+         * Streaming text file support (see `apytypes.export_csv` and
+         * `apytypes.import_csv`)
+         */
+        .def(
+            "_write_text",
+            &APyFixedArray::python_write_text,
+            nb::arg("file"),
+            nb::arg("columns"),
+            nb::arg("radix"),
+            nb::arg("delimiter").none(),
+            nb::arg("line_end"),
+            nb::arg("is_signed")
+        )
+        .def_static(
+            "_read_text",
+            &APyFixedArray::python_read_text,
+            nb::arg("file"),
+            nb::arg("radix"),
+            nb::arg("delimiter").none(),
+            nb::arg("int_bits") = nb::none(),
+            nb::arg("frac_bits") = nb::none(),
+            nb::arg("bits") = nb::none()
+        )
 
         /*
          * Arithmetic operations
@@ -300,10 +340,10 @@ void bind_fixed_array(nb::module_& m)
          * The right-hand versions are not used since Numpy will convert the
          * APyFixedArray to a Numpy array before they are invoked.
          */
-        .def("__add__", L_OP<STD_ADD<>, nb::ndarray<nb::c_contig>>, NB_OP())
-        .def("__sub__", L_OP<STD_SUB<>, nb::ndarray<nb::c_contig>>, NB_OP())
-        .def("__mul__", L_OP<STD_MUL<>, nb::ndarray<nb::c_contig>>, NB_OP())
-        .def("__truediv__", L_OP<STD_DIV<>, nb::ndarray<nb::c_contig>>, NB_OP())
+        .def("__add__", L_OP<STD_ADD<>, nb::ndarray<>>, NB_OP())
+        .def("__sub__", L_OP<STD_SUB<>, nb::ndarray<>>, NB_OP())
+        .def("__mul__", L_OP<STD_MUL<>, nb::ndarray<>>, NB_OP())
+        .def("__truediv__", L_OP<STD_DIV<>, nb::ndarray<>>, NB_OP())
 
         /*
          * Logic operations
@@ -487,10 +527,19 @@ void bind_fixed_array(nb::module_& m)
             The returned array has the same `shape` and values as `self`. This
             method rounds away from infinity on ties.
 
+            If `dtype` is :class:`numpy.float32` or :class:`numpy.float16`, the values
+            are instead rounded once, to nearest with ties to even, directly to that
+            data type. Other values of `dtype` give a :class:`numpy.float64` array.
+            Large arrays are converted in parallel.
+
+            .. versionchanged:: 0.6
+                Single- and half-precision arrays are returned for the corresponding
+                `dtype`.
+
             Parameters
             ----------
-            dtype : :py:class:`numpy.dtype`
-                The desired data type of the output array. This parameter is currently ignored.
+            dtype : :py:class:`numpy.dtype`, optional
+                The desired floating-point data type of the output array.
             copy : :class:`bool`
                 Whether to copy the data or not. Must be :code:`True` or :code:`None`.
 
@@ -507,17 +556,21 @@ void bind_fixed_array(nb::module_& m)
             R"pbdoc(
             Return the underlying bit representations.
 
+            If *numpy* is :code:`True` and the total number of bits is more than 64, each
+            bit representation is split into 64-bit words, least significant word first,
+            along an additional, innermost, dimension of a :class:`numpy.ndarray` of
+            unsigned 64-bit integers.
+
+            .. versionchanged:: 0.6
+                Bit representations of more than 64 bits can be returned in a
+                :class:`numpy.ndarray`.
+
             Parameters
             ----------
             numpy : :class:`bool`, default: :code:`False`
                 If :code:`True`, return the bit representations in a :class:`numpy.ndarray`.
                 If :code:`False`, return the bit representations in a :class:`list`.
 
-            Raises
-            ------
-            :class:`ValueError`
-                If *numpy* is :code:`True` and the total number of bits is more than 64.
-
             Examples
             --------
             >>> from apytypes import fx
@@ -528,6 +581,11 @@ void bind_fixed_array(nb::module_& m)
             [4, 6, 8, 10]
             >>> a.to_bits(numpy=True)
             array([ 4,  6,  8, 10], dtype=uint8)
+            >>> from apytypes import APyFixedArray
+            >>> b = APyFixedArray([2**80 - 1, 2**64 + 3], int_bits=80, frac_bits=0)
+            >>> b.to_bits(numpy=True)
+            array([[18446744073709551615,                65535],
+                   [                   3,                    1]], dtype=uint64)
 
             Returns
             -------
@@ -777,6 +835,61 @@ void bind_fixed_array(nb::module_& m)
             :class:`APyFixedArray`
             )pbdoc"
         )
+        .def(
+            "fma",
+            &APyFixedArray::fma,
+            nb::arg("b"),
+            nb::arg("c"),
+            nb::arg("int_bits") = nb::none(),
+            nb::arg("frac_bits") = nb::none(),
+            nb::arg("quantization") = nb::none(),
+            nb::arg("overflow") = nb::none(),
+            nb::arg("bits") = nb::none(),
+            R"pbdoc(
+            Fused multiply-add, ``self * b + c``, with a single cast of the result.
+
+            The products and sums are evaluated in full precision, using the same word
+            lengths as ``self * b + c``, and are then quantized and overflowed once into
+            the new format. The result is identical to
+            ``(self * b + c).cast(int_bits, frac_bits, quantization, overflow, bits)``,
+            but no intermediate arrays are created.
+
+            Exactly two of three bit-specifiers (`bits`, `int_bits`, `frac_bits`) must
+            be set.
+
+            .. versionadded:: 0.6
+
+            Parameters
+            ----------
+            b : :class:`APyFixedArray`
+                The array to multiply with.
+            c : :class:`APyFixedArray`
+                The array to add to the product.
+            int_bits : :class:`int`, optional
+                Number of integer bits in the result.
+            frac_bits : :class:`int`, optional
+                Number of fractional bits in the result.
+            quantization : :class:`QuantizationMode`, optional
+                Quantization mode to use in the cast.
+            overflow : :class:`OverflowMode`, optional
+                Overflowing mode to use in the cast.
+            bits : :class:`int`, optional
+                Total number of bits in the result.
+
+            Returns
+            -------
+            :class:`APyFixedArray`
+
+            Examples
+            --------
+            >>> import apytypes as apy
+            >>> a = apy.fx([1.0, 2.0, 3.0], int_bits=4, frac_bits=2)
+            >>> b = apy.fx([0.5, 0.25, -1.0], int_bits=4, frac_bits=2)
+            >>> c = apy.fx([2.0, 0.75, 4.5], int_bits=4, frac_bits=2)
+            >>> a.fma(b, c, int_bits=4, frac_bits=1)
+            APyFixedArray([5, 2, 3], int_bits=4, frac_bits=1)
+            )pbdoc"
+        )
         .def(
             "broadcast_to",
             &APyFixedArray::broadcast_to_python,
@@ -844,6 +957,129 @@ void bind_fixed_array(nb::module_& m)
             nb::arg("other"),
             nb::arg("mode") = "full"
         )
+        .def(
+            "convolve2d",
+            &APyFixedArray::convolve2d,
+            nb::arg("other"),
+            nb::arg("mode") = ConvolutionMode::FULL,
+            nb::arg("stride") = 1,
+            R"pbdoc(
+            Return the two-dimensional discrete linear convolution with another array.
+
+            The convolution is taken over the last two axes. The array `other` must be
+            two-dimensional, and any leading axes of `self` are batch axes: each
+            two-dimensional slice of `self` is convolved with `other`. Along each of the
+            two axes, `mode` selects the outputs as for :func:`convolve`. With `stride`,
+            only every `stride`-th output is computed, as in a strided convolutional
+            layer.
+
+            The result format is that of :func:`convolve`, with the length of the
+            shorter array replaced by the largest number of products of an output. An
+            active :class:`APyFixedAccumulatorContext` sets the result format instead.
+
+            .. versionadded:: 0.6
+
+            Parameters
+            ----------
+            other : :class:`APyFixedArray`
+                The two-dimensional array to convolve with.
+            mode : :class:`ConvolutionMode` or {'full', 'same', 'valid'}, default: :class:`~ConvolutionMode.FULL`
+                The outputs to keep along each axis, see :func:`convolve`.
+            stride : :class:`int` or :class:`tuple` of :class:`int`, default: 1
+                Step between the kept outputs, either for both axes or one per axis.
+
+            Returns
+            -------
+            convolved : :class:`APyFixedArray`
+                The convolved array.
+
+            Examples
+            --------
+            >>> import apytypes as apy
+            >>> a = apy.fx([[1, 2], [3, 4]], int_bits=4, frac_bits=0)
+            >>> k = apy.fx([[1, 1], [1, 1]], int_bits=2, frac_bits=0)
+            >>> a.convolve2d(k)
+            APyFixedArray([[ 1,  3,  2],
+                           [ 4, 10,  6],
+                           [ 3,  7,  4]], int_bits=8, frac_bits=0)
+            )pbdoc"
+        )
+        .def(
+            "convolve2d",
+            [](const APyFixedArray& self,
+               const APyFixedArray& other,
+               const std::string& mode,
+               const PyShapeParam_t& stride) {
+                return self.convolve2d(other, get_conv_mode(mode), stride);
+            },
+            nb::arg("other"),
+            nb::arg("mode") = "full",
+            nb::arg("stride") = 1
+        )
+        .def(
+            "correlate",
+            &APyFixedArray::correlate,
+            nb::arg("other"),
+            nb::arg("mode") = ConvolutionMode::FULL,
+            nb::arg("stride") = 1,
+            R"pbdoc(
+            Return the discrete linear cross-correlation with another array.
+
+            The correlation is taken over the last :code:`other.ndim` axes, and any
+            leading axes of `self` are batch axes. For one-dimensional arrays, the
+            result is that of :func:`numpy.correlate`, but `mode` defaults to
+            :class:`~ConvolutionMode.FULL`. The correlation is the convolution with
+            `other` reversed along all axes.
+
+            With a `stride`, only every `stride`-th output is computed, as in a strided
+            convolutional layer. A correlation with the kernel of a convolutional layer
+            in :class:`~ConvolutionMode.VALID` mode sums over its input channels.
+
+            The result format is that of :func:`convolve`, with the length of the
+            shorter array replaced by the largest number of products of an output. An
+            active :class:`APyFixedAccumulatorContext` sets the result format instead.
+
+            .. versionadded:: 0.6
+
+            Parameters
+            ----------
+            other : :class:`APyFixedArray`
+                The array to correlate with.
+            mode : :class:`ConvolutionMode` or {'full', 'same', 'valid'}, default: :class:`~ConvolutionMode.FULL`
+                The outputs to keep along each axis, see :func:`convolve`. With
+                :class:`~ConvolutionMode.SAME`, the outputs are centered as for
+                :func:`numpy.correlate`.
+            stride : :class:`int` or :class:`tuple` of :class:`int`, default: 1
+                Step between the kept outputs, either for all axes or one per axis.
+
+            Returns
+            -------
+            correlated : :class:`APyFixedArray`
+                The correlated array.
+
+            Examples
+            --------
+            >>> import apytypes as apy
+            >>> a = apy.fx([1, 2, 3], int_bits=3, frac_bits=0)
+            >>> v = apy.fx([0, 1, 2], int_bits=3, frac_bits=0)
+            >>> a.correlate(v)
+            APyFixedArray([2, 5, 8, 3, 0], int_bits=8, frac_bits=0)
+            >>> a.correlate(v, mode="same")
+            APyFixedArray([5, 8, 3], int_bits=8, frac_bits=0)
+            )pbdoc"
+        )
+        .def(
+            "correlate",
+            [](const APyFixedArray& self,
+               const APyFixedArray& other,
+               const std::string& mode,
+               const PyShapeParam_t& stride) {
+                return self.correlate(other, get_conv_mode(mode), stride);
+            },
+            nb::arg("other"),
+            nb::arg("mode") = "full",
+            nb::arg("stride") = 1
+        )
 
         .def(
             "squeeze",
@@ -1428,6 +1664,55 @@ void bind_fixed_array(nb::module_& m)
 
             )pbdoc"
         )
+        .def_static(
+            "from_dlpack",
+            &APyFixedArray::from_dlpack,
+            nb::arg("x"),
+            nb::arg("int_bits") = nb::none(),
+            nb::arg("frac_bits") = nb::none(),
+            nb::arg("bits") = nb::none(),
+            R"pbdoc(
+            Create an :class:`APyFixedArray` object from limbs in a DLPack-compatible
+            array.
+
+            The limbs are laid out as exported by :func:`__dlpack__`. For single-limb
+            formats (at most 64 bits on 64-bit platforms), `x` holds the bit pattern of
+            each element, and may be of any integer type. For multi-limb formats, an
+            additional innermost dimension of `x` holds the limbs of each element,
+            least significant limb first. Bits outside of the format are discarded by
+            wrapping. Exactly two of the three bit-specifiers (`bits`, `int_bits`,
+            `frac_bits`) must be set.
+
+            Only arrays in CPU memory can be imported, other devices raise
+            :class:`BufferError`.
+
+            .. versionadded:: 0.6
+
+            Parameters
+            ----------
+            x : object
+                DLPack-compatible array, e.g., a NumPy array or a PyTorch tensor.
+            int_bits : :class:`int`, optional
+                Number of integer bits in the created fixed-point tensor.
+            frac_bits : :class:`int`, optional
+                Number of fractional bits in the created fixed-point tensor.
+            bits : :class:`int`, optional
+                Total number of bits in the created fixed-point tensor.
+
+            Examples
+            --------
+            >>> import apytypes as apy
+            >>> import numpy as np
+            >>> a = apy.fx([1.0, -0.5, 2.25], int_bits=4, frac_bits=2)
+            >>> b = np.from_dlpack(a)
+            >>> apy.APyFixedArray.from_dlpack(b, int_bits=4, frac_bits=2)
+            APyFixedArray([ 4, 62,  9], int_bits=4, frac_bits=2)
+
+            Returns
+            -------
+            :class:`APyFixedArray`
+            )pbdoc"
+        )
         .def_static(
             "zeros",
             &APyFixedArray::zeros,
@@ -1719,6 +2004,53 @@ void bind_fixed_array(nb::module_& m)
             nb::arg("dtype") = nb::none(),
             nb::arg("copy") = nb::none()
         )
+        .def(
+            "__dlpack__",
+            &APyFixedArray::python_dlpack<apy_limb_signed_t>,
+            nb::kw_only(),
+            nb::arg("stream") = nb::none(),
+            nb::arg("max_version") = nb::none(),
+            nb::arg("dl_device") = nb::none(),
+            nb::arg("copy") = nb::none(),
+            R"pbdoc(
+            Export the underlying limbs through the DLPack protocol.
+
+            The limbs are exported without a copy, unless `copy` is :code:`True`, as
+            signed integers of the limb size (64 bits on 64-bit platforms). For
+            single-limb arrays (at most 64 bits), each element is the two's complement
+            bit pattern of the value, sign-extended to the full limb. For multi-limb
+            arrays, an additional innermost dimension holds the limbs of each element,
+            least significant limb first.
+
+            The unsigned bit patterns of :func:`to_bits` are the exported values modulo
+            ``2**bits``. They are not exported without a copy, as the limbs are stored
+            sign-extended, but ``to_bits(numpy=True)`` returns them in a NumPy array,
+            which in turn supports DLPack.
+
+            .. versionadded:: 0.6
+
+            Examples
+            --------
+            >>> import apytypes as apy
+            >>> import numpy as np
+            >>> a = apy.fx([1.0, -0.5, 2.25], int_bits=4, frac_bits=2)
+            >>> np.from_dlpack(a)
+            array([ 4, -2,  9])
+
+            See Also
+            --------
+            from_dlpack
+            )pbdoc"
+        )
+        .def(
+            "__dlpack_device__",
+            [](const APyFixedArray&) { return std::make_tuple(1, 0); },
+            R"pbdoc(
+            Return the DLPack device of the array, which is always the CPU.
+
+            .. versionadded:: 0.6
+            )pbdoc"
+        )
 
         ;
 
@@ -12,16 +12,20 @@
 #include "apytypes_intrinsics.h"
 #include "apytypes_mp.h"
 #include "apytypes_scratch_vector.h"
+#include "apytypes_simd.h"
 #include "apytypes_util.h"
 #include "ieee754.h"
 #include "python_util.h"
 
 // Standard header includes
 #include <algorithm>
+#include <array>       // std::array
 #include <cassert>     // assert
+#include <cstring>     // std::memcpy
 #include <functional>  // std::invoke, std::cref, std::ref
 #include <optional>    // std::optional
 #include <string_view> // std::string_view
+#include <vector>      // std::vector
 
 /*!
  * Sizes of APyFloat datatypes
@@ -495,6 +499,165 @@ template <typename QNTZ_FUNC_SIGNATURE>
     return res;
 }
 
+/*!
+ * Quantize the exact value of `x[0] * y[0] + ... + x[N-1] * y[N-1] + z` to `res_spec`,
+ * rounding only once. The products and the sum are evaluated exactly in fixed-point
+ * and rounded to odd with two extra mantissa bits, into a format with the bias of
+ * `res_spec` and one more exponent bit. Rounding that to `res_spec` gives the same
+ * result as rounding the exact sum. Requires `res_spec.man_bits + 2 <= _MAN_LIMIT_BITS`
+ * and `res_spec.exp_bits + 1 <= _EXP_LIMIT_BITS`.
+ */
+template <std::size_t N, typename QNTZ_FUNC_SIGNATURE>
+[[maybe_unused]] static APyFloatData floating_point_sum_of_products(
+    const std::array<APyFloatData, N>& x,
+    const APyFloatSpec& x_spec,
+    const std::array<APyFloatData, N>& y,
+    const APyFloatSpec& y_spec,
+    const APyFloatData& z,
+    const APyFloatSpec& z_spec,
+    const APyFloatSpec& res_spec,
+    QuantizationMode qntz,
+    QNTZ_FUNC_SIGNATURE qntz_func
+)
+{
+    const exp_t RES_MAX_EXP = (1ULL << res_spec.exp_bits) - 1;
+    const APyFloatSpec acc_spec = { std::uint8_t(res_spec.exp_bits + 1),
+                                    std::uint8_t(res_spec.man_bits + 2),
+                                    res_spec.bias };
+
+    // Special values. Infinities of opposite signs sum to NaN.
+    bool is_nan_res = is_nan(z, z_spec);
+    bool is_inf_res = is_inf(z, z_spec);
+    bool inf_sign = z.sign;
+    for (std::size_t i = 0; i < N; i++) {
+        const bool prod_sign = x[i].sign != y[i].sign;
+        if (is_nan(x[i], x_spec) || is_nan(y[i], y_spec)) {
+            is_nan_res = true;
+        } else if (is_inf(x[i], x_spec) || is_inf(y[i], y_spec)) {
+            is_nan_res |= is_zero(x[i]) || is_zero(y[i]);
+            is_nan_res |= is_inf_res && inf_sign != prod_sign;
+            is_inf_res = true;
+            inf_sign = prod_sign;
+        }
+    }
+    if (is_nan_res) {
+        return { false, RES_MAX_EXP, 1 };
+    }
+    if (is_inf_res) {
+        return { inf_sign, RES_MAX_EXP, 0 };
+    }
+
+    // Exact fixed-point value of a finite floating-point value
+    const auto to_fixed = [](const APyFloatData& src, const APyFloatSpec& spec) {
+        const bool normal = src.exp != 0;
+        const man_t man = normal ? src.man | (man_t(1) << spec.man_bits) : src.man;
+        APyFixed res(spec.man_bits + 2, 2, { UINT64_TO_LIMB(man) });
+        res <<= int(std::int64_t(normal ? src.exp : 1) - std::int64_t(spec.bias));
+        return src.sign ? -res : res;
+    };
+
+    // The non-zero terms of the sum. Sums of only zeros keep their sign if all terms
+    // agree on it.
+    std::vector<APyFixed> terms;
+    terms.reserve(N + 1);
+    bool all_neg = z.sign, all_pos = !z.sign;
+    for (std::size_t i = 0; i < N; i++) {
+        const bool prod_sign = x[i].sign != y[i].sign;
+        all_neg &= prod_sign;
+        all_pos &= !prod_sign;
+        if (!is_zero(x[i]) && !is_zero(y[i])) {
+            terms.push_back(to_fixed(x[i], x_spec) * to_fixed(y[i], y_spec));
+        }
+    }
+    if (terms.empty()) {
+        if (is_zero(z)) {
+            const bool trn = qntz == QuantizationMode::TRN;
+            return { all_neg || (!all_pos && trn), 0, 0 };
+        }
+        return floating_point_cast(z, z_spec, res_spec, qntz, qntz_func);
+    }
+    if (!is_zero(z)) {
+        terms.push_back(to_fixed(z, z_spec));
+    }
+
+    /*
+     * Sum the terms exactly, from the largest, until the remaining terms are far below
+     * the least significant bit of the sum. The remaining terms then only contribute
+     * to the sticky bit, and are replaced by a small value with the sign of their sum.
+     * This keeps the width of the exact sum bounded.
+     */
+    std::sort(std::begin(terms), std::end(terms), [](const auto& a, const auto& b) {
+        return a.int_bits() > b.int_bits();
+    });
+    const int guard = res_spec.man_bits + 8;
+    const auto sum_while_near = [&](std::size_t& i) {
+        APyFixed res = terms[i++];
+        while (i < terms.size()
+               && (res.is_zero()
+                   || std::int64_t(terms[i].int_bits())
+                       >= -std::int64_t(res.frac_bits()) - guard)) {
+            res = res + terms[i++];
+        }
+        return res;
+    };
+    std::size_t i = 0;
+    APyFixed sum = sum_while_near(i);
+    if (i < terms.size()) {
+        // The sign of the remaining terms is that of their largest terms
+        const APyFixed rest = sum_while_near(i);
+        if (!rest.is_zero()) {
+            APyFixed sticky(2, 2, { 1 });
+            sticky <<= -sum.frac_bits() - guard;
+            sum = sum + (rest.is_negative() ? -sticky : sticky);
+        }
+    }
+
+    const auto& data = sum.read_data();
+    ScratchVector<apy_limb_t, 8> sum_abs(data.size());
+    const bool sign
+        = limb_vector_abs(std::begin(data), std::end(data), std::begin(sum_abs));
+    const std::int64_t sum_bits = std::int64_t(sum_abs.size() * APY_LIMB_SIZE_BITS);
+    const std::int64_t lz
+        = limb_vector_leading_zeros(std::begin(sum_abs), std::end(sum_abs));
+
+    // Exactly zero sums of non-zero terms are negative when rounding towards negative
+    // infinity
+    if (lz == sum_bits) {
+        return { qntz == QuantizationMode::TRN, 0, 0 };
+    }
+
+    // Round the exact sum to odd in `acc_spec`. Sums above the result range all
+    // quantize like `2**(max_exp + 1)`.
+    const std::int64_t bias = res_spec.bias;
+    const std::int64_t lsb_exp = -std::int64_t(sum.frac_bits());
+    const std::int64_t msb_exp = lsb_exp + sum_bits - lz - 1;
+    APyFloatData acc;
+    if (msb_exp > std::int64_t(RES_MAX_EXP) - 1 - bias) {
+        acc = { sign, RES_MAX_EXP, 0 };
+    } else {
+        const std::int64_t acc_lsb_exp
+            = std::max(msb_exp, 1 - bias) - std::int64_t(acc_spec.man_bits);
+        man_t man;
+        if (acc_lsb_exp >= lsb_exp) {
+            const unsigned shift = unsigned(std::min(acc_lsb_exp - lsb_exp, sum_bits));
+            const auto begin = std::begin(sum_abs), end = std::end(sum_abs);
+            const bool jam = shift > 0 && limb_vector_or_reduce(begin, end, shift);
+            limb_vector_lsr(begin, end, shift);
+            man = limb_vector_to_uint64(sum_abs, 0) | man_t(jam);
+        } else {
+            man = limb_vector_to_uint64(sum_abs, 0) << (lsb_exp - acc_lsb_exp);
+        }
+        const man_t ACC_LEADING_ONE = man_t(1) << acc_spec.man_bits;
+        if (man & ACC_LEADING_ONE) {
+            const exp_t exp = exp_t(acc_lsb_exp + acc_spec.man_bits + bias);
+            acc = { sign, exp, man & (ACC_LEADING_ONE - 1) };
+        } else {
+            acc = { sign, 0, man };
+        }
+    }
+    return floating_point_cast(acc, acc_spec, res_spec, qntz, qntz_func);
+}
+
 //! Cast a floating-point value from one format to another using many pre-computed
 //! constants making it suitable for arrays. Specialized for the case where more
 //! mantissa bits are used in the result.
@@ -1017,17 +1180,152 @@ floating_point_to_double(const APyFloatData& data_in, const APyFloatSpec& spec)
     return res;
 }
 
-template <typename RANDOM_ACCESS_IT> struct FloatingPointToDouble {
-    FloatingPointToDouble(const APyFloatSpec& spec)
-        : spec { spec }
-    {
+/* ********************************************************************************** *
+ * *                 Conversion to NumPy floating-point data types                  * *
+ * ********************************************************************************** */
+
+//! IEEE-754 floating-point format of `DST_TYPE` in `fixed_point_to_floats` and
+//! `floating_point_to_floats`. Half-precision values are stored as their bit patterns.
+template <typename DST_TYPE> constexpr APyFloatSpec ieee754_spec_of()
+{
+    static_assert(
+        std::is_same_v<DST_TYPE, double> || std::is_same_v<DST_TYPE, float>
+        || std::is_same_v<DST_TYPE, std::uint16_t>
+    );
+    if constexpr (std::is_same_v<DST_TYPE, double>) {
+        return { 11, 52, 1023 };
+    } else if constexpr (std::is_same_v<DST_TYPE, float>) {
+        return { 8, 23, 127 };
+    } else {
+        return { 5, 10, 15 };
     }
-    APyFloatSpec spec;
-    double operator()(RANDOM_ACCESS_IT begin, RANDOM_ACCESS_IT) const
-    {
-        return floating_point_to_double(*begin, spec);
+}
+
+//! Store floating-point data of the IEEE-754 format of `DST_TYPE` in `dst`
+template <typename DST_TYPE>
+static APY_INLINE void store_ieee754(const APyFloatData& data, DST_TYPE* dst)
+{
+    constexpr APyFloatSpec spec = ieee754_spec_of<DST_TYPE>();
+    const std::uint64_t bits = to_bits_uint64(data, spec.exp_bits, spec.man_bits);
+    if constexpr (std::is_same_v<DST_TYPE, float>) {
+        const std::uint32_t bits32 = std::uint32_t(bits);
+        std::memcpy(dst, &bits32, sizeof(float));
+    } else {
+        *dst = DST_TYPE(bits);
+    }
+}
+
+/*!
+ * Convert the `n` fixed-point values of format `spec` at `src` to `DST_TYPE`: `double`,
+ * `float`, or half-precision bit patterns in `std::uint16_t`. Values are rounded to
+ * nearest, with ties away from zero for `double`, the same as `FixedPointToDouble`,
+ * and with ties to even otherwise. Single-limb values of at most 53 bits are converted
+ * exactly to `double` using SIMD.
+ */
+template <typename DST_TYPE>
+void fixed_point_to_floats(
+    const apy_limb_t* src, std::size_t n, const APyFixedSpec& spec, DST_TYPE* dst
+)
+{
+    constexpr std::size_t BLOCK_SIZE = 256;
+    constexpr APyFloatSpec dst_spec = ieee754_spec_of<DST_TYPE>();
+    const std::size_t n_limbs = bits_to_limbs(spec.bits);
+    const int frac_bits = spec.bits - spec.int_bits;
+
+    // The SIMD conversion is exact when the result is a normal double-precision number,
+    // and narrowing an exact double-precision value to single precision is a single
+    // rounding
+    constexpr bool is_hardware_float = !std::is_same_v<DST_TYPE, std::uint16_t>;
+    if constexpr (APY_LIMB_SIZE_BITS == 64 && is_hardware_float) {
+        if (spec.bits <= 53 && spec.int_bits <= 1024 && frac_bits <= 1022) {
+            const auto* words = reinterpret_cast<const std::uint64_t*>(src);
+            if constexpr (std::is_same_v<DST_TYPE, double>) {
+                simd::fixed_point_to_double(dst, words, n, frac_bits);
+                return;
+            }
+            double buffer[BLOCK_SIZE];
+            for (std::size_t i = 0; i < n; i += BLOCK_SIZE) {
+                const std::size_t n_block = std::min(BLOCK_SIZE, n - i);
+                simd::fixed_point_to_double(buffer, words + i, n_block, frac_bits);
+                for (std::size_t j = 0; j < n_block; j++) {
+                    dst[i + j] = DST_TYPE(buffer[j]);
+                }
+            }
+            return;
+        }
     }
-};
+
+    if constexpr (std::is_same_v<DST_TYPE, double>) {
+        FixedPointToDouble<const apy_limb_t*> converter(spec);
+        for (std::size_t i = 0; i < n; i++) {
+            dst[i] = converter(src + i * n_limbs, src + (i + 1) * n_limbs);
+        }
+    } else {
+        for (std::size_t i = 0; i < n; i++) {
+            const APyFloatData data = floating_point_from_fixed_point(
+                src + i * n_limbs,
+                src + (i + 1) * n_limbs,
+                spec.bits,
+                spec.int_bits,
+                dst_spec.exp_bits,
+                dst_spec.man_bits,
+                dst_spec.bias
+            );
+            store_ieee754(data, dst + i);
+        }
+    }
+}
+
+/*!
+ * Convert the `n` floating-point values of format `spec` at `src` to `DST_TYPE`:
+ * `double`, `float`, or half-precision bit patterns in `std::uint16_t`. Values are
+ * rounded to nearest, with ties to even. Values with at most 52 mantissa bits are
+ * converted to `double` using SIMD.
+ */
+template <typename DST_TYPE>
+void floating_point_to_floats(
+    const APyFloatData* src, std::size_t n, const APyFloatSpec& spec, DST_TYPE* dst
+)
+{
+    constexpr std::size_t BLOCK_SIZE = 256;
+    constexpr APyFloatSpec dst_spec = ieee754_spec_of<DST_TYPE>();
+    constexpr QuantizationMode qntz = QuantizationMode::RND_CONV;
+    const auto qntz_func = get_qntz_func(qntz);
+    const auto convert_scalar = [&](std::size_t i) {
+        const APyFloatData data
+            = floating_point_cast(src[i], spec, dst_spec, qntz, qntz_func);
+        store_ieee754(data, dst + i);
+    };
+
+    // Values evaluated by the SIMD conversion are exact in double precision, so
+    // narrowing them to single precision is a single rounding
+    if constexpr (!std::is_same_v<DST_TYPE, std::uint16_t>) {
+        if (spec.man_bits <= 52) {
+            double buffer[BLOCK_SIZE];
+            std::size_t fallback_idx[BLOCK_SIZE];
+            for (std::size_t i = 0; i < n; i += BLOCK_SIZE) {
+                const std::size_t n_block = std::min(BLOCK_SIZE, n - i);
+                const std::size_t n_fallback = simd::floating_point_to_double(
+                    buffer, src + i, n_block, spec, fallback_idx
+                );
+                std::size_t k = 0;
+                for (std::size_t j = 0; j < n_block; j++) {
+                    if (k < n_fallback && fallback_idx[k] == j) {
+                        convert_scalar(i + j);
+                        k++;
+                    } else {
+                        dst[i + j] = DST_TYPE(buffer[j]);
+                    }
+                }
+            }
+            return;
+        }
+    }
+
+    for (std::size_t i = 0; i < n; i++) {
+        convert_scalar(i);
+    }
+}
 
 /* ********************************************************************************** *
  * *              Floating-point iterator-based arithmetic functions                * *
@@ -2598,6 +2896,16 @@ private:
     exp_t RES_MAX_EXP;
 };
 
+//! Number of elements evaluated per call to the SIMD floating-point kernels, bounding
+//! the on-stack buffer of fallback indices
+static constexpr std::size_t _FLOAT_SIMD_BLOCK_SIZE = 256;
+
+//! Test if quantization mode `qntz` is supported by the SIMD floating-point kernels
+[[maybe_unused]] static APY_INLINE bool is_simd_qntz(QuantizationMode qntz)
+{
+    return qntz == QuantizationMode::RND_CONV || qntz == QuantizationMode::TRN;
+}
+
 template <
     bool IS_SUBTRACT,
     std::size_t SRC1_INC,
@@ -2627,6 +2935,14 @@ public:
                         src1_spec, src2_spec, dst_spec, qntz
                     );
                     f = &F::add_same_wl;
+                    if constexpr (IS_SIMD_INC) {
+                        if (src1_spec == dst_spec && is_simd_qntz(qntz)
+                            && simd::is_floating_point_simd_format(dst_spec)) {
+                            _spec = dst_spec;
+                            _qntz = qntz;
+                            f = &F::add_same_wl_simd;
+                        }
+                    }
                 } else {
                     _add_diff_wl = _FloatingPointAddSubDiffWl<IS_SUBTRACT>(
                         src1_spec, src2_spec, dst_spec, qntz
@@ -2662,11 +2978,19 @@ public:
     }
 
 private:
+    // The SIMD kernels require unit-stride destinations and unit-stride or broadcast
+    // sources
+    static constexpr bool IS_SIMD_INC = DST_INC == 1 && SRC1_INC <= 1 && SRC2_INC <= 1;
+
     // Set during functor initialization
     _FloatingPointAddSubSameWl<IS_SUBTRACT> _add_same_wl;
     _FloatingPointAddSubDiffWl<IS_SUBTRACT> _add_diff_wl;
     _FloatingPointAddSubGeneral<IS_SUBTRACT> _add_general;
 
+    // Set during functor initialization, only when using `add_same_wl_simd`
+    APyFloatSpec _spec;
+    QuantizationMode _qntz;
+
     // Pointer to the correct adder function based on the floating-point specs
     void (_FloatingPointAddSub::*f)(
         const APyFloatData* src1,
@@ -2710,6 +3034,42 @@ private:
             _add_diff_wl(src1 + SRC1_INC * i, src2 + SRC2_INC * i, dst + DST_INC * i);
         }
     }
+
+    void add_same_wl_simd(
+        const APyFloatData* src1,
+        const APyFloatData* src2,
+        APyFloatData* dst,
+        std::size_t nitems
+    ) const
+    {
+        if (nitems == 1) {
+            _add_same_wl(src1, src2, dst);
+            return;
+        }
+
+        std::size_t fallback_idx[_FLOAT_SIMD_BLOCK_SIZE];
+        for (std::size_t i = 0; i < nitems; i += _FLOAT_SIMD_BLOCK_SIZE) {
+            const std::size_t n = std::min(_FLOAT_SIMD_BLOCK_SIZE, nitems - i);
+            const APyFloatData* x = src1 + SRC1_INC * i;
+            const APyFloatData* y = src2 + SRC2_INC * i;
+            std::size_t n_fallback = simd::floating_point_add_same_wl(
+                dst + i,
+                x,
+                y,
+                SRC1_INC == 0,
+                SRC2_INC == 0,
+                n,
+                _spec,
+                _qntz,
+                IS_SUBTRACT,
+                fallback_idx
+            );
+            for (std::size_t j = 0; j < n_fallback; j++) {
+                const std::size_t k = fallback_idx[j];
+                _add_same_wl(x + SRC1_INC * k, y + SRC2_INC * k, dst + i + k);
+            }
+        }
+    }
 };
 
 template <std::size_t SRC1_INC = 1, std::size_t SRC2_INC = 1, std::size_t DST_INC = 1>
@@ -2728,6 +3088,17 @@ public:
             _mul_short
                 = _FloatingPointMultiplierShort(src1_spec, src2_spec, dst_spec, qntz);
             f = &F::mul_short;
+            if constexpr (IS_SIMD_INC) {
+                if (is_simd_qntz(qntz) && simd::is_floating_point_simd_format(src1_spec)
+                    && simd::is_floating_point_simd_format(src2_spec)
+                    && simd::is_floating_point_simd_format(dst_spec)) {
+                    _src1_spec = src1_spec;
+                    _src2_spec = src2_spec;
+                    _dst_spec = dst_spec;
+                    _qntz = qntz;
+                    f = &F::mul_short_simd;
+                }
+            }
         } else {
             _mul_general
                 = _FloatingPointMultiplierGeneral(src1_spec, src2_spec, dst_spec, qntz);
@@ -2755,10 +3126,18 @@ public:
     }
 
 private:
+    // The SIMD kernels require unit-stride destinations and unit-stride or broadcast
+    // sources
+    static constexpr bool IS_SIMD_INC = DST_INC == 1 && SRC1_INC <= 1 && SRC2_INC <= 1;
+
     // Set first during functor initialization
     _FloatingPointMultiplierShort _mul_short;
     _FloatingPointMultiplierGeneral _mul_general;
 
+    // Set during functor initialization, only when using `mul_short_simd`
+    APyFloatSpec _src1_spec, _src2_spec, _dst_spec;
+    QuantizationMode _qntz;
+
     // Pointer `f` to the correct function based on the floating-point specs
     void (FloatingPointMultiplier::*f)(
         const APyFloatData* src1,
@@ -2790,6 +3169,43 @@ private:
             _mul_general(src1 + SRC1_INC * i, src2 + SRC2_INC * i, dst + DST_INC * i);
         }
     }
+
+    void mul_short_simd(
+        const APyFloatData* src1,
+        const APyFloatData* src2,
+        APyFloatData* dst,
+        std::size_t nitems
+    ) const
+    {
+        if (nitems == 1) {
+            _mul_short(src1, src2, dst);
+            return;
+        }
+
+        std::size_t fallback_idx[_FLOAT_SIMD_BLOCK_SIZE];
+        for (std::size_t i = 0; i < nitems; i += _FLOAT_SIMD_BLOCK_SIZE) {
+            const std::size_t n = std::min(_FLOAT_SIMD_BLOCK_SIZE, nitems - i);
+            const APyFloatData* x = src1 + SRC1_INC * i;
+            const APyFloatData* y = src2 + SRC2_INC * i;
+            std::size_t n_fallback = simd::floating_point_mul(
+                dst + i,
+                x,
+                y,
+                SRC1_INC == 0,
+                SRC2_INC == 0,
+                n,
+                _src1_spec,
+                _src2_spec,
+                _dst_spec,
+                _qntz,
+                fallback_idx
+            );
+            for (std::size_t j = 0; j < n_fallback; j++) {
+                const std::size_t k = fallback_idx[j];
+                _mul_short(x + SRC1_INC * k, y + SRC2_INC * k, dst + i + k);
+            }
+        }
+    }
 };
 
 template <std::size_t SRC1_INC = 1, std::size_t SRC2_INC = 1, std::size_t DST_INC = 1>
@@ -2844,6 +3260,40 @@ using FloatingPointAdder = _FloatingPointAddSub<false, SRC1_INC, SRC2_INC, DST_I
 template <std::size_t SRC1_INC = 1, std::size_t SRC2_INC = 1, std::size_t DST_INC = 1>
 using FloatingPointSubtractor = _FloatingPointAddSub<true, SRC1_INC, SRC2_INC, DST_INC>;
 
+/*!
+ * Evaluate an elementwise floating-point functor, e.g., `FloatingPointAdder` or
+ * `ComplexFloatingPointMultiplier`, on `nitems` elements. Each element spans
+ * `ITEM_SIZE` consecutive `APyFloatData` (two for the complex-valued functors), and the
+ * operands advance `SRC1_INC`, `SRC2_INC`, and `DST_INC` elements per element, just as
+ * in the functor. The elements are split over the global threadpool when
+ * `use_threadpool` is set, unless `qntz` is stochastic, in which case the thread-local
+ * random number generator of the calling thread must be used.
+ */
+template <
+    std::size_t SRC1_INC,
+    std::size_t SRC2_INC,
+    std::size_t DST_INC,
+    std::size_t ITEM_SIZE = 1,
+    typename FUNCTOR>
+void floating_point_elementwise(
+    const FUNCTOR& f,
+    const APyFloatData* src1,
+    const APyFloatData* src2,
+    APyFloatData* dst,
+    std::size_t nitems,
+    QuantizationMode qntz,
+    bool use_threadpool
+)
+{
+    use_threadpool &= !is_stochastic_quantization(qntz);
+    threadpool_chunked_for(use_threadpool, nitems, [&](auto begin, auto end) {
+        f(src1 + ITEM_SIZE * SRC1_INC * begin,
+          src2 + ITEM_SIZE * SRC2_INC * begin,
+          dst + ITEM_SIZE * DST_INC * begin,
+          end - begin);
+    });
+}
+
 class FloatingPointInnerProduct {
 public:
     explicit FloatingPointInnerProduct(
@@ -1,9 +1,12 @@
 #include "apyfloatarray.h"
 #include "apyarray.h"
+#include "apyconvolve.h"
 #include "apyfloat.h"
 #include "apyfloat_util.h"
 #include "apytypes_common.h"
 #include "apytypes_intrinsics.h"
+#include "apytypes_simd.h"
+#include "apytypes_text_io.h"
 #include "apytypes_util.h"
 #include "array_utils.h"
 #include "ieee754.h"
@@ -26,6 +29,7 @@ namespace nb = nanobind;
 #include <stdlib.h>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 #include <variant>
 
@@ -79,9 +83,9 @@ APyFloatArray::APyFloatArray(
     if (is_ndarray(sign_seq) || is_ndarray(exp_seq) || is_ndarray(man_seq)) {
         if (is_ndarray(sign_seq) && is_ndarray(exp_seq) && is_ndarray(man_seq)) {
             // If any input array is ndarray, than all input arrays *must* be ndarray
-            auto&& ndarray_sign = nb::cast<nb::ndarray<nb::c_contig>>(sign_seq);
-            auto&& ndarray_exp = nb::cast<nb::ndarray<nb::c_contig>>(exp_seq);
-            auto&& ndarray_man = nb::cast<nb::ndarray<nb::c_contig>>(man_seq);
+            auto&& ndarray_sign = nb::cast<nb::ndarray<>>(sign_seq);
+            auto&& ndarray_exp = nb::cast<nb::ndarray<>>(exp_seq);
+            auto&& ndarray_man = nb::cast<nb::ndarray<>>(man_seq);
             _set_sign_bits_from_ndarray(ndarray_sign);
             _set_exp_bits_from_ndarray(ndarray_exp);
             _set_man_bits_from_ndarray(ndarray_man);
@@ -127,6 +131,34 @@ APyFloatArray::APyFloatArray(
 {
 }
 
+APyFloatArray::APyFloatArray(
+    cow_no_init_t,
+    const std::vector<std::size_t>& shape,
+    std::uint8_t exp_bits,
+    std::uint8_t man_bits,
+    exp_t bias
+)
+    : APyArray(shape, 1, vector_type(fold_shape(shape), cow_no_init))
+    , exp_bits(exp_bits)
+    , man_bits(man_bits)
+    , bias(bias)
+{
+}
+
+APyFloatArray::APyFloatArray(
+    const std::vector<std::size_t>& shape,
+    std::uint8_t exp_bits,
+    std::uint8_t man_bits,
+    exp_t bias,
+    vector_type&& v
+)
+    : APyArray(shape, 1, std::move(v))
+    , exp_bits(exp_bits)
+    , man_bits(man_bits)
+    , bias(bias)
+{
+}
+
 /* ********************************************************************************** *
  * *                            Binary arithmetic operators                         * *
  * ********************************************************************************** */
@@ -141,11 +173,19 @@ APyFloatArray APyFloatArray::operator+(const APyFloatArray& rhs) const
     const std::uint8_t res_man_bits = std::max(man_bits, rhs.man_bits);
     const exp_t res_bias = calc_bias(res_exp_bits, spec(), rhs.spec());
     const QuantizationMode& qntz = get_float_quantization_mode();
-    APyFloatArray res(_shape, res_exp_bits, res_man_bits, res_bias);
+    APyFloatArray res(cow_no_init, _shape, res_exp_bits, res_man_bits, res_bias);
 
     // Perform addition
     auto add = FloatingPointAdder<>(spec(), rhs.spec(), res.spec(), qntz);
-    add(_data.data(), rhs._data.data(), res._data.data(), res._nitems);
+    floating_point_elementwise<1, 1, 1>(
+        add,
+        _data.data(),
+        rhs._data.data(),
+        res._data.data(),
+        res._nitems,
+        qntz,
+        is_elementwise_with_threadpool_justified(res._nitems)
+    );
 
     return res;
 }
@@ -156,12 +196,20 @@ APyFloatArray APyFloatArray::operator+(const APyFloat& rhs) const
     const std::uint8_t res_man_bits = std::max(man_bits, rhs.get_man_bits());
     const exp_t res_bias = calc_bias(res_exp_bits, spec(), rhs.spec());
     const QuantizationMode& qntz = get_float_quantization_mode();
-    APyFloatArray res(_shape, res_exp_bits, res_man_bits, res_bias);
+    APyFloatArray res(cow_no_init, _shape, res_exp_bits, res_man_bits, res_bias);
 
     // Perform addition
     const APyFloatData& rhs_data = rhs.get_data();
     auto add = FloatingPointAdder<1, 0, 1>(spec(), rhs.spec(), res.spec(), qntz);
-    add(_data.data(), &rhs_data, res._data.data(), res._nitems);
+    floating_point_elementwise<1, 0, 1>(
+        add,
+        _data.data(),
+        &rhs_data,
+        res._data.data(),
+        res._nitems,
+        qntz,
+        is_elementwise_with_threadpool_justified(res._nitems)
+    );
 
     return res;
 }
@@ -176,11 +224,19 @@ APyFloatArray APyFloatArray::operator-(const APyFloatArray& rhs) const
     const std::uint8_t res_man_bits = std::max(man_bits, rhs.man_bits);
     const exp_t res_bias = calc_bias(res_exp_bits, spec(), rhs.spec());
     const QuantizationMode& qntz = get_float_quantization_mode();
-    APyFloatArray res(_shape, res_exp_bits, res_man_bits, res_bias);
+    APyFloatArray res(cow_no_init, _shape, res_exp_bits, res_man_bits, res_bias);
 
     // Perform subtraction
     auto sub = FloatingPointSubtractor<>(spec(), rhs.spec(), res.spec(), qntz);
-    sub(_data.data(), rhs._data.data(), res._data.data(), res._nitems);
+    floating_point_elementwise<1, 1, 1>(
+        sub,
+        _data.data(),
+        rhs._data.data(),
+        res._data.data(),
+        res._nitems,
+        qntz,
+        is_elementwise_with_threadpool_justified(res._nitems)
+    );
 
     return res;
 }
@@ -191,12 +247,20 @@ APyFloatArray APyFloatArray::operator-(const APyFloat& rhs) const
     const std::uint8_t res_man_bits = std::max(man_bits, rhs.get_man_bits());
     const exp_t res_bias = calc_bias(res_exp_bits, spec(), rhs.spec());
     const QuantizationMode& qntz = get_float_quantization_mode();
-    APyFloatArray res(_shape, res_exp_bits, res_man_bits, res_bias);
+    APyFloatArray res(cow_no_init, _shape, res_exp_bits, res_man_bits, res_bias);
 
     // Perform the subtraction
     const APyFloatData& rhs_data = rhs.get_data();
     auto sub = FloatingPointSubtractor<1, 0, 1>(spec(), rhs.spec(), res.spec(), qntz);
-    sub(_data.data(), &rhs_data, res._data.data(), res._nitems);
+    floating_point_elementwise<1, 0, 1>(
+        sub,
+        _data.data(),
+        &rhs_data,
+        res._data.data(),
+        res._nitems,
+        qntz,
+        is_elementwise_with_threadpool_justified(res._nitems)
+    );
 
     return res;
 }
@@ -204,9 +268,10 @@ APyFloatArray APyFloatArray::operator-(const APyFloat& rhs) const
 APyFloatArray APyFloatArray::operator-() const
 {
     auto res = *this;
+    APyFloatData* res_data = res._data.data(); // copy-on-write once, outside loop
     VECTORIZE_LOOP
     for (std::size_t i = 0; i < res._data.size(); i++) {
-        res._data[i].sign = !res._data[i].sign;
+        res_data[i].sign = !res_data[i].sign;
     }
     return res;
 }
@@ -214,9 +279,10 @@ APyFloatArray APyFloatArray::operator-() const
 APyFloatArray APyFloatArray::abs() const
 {
     auto res = *this;
+    APyFloatData* res_data = res._data.data(); // copy-on-write once, outside loop
     VECTORIZE_LOOP
     for (std::size_t i = 0; i < res._data.size(); i++) {
-        res._data[i].sign = false;
+        res_data[i].sign = false;
     }
     return res;
 }
@@ -231,11 +297,19 @@ APyFloatArray APyFloatArray::operator*(const APyFloatArray& rhs) const
     const std::uint8_t res_man_bits = std::max(man_bits, rhs.man_bits);
     const exp_t res_bias = calc_bias(res_exp_bits, spec(), rhs.spec());
     const QuantizationMode& qntz = get_float_quantization_mode();
-    APyFloatArray res(_shape, res_exp_bits, res_man_bits, res_bias);
+    APyFloatArray res(cow_no_init, _shape, res_exp_bits, res_man_bits, res_bias);
 
     // Perform multiplication
     auto mul = FloatingPointMultiplier<>(spec(), rhs.spec(), res.spec(), qntz);
-    mul(_data.data(), rhs._data.data(), res._data.data(), _nitems);
+    floating_point_elementwise<1, 1, 1>(
+        mul,
+        _data.data(),
+        rhs._data.data(),
+        res._data.data(),
+        _nitems,
+        qntz,
+        is_elementwise_with_threadpool_justified(_nitems)
+    );
 
     return res;
 }
@@ -247,12 +321,20 @@ APyFloatArray APyFloatArray::operator*(const APyFloat& rhs) const
     const std::uint8_t res_man_bits = std::max(man_bits, rhs.get_man_bits());
     const exp_t res_bias = calc_bias(res_exp_bits, spec(), rhs.spec());
     const QuantizationMode& qntz = get_float_quantization_mode();
-    APyFloatArray res(_shape, res_exp_bits, res_man_bits, res_bias);
+    APyFloatArray res(cow_no_init, _shape, res_exp_bits, res_man_bits, res_bias);
 
     // Perform multiplication
     const APyFloatData& rhs_data = rhs.get_data();
     auto mul = FloatingPointMultiplier<1, 0, 1>(spec(), rhs.spec(), res.spec(), qntz);
-    mul(_data.data(), &rhs_data, res._data.data(), _nitems);
+    floating_point_elementwise<1, 0, 1>(
+        mul,
+        _data.data(),
+        &rhs_data,
+        res._data.data(),
+        _nitems,
+        qntz,
+        is_elementwise_with_threadpool_justified(_nitems)
+    );
 
     return res;
 }
@@ -267,11 +349,19 @@ APyFloatArray APyFloatArray::operator/(const APyFloatArray& rhs) const
     const std::uint8_t res_man_bits = std::max(man_bits, rhs.get_man_bits());
     const exp_t res_bias = calc_bias(res_exp_bits, spec(), rhs.spec());
     const QuantizationMode& qntz = get_float_quantization_mode();
-    APyFloatArray res(_shape, res_exp_bits, res_man_bits, res_bias);
+    APyFloatArray res(cow_no_init, _shape, res_exp_bits, res_man_bits, res_bias);
 
     // Perform division
     FloatingPointDivider div(spec(), rhs.spec(), res.spec(), qntz);
-    div(_data.data(), rhs._data.data(), res._data.data(), _nitems);
+    floating_point_elementwise<1, 1, 1>(
+        div,
+        _data.data(),
+        rhs._data.data(),
+        res._data.data(),
+        _nitems,
+        qntz,
+        is_elementwise_with_threadpool_justified(_nitems)
+    );
 
     return res;
 }
@@ -283,12 +373,20 @@ APyFloatArray APyFloatArray::operator/(const APyFloat& rhs) const
     const std::uint8_t res_man_bits = std::max(man_bits, rhs.get_man_bits());
     const exp_t res_bias = calc_bias(res_exp_bits, spec(), rhs.spec());
     const QuantizationMode& qntz = get_float_quantization_mode();
-    APyFloatArray res(_shape, res_exp_bits, res_man_bits, res_bias);
+    APyFloatArray res(cow_no_init, _shape, res_exp_bits, res_man_bits, res_bias);
 
     // Perform division
     const APyFloatData& rhs_data = rhs.get_data();
     FloatingPointDivider<1, 0, 1> div(spec(), rhs.spec(), res.spec(), qntz);
-    div(_data.data(), &rhs_data, res._data.data(), _nitems);
+    floating_point_elementwise<1, 0, 1>(
+        div,
+        _data.data(),
+        &rhs_data,
+        res._data.data(),
+        _nitems,
+        qntz,
+        is_elementwise_with_threadpool_justified(_nitems)
+    );
 
     return res;
 }
@@ -299,12 +397,20 @@ APyFloatArray APyFloatArray::rdiv(const APyFloat& lhs) const
     const std::uint8_t res_man_bits = std::max(man_bits, lhs.get_man_bits());
     const exp_t res_bias = calc_bias(res_exp_bits, spec(), lhs.spec());
     const QuantizationMode& qntz = get_float_quantization_mode();
-    APyFloatArray res(_shape, res_exp_bits, res_man_bits, res_bias);
+    APyFloatArray res(cow_no_init, _shape, res_exp_bits, res_man_bits, res_bias);
 
     // Perform division
     const APyFloatData& lhs_data = lhs.get_data();
     FloatingPointDivider<0, 1, 1> div(lhs.spec(), spec(), res.spec(), qntz);
-    div(&lhs_data, _data.data(), res._data.data(), _nitems);
+    floating_point_elementwise<0, 1, 1>(
+        div,
+        &lhs_data,
+        _data.data(),
+        res._data.data(),
+        _nitems,
+        qntz,
+        is_elementwise_with_threadpool_justified(_nitems)
+    );
 
     return res;
 }
@@ -315,12 +421,20 @@ APyFloatArray APyFloatArray::rsub(const APyFloat& lhs) const
     const std::uint8_t res_man_bits = std::max(man_bits, lhs.get_man_bits());
     const exp_t res_bias = calc_bias(res_exp_bits, spec(), lhs.spec());
     const QuantizationMode& qntz = get_float_quantization_mode();
-    APyFloatArray res(_shape, res_exp_bits, res_man_bits, res_bias);
+    APyFloatArray res(cow_no_init, _shape, res_exp_bits, res_man_bits, res_bias);
 
     // Perform subtraction
     const APyFloatData& lhs_data = lhs.get_data();
     FloatingPointSubtractor<0, 1, 1> sub(lhs.spec(), spec(), res.spec(), qntz);
-    sub(&lhs_data, _data.data(), res._data.data(), _nitems);
+    floating_point_elementwise<0, 1, 1>(
+        sub,
+        &lhs_data,
+        _data.data(),
+        res._data.data(),
+        _nitems,
+        qntz,
+        is_elementwise_with_threadpool_justified(_nitems)
+    );
 
     return res;
 }
@@ -496,11 +610,12 @@ APyFloatArray APyFloatArray::operator~() const
     auto res = *this;
     auto exp_mask = ((1ULL << exp_bits) - 1);
     auto man_mask = ((1ULL << man_bits) - 1);
+    APyFloatData* res_data = res._data.data(); // copy-on-write once, outside loop
     VECTORIZE_LOOP
     for (std::size_t i = 0; i < res._data.size(); i++) {
-        res._data[i].sign = !res._data[i].sign;
-        res._data[i].exp = (~res._data[i].exp) & exp_mask;
-        res._data[i].man = (~res._data[i].man) & man_mask;
+        res_data[i].sign = !res_data[i].sign;
+        res_data[i].exp = (~res_data[i].exp) & exp_mask;
+        res_data[i].man = (~res_data[i].man) & man_mask;
     }
     return res;
 }
@@ -700,62 +815,37 @@ APyFloatArray::convolve(const APyFloatArray& rhs, const ConvolutionMode conv_mod
     const APyFloatArray* a = swap ? &rhs : this;
     const APyFloatArray* b = &b_cpy;
 
-    // Extract convolution properties
-    auto [len, n_left, n_right] = get_conv_lengths(conv_mode, a, b);
-
-    // Create result vector
-    const std::optional<APyFloatAccumulatorOption> mode = get_accumulator_mode_float();
-    const QuantizationMode& qntz
-        = mode.has_value() ? mode->quantization : get_float_quantization_mode();
-    std::uint8_t res_exp_bits;
-    std::uint8_t res_man_bits;
-    exp_t res_bias;
-    if (mode.has_value()) {
-        res_exp_bits = mode->exp_bits;
-        res_man_bits = mode->man_bits;
-        res_bias = mode->bias.has_value() ? *mode->bias : ieee_bias(res_exp_bits);
-    } else {
-        res_exp_bits = std::max(exp_bits, rhs.exp_bits);
-        res_man_bits = std::max(man_bits, rhs.man_bits);
-        res_bias = calc_bias(res_exp_bits, spec(), rhs.spec());
-    }
-    APyFloatArray result({ len }, res_exp_bits, res_man_bits, res_bias);
-
-    // Loop working variables
-    std::size_t n = b->_shape[0] - n_left;
-    auto dst = std::begin(result._data);
-    auto src1 = std::cbegin(a->_data);
-    auto src2 = std::cbegin(b->_data) + n_left;
-
-    const APyFloatSpec& lhs_spec = swap ? rhs.spec() : spec();
-    const APyFloatSpec& rhs_spec = swap ? spec() : rhs.spec();
-    const APyFloatSpec& res_spec = result.spec();
-    auto inner_product = FloatingPointInnerProduct(lhs_spec, rhs_spec, res_spec, qntz);
-
-    // `b` limits length of the inner product length
-    for (std::size_t i = 0; i < n_left; i++) {
-        inner_product(&*src1, &*src2, &*dst, n);
-        src2--;
-        dst++;
-        n++;
-    }
-
-    // full inner product length
-    for (std::size_t i = 0; i < a->_shape[0] - b->_shape[0] + 1; i++) {
-        inner_product(&*src1, &*src2, &*dst, n);
-        src1++;
-        dst++;
-    }
+    // Split the outputs over the thread pool, one inner product per output
+    return convolve_1d(*a, std::cbegin(a->_data), *b, std::cbegin(b->_data), conv_mode);
+}
 
-    // `a` limits length of the inner product length
-    for (std::size_t i = 0; i < n_right; i++) {
-        n--;
-        inner_product(&*src1, &*src2, &*dst, n);
-        src1++;
-        dst++;
+//! Perform a two-dimensional convolution with `other` using `mode`
+APyFloatArray APyFloatArray::convolve2d(
+    const APyFloatArray& other,
+    const ConvolutionMode conv_mode,
+    const PyShapeParam_t& stride
+) const
+{
+    if (ndim() < 2 || other.ndim() != 2) {
+        auto msg = fmt::format(
+            "can only convolve2d 2D arrays, or batches of them "
+            "(lhs.ndim = {}, rhs.ndim = {})",
+            ndim(),
+            other.ndim()
+        );
+        throw nanobind::value_error(msg.c_str());
     }
+    return convolve_nd(*this, other, conv_mode, stride, false, "convolve2d");
+}
 
-    return result;
+//! Perform a correlation with `other` using `mode`
+APyFloatArray APyFloatArray::correlate(
+    const APyFloatArray& other,
+    const ConvolutionMode conv_mode,
+    const PyShapeParam_t& stride
+) const
+{
+    return convolve_nd(*this, other, conv_mode, stride, true, "correlate");
 }
 
 std::variant<APyFloatArray, APyFloat>
@@ -1108,14 +1198,14 @@ APyFloatArray::nanmin(const std::optional<PyShapeParam_t>& py_axis) const
 
 std::string APyFloatArray::repr() const
 {
-    const auto sign_fmt = [](auto cbegin_it, auto) -> std::string {
-        return fmt::format("{}", int(cbegin_it->sign));
+    const auto sign_fmt = [](auto cbegin_it, auto, auto& out) {
+        out += cbegin_it->sign ? '1' : '0';
     };
-    const auto exp_fmt = [](auto cbegin_it, auto) -> std::string {
-        return fmt::format("{}", cbegin_it->exp);
+    const auto exp_fmt = [](auto cbegin_it, auto, auto& out) {
+        fmt::format_to(std::back_inserter(out), "{}", cbegin_it->exp);
     };
-    const auto man_fmt = [](auto cbegin_it, auto) -> std::string {
-        return fmt::format("{}", cbegin_it->man);
+    const auto man_fmt = [](auto cbegin_it, auto, auto& out) {
+        fmt::format_to(std::back_inserter(out), "{}", cbegin_it->man);
     };
 
     std::initializer_list<formatter_t> formatters { sign_fmt, exp_fmt, man_fmt };
@@ -1220,16 +1310,15 @@ nb::list APyFloatArray::to_bits_python_recursive_descent(
     return result;
 }
 
-nb::ndarray<nb::numpy, double>
+nb::ndarray<nb::numpy>
 APyFloatArray::to_numpy(std::optional<nb::object> dtype, std::optional<bool> copy) const
 {
-
-    (void)dtype;
-
-    FloatingPointToDouble<vector_const_iterator> converter(spec());
-    return nb::ndarray<nb::numpy, double>(
-        to_ndarray<double>(converter, "to_numpy", copy)
-    );
+    const APyFloatSpec src_spec = spec();
+    const APyFloatData* src = _data.data();
+    const auto convert_block = [&](std::size_t begin, std::size_t end, auto* dst) {
+        floating_point_to_floats(src + begin, end - begin, src_spec, dst);
+    };
+    return to_numpy_floats</*IS_COMPLEX=*/false>(convert_block, dtype, copy);
 }
 
 bool APyFloatArray::is_identical(const nb::object& other, bool ignore_zero_sign) const
@@ -1288,6 +1377,53 @@ void APyFloatArray::python_unpickle(
     new (apyfloatarray) APyFloatArray(fp_res);
 }
 
+void APyFloatArray::python_write_text(
+    const nb::object& file,
+    std::size_t columns,
+    std::string_view radix,
+    const std::optional<std::string>& delimiter,
+    const std::string& line_end
+) const
+{
+    const auto format = TextFormat::from_python(radix, delimiter, line_end);
+    const int bits = 1 + exp_bits + man_bits;
+    const std::size_t n_words = bits_to_words(bits);
+    const APyFloatData* src = _data.data();
+    auto get_words = [&](std::size_t i, std::uint64_t* words) {
+        float_data_to_words(src[i], exp_bits, man_bits, words, n_words);
+    };
+    write_bit_patterns(file, _nitems, columns, bits, format, get_words);
+}
+
+APyFloatArray APyFloatArray::python_read_text(
+    const nb::object& file,
+    std::string_view radix,
+    const std::optional<std::string>& delimiter,
+    int exp_bits,
+    int man_bits,
+    std::optional<exp_t> bias
+)
+{
+    check_exponent_format(exp_bits, "APyFloatArray._read_text");
+    check_mantissa_format(man_bits, "APyFloatArray._read_text");
+    const auto format = TextFormat::from_python(radix, delimiter);
+    const std::size_t n_words = bits_to_words(1 + exp_bits + man_bits);
+    const BitPatternTable table = read_bit_patterns(file, n_words, format);
+
+    APyFloatArray result(table.shape(format), exp_bits, man_bits, bias);
+    const std::uint64_t* src = table.words.data();
+    APyFloatData* dst = result._data.data();
+    const std::size_t n = result._nitems;
+    const bool use_threadpool = result.is_elementwise_with_threadpool_justified(n);
+    threadpool_chunked_for(use_threadpool, n, [&](auto begin, auto end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const std::uint64_t* words = src + i * n_words;
+            dst[i] = float_data_from_words(words, n_words, exp_bits, man_bits);
+        }
+    });
+    return result;
+}
+
 APyFloatArray APyFloatArray::from_numbers(
     const nb::typed<nb::iterable, nb::any>& number_seq,
     int exp_bits,
@@ -1297,7 +1433,7 @@ APyFloatArray APyFloatArray::from_numbers(
 {
     if (nb::isinstance<nb::ndarray<>>(number_seq)) {
         // Sequence is NDArray. Initialize using `from_array`.
-        auto ndarray = nb::cast<nb::ndarray<nb::c_contig>>(number_seq);
+        auto ndarray = nb::cast<nb::ndarray<>>(number_seq);
         return from_array(ndarray, exp_bits, man_bits, bias);
     }
 
@@ -1342,7 +1478,7 @@ APyFloatArray APyFloatArray::from_numbers(
 }
 
 APyFloatArray APyFloatArray::from_array(
-    const nb::ndarray<nb::c_contig>& ndarray,
+    const nb::ndarray<>& ndarray,
     int exp_bits,
     int man_bits,
     std::optional<exp_t> bias
@@ -1368,26 +1504,69 @@ APyFloatArray APyFloatArray::from_array(
     return result;
 }
 
-void APyFloatArray::_set_values_from_ndarray(const nb::ndarray<nb::c_contig>& ndarray)
+template <typename T>
+void APyFloatArray::_set_values_from_numbers(
+    const NDArrayReader<T>& src, std::size_t offset
+)
 {
-    // Double value used for converting.
-    APyFloat double_caster(11, 52, 1023);
+    constexpr std::size_t BLOCK_SIZE = 256;
+    const APyFloatSpec& res_spec = spec();
+    APyFloatData* dst = _data.data();
+
+    const bool use_threadpool = is_elementwise_with_threadpool_justified(_nitems);
+    threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+        // Double value used for converting
+        APyFloat double_caster(11, 52, 1023);
+        T buffer[BLOCK_SIZE];
+        double double_buffer[BLOCK_SIZE];
+        std::size_t fallback_idx[BLOCK_SIZE];
+
+        for (std::size_t i = begin; i < end; i += BLOCK_SIZE) {
+            const std::size_t n = std::min(BLOCK_SIZE, end - i);
+            const T* block_src = src.read(offset + i, n, buffer);
+            std::size_t n_fallback;
+            if constexpr (std::is_same_v<T, float>) {
+                n_fallback = simd::floating_point_from_float(
+                    dst + i, block_src, n, res_spec, fallback_idx
+                );
+            } else if constexpr (std::is_same_v<T, double>) {
+                n_fallback = simd::floating_point_from_double(
+                    dst + i, block_src, n, res_spec, fallback_idx
+                );
+            } else {
+                for (std::size_t j = 0; j < n; j++) {
+                    double_buffer[j] = static_cast<double>(block_src[j]);
+                }
+                n_fallback = simd::floating_point_from_double(
+                    dst + i, double_buffer, n, res_spec, fallback_idx
+                );
+            }
+
+            // Subnormals, non-finite values, and values that do not have a normal
+            // result are converted one at a time
+            for (std::size_t j = 0; j < n_fallback; j++) {
+                const std::size_t k = fallback_idx[j];
+                double value = static_cast<double>(block_src[k]);
+                double_caster.set_data(
+                    { sign_of_double(value),
+                      exp_t(exp_of_double(value)),
+                      man_of_double(value) }
+                );
+                dst[i + k] = double_caster.cast_from_double(exp_bits, man_bits, bias)
+                             .get_data();
+            }
+        }
+    });
+}
 
+void APyFloatArray::_set_values_from_ndarray(
+    const nb::ndarray<>& ndarray, std::size_t offset
+)
+{
 #define CHECK_AND_SET_VALUES_FROM_NPTYPE(__TYPE__)                                     \
     do {                                                                               \
         if (ndarray.dtype() == nb::dtype<__TYPE__>()) {                                \
-            auto ndarray_view = ndarray.view<__TYPE__, nb::ndim<1>>();                 \
-            for (std::size_t i = 0; i < ndarray.size(); i++) {                         \
-                double value = static_cast<double>(ndarray_view.data()[i]);            \
-                double_caster.set_data(                                                \
-                    { sign_of_double(value),                                           \
-                      exp_t(exp_of_double(value)),                                     \
-                      man_of_double(value) }                                           \
-                );                                                                     \
-                APyFloat fp                                                            \
-                    = double_caster.cast_from_double(exp_bits, man_bits, bias);        \
-                _data[i] = fp.get_data();                                              \
-            }                                                                          \
+            _set_values_from_numbers(NDArrayReader<__TYPE__>(ndarray), offset);        \
             return; /* Conversion completed, exit function */                          \
         }                                                                              \
     } while (0)
@@ -1430,7 +1609,7 @@ APyFloatArray APyFloatArray::from_bits(
     check_mantissa_format(man_bits, "APyFloatArray.from_bits");
 
     if (nb::isinstance<nb::ndarray<>>(python_bit_patterns)) { // ndarray
-        const auto ndarray = nb::cast<nb::ndarray<nb::c_contig>>(python_bit_patterns);
+        const auto ndarray = nb::cast<nb::ndarray<>>(python_bit_patterns);
 
         assert(ndarray.ndim() > 0);
         std::vector<std::size_t> shape(ndarray.ndim(), 0);
@@ -1468,7 +1647,7 @@ APyFloatArray APyFloatArray::from_bits(
     return result;
 }
 
-void APyFloatArray::_set_bits_from_ndarray(const nb::ndarray<nb::c_contig>& ndarray)
+void APyFloatArray::_set_bits_from_ndarray(const nb::ndarray<>& ndarray)
 {
     // Double value used for converting.
     APyFloat f(exp_bits, man_bits, bias);
@@ -1476,12 +1655,10 @@ void APyFloatArray::_set_bits_from_ndarray(const nb::ndarray<nb::c_contig>& ndar
 #define CHECK_AND_SET_BITS_FROM_NPTYPE(__TYPE__)                                       \
     do {                                                                               \
         if (ndarray.dtype() == nb::dtype<__TYPE__>()) {                                \
-            const auto ndarray_view = ndarray.view<__TYPE__, nb::ndim<1>>();           \
-            for (std::size_t i = 0; i < ndarray.size(); i++) {                         \
-                const auto bits = static_cast<std::uint64_t>(ndarray_view.data()[i]);  \
-                f.update_from_bits(bits);                                              \
+            NDArrayReader<__TYPE__>(ndarray).for_each([&](std::size_t i, __TYPE__ v) { \
+                f.update_from_bits(static_cast<std::uint64_t>(v));                     \
                 _data[i] = f.get_data();                                               \
-            }                                                                          \
+            });                                                                        \
             return; /* Conversion completed, exit function */                          \
         }                                                                              \
     } while (0)
@@ -1511,7 +1688,7 @@ void APyFloatArray::_set_bits_from_ndarray(const nb::ndarray<nb::c_contig>& ndar
     );
 }
 
-void APyFloatArray::_set_sign_bits_from_ndarray(const nb::ndarray<nb::c_contig>& array)
+void APyFloatArray::_set_sign_bits_from_ndarray(const nb::ndarray<>& array)
 {
     assert(array.ndim() == _ndim);
 
@@ -1544,7 +1721,7 @@ void APyFloatArray::_set_sign_bits_from_ndarray(const nb::ndarray<nb::c_contig>&
     );
 }
 
-void APyFloatArray::_set_exp_bits_from_ndarray(const nb::ndarray<nb::c_contig>& array)
+void APyFloatArray::_set_exp_bits_from_ndarray(const nb::ndarray<>& array)
 {
     assert(array.ndim() == _ndim);
 
@@ -1575,7 +1752,7 @@ void APyFloatArray::_set_exp_bits_from_ndarray(const nb::ndarray<nb::c_contig>&
     );
 }
 
-void APyFloatArray::_set_man_bits_from_ndarray(const nb::ndarray<nb::c_contig>& array)
+void APyFloatArray::_set_man_bits_from_ndarray(const nb::ndarray<>& array)
 {
     assert(array.ndim() == _ndim);
 
@@ -1608,14 +1785,13 @@ void APyFloatArray::_set_man_bits_from_ndarray(const nb::ndarray<nb::c_contig>&
 
 template <typename DTYPE>
 bool APyFloatArray::_check_and_set_sign_bits_from_ndarray(
-    const nb::ndarray<nb::c_contig>& ndarray_sign
+    const nb::ndarray<>& ndarray_sign
 )
 {
     if (ndarray_sign.dtype() == nb::dtype<DTYPE>()) {
-        auto&& ndarray_view = ndarray_sign.view<DTYPE, nb::ndim<1>>();
-        for (std::size_t i = 0; i < ndarray_sign.size(); i++) {
-            _data[i].sign = bool(DTYPE((ndarray_view.data()[i])));
-        }
+        NDArrayReader<DTYPE>(ndarray_sign).for_each([&](std::size_t i, DTYPE v) {
+            _data[i].sign = bool(v);
+        });
         return true;
     }
     return false;
@@ -1623,16 +1799,15 @@ bool APyFloatArray::_check_and_set_sign_bits_from_ndarray(
 
 template <typename DTYPE>
 bool APyFloatArray::_check_and_set_exp_bits_from_ndarray(
-    const nb::ndarray<nb::c_contig>& ndarray_exp
+    const nb::ndarray<>& ndarray_exp
 )
 {
     if (ndarray_exp.dtype() == nb::dtype<DTYPE>()) {
-        auto&& ndarray_view = ndarray_exp.view<DTYPE, nb::ndim<1>>();
-        for (std::size_t i = 0; i < ndarray_exp.size(); i++) {
-            std::uint64_t bits = std::uint64_t(ndarray_view.data()[i]);
+        NDArrayReader<DTYPE>(ndarray_exp).for_each([&](std::size_t i, DTYPE v) {
+            std::uint64_t bits = std::uint64_t(v);
             bits &= ((1ULL) << exp_bits) - 1;
             _data[i].exp = bits;
-        }
+        });
         return true;
     }
     return false;
@@ -1640,21 +1815,175 @@ bool APyFloatArray::_check_and_set_exp_bits_from_ndarray(
 
 template <typename DTYPE>
 bool APyFloatArray::_check_and_set_man_bits_from_ndarray(
-    const nb::ndarray<nb::c_contig>& ndarray_man
+    const nb::ndarray<>& ndarray_man
 )
 {
     if (ndarray_man.dtype() == nb::dtype<DTYPE>()) {
-        auto&& ndarray_view = ndarray_man.view<DTYPE, nb::ndim<1>>();
-        for (std::size_t i = 0; i < ndarray_man.size(); i++) {
-            std::uint64_t bits = std::uint64_t(ndarray_view.data()[i]);
+        NDArrayReader<DTYPE>(ndarray_man).for_each([&](std::size_t i, DTYPE v) {
+            std::uint64_t bits = std::uint64_t(v);
             bits &= ((1ULL) << man_bits) - 1;
             _data[i].man = bits;
-        }
+        });
         return true;
     }
     return false;
 }
 
+APyFloatArray APyFloatArray::fma(
+    const APyFloatArray& b,
+    const APyFloatArray& c,
+    std::optional<int> new_exp_bits,
+    std::optional<int> new_man_bits,
+    std::optional<exp_t> new_bias,
+    std::optional<QuantizationMode> quantization
+) const
+{
+    if (_shape != b._shape || _shape != c._shape) {
+        auto&& new_shape = smallest_broadcastable_shape(_shape, b._shape);
+        if (new_shape.size()) {
+            new_shape = smallest_broadcastable_shape(new_shape, c._shape);
+        }
+        if (new_shape.size() == 0) {
+            throw std::length_error(
+                fmt::format(
+                    "APyFloatArray.fma: shape mismatch, self.shape={}, b.shape={}, "
+                    "c.shape={}",
+                    tuple_string_from_vec(_shape),
+                    tuple_string_from_vec(b._shape),
+                    tuple_string_from_vec(c._shape)
+                )
+            );
+        }
+        return broadcast_to(new_shape).fma(
+            b.broadcast_to(new_shape),
+            c.broadcast_to(new_shape),
+            new_exp_bits,
+            new_man_bits,
+            new_bias,
+            quantization
+        );
+    }
+
+    const int res_exp_bits
+        = new_exp_bits.value_or(std::max({ exp_bits, b.exp_bits, c.exp_bits }));
+    const int res_man_bits
+        = new_man_bits.value_or(std::max({ man_bits, b.man_bits, c.man_bits }));
+    check_exponent_format(res_exp_bits, "APyFloatArray.fma");
+    check_mantissa_format(res_man_bits, "APyFloatArray.fma");
+    const exp_t res_bias = new_bias.value_or(APyFloat::ieee_bias(res_exp_bits));
+    const APyFloatSpec res_spec
+        = { std::uint8_t(res_exp_bits), std::uint8_t(res_man_bits), res_bias };
+    const QuantizationMode qntz = quantization.value_or(get_float_quantization_mode());
+
+    // Exponent range of the exact products and sums. The accumulator format has no
+    // subnormals or overflows in this range.
+    const auto max_exp = [](const APyFloatSpec& spec) {
+        return std::int64_t((1ULL << spec.exp_bits) - 2) - std::int64_t(spec.bias);
+    };
+    const auto min_exp = [](const APyFloatSpec& spec) {
+        return 1 - std::int64_t(spec.bias) - std::int64_t(spec.man_bits);
+    };
+    const std::int64_t exp_range = std::max(
+        { max_exp(spec()) + max_exp(b.spec()) + 2,
+          max_exp(c.spec()) + 1,
+          1 - std::min(min_exp(spec()) + min_exp(b.spec()), min_exp(c.spec())) }
+    );
+    int acc_exp_bits = 2;
+    while ((std::int64_t(1) << (acc_exp_bits - 1)) - 1 < exp_range) {
+        acc_exp_bits++;
+    }
+
+    const int prod_man_bits = man_bits + b.man_bits + 1;
+    if (unsigned(res_man_bits + 2) > _MAN_LIMIT_BITS) {
+        throw std::domain_error(
+            fmt::format(
+                "APyFloatArray.fma: at most {} mantissa bits are supported in the "
+                "result, got man_bits={}",
+                _MAN_LIMIT_BITS - 2,
+                res_man_bits
+            )
+        );
+    }
+
+    const auto qntz_func = get_qntz_func(qntz);
+    APyFloatArray result(
+        cow_no_init, _shape, res_spec.exp_bits, res_spec.man_bits, res_spec.bias
+    );
+
+    constexpr std::size_t BLOCK_SIZE = 256;
+    const bool use_threadpool = is_elementwise_with_threadpool_justified(_nitems)
+        && !is_stochastic_quantization(qntz);
+
+    if (unsigned(acc_exp_bits) > _EXP_LIMIT_BITS
+        || unsigned(prod_man_bits) > _MAN_LIMIT_BITS) {
+        // The exact product is not representable in `APyFloatData`, evaluate the
+        // product and sum exactly in fixed-point
+        if (unsigned(res_exp_bits + 1) > _EXP_LIMIT_BITS) {
+            throw std::domain_error(
+                fmt::format(
+                    "APyFloatArray.fma: at most {} exponent bits are supported in the "
+                    "result for these operands, got exp_bits={}",
+                    _EXP_LIMIT_BITS - 1,
+                    res_exp_bits
+                )
+            );
+        }
+        threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+            for (std::size_t i = begin; i < end; i++) {
+                result._data[i] = floating_point_sum_of_products<1>(
+                    { _data[i] },
+                    spec(),
+                    { b._data[i] },
+                    b.spec(),
+                    c._data[i],
+                    c.spec(),
+                    res_spec,
+                    qntz,
+                    qntz_func
+                );
+            }
+        });
+        return result;
+    }
+
+    /*
+     * The product is exact in `prod_spec`. The sum is rounded to odd (`JAM_UNBIASED`)
+     * with two extra mantissa bits in `acc_spec`, after which rounding to the result
+     * format gives the same result as rounding the exact sum directly.
+     */
+    const exp_t acc_bias = APyFloat::ieee_bias(acc_exp_bits);
+    const APyFloatSpec prod_spec
+        = { std::uint8_t(acc_exp_bits), std::uint8_t(prod_man_bits), acc_bias };
+    const APyFloatSpec acc_spec
+        = { std::uint8_t(acc_exp_bits), std::uint8_t(res_man_bits + 2), acc_bias };
+    const FloatingPointMultiplier<> mul(
+        spec(), b.spec(), prod_spec, QuantizationMode::RND_CONV
+    );
+    const FloatingPointAdder<> add(
+        prod_spec, c.spec(), acc_spec, QuantizationMode::JAM_UNBIASED
+    );
+    threadpool_chunked_for(use_threadpool, _nitems, [&](auto begin, auto end) {
+        APyFloatData prod[BLOCK_SIZE];
+        APyFloatData acc[BLOCK_SIZE];
+        for (std::size_t i = begin; i < end; i += BLOCK_SIZE) {
+            const std::size_t n = std::min<std::size_t>(BLOCK_SIZE, end - i);
+            mul(&_data[i], &b._data[i], prod, n);
+            add(prod, &c._data[i], acc, n);
+            for (std::size_t j = 0; j < n; j++) {
+                // Exactly zero sums of opposite signs are negative when rounding
+                // towards negative infinity
+                if (qntz == QuantizationMode::TRN && is_zero(acc[j])) {
+                    acc[j].sign = prod[j].sign | c._data[i + j].sign;
+                }
+                result._data[i + j]
+                    = floating_point_cast(acc[j], acc_spec, res_spec, qntz, qntz_func);
+            }
+        }
+    });
+
+    return result;
+}
+
 APyFloatArray APyFloatArray::cast(
     std::optional<int> new_exp_bits,
     std::optional<int> new_man_bits,
@@ -1703,70 +2032,78 @@ APyFloatArray APyFloatArray::_cast(
         return *this;
     }
 
-    APyFloatArray result(_shape, new_exp_bits, new_man_bits, new_bias);
+    APyFloatArray result(cow_no_init, _shape, new_exp_bits, new_man_bits, new_bias);
 
     const exp_t SRC_MAX_EXP = (1ULL << exp_bits) - 1;
     const exp_t DST_MAX_EXP = (1ULL << new_exp_bits) - 1;
     const int SPEC_MAN_BITS_DELTA = new_man_bits - man_bits;
     const std::int64_t BIAS_DELTA = std::int64_t(bias) - std::int64_t(new_bias);
+    bool use_threadpool = is_elementwise_with_threadpool_justified(_nitems);
 
     // If longer word lengths, use simpler/faster method
     if (new_exp_bits >= exp_bits && new_man_bits >= man_bits) {
-        for (std::size_t i = 0; i < _data.size(); i++) {
-            result._data[i] = array_floating_point_cast_no_quant(
-                _data[i],
-                spec(),
-                SRC_MAX_EXP,
-                DST_MAX_EXP,
-                SPEC_MAN_BITS_DELTA,
-                BIAS_DELTA
-            );
-        }
+        threadpool_chunked_for(use_threadpool, _data.size(), [&](auto begin, auto end) {
+            for (std::size_t i = begin; i < end; i++) {
+                result._data[i] = array_floating_point_cast_no_quant(
+                    _data[i],
+                    spec(),
+                    SRC_MAX_EXP,
+                    DST_MAX_EXP,
+                    SPEC_MAN_BITS_DELTA,
+                    BIAS_DELTA
+                );
+            }
+        });
         return result;
     }
 
+    use_threadpool &= !is_stochastic_quantization(quantization);
     const auto quantization_func = get_qntz_func(quantization);
     const man_t SRC_LEADING_ONE = (1ULL << man_bits);
     const man_t DST_LEADING_ONE = (1ULL << new_man_bits);
     const man_t SRC_HIDDEN_ONE = (1ULL << man_bits);
 
     if (SPEC_MAN_BITS_DELTA >= 0) {
-        for (std::size_t i = 0; i < _data.size(); i++) {
-            result._data[i] = array_floating_point_cast_pos_man_delta(
-                _data[i],
-                spec(),
-                result.spec(),
-                quantization,
-                quantization_func,
-                SRC_MAX_EXP,
-                DST_MAX_EXP,
-                SRC_LEADING_ONE,
-                DST_LEADING_ONE,
-                SPEC_MAN_BITS_DELTA,
-                SRC_HIDDEN_ONE,
-                BIAS_DELTA
-            );
-        }
+        threadpool_chunked_for(use_threadpool, _data.size(), [&](auto begin, auto end) {
+            for (std::size_t i = begin; i < end; i++) {
+                result._data[i] = array_floating_point_cast_pos_man_delta(
+                    _data[i],
+                    spec(),
+                    result.spec(),
+                    quantization,
+                    quantization_func,
+                    SRC_MAX_EXP,
+                    DST_MAX_EXP,
+                    SRC_LEADING_ONE,
+                    DST_LEADING_ONE,
+                    SPEC_MAN_BITS_DELTA,
+                    SRC_HIDDEN_ONE,
+                    BIAS_DELTA
+                );
+            }
+        });
     } else {
         const int SPEC_MAN_BITS_DELTA_REV = -SPEC_MAN_BITS_DELTA;
         const man_t FINAL_STICKY = (1ULL << (SPEC_MAN_BITS_DELTA_REV - 1)) - 1;
-        for (std::size_t i = 0; i < _data.size(); i++) {
-            result._data[i] = array_floating_point_cast_neg_man_delta(
-                _data[i],
-                spec(),
-                result.spec(),
-                quantization,
-                quantization_func,
-                SRC_MAX_EXP,
-                DST_MAX_EXP,
-                SRC_LEADING_ONE,
-                DST_LEADING_ONE,
-                SPEC_MAN_BITS_DELTA_REV,
-                SRC_HIDDEN_ONE,
-                FINAL_STICKY,
-                BIAS_DELTA
-            );
-        }
+        threadpool_chunked_for(use_threadpool, _data.size(), [&](auto begin, auto end) {
+            for (std::size_t i = begin; i < end; i++) {
+                result._data[i] = array_floating_point_cast_neg_man_delta(
+                    _data[i],
+                    spec(),
+                    result.spec(),
+                    quantization,
+                    quantization_func,
+                    SRC_MAX_EXP,
+                    DST_MAX_EXP,
+                    SRC_LEADING_ONE,
+                    DST_LEADING_ONE,
+                    SPEC_MAN_BITS_DELTA_REV,
+                    SRC_HIDDEN_ONE,
+                    FINAL_STICKY,
+                    BIAS_DELTA
+                );
+            }
+        });
     }
 
     return result;
@@ -1798,6 +2135,7 @@ APyFloat APyFloatArray::checked_inner_product(const APyFloatArray& rhs) const
         = FloatingPointInnerProduct(spec(), rhs.spec(), result.spec(), qntz);
 
     // dst = A x b
+    const GILRelease gil_release(_shape[0]);
     APyFloatData sum {};
     inner_product(
         _data.data(),     // src1, a: [1 x N]
@@ -1840,8 +2178,11 @@ APyFloatArray APyFloatArray::checked_2d_matmul(const APyFloatArray& rhs) const
         res_bias = calc_bias(res_exp_bits, spec(), rhs.spec());
     }
 
-    // Determine if threadpool should be used or not.
+    // Determine if threadpool should be used or not. The GIL is released for the
+    // remainder of the product.
     const bool use_threadpool = is_mac_with_threadpool_justified(M * N * res_cols);
+    const GILRelease gil_release(M * N * res_cols);
+    const auto pool_lock = lock_thread_pool(use_threadpool);
     const std::size_t n_threads = use_threadpool ? thread_pool.get_thread_count() : 1;
 
     // Resulting tensor
@@ -1899,13 +2240,14 @@ APyFloatArray APyFloatArray::checked_2d_matmul(const APyFloatArray& rhs) const
 
 std::string APyFloatArray::to_string_dec() const
 {
-    const auto formatter = [spec = spec()](auto cbegin_it, auto) -> std::string {
+    const auto formatter = [spec = spec()](auto cbegin_it, auto, auto& out) {
         // NOTE: Python, unlike C++, unconditionally encodes the string of a
         // floating-point NaN without a minus sign.
         if (is_nan(*cbegin_it, spec)) {
-            return "nan";
+            out += "nan";
         } else {
-            return fmt::format("{:}", floating_point_to_double(*cbegin_it, spec));
+            double value = floating_point_to_double(*cbegin_it, spec);
+            fmt::format_to(std::back_inserter(out), "{:}", value);
         }
     };
 
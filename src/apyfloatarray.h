@@ -14,6 +14,8 @@
 
 #include <cstdint>
 #include <optional>
+#include <string>
+#include <string_view>
 #include <vector>
 
 //! An N-dimensional array class for `APyFloat` objects
@@ -59,6 +61,26 @@ public:
         std::optional<exp_t> bias = std::nullopt
     );
 
+    //! Constructor specifying only the shape and format of the array, leaving the
+    //! elements unspecified. Every element must be written before it is read.
+    APyFloatArray(
+        cow_no_init_t,
+        const std::vector<std::size_t>& shape,
+        std::uint8_t exp_bits,
+        std::uint8_t man_bits,
+        exp_t bias
+    );
+
+    //! Constructor specifying the shape and format of the array, stealing the data
+    //! from vector
+    APyFloatArray(
+        const std::vector<std::size_t>& shape,
+        std::uint8_t exp_bits,
+        std::uint8_t man_bits,
+        exp_t bias,
+        vector_type&& v
+    );
+
 private:
     //! Default constructor (not available)
     APyFloatArray() = delete;
@@ -80,6 +102,14 @@ public:
         return APyFloatArray(shape, exp_bits, man_bits, bias);
     }
 
+    //! Create an `APyFloatArray` with the same bit specifiers as `*this`, stealing
+    //! the data from vector
+    APyFloatArray
+    create_array(const std::vector<std::size_t>& shape, vector_type&& data) const
+    {
+        return APyFloatArray(shape, exp_bits, man_bits, bias, std::move(data));
+    }
+
     //! Create an `APyFloatArray` with a given shape and bit specifiers
     static APyFloatArray
     create_array_static(const std::vector<std::size_t>& shape, const APyFloat& fp)
@@ -113,6 +143,12 @@ public:
         return n_mac >= thread_pool_settings.apyfloatarray.n_mac_threshold;
     }
 
+    //! Test if using threadpool is justified based on number of elementwise operations
+    bool is_elementwise_with_threadpool_justified(std::size_t n_elem) const noexcept
+    {
+        return n_elem >= thread_pool_settings.apyfloatarray.n_elem_threshold;
+    }
+
     /* ****************************************************************************** *
      * *                       Elementary arithmetic operators                      * *
      * ****************************************************************************** */
@@ -199,7 +235,7 @@ public:
 
     //! Create an `APyFloatArray` tensor object initialized with values from an ndarray
     static APyFloatArray from_array(
-        const nanobind::ndarray<nanobind::c_contig>& ndarray,
+        const nanobind::ndarray<>& ndarray,
         int exp_bits,
         int man_bits,
         std::optional<exp_t> bias = std::nullopt
@@ -214,37 +250,45 @@ public:
     );
 
     //! Set data fields based on an ndarray of bit patterns
-    void _set_bits_from_ndarray(const nanobind::ndarray<nanobind::c_contig>& ndarray);
+    void _set_bits_from_ndarray(const nanobind::ndarray<>& ndarray);
+
+    //! Set data fields based on an ndarray of doubles, starting at C-order element
+    //! `offset` of the ndarray
+    void
+    _set_values_from_ndarray(const nanobind::ndarray<>& ndarray, std::size_t offset = 0);
 
-    //! Set data fields based on an ndarray of doubles
-    void _set_values_from_ndarray(const nanobind::ndarray<nanobind::c_contig>& ndarray);
+    //! Set the values of `*this` from the floating-point values or integers read by
+    //! `src`, starting at element `offset`. Values are converted using SIMD, and large
+    //! arrays in parallel.
+    template <typename T>
+    void _set_values_from_numbers(const NDArrayReader<T>& src, std::size_t offset = 0);
 
     //! Set `sign` bits from ndarray
-    void _set_sign_bits_from_ndarray(const nb::ndarray<nb::c_contig>& array);
+    void _set_sign_bits_from_ndarray(const nb::ndarray<>& array);
 
     //! Set `exp` bits from ndarray
-    void _set_exp_bits_from_ndarray(const nb::ndarray<nb::c_contig>& array);
+    void _set_exp_bits_from_ndarray(const nb::ndarray<>& array);
 
     //! Set `man` bits from ndarray
-    void _set_man_bits_from_ndarray(const nb::ndarray<nb::c_contig>& array);
+    void _set_man_bits_from_ndarray(const nb::ndarray<>& array);
 
     //! Check and set `sign` from ndarray of `DTYPE`. Returns `true` on success and
     //! `false` otherwise. This is primarily a helper function to
     //! `_set_sign_bits_from_ndarray`
     template <typename DTYPE>
-    bool _check_and_set_sign_bits_from_ndarray(const nb::ndarray<nb::c_contig>& array);
+    bool _check_and_set_sign_bits_from_ndarray(const nb::ndarray<>& array);
 
     //! Check and set `exp` from ndarray of `DTYPE`. Returns `true` on success and
     //! `false` otherwise. This is primarily a helper function to
     //! `_set_exp_bits_from_ndarray`
     template <typename DTYPE>
-    bool _check_and_set_exp_bits_from_ndarray(const nb::ndarray<nb::c_contig>& array);
+    bool _check_and_set_exp_bits_from_ndarray(const nb::ndarray<>& array);
 
     //! Check and set `man` from ndarray of `DTYPE`. Returns `true` on success and
     //! `false` otherwise. This is primarily a helper function to
     //! `_set_man_bits_from_ndarray`
     template <typename DTYPE>
-    bool _check_and_set_man_bits_from_ndarray(const nb::ndarray<nb::c_contig>& array);
+    bool _check_and_set_man_bits_from_ndarray(const nb::ndarray<>& array);
 
     /* ****************************************************************************** *
      *                           Conversion to other types                            *
@@ -316,6 +360,16 @@ public:
     //! Perform a linear convolution with `other` using `mode`
     APyFloatArray convolve(const APyFloatArray& other, ConvolutionMode mode) const;
 
+    //! Perform a two-dimensional convolution with `other` over the last two axes
+    APyFloatArray convolve2d(
+        const APyFloatArray& other, ConvolutionMode mode, const PyShapeParam_t& stride
+    ) const;
+
+    //! Perform a correlation with `other` over the last `other.ndim()` axes
+    APyFloatArray correlate(
+        const APyFloatArray& other, ConvolutionMode mode, const PyShapeParam_t& stride
+    ) const;
+
     //! Sum over one or more axes.
     std::variant<APyFloatArray, APyFloat>
     sum(const std::optional<PyShapeParam_t>& axis = std::nullopt) const;
@@ -360,6 +414,16 @@ public:
     std::variant<APyFloatArray, APyFloat>
     nanmin(const std::optional<PyShapeParam_t>& axis = std::nullopt) const;
 
+    //! Fused multiply-add, `*this * b + c`, rounded once to the new format
+    APyFloatArray fma(
+        const APyFloatArray& b,
+        const APyFloatArray& c,
+        std::optional<int> exp_bits = std::nullopt,
+        std::optional<int> man_bits = std::nullopt,
+        std::optional<exp_t> bias = std::nullopt,
+        std::optional<QuantizationMode> quantization = std::nullopt
+    ) const;
+
     //! Return a copy of the tensor with the elements resized.
     APyFloatArray cast(
         std::optional<int> exp_bits,
@@ -422,7 +486,7 @@ public:
     ) const;
 
     //! Convert to a NumPy array
-    nanobind::ndarray<nanobind::numpy, double> to_numpy(
+    nanobind::ndarray<nanobind::numpy> to_numpy(
         std::optional<nb::object> dtype = std::nullopt,
         std::optional<bool> copy = std::nullopt
     ) const;
@@ -450,6 +514,29 @@ public:
             std::vector<APyFloatData::Tuple>>& state
     );
 
+    //! Write the bit patterns of the array as text to the binary Python file object
+    //! `file`, `columns` values per line (see `apytypes_text_io.h`)
+    void python_write_text(
+        const nb::object& file,
+        std::size_t columns,
+        std::string_view radix,
+        const std::optional<std::string>& delimiter,
+        const std::string& line_end
+    ) const;
+
+    //! Read an `APyFloatArray` from bit patterns in the text of the binary Python file
+    //! object `file`. Delimited text gives a two-dimensional array with one row per
+    //! line, or a one-dimensional array for a single line. Whitespace-separated text
+    //! gives a one-dimensional array.
+    static APyFloatArray python_read_text(
+        const nb::object& file,
+        std::string_view radix,
+        const std::optional<std::string>& delimiter,
+        int exp_bits,
+        int man_bits,
+        std::optional<exp_t> bias = std::nullopt
+    );
+
     /* ****************************************************************************** *
      * *                          Convenience methods                               * *
      * ****************************************************************************** */
@@ -0,0 +1,276 @@
+#include "apyfloatarray_planes.h"
+#include "apyfloat_util.h"
+#include "apyfloatarray.h"
+#include "apytypes_util.h"
+#include "array_utils.h"
+#include "simd_hints.h"
+
+#include <nanobind/nanobind.h>
+#include <nanobind/ndarray.h>
+#include <nanobind/stl/variant.h> // std::variant (with nanobind support)
+
+#include <algorithm>   // std::copy, std::min
+#include <fmt/format.h>
+#include <functional>  // std::plus, std::minus, std::multiplies
+#include <optional>    // std::optional
+#include <stdexcept>   // std::length_error
+#include <type_traits> // std::decay_t
+#include <utility>     // std::in_place_type, std::move
+#include <variant>     // std::visit
+
+namespace nb = nanobind;
+
+//! Create a plane of `n` elements using the smallest unsigned integer type with at
+//! least `bits` bits
+static APyFloatArrayPlanes::plane_type make_plane(unsigned bits, std::size_t n)
+{
+    using plane_type = APyFloatArrayPlanes::plane_type;
+    if (bits <= 8) {
+        return plane_type(std::in_place_type<std::vector<std::uint8_t>>, n);
+    } else if (bits <= 16) {
+        return plane_type(std::in_place_type<std::vector<std::uint16_t>>, n);
+    } else if (bits <= 32) {
+        return plane_type(std::in_place_type<std::vector<std::uint32_t>>, n);
+    } else {
+        return plane_type(std::in_place_type<std::vector<std::uint64_t>>, n);
+    }
+}
+
+APyFloatArrayPlanes::APyFloatArrayPlanes(const APyFloatArray& array)
+    : APyFloatArrayPlanes(
+          array.shape(), array.get_exp_bits(), array.get_man_bits(), array.get_bias()
+      )
+{
+    pack(array.data(), 0, _nitems);
+}
+
+APyFloatArrayPlanes::APyFloatArrayPlanes(
+    const std::vector<std::size_t>& shape,
+    std::uint8_t exp_bits,
+    std::uint8_t man_bits,
+    exp_t bias
+)
+    : _shape { shape }
+    , _nitems { fold_shape(shape) }
+    , exp_bits { exp_bits }
+    , man_bits { man_bits }
+    , bias { bias }
+    , _sign(_nitems)
+    , _exp { make_plane(exp_bits, _nitems) }
+    , _man { make_plane(man_bits, _nitems) }
+{
+}
+
+APyFloatArrayPlanes APyFloatArrayPlanes::zeros(
+    const PyShapeParam_t& shape, int exp_bits, int man_bits, std::optional<exp_t> bias
+)
+{
+    check_exponent_format(exp_bits, "APyFloatArrayPlanes.zeros");
+    check_mantissa_format(man_bits, "APyFloatArrayPlanes.zeros");
+    return APyFloatArrayPlanes(
+        cpp_shape_from_python_shape_like(shape),
+        exp_bits,
+        man_bits,
+        bias.value_or(ieee_bias(exp_bits))
+    );
+}
+
+APyFloatArrayPlanes APyFloatArrayPlanes::from_numbers(
+    const nb::typed<nb::iterable, nb::any>& number_seq,
+    int exp_bits,
+    int man_bits,
+    std::optional<exp_t> bias
+)
+{
+    if (!nb::isinstance<nb::ndarray<>>(number_seq)) {
+        // The Python objects of a sequence already outweigh an `APyFloatArray`
+        return APyFloatArrayPlanes(
+            APyFloatArray::from_numbers(number_seq, exp_bits, man_bits, bias)
+        );
+    }
+
+    check_exponent_format(exp_bits, "APyFloatArrayPlanes.from_float");
+    check_mantissa_format(man_bits, "APyFloatArrayPlanes.from_float");
+
+    const auto ndarray = nb::cast<nb::ndarray<>>(number_seq);
+    if (ndarray.ndim() == 0) {
+        throw nb::value_error(
+            "APyFloatArrayPlanes.from_float: zero-dimensional arrays not supported"
+        );
+    }
+
+    std::vector<std::size_t> shape(ndarray.ndim(), 0);
+    for (std::size_t i = 0; i < ndarray.ndim(); i++) {
+        shape[i] = ndarray.shape(i);
+    }
+
+    APyFloatArrayPlanes result(
+        shape, exp_bits, man_bits, bias.value_or(ieee_bias(exp_bits))
+    );
+    for (std::size_t i = 0; i < result._nitems; i += BLOCK_SIZE) {
+        const std::size_t n = std::min(BLOCK_SIZE, result._nitems - i);
+        APyFloatArray block(cow_no_init, { n }, exp_bits, man_bits, result.bias);
+        block._set_values_from_ndarray(ndarray, i);
+        result.pack(block.data(), i, n);
+    }
+    return result;
+}
+
+APyFloatArray APyFloatArrayPlanes::to_array() const
+{
+    APyFloatArray result(cow_no_init, _shape, exp_bits, man_bits, bias);
+    unpack(result.data(), 0, _nitems);
+    return result;
+}
+
+void APyFloatArrayPlanes::pack(const APyFloatData* src, std::size_t begin, std::size_t n)
+{
+    std::uint8_t* sign = _sign.data() + begin;
+    std::visit(
+        [&](auto& exp_plane, auto& man_plane) {
+            using EXP_T = typename std::decay_t<decltype(exp_plane)>::value_type;
+            using MAN_T = typename std::decay_t<decltype(man_plane)>::value_type;
+            EXP_T* exp = exp_plane.data() + begin;
+            MAN_T* man = man_plane.data() + begin;
+            VECTORIZE_LOOP
+            for (std::size_t i = 0; i < n; i++) {
+                sign[i] = std::uint8_t(src[i].sign);
+                exp[i] = EXP_T(src[i].exp);
+                man[i] = MAN_T(src[i].man);
+            }
+        },
+        _exp,
+        _man
+    );
+}
+
+void APyFloatArrayPlanes::unpack(APyFloatData* dst, std::size_t begin, std::size_t n)
+    const
+{
+    const std::uint8_t* sign = _sign.data() + begin;
+    std::visit(
+        [&](const auto& exp_plane, const auto& man_plane) {
+            const auto* exp = exp_plane.data() + begin;
+            const auto* man = man_plane.data() + begin;
+            VECTORIZE_LOOP
+            for (std::size_t i = 0; i < n; i++) {
+                dst[i] = { bool(sign[i]), exp_t(exp[i]), man_t(man[i]) };
+            }
+        },
+        _exp,
+        _man
+    );
+}
+
+template <typename BIN_OP>
+APyFloatArrayPlanes APyFloatArrayPlanes::apply_blockwise(
+    const APyFloatArrayPlanes& rhs, std::string_view op_name
+) const
+{
+    if (_shape != rhs._shape) {
+        throw std::length_error(
+            fmt::format(
+                "APyFloatArrayPlanes.{}: shape mismatch, lhs.shape={}, rhs.shape={}",
+                op_name,
+                tuple_string_from_vec(_shape),
+                tuple_string_from_vec(rhs._shape)
+            )
+        );
+    }
+
+    // The result format only depends on the operand formats, so it is known once the
+    // first (possibly empty) block has been computed
+    std::optional<APyFloatArrayPlanes> result;
+    std::size_t i = 0;
+    do {
+        const std::size_t n = std::min(BLOCK_SIZE, _nitems - i);
+        APyFloatArray lhs_block(cow_no_init, { n }, exp_bits, man_bits, bias);
+        APyFloatArray rhs_block(cow_no_init, { n }, rhs.exp_bits, rhs.man_bits, rhs.bias);
+        unpack(lhs_block.data(), i, n);
+        rhs.unpack(rhs_block.data(), i, n);
+        const APyFloatArray res_block = BIN_OP()(lhs_block, rhs_block);
+        if (!result) {
+            result.emplace(
+                _shape,
+                res_block.get_exp_bits(),
+                res_block.get_man_bits(),
+                res_block.get_bias()
+            );
+        }
+        result->pack(res_block.data(), i, n);
+        i += n;
+    } while (i < _nitems);
+    return std::move(*result);
+}
+
+APyFloatArrayPlanes APyFloatArrayPlanes::operator+(const APyFloatArrayPlanes& rhs
+) const
+{
+    return apply_blockwise<std::plus<>>(rhs, "__add__");
+}
+
+APyFloatArrayPlanes APyFloatArrayPlanes::operator-(const APyFloatArrayPlanes& rhs
+) const
+{
+    return apply_blockwise<std::minus<>>(rhs, "__sub__");
+}
+
+APyFloatArrayPlanes APyFloatArrayPlanes::operator*(const APyFloatArrayPlanes& rhs
+) const
+{
+    return apply_blockwise<std::multiplies<>>(rhs, "__mul__");
+}
+
+nb::typed<nb::tuple, std::size_t, nb::ellipsis>
+APyFloatArrayPlanes::python_get_shape() const
+{
+    nb::list result_list;
+    for (std::size_t i = 0; i < _shape.size(); i++) {
+        result_list.append(_shape[i]);
+    }
+    return nb::typed<nb::tuple, std::size_t, nb::ellipsis>(nb::tuple(result_list));
+}
+
+std::size_t APyFloatArrayPlanes::nbytes() const noexcept
+{
+    auto plane_bytes = [](const auto& plane) {
+        using INT_TYPE = typename std::decay_t<decltype(plane)>::value_type;
+        return plane.size() * sizeof(INT_TYPE);
+    };
+    return plane_bytes(_sign) + std::visit(plane_bytes, _exp)
+        + std::visit(plane_bytes, _man);
+}
+
+template <typename INT_TYPE>
+nb::ndarray<nb::numpy, INT_TYPE>
+APyFloatArrayPlanes::plane_to_ndarray(const std::vector<INT_TYPE>& plane) const
+{
+    INT_TYPE* result_data = new INT_TYPE[plane.size()];
+    std::copy(plane.begin(), plane.end(), result_data);
+
+    // Delete `result_data` when the `owner` capsule expires
+    nb::capsule owner(result_data, [](void* p) noexcept { delete[] (INT_TYPE*)p; });
+
+    return nb::ndarray<nb::numpy, INT_TYPE>(
+        result_data, _shape.size(), _shape.data(), owner
+    );
+}
+
+APyFloatArrayPlanes::ndarray_type APyFloatArrayPlanes::sign_ndarray() const
+{
+    return plane_to_ndarray(_sign);
+}
+
+APyFloatArrayPlanes::ndarray_type APyFloatArrayPlanes::exp_ndarray() const
+{
+    return std::visit(
+        [&](const auto& plane) -> ndarray_type { return plane_to_ndarray(plane); }, _exp
+    );
+}
+
+APyFloatArrayPlanes::ndarray_type APyFloatArrayPlanes::man_ndarray() const
+{
+    return std::visit(
+        [&](const auto& plane) -> ndarray_type { return plane_to_ndarray(plane); }, _man
+    );
+}
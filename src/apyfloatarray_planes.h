@@ -0,0 +1,134 @@
+/*
+ * Structure-of-arrays storage for `APyFloatArray`. The signs, biased exponents, and
+ * mantissas are stored in separate planes, each using the smallest unsigned integer
+ * type that fits the corresponding field of the floating-point format. An 8-bit
+ * floating-point array uses three bytes per element, compared to the 16 bytes of an
+ * `APyFloatData` in an `APyFloatArray`.
+ *
+ * Planes are created and combined one block of elements at a time, so only a block of
+ * `APyFloatData` is ever materialized alongside the planes.
+ */
+
+#ifndef _APYFLOAT_ARRAY_PLANES_H
+#define _APYFLOAT_ARRAY_PLANES_H
+
+#include "apyfloatarray.h"
+#include "apytypes_fwd.h"
+#include "array_utils.h"
+
+// Python object access through Nanobind
+#include <nanobind/nanobind.h>
+#include <nanobind/ndarray.h>     // nanobind::ndarray
+#include <nanobind/stl/variant.h> // std::variant (with nanobind support)
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+//! Compact, immutable, structure-of-arrays floating-point array
+class APyFloatArrayPlanes {
+public:
+    //! A single plane, using the smallest unsigned integer type that fits the field
+    using plane_type = std::variant<
+        std::vector<std::uint8_t>,
+        std::vector<std::uint16_t>,
+        std::vector<std::uint32_t>,
+        std::vector<std::uint64_t>>;
+
+    //! A single plane exported to NumPy
+    using ndarray_type = std::variant<
+        nb::ndarray<nb::numpy, std::uint64_t>,
+        nb::ndarray<nb::numpy, std::uint32_t>,
+        nb::ndarray<nb::numpy, std::uint16_t>,
+        nb::ndarray<nb::numpy, std::uint8_t>>;
+
+    //! Split an `APyFloatArray` into planes
+    explicit APyFloatArrayPlanes(const APyFloatArray& array);
+
+    //! Zero-initialized planes of a given shape and format
+    APyFloatArrayPlanes(
+        const std::vector<std::size_t>& shape,
+        std::uint8_t exp_bits,
+        std::uint8_t man_bits,
+        exp_t bias
+    );
+
+    //! Create planes of a given shape and format, filled with zeros
+    static APyFloatArrayPlanes zeros(
+        const PyShapeParam_t& shape,
+        int exp_bits,
+        int man_bits,
+        std::optional<exp_t> bias = std::nullopt
+    );
+
+    //! Create planes from a sequence of numbers or an ndarray. Ndarrays are converted
+    //! one block of elements at a time.
+    static APyFloatArrayPlanes from_numbers(
+        const nb::typed<nb::iterable, nb::any>& number_seq,
+        int exp_bits,
+        int man_bits,
+        std::optional<exp_t> bias = std::nullopt
+    );
+
+    //! Element-wise addition, computed one block of elements at a time
+    APyFloatArrayPlanes operator+(const APyFloatArrayPlanes& rhs) const;
+    //! Element-wise subtraction, computed one block of elements at a time
+    APyFloatArrayPlanes operator-(const APyFloatArrayPlanes& rhs) const;
+    //! Element-wise multiplication, computed one block of elements at a time
+    APyFloatArrayPlanes operator*(const APyFloatArrayPlanes& rhs) const;
+
+    //! Merge the planes into an `APyFloatArray`
+    APyFloatArray to_array() const;
+
+    //! Return the shape as a Python tuple
+    nb::typed<nb::tuple, std::size_t, nb::ellipsis> python_get_shape() const;
+
+    //! Return the total number of bytes used by the planes
+    std::size_t nbytes() const noexcept;
+
+    //! Return a copy of the sign plane
+    ndarray_type sign_ndarray() const;
+    //! Return a copy of the exponent plane
+    ndarray_type exp_ndarray() const;
+    //! Return a copy of the mantissa plane
+    ndarray_type man_ndarray() const;
+
+    APY_INLINE std::uint8_t get_exp_bits() const noexcept { return exp_bits; }
+    APY_INLINE std::uint8_t get_man_bits() const noexcept { return man_bits; }
+    APY_INLINE exp_t get_bias() const noexcept { return bias; }
+
+private:
+    std::vector<std::size_t> _shape;
+    std::size_t _nitems;
+    std::uint8_t exp_bits;
+    std::uint8_t man_bits;
+    exp_t bias;
+
+    std::vector<std::uint8_t> _sign;
+    plane_type _exp;
+    plane_type _man;
+
+    //! Number of elements converted to and from `APyFloatData` at a time
+    static constexpr std::size_t BLOCK_SIZE = 4096;
+
+    //! Write the `n` elements of `src` to the planes, starting at element `begin`
+    void pack(const APyFloatData* src, std::size_t begin, std::size_t n);
+
+    //! Read `n` elements, starting at element `begin`, from the planes into `dst`
+    void unpack(APyFloatData* dst, std::size_t begin, std::size_t n) const;
+
+    //! Apply the `APyFloatArray` operator `BIN_OP` to one block of elements at a time
+    template <typename BIN_OP>
+    APyFloatArrayPlanes
+    apply_blockwise(const APyFloatArrayPlanes& rhs, std::string_view op_name) const;
+
+    //! Return a copy of a plane as a NumPy array of the same shape as the array
+    template <typename INT_TYPE>
+    nb::ndarray<nb::numpy, INT_TYPE> plane_to_ndarray(const std::vector<INT_TYPE>& plane
+    ) const;
+};
+
+#endif // _APYFLOAT_ARRAY_PLANES_H
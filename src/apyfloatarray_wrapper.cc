@@ -1,11 +1,14 @@
 #include "apyfloatarray.h"
 #include "apyfloatarray_iterator.h"
+#include "apyfloatarray_planes.h"
 #include "nanobind_util.h"
 
 #include <nanobind/make_iterator.h>
 #include <nanobind/nanobind.h>
 #include <nanobind/operators.h>
 #include <nanobind/stl/optional.h>
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/string_view.h>
 
 namespace nb = nanobind;
 
@@ -42,9 +45,7 @@ static auto L_OP(const APyFloatArray& lhs, const R_TYPE& rhs)
         return OP()(lhs, APyFloat::from_double(rhs, exp_bits, man_bits, bias));
     } else if constexpr (std::is_same_v<remove_cvref_t<R_TYPE>, APyFloat>) {
         return OP()(lhs, rhs);
-    } else if constexpr (
-        std::is_same_v<remove_cvref_t<R_TYPE>, nb::ndarray<nb::c_contig>>
-    ) {
+    } else if constexpr (std::is_same_v<remove_cvref_t<R_TYPE>, nb::ndarray<>>) {
         return OP()(lhs, APyFloatArray::from_array(rhs, exp_bits, man_bits, bias));
     } else {
         return OP()(lhs, APyFloat::from_integer(rhs, exp_bits, man_bits, bias));
@@ -124,6 +125,43 @@ void bind_float_array(nb::module_& m)
          */
         .def("__getstate__", &APyFloatArray::python_pickle)
         .def("__setstate__", &APyFloatArray::python_unpickle)
+        .def("__reduce_ex__", &APyFloatArray::python_reduce_ex, nb::arg("protocol"))
+
+        /*
+         * Native binary file format payload (see `apytypes.save` and `apytypes.load`)
+         */
+        .def("_write_raw", &APyFloatArray::python_write_raw, nb::arg("file"))
+        .def(
+            "_from_raw",
+            &APyFloatArray::python_from_raw,
+            nb::arg("shape"),
+            nb::arg("payload")
+        )
+        .def("_raw_payload", &APyFloatArray::python_raw_payload)
+
+        /*
+         * Streaming text file support (see `apytypes.export_csv` and
+         * `apytypes.import_csv`)
+         */
+        .def(
+            "_write_text",
+            &APyFloatArray::python_write_text,
+            nb::arg("file"),
+            nb::arg("columns"),
+            nb::arg("radix"),
+            nb::arg("delimiter").none(),
+            nb::arg("line_end")
+        )
+        .def_static(
+            "_read_text",
+            &APyFloatArray::python_read_text,
+            nb::arg("file"),
+            nb::arg("radix"),
+            nb::arg("delimiter").none(),
+            nb::arg("exp_bits"),
+            nb::arg("man_bits"),
+            nb::arg("bias") = nb::none()
+        )
 
         /*
          * Arithmetic operations
@@ -205,10 +243,10 @@ void bind_float_array(nb::module_& m)
          * The right-hand versions are not used since Numpy will convert the
          * APyFloatArray to a Numpy array before they are invoked.
          */
-        .def("__add__", L_OP<STD_ADD<>, nb::ndarray<nb::c_contig>>, NB_OP())
-        .def("__sub__", L_OP<STD_SUB<>, nb::ndarray<nb::c_contig>>, NB_OP())
-        .def("__mul__", L_OP<STD_MUL<>, nb::ndarray<nb::c_contig>>, NB_OP())
-        .def("__truediv__", L_OP<STD_DIV<>, nb::ndarray<nb::c_contig>>, NB_OP())
+        .def("__add__", L_OP<STD_ADD<>, nb::ndarray<>>, NB_OP())
+        .def("__sub__", L_OP<STD_SUB<>, nb::ndarray<>>, NB_OP())
+        .def("__mul__", L_OP<STD_MUL<>, nb::ndarray<>>, NB_OP())
+        .def("__truediv__", L_OP<STD_DIV<>, nb::ndarray<>>, NB_OP())
 
         /*
          * Logic operations
@@ -306,12 +344,21 @@ void bind_float_array(nb::module_& m)
             Return array as a :class:`numpy.ndarray` of :class:`numpy.float64`.
 
             The returned array has the same `shape` and values as `self`. This
-            method rounds away from infinity on ties.
+            method rounds to nearest with ties to even.
+
+            If `dtype` is :class:`numpy.float32` or :class:`numpy.float16`, the values
+            are instead rounded once, directly to that data type. Other values of
+            `dtype` give a :class:`numpy.float64` array. Large arrays are converted in
+            parallel.
+
+            .. versionchanged:: 0.6
+                Single- and half-precision arrays are returned for the corresponding
+                `dtype`.
 
             Parameters
             ----------
-            dtype : :py:class:`numpy.dtype`
-                The desired data type of the output array. This parameter is currently ignored.
+            dtype : :py:class:`numpy.dtype`, optional
+                The desired floating-point data type of the output array.
             copy : :class:`bool`
                 Whether to copy the data or not. Must be :code:`True` or :code:`None`.
 
@@ -352,6 +399,34 @@ void bind_float_array(nb::module_& m)
             :class:`list` of :class:`int` or :class:`numpy.ndarray`
             )pbdoc"
         )
+        .def(
+            "to_planes",
+            [](const APyFloatArray& array) { return APyFloatArrayPlanes(array); },
+            R"pbdoc(
+            Return a compact copy with the signs, exponents, and mantissas stored in
+            separate planes.
+
+            Each plane uses the smallest unsigned integer type that fits the
+            corresponding field, e.g., three bytes per element for 8-bit formats. Use
+            :func:`APyFloatArrayPlanes.to_array` to convert back.
+
+            .. versionadded:: 0.6
+
+            Examples
+            --------
+            >>> import apytypes as apy
+            >>> a = apy.fp([1.0, 0.25, -1.5], exp_bits=4, man_bits=3)
+            >>> p = a.to_planes()
+            >>> p.nbytes
+            9
+            >>> p.to_array().is_identical(a)
+            True
+
+            Returns
+            -------
+            :class:`APyFloatArrayPlanes`
+            )pbdoc"
+        )
         .def("reshape", &APyFloatArray::python_reshape, nb::arg("new_shape"), R"pbdoc(
             Reshape the APyFloatArray to the specified shape without changing its data.
 
@@ -1072,6 +1147,109 @@ void bind_float_array(nb::module_& m)
             nb::arg("other"),
             nb::arg("mode") = "full"
         )
+        .def(
+            "convolve2d",
+            &APyFloatArray::convolve2d,
+            nb::arg("other"),
+            nb::arg("mode") = ConvolutionMode::FULL,
+            nb::arg("stride") = 1,
+            R"pbdoc(
+            Return the two-dimensional discrete linear convolution with another array.
+
+            The convolution is taken over the last two axes. The array `other` must be
+            two-dimensional, and any leading axes of `self` are batch axes: each
+            two-dimensional slice of `self` is convolved with `other`. Along each of the
+            two axes, `mode` selects the outputs as for :func:`convolve`. With `stride`,
+            only every `stride`-th output is computed, as in a strided convolutional
+            layer.
+
+            The result format is that of :func:`convolve`. The products of each output
+            are accumulated in index order of the array with the most items, as for
+            :func:`convolve`.
+
+            .. versionadded:: 0.6
+
+            Parameters
+            ----------
+            other : :class:`APyFloatArray`
+                The two-dimensional array to convolve with.
+            mode : :class:`ConvolutionMode` or {'full', 'same', 'valid'}, default: :class:`~ConvolutionMode.FULL`
+                The outputs to keep along each axis, see :func:`convolve`.
+            stride : :class:`int` or :class:`tuple` of :class:`int`, default: 1
+                Step between the kept outputs, either for both axes or one per axis.
+
+            Returns
+            -------
+            convolved : :class:`APyFloatArray`
+                The convolved array.
+            )pbdoc"
+        )
+        .def(
+            "convolve2d",
+            [](const APyFloatArray& self,
+               const APyFloatArray& other,
+               const std::string& mode,
+               const PyShapeParam_t& stride) {
+                return self.convolve2d(other, get_conv_mode(mode), stride);
+            },
+            nb::arg("other"),
+            nb::arg("mode") = "full",
+            nb::arg("stride") = 1
+        )
+        .def(
+            "correlate",
+            &APyFloatArray::correlate,
+            nb::arg("other"),
+            nb::arg("mode") = ConvolutionMode::FULL,
+            nb::arg("stride") = 1,
+            R"pbdoc(
+            Return the discrete linear cross-correlation with another array.
+
+            The correlation is taken over the last :code:`other.ndim` axes, and any
+            leading axes of `self` are batch axes. For one-dimensional arrays, the
+            result is that of :func:`numpy.correlate`, but `mode` defaults to
+            :class:`~ConvolutionMode.FULL`. The correlation is the convolution with
+            `other` reversed along all axes.
+
+            With a `stride`, only every `stride`-th output is computed, as in a strided
+            convolutional layer. A correlation with the kernel of a convolutional layer
+            in :class:`~ConvolutionMode.VALID` mode sums over its input channels.
+
+            The result format is that of :func:`convolve`. The products of each output
+            are accumulated in index order of the array with the most items, as for
+            :func:`convolve`.
+
+            .. versionadded:: 0.6
+
+            Parameters
+            ----------
+            other : :class:`APyFloatArray`
+                The array to correlate with.
+            mode : :class:`ConvolutionMode` or {'full', 'same', 'valid'}, default: :class:`~ConvolutionMode.FULL`
+                The outputs to keep along each axis, see :func:`convolve`. With
+                :class:`~ConvolutionMode.SAME`, the outputs are centered as for
+                :func:`numpy.correlate`.
+            stride : :class:`int` or :class:`tuple` of :class:`int`, default: 1
+                Step between the kept outputs, either for all axes or one per axis.
+
+            Returns
+            -------
+            correlated : :class:`APyFloatArray`
+                The correlated array.
+            )pbdoc"
+        )
+        .def(
+            "correlate",
+            [](const APyFloatArray& self,
+               const APyFloatArray& other,
+               const std::string& mode,
+               const PyShapeParam_t& stride) {
+                return self.correlate(other, get_conv_mode(mode), stride);
+            },
+            nb::arg("other"),
+            nb::arg("mode") = "full",
+            nb::arg("stride") = 1
+        )
         .def("squeeze", &APyFloatArray::squeeze, nb::arg("axis") = nb::none(), R"pbdoc(
             Remove axes of size one at the specified axis/axes.
 
@@ -1550,6 +1728,54 @@ void bind_float_array(nb::module_& m)
             nb::arg("copy") = nb::none()
         )
 
+        .def(
+            "fma",
+            &APyFloatArray::fma,
+            nb::arg("b"),
+            nb::arg("c"),
+            nb::arg("exp_bits") = nb::none(),
+            nb::arg("man_bits") = nb::none(),
+            nb::arg("bias") = nb::none(),
+            nb::arg("quantization") = nb::none(),
+            R"pbdoc(
+            Fused multiply-add, ``self * b + c``, with a single rounding.
+
+            The product and sum are evaluated exactly and rounded once into the new
+            format, as done by a hardware fused multiply-add unit. Stochastic
+            quantization modes round the sum with two extra mantissa bits.
+
+            .. versionadded:: 0.6
+
+            Parameters
+            ----------
+            b : :class:`APyFloatArray`
+                The array to multiply with.
+            c : :class:`APyFloatArray`
+                The array to add to the product.
+            exp_bits : :class:`int`, optional
+                Number of exponent bits in the result. If not provided, the largest
+                number of exponent bits of the operands is used.
+            man_bits : :class:`int`, optional
+                Number of mantissa bits in the result. If not provided, the largest
+                number of mantissa bits of the operands is used.
+            bias : :class:`int`, optional
+                Bias used in the result. If not provided, *bias* is ``2**(exp_bits - 1) - 1``.
+            quantization : :class:`QuantizationMode`, optional.
+                Quantization mode to use. If None, use the global quantization mode.
+
+            Returns
+            -------
+            :class:`APyFloatArray`
+
+            Raises
+            ------
+            :class:`ValueError`
+                If the result has more than 59 mantissa bits, or more than 29 exponent
+                bits for operands whose exact products need more than 61 mantissa bits
+                or 30 exponent bits.
+
+            )pbdoc"
+        )
         .def(
             "cast",
             &APyFloatArray::cast,
@@ -1711,6 +1937,152 @@ void bind_float_array(nb::module_& m)
             )pbdoc"
         );
 
+    nb::class_<APyFloatArrayPlanes>(m, "APyFloatArrayPlanes", R"pbdoc(
+        Compact structure-of-arrays floating-point array.
+
+        The signs, biased exponents, and mantissas are stored in separate planes, each
+        using the smallest unsigned integer type that fits the corresponding field.
+        Planes are created using :func:`APyFloatArrayPlanes.from_float`,
+        :func:`APyFloatArrayPlanes.zeros`, or :func:`APyFloatArray.to_planes`.
+        Addition, subtraction, and multiplication of planes with the same shape return
+        planes, and are computed a block of elements at a time, so the full array is
+        never stored as an :class:`APyFloatArray`.
+
+        .. versionadded:: 0.6
+        )pbdoc")
+        .def(nb::self + nb::self, NB_NARG())
+        .def(nb::self - nb::self, NB_NARG())
+        .def(nb::self * nb::self, NB_NARG())
+        .def_static(
+            "from_float",
+            &APyFloatArrayPlanes::from_numbers,
+            nb::arg("number_sequence"),
+            nb::arg("exp_bits"),
+            nb::arg("man_bits"),
+            nb::arg("bias") = nb::none(),
+            R"pbdoc(
+            Create an :class:`APyFloatArrayPlanes` from iterable sequence of numbers.
+
+            NumPy arrays are converted a block of elements at a time.
+
+            Parameters
+            ----------
+            number_sequence : :class:`~collections.abc.Iterable` of numbers
+                Floating point values to initialize from. The shape will be taken from
+                the sequence shape.
+            exp_bits : :class:`int`
+                Number of exponent bits.
+            man_bits : :class:`int`
+                Number of mantissa bits.
+            bias : :class:`int`, optional
+                Exponent bias. If not provided, *bias* is ``2**(exp_bits - 1) - 1``.
+
+            Examples
+            --------
+            >>> import apytypes as apy
+            >>> p = apy.APyFloatArrayPlanes.from_float(
+            ...     [1.0, 0.25, -1.5], exp_bits=4, man_bits=3
+            ... )
+            >>> p.nbytes
+            9
+            >>> float((p * p).to_array()[2])
+            2.25
+
+            Returns
+            -------
+            :class:`APyFloatArrayPlanes`
+            )pbdoc"
+        )
+        .def_static(
+            "zeros",
+            &APyFloatArrayPlanes::zeros,
+            nb::arg("shape"),
+            nb::arg("exp_bits"),
+            nb::arg("man_bits"),
+            nb::arg("bias") = nb::none(),
+            R"pbdoc(
+            Initialize planes with zeros.
+
+            Parameters
+            ----------
+            shape : :class:`tuple`
+                Shape of the array.
+            exp_bits : :class:`int`
+                Number of exponent bits.
+            man_bits : :class:`int`
+                Number of mantissa bits.
+            bias : :class:`int`, optional
+                Exponent bias. If not provided, *bias* is ``2**(exp_bits - 1) - 1``.
+
+            Returns
+            -------
+            :class:`APyFloatArrayPlanes`
+            )pbdoc"
+        )
+        .def("to_array", &APyFloatArrayPlanes::to_array, R"pbdoc(
+            Convert to an :class:`APyFloatArray`.
+
+            Returns
+            -------
+            :class:`APyFloatArray`
+            )pbdoc")
+        .def_prop_ro("shape", &APyFloatArrayPlanes::python_get_shape, R"pbdoc(
+            The shape of the array.
+
+            Returns
+            -------
+            :class:`tuple` of :class:`int`
+            )pbdoc")
+        .def_prop_ro("exp_bits", &APyFloatArrayPlanes::get_exp_bits, R"pbdoc(
+            Number of exponent bits.
+
+            Returns
+            -------
+            :class:`int`
+            )pbdoc")
+        .def_prop_ro("man_bits", &APyFloatArrayPlanes::get_man_bits, R"pbdoc(
+            Number of mantissa bits.
+
+            Returns
+            -------
+            :class:`int`
+            )pbdoc")
+        .def_prop_ro("bias", &APyFloatArrayPlanes::get_bias, R"pbdoc(
+            Exponent bias.
+
+            Returns
+            -------
+            :class:`int`
+            )pbdoc")
+        .def_prop_ro("nbytes", &APyFloatArrayPlanes::nbytes, R"pbdoc(
+            Number of bytes used by the planes.
+
+            Returns
+            -------
+            :class:`int`
+            )pbdoc")
+        .def_prop_ro("sign", &APyFloatArrayPlanes::sign_ndarray, R"pbdoc(
+            Copy of the sign plane.
+
+            Returns
+            -------
+            :class:`numpy.ndarray`
+            )pbdoc")
+        .def_prop_ro("exp", &APyFloatArrayPlanes::exp_ndarray, R"pbdoc(
+            Copy of the biased exponent plane.
+
+            Returns
+            -------
+            :class:`numpy.ndarray`
+            )pbdoc")
+        .def_prop_ro("man", &APyFloatArrayPlanes::man_ndarray, R"pbdoc(
+            Copy of the mantissa plane, without the hidden one.
+
+            Returns
+            -------
+            :class:`numpy.ndarray`
+            )pbdoc");
+
     nb::class_<APyFloatArrayIterator>(m, "APyFloatArrayIterator")
         .def(
             "__iter__",
@@ -0,0 +1,475 @@
+#include "apyiir.h"
+#include "apytypes_common.h"
+#include "apytypes_mp.h"
+#include "apytypes_util.h"
+
+#include <fmt/format.h>
+
+#include <nanobind/nanobind.h>
+
+#include <algorithm>   // std::copy_n, std::max, std::any_of
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint8_t
+#include <iterator>    // std::begin, std::cbegin
+#include <string_view> // std::string_view
+#include <utility>     // std::swap
+#include <variant>     // std::holds_alternative, std::get
+
+namespace nb = nanobind;
+
+/* ********************************************************************************** *
+ * *                        Fixed-point second-order section                        * *
+ * ********************************************************************************** */
+
+//! Format of the exact feed-forward sum of three products
+static APyFixedSpec
+biquad_ff_spec(const APyFixedSpec& src_spec, const APyFixedSpec& coef_spec)
+{
+    return { src_spec.bits + coef_spec.bits + 2,
+             src_spec.int_bits + coef_spec.int_bits + 2 };
+}
+
+//! Format of the exact feedback sum of two products
+static APyFixedSpec
+biquad_fb_spec(const APyFixedSpec& dst_spec, const APyFixedSpec& coef_spec)
+{
+    return { dst_spec.bits + coef_spec.bits + 1,
+             dst_spec.int_bits + coef_spec.int_bits + 1 };
+}
+
+//! Format of the exact difference of the feed-forward and feedback sums
+static APyFixedSpec biquad_acc_spec(const APyFixedSpec& ff, const APyFixedSpec& fb)
+{
+    const int frac_bits = std::max(ff.bits - ff.int_bits, fb.bits - fb.int_bits);
+    const int int_bits = std::max(ff.int_bits, fb.int_bits) + 1;
+    return { int_bits + frac_bits, int_bits };
+}
+
+FixedPointBiquad::FixedPointBiquad(
+    const APyFixedSpec& src_spec,
+    const APyFixedSpec& coef_spec,
+    const apy_limb_t* coef,
+    const FixedPointBiquadFormat& format
+)
+    : src_limbs { bits_to_limbs(src_spec.bits) }
+    , dst_limbs { bits_to_limbs(format.spec.bits) }
+    , coef_limbs { bits_to_limbs(coef_spec.bits) }
+    , acc_spec { biquad_acc_spec(
+          biquad_ff_spec(src_spec, coef_spec), biquad_fb_spec(format.spec, coef_spec)
+      ) }
+    , format { format }
+    , ff { src_spec, coef_spec, biquad_ff_spec(src_spec, coef_spec), std::nullopt }
+    , fb {
+        format.spec, coef_spec, biquad_fb_spec(format.spec, coef_spec), std::nullopt
+    }
+{
+    const APyFixedSpec ff_spec = biquad_ff_spec(src_spec, coef_spec);
+    const APyFixedSpec fb_spec = biquad_fb_spec(format.spec, coef_spec);
+    const int acc_frac_bits = acc_spec.bits - acc_spec.int_bits;
+    ff_limbs = bits_to_limbs(ff_spec.bits);
+    fb_limbs = bits_to_limbs(fb_spec.bits);
+    ff_shift = unsigned(acc_frac_bits - (ff_spec.bits - ff_spec.int_bits));
+    fb_shift = unsigned(acc_frac_bits - (fb_spec.bits - fb_spec.int_bits));
+
+    // The accumulator also holds the result of the quantization, which may have more
+    // fractional bits than the accumulator, and one spare bit for rounding
+    const int dst_frac_bits = format.spec.bits - format.spec.int_bits;
+    acc_limbs = bits_to_limbs(
+        acc_spec.int_bits + 1 + std::max(acc_frac_bits, dst_frac_bits)
+    );
+    is_single_limb = acc_limbs == 1;
+
+    b.resize(3 * coef_limbs);
+    a.resize(2 * coef_limbs);
+    for (std::size_t i = 0; i < 3; i++) {
+        auto dst = std::begin(b) + i * coef_limbs;
+        std::copy_n(coef + (2 - i) * coef_limbs, coef_limbs, dst);
+    }
+    for (std::size_t i = 0; i < 2; i++) {
+        auto dst = std::begin(a) + i * coef_limbs;
+        std::copy_n(coef + (5 - i) * coef_limbs, coef_limbs, dst);
+    }
+
+    ff_sum.resize(ff_limbs);
+    fb_sum.resize(fb_limbs);
+    acc.resize(acc_limbs);
+    acc_fb.resize(acc_limbs);
+}
+
+void FixedPointBiquad::operator()(CIt src, It dst, std::size_t n) const
+{
+    for (std::size_t t = 0; t < n; t++) {
+        const CIt x = src + t * src_limbs;
+        const It y = dst + t * dst_limbs;
+        if (is_single_limb) {
+            // All products and sums fit in a single limb
+            apy_limb_t ff_acc = 0;
+            apy_limb_t fb_acc = 0;
+            for (std::size_t i = 0; i < 3; i++) {
+                ff_acc += apy_limb_t(apy_limb_signed_t(x[i]) * apy_limb_signed_t(b[i]));
+            }
+            for (std::size_t i = 0; i < 2; i++) {
+                fb_acc += apy_limb_t(apy_limb_signed_t(y[i]) * apy_limb_signed_t(a[i]));
+            }
+            acc[0] = (ff_acc << ff_shift) - (fb_acc << fb_shift);
+        } else {
+            ff(x, std::cbegin(b), std::begin(ff_sum), 3);
+            fb(y, std::cbegin(a), std::begin(fb_sum), 2);
+            _cast_no_quantize_no_overflow(
+                std::cbegin(ff_sum),
+                std::cend(ff_sum),
+                std::begin(acc),
+                std::end(acc),
+                ff_shift
+            );
+            _cast_no_quantize_no_overflow(
+                std::cbegin(fb_sum),
+                std::cend(fb_sum),
+                std::begin(acc_fb),
+                std::end(acc_fb),
+                fb_shift
+            );
+            apy_subtraction_same_length(
+                acc.data(), acc.data(), acc_fb.data(), acc_limbs
+            );
+        }
+
+        // Quantize and overflow the exact result once, to the output format
+        quantize(
+            std::begin(acc),
+            std::end(acc),
+            acc_spec.bits,
+            acc_spec.int_bits,
+            format.spec.bits,
+            format.spec.int_bits,
+            format.quantization,
+            rnd64_fx
+        );
+        overflow(
+            std::begin(acc),
+            std::end(acc),
+            format.spec.bits,
+            format.spec.int_bits,
+            format.overflow
+        );
+        std::copy_n(std::cbegin(acc), dst_limbs, y + 2 * dst_limbs);
+    }
+}
+
+/* ********************************************************************************** *
+ * *                      Floating-point second-order section                       * *
+ * ********************************************************************************** */
+
+FloatingPointBiquad::FloatingPointBiquad(
+    const APyFloatSpec& src_spec,
+    const APyFloatSpec& coef_spec,
+    const APyFloatData* coef,
+    const FloatingPointBiquadFormat& format
+)
+    : b { coef[2], coef[1], coef[0] }
+    , a { coef[5], coef[4] }
+    , ff { src_spec, coef_spec, format.spec, format.quantization }
+    , fb { format.spec, coef_spec, format.spec, format.quantization }
+    , sub { format.spec, format.spec, format.spec, format.quantization }
+{
+}
+
+void FloatingPointBiquad::operator()(CIt src, It dst, std::size_t n) const
+{
+    for (std::size_t t = 0; t < n; t++) {
+        APyFloatData ff_sum, fb_sum;
+        ff(&src[t], b, &ff_sum, 3);
+        fb(&dst[t], a, &fb_sum, 2);
+        sub(&ff_sum, &fb_sum, &dst[t + 2]);
+    }
+}
+
+/* ********************************************************************************** *
+ * *                                   IIR filters                                  * *
+ * ********************************************************************************** */
+
+template <typename ARRAY_TYPE>
+IIRFilter<ARRAY_TYPE>::IIRFilter(const IIRSections_t<ARRAY_TYPE>& sos)
+{
+    // Copy the six coefficients of row `row` of `arr`
+    const auto add_section = [&](const ARRAY_TYPE& arr, std::size_t row) {
+        const std::size_t itemsize = traits::itemsize(arr.spec());
+        const T* src = arr.data() + row * 6 * itemsize;
+        _coef_specs.push_back(arr.spec());
+        _coefs.emplace_back(src, src + 6 * itemsize);
+    };
+
+    if (std::holds_alternative<ARRAY_TYPE>(sos)) {
+        const ARRAY_TYPE& arr = std::get<ARRAY_TYPE>(sos);
+        if (arr.ndim() != 2 || arr.shape()[1] != 6) {
+            auto msg = fmt::format(
+                "{}: `sos` must have shape (n_sections, 6), got {}",
+                traits::NAME,
+                tuple_string_from_vec(arr.shape())
+            );
+            throw nb::value_error(msg.c_str());
+        }
+        for (std::size_t s = 0; s < arr.shape()[0]; s++) {
+            add_section(arr, s);
+        }
+    } else {
+        const std::vector<ARRAY_TYPE>& arrs = std::get<std::vector<ARRAY_TYPE>>(sos);
+        for (std::size_t s = 0; s < arrs.size(); s++) {
+            if (arrs[s].ndim() != 1 || arrs[s].shape()[0] != 6) {
+                auto msg = fmt::format(
+                    "{}: section {} must have shape (6,), got {}",
+                    traits::NAME,
+                    s,
+                    tuple_string_from_vec(arrs[s].shape())
+                );
+                throw nb::value_error(msg.c_str());
+            }
+            add_section(arrs[s], 0);
+        }
+    }
+
+    if (_coefs.empty()) {
+        auto msg
+            = fmt::format("{}: `sos` must have at least one section", traits::NAME);
+        throw nb::value_error(msg.c_str());
+    }
+    for (std::size_t s = 0; s < _coefs.size(); s++) {
+        const std::size_t itemsize = traits::itemsize(_coef_specs[s]);
+        if (!traits::is_one(_coefs[s].data() + 3 * itemsize, _coef_specs[s])) {
+            auto msg = fmt::format(
+                "{}: coefficient `a0` of section {} must be one", traits::NAME, s
+            );
+            throw nb::value_error(msg.c_str());
+        }
+    }
+}
+
+template <typename ARRAY_TYPE>
+void IIRFilter<ARRAY_TYPE>::initialize(
+    const spec_type& in_spec, const std::vector<std::size_t>& channel_shape
+)
+{
+    _in_spec = in_spec;
+    _channel_shape = channel_shape;
+
+    // Each section takes the output of the previous one as input
+    _sections.clear();
+    _itemsize = { traits::itemsize(in_spec) };
+    spec_type src_spec = in_spec;
+    for (std::size_t s = 0; s < n_sections(); s++) {
+        _sections.emplace_back(src_spec, _coef_specs[s], _coefs[s].data(), _formats[s]);
+        src_spec = _formats[s].spec;
+        _itemsize.push_back(traits::itemsize(src_spec));
+    }
+    _max_itemsize = *std::max_element(std::begin(_itemsize), std::end(_itemsize));
+
+    // The streams are preceded by zeros
+    _state_offset.resize(_itemsize.size());
+    _state_size = 0;
+    for (std::size_t s = 0; s < _itemsize.size(); s++) {
+        _state_offset[s] = _state_size;
+        _state_size += 2 * _itemsize[s];
+    }
+    _state.assign(fold_shape(channel_shape) * _state_size, T {});
+}
+
+template <typename ARRAY_TYPE>
+ARRAY_TYPE IIRFilter<ARRAY_TYPE>::process(const ARRAY_TYPE& x, int axis)
+{
+    const int ndim = int(x.ndim());
+    if (axis < -ndim || axis >= ndim) {
+        auto msg = fmt::format(
+            "{}.process: axis {} out of range (ndim = {})", traits::NAME, axis, ndim
+        );
+        throw nb::index_error(msg.c_str());
+    }
+    const std::size_t ax = std::size_t(axis < 0 ? axis + ndim : axis);
+
+    std::vector<std::size_t> channel_shape = x.shape();
+    channel_shape.erase(std::begin(channel_shape) + ax);
+    if (!_in_spec.has_value()) {
+        initialize(x.spec(), channel_shape);
+    } else if (!traits::same_spec(*_in_spec, x.spec())
+               || channel_shape != _channel_shape) {
+        auto msg = fmt::format(
+            "{}.process: input format or channel shape differs from that of the "
+            "previous blocks, use `reset()` to start new streams",
+            traits::NAME
+        );
+        throw nb::value_error(msg.c_str());
+    }
+
+    ARRAY_TYPE result = traits::make_array(x.shape(), _formats.back().spec);
+
+    // Each channel is a stream of `n` items, `inner` items apart
+    const std::size_t n = x.shape()[ax];
+    const std::size_t inner = strides_from_shape(x.shape())[ax];
+    const std::size_t n_channels = fold_shape(channel_shape);
+    const std::size_t n_mac = n_channels * n * n_sections() * 5;
+    const T* src_data = x.data();
+    T* dst_data = result.data();
+
+    const bool is_stochastic = std::any_of(
+        std::begin(_formats), std::end(_formats), traits::is_stochastic
+    );
+    const bool use_threadpool = n_mac >= traits::n_mac_threshold() && !is_stochastic;
+    const GILRelease gil_release(n_mac);
+    threadpool_chunked_for(use_threadpool, n_channels, [&](auto begin, auto end) {
+        // Each worker uses its own copy of the sections and their scratch data
+        const std::vector<section_type> sections = _sections;
+        std::vector<T> src((n + 2) * _max_itemsize);
+        std::vector<T> dst((n + 2) * _max_itemsize);
+        for (std::size_t c = begin; c < end; c++) {
+            const std::size_t first = (c / inner) * n * inner + c % inner;
+            T* state = _state.data() + c * _state_size;
+
+            // Gather the input, preceded by its two previous samples
+            std::size_t itemsize = _itemsize[0];
+            std::copy_n(state + _state_offset[0], 2 * itemsize, std::begin(src));
+            for (std::size_t i = 0; i < n; i++) {
+                std::copy_n(
+                    src_data + (first + i * inner) * itemsize,
+                    itemsize,
+                    std::begin(src) + (i + 2) * itemsize
+                );
+            }
+
+            // Filter through the sections, keeping the last two samples of each signal
+            for (std::size_t s = 0; s < sections.size(); s++) {
+                const std::size_t dst_itemsize = _itemsize[s + 1];
+                std::copy_n(
+                    state + _state_offset[s + 1], 2 * dst_itemsize, std::begin(dst)
+                );
+                sections[s](std::cbegin(src), std::begin(dst), n);
+                std::copy_n(
+                    std::cbegin(src) + n * itemsize,
+                    2 * itemsize,
+                    state + _state_offset[s]
+                );
+                std::swap(src, dst);
+                itemsize = dst_itemsize;
+            }
+            std::copy_n(
+                std::cbegin(src) + n * itemsize,
+                2 * itemsize,
+                state + _state_offset[sections.size()]
+            );
+
+            // Scatter the output
+            for (std::size_t i = 0; i < n; i++) {
+                std::copy_n(
+                    std::cbegin(src) + (i + 2) * itemsize,
+                    itemsize,
+                    dst_data + (first + i * inner) * itemsize
+                );
+            }
+        }
+    });
+
+    return result;
+}
+
+template <typename ARRAY_TYPE> void IIRFilter<ARRAY_TYPE>::reset() noexcept
+{
+    _in_spec.reset();
+    _channel_shape.clear();
+    _sections.clear();
+    _state.clear();
+}
+
+template class IIRFilter<APyFixedArray>;
+template class IIRFilter<APyFloatArray>;
+
+/* ********************************************************************************** *
+ * *                          Fixed- and floating-point IIR                         * *
+ * ********************************************************************************** */
+
+//! Resolve a per-section parameter of the IIR filters into one value per section
+template <typename T>
+static std::vector<T> iir_section_values(
+    const IIRSectionParam_t<T>& param,
+    std::size_t n_sections,
+    std::string_view name,
+    std::string_view param_name
+)
+{
+    if (std::holds_alternative<T>(param)) {
+        return std::vector<T>(n_sections, std::get<T>(param));
+    }
+    const std::vector<T>& values = std::get<std::vector<T>>(param);
+    if (values.size() != n_sections) {
+        auto msg = fmt::format(
+            "{}: `{}` has {} values, but the filter has {} sections",
+            name,
+            param_name,
+            values.size(),
+            n_sections
+        );
+        throw nb::value_error(msg.c_str());
+    }
+    return values;
+}
+
+FixedPointIIR::FixedPointIIR(
+    const IIRSections_t<APyFixedArray>& sos,
+    const IIRSectionParam_t<int>& int_bits,
+    const IIRSectionParam_t<int>& frac_bits,
+    const std::optional<IIRSectionParam_t<QuantizationMode>>& quantization,
+    const std::optional<IIRSectionParam_t<OverflowMode>>& overflow
+)
+    : IIRFilter<APyFixedArray>(sos)
+{
+    const std::string_view name = traits::NAME;
+    const std::size_t n = n_sections();
+    const APyFixedCastOption cast_option = get_fixed_cast_mode();
+    const auto section_int_bits = iir_section_values(int_bits, n, name, "int_bits");
+    const auto section_frac_bits = iir_section_values(frac_bits, n, name, "frac_bits");
+    const auto section_quantization = iir_section_values(
+        quantization.value_or(cast_option.quantization), n, name, "quantization"
+    );
+    const auto section_overflow = iir_section_values(
+        overflow.value_or(cast_option.overflow), n, name, "overflow"
+    );
+
+    for (std::size_t s = 0; s < n; s++) {
+        const int bits = section_int_bits[s] + section_frac_bits[s];
+        if (bits <= 0) {
+            auto msg = fmt::format(
+                "{}: section {} has a non-positive number of bits ({})", name, s, bits
+            );
+            throw nb::value_error(msg.c_str());
+        }
+        _formats.push_back({ { bits, section_int_bits[s] },
+                             section_quantization[s],
+                             section_overflow[s] });
+    }
+}
+
+FloatingPointIIR::FloatingPointIIR(
+    const IIRSections_t<APyFloatArray>& sos,
+    const IIRSectionParam_t<int>& exp_bits,
+    const IIRSectionParam_t<int>& man_bits,
+    const std::optional<IIRSectionParam_t<exp_t>>& bias,
+    const std::optional<IIRSectionParam_t<QuantizationMode>>& quantization
+)
+    : IIRFilter<APyFloatArray>(sos)
+{
+    const std::string_view name = traits::NAME;
+    const std::size_t n = n_sections();
+    const auto section_exp_bits = iir_section_values(exp_bits, n, name, "exp_bits");
+    const auto section_man_bits = iir_section_values(man_bits, n, name, "man_bits");
+    const auto section_quantization = iir_section_values(
+        quantization.value_or(get_float_quantization_mode()), n, name, "quantization"
+    );
+    std::vector<exp_t> section_bias;
+    if (bias.has_value()) {
+        section_bias = iir_section_values(*bias, n, name, "bias");
+    }
+
+    for (std::size_t s = 0; s < n; s++) {
+        const std::uint8_t e = check_exponent_format(section_exp_bits[s], name);
+        const std::uint8_t m = check_mantissa_format(section_man_bits[s], name);
+        const exp_t b = bias.has_value() ? section_bias[s] : ieee_bias(e);
+        _formats.push_back({ { e, m, b }, section_quantization[s] });
+    }
+}
@@ -0,0 +1,316 @@
+/*
+ * Stateful bit-true IIR filters, evaluated as cascades of second-order sections
+ * (biquads). Each section has its own coefficient format, and its own output format,
+ * quantization, and overflow. The state of each section, its two previous inputs and
+ * outputs, is held per channel, so that any number of independent channels can be
+ * filtered one block at a time. The channels are split over the thread pool.
+ */
+
+#ifndef _APYIIR_H
+#define _APYIIR_H
+
+#include "apyfixed_util.h"
+#include "apyfixedarray.h"
+#include "apyfloat_util.h"
+#include "apyfloatarray.h"
+#include "apytypes_common.h"
+#include "apytypes_fwd.h"
+#include "apytypes_util.h"
+
+#include <cstddef>     // std::size_t
+#include <optional>    // std::optional
+#include <string_view> // std::string_view
+#include <variant>     // std::variant
+#include <vector>      // std::vector
+
+//! A per-section parameter of the IIR filters: either a single value for all sections,
+//! or one value per section
+template <typename T> using IIRSectionParam_t = std::variant<T, std::vector<T>>;
+
+//! Second-order sections `[b0, b1, b2, a0, a1, a2]`, either as a single array of shape
+//! `(n_sections, 6)`, or as one array of shape `(6,)` per section
+template <typename ARRAY_TYPE>
+using IIRSections_t = std::variant<ARRAY_TYPE, std::vector<ARRAY_TYPE>>;
+
+/* ********************************************************************************** *
+ * *                        Fixed-point second-order section                        * *
+ * ********************************************************************************** */
+
+//! Output format, quantization, and overflow of a `FixedPointBiquad`
+struct FixedPointBiquadFormat {
+    APyFixedSpec spec;
+    QuantizationMode quantization;
+    OverflowMode overflow;
+};
+
+/*!
+ * Bit-true fixed-point second-order section in direct form I. The output
+ *
+ *     y[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] - a1 * y[n-1] - a2 * y[n-2]
+ *
+ * is computed exactly, and is then quantized and overflowed once to the output format.
+ * The coefficient `a0` must be one.
+ */
+class FixedPointBiquad {
+public:
+    using It = std::vector<apy_limb_t>::iterator;
+    using CIt = std::vector<apy_limb_t>::const_iterator;
+
+    //! Create a section with input format `src_spec`, from the six coefficients of
+    //! format `coef_spec` at `coef`
+    FixedPointBiquad(
+        const APyFixedSpec& src_spec,
+        const APyFixedSpec& coef_spec,
+        const apy_limb_t* coef,
+        const FixedPointBiquadFormat& format
+    );
+
+    //! Filter `n` samples. The input `src` holds the two previous inputs followed by
+    //! the `n` new inputs. The output `dst` holds the two previous outputs, and the `n`
+    //! new outputs are written after them.
+    void operator()(CIt src, It dst, std::size_t n) const;
+
+private:
+    std::size_t src_limbs, dst_limbs, coef_limbs, acc_limbs;
+    APyFixedSpec acc_spec;
+    FixedPointBiquadFormat format;
+
+    //! Feed-forward `[b2, b1, b0]` and feedback `[a2, a1]` coefficients, time-reversed
+    //! to line up with the oldest sample first
+    std::vector<apy_limb_t> b, a;
+
+    //! Exact feed-forward and feedback sums, and their left shifts to the accumulator
+    FixedPointInnerProduct ff, fb;
+    std::size_t ff_limbs, fb_limbs;
+    unsigned ff_shift, fb_shift;
+
+    //! Single-limb accumulator, evaluated with native integer arithmetic
+    bool is_single_limb;
+
+    mutable std::vector<apy_limb_t> ff_sum, fb_sum, acc, acc_fb;
+};
+
+/* ********************************************************************************** *
+ * *                      Floating-point second-order section                       * *
+ * ********************************************************************************** */
+
+//! Output format and quantization of a `FloatingPointBiquad`
+struct FloatingPointBiquadFormat {
+    APyFloatSpec spec;
+    QuantizationMode quantization;
+};
+
+/*!
+ * Bit-true floating-point second-order section in direct form I. The feed-forward sum
+ * `b2 * x[n-2] + b1 * x[n-1] + b0 * x[n]` and the feedback sum
+ * `a2 * y[n-2] + a1 * y[n-1]` are evaluated as inner products in the output format,
+ * oldest sample first, and the output is their difference. The coefficient `a0` must be
+ * one.
+ */
+class FloatingPointBiquad {
+public:
+    using It = std::vector<APyFloatData>::iterator;
+    using CIt = std::vector<APyFloatData>::const_iterator;
+
+    //! Create a section with input format `src_spec`, from the six coefficients of
+    //! format `coef_spec` at `coef`
+    FloatingPointBiquad(
+        const APyFloatSpec& src_spec,
+        const APyFloatSpec& coef_spec,
+        const APyFloatData* coef,
+        const FloatingPointBiquadFormat& format
+    );
+
+    //! Filter `n` samples, laid out as for `FixedPointBiquad`
+    void operator()(CIt src, It dst, std::size_t n) const;
+
+private:
+    APyFloatData b[3], a[2];
+    FloatingPointInnerProduct ff, fb;
+    FloatingPointSubtractor<> sub;
+};
+
+/* ********************************************************************************** *
+ * *                                IIR filter traits                               * *
+ * ********************************************************************************** */
+
+//! Formats and sections of the IIR filters over arrays of type `ARRAY_TYPE`
+template <typename ARRAY_TYPE> struct IIRTraits;
+
+template <> struct IIRTraits<APyFixedArray> {
+    static constexpr auto NAME = std::string_view("APyFixedIIR");
+    using spec_type = APyFixedSpec;
+    using format_type = FixedPointBiquadFormat;
+    using section_type = FixedPointBiquad;
+
+    static std::size_t itemsize(const spec_type& spec)
+    {
+        return bits_to_limbs(spec.bits);
+    }
+
+    static bool same_spec(const spec_type& a, const spec_type& b)
+    {
+        return a.bits == b.bits && a.int_bits == b.int_bits;
+    }
+
+    //! Test if the item at `src` is exactly one
+    static bool is_one(const apy_limb_t* src, const spec_type& spec)
+    {
+        const int frac_bits = spec.bits - spec.int_bits;
+        if (frac_bits < 0 || spec.int_bits < 2) {
+            return false; // one is not representable
+        }
+        for (std::size_t i = 0; i < itemsize(spec); i++) {
+            const bool is_one_limb = i == std::size_t(frac_bits) / APY_LIMB_SIZE_BITS;
+            const apy_limb_t one = apy_limb_t(1) << (frac_bits % APY_LIMB_SIZE_BITS);
+            if (src[i] != (is_one_limb ? one : apy_limb_t(0))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool is_stochastic(const format_type& format)
+    {
+        return is_stochastic_quantization(format.quantization);
+    }
+
+    static std::size_t n_mac_threshold()
+    {
+        return thread_pool_settings.apyfixedarray.n_mac_threshold;
+    }
+
+    static APyFixedArray
+    make_array(const std::vector<std::size_t>& shape, const spec_type& spec)
+    {
+        return APyFixedArray(shape, spec.bits, spec.int_bits);
+    }
+};
+
+template <> struct IIRTraits<APyFloatArray> {
+    static constexpr auto NAME = std::string_view("APyFloatIIR");
+    using spec_type = APyFloatSpec;
+    using format_type = FloatingPointBiquadFormat;
+    using section_type = FloatingPointBiquad;
+
+    static std::size_t itemsize(const spec_type&) { return 1; }
+
+    static bool same_spec(const spec_type& a, const spec_type& b) { return a == b; }
+
+    //! Test if the item at `src` is exactly one
+    static bool is_one(const APyFloatData* src, const spec_type& spec)
+    {
+        return !src->sign && src->man == 0 && src->exp == spec.bias;
+    }
+
+    static bool is_stochastic(const format_type& format)
+    {
+        return is_stochastic_quantization(format.quantization);
+    }
+
+    static std::size_t n_mac_threshold()
+    {
+        return thread_pool_settings.apyfloatarray.n_mac_threshold;
+    }
+
+    static APyFloatArray
+    make_array(const std::vector<std::size_t>& shape, const spec_type& spec)
+    {
+        return APyFloatArray(shape, spec.exp_bits, spec.man_bits, spec.bias);
+    }
+};
+
+/* ********************************************************************************** *
+ * *                                   IIR filters                                  * *
+ * ********************************************************************************** */
+
+/*!
+ * Streaming IIR filter over arrays of type `ARRAY_TYPE`, as a cascade of second-order
+ * sections. Each channel, i.e., each one-dimensional slice along the filtered axis,
+ * has its own state. The input format and the shape of the channels are set by the
+ * first block after construction or `reset()`. The output format is that of the last
+ * section.
+ */
+template <typename ARRAY_TYPE> class IIRFilter {
+public:
+    using traits = IIRTraits<ARRAY_TYPE>;
+    using T = typename ARRAY_TYPE::vector_type::value_type;
+    using spec_type = typename traits::spec_type;
+    using format_type = typename traits::format_type;
+    using section_type = typename traits::section_type;
+
+    //! Filter the next block `x` of the input streams along `axis`. Throws
+    //! `nb::index_error` if `axis` is out of range, and `nb::value_error` if the format
+    //! of `x` or the shape of its channels differs from that of the previous blocks.
+    ARRAY_TYPE process(const ARRAY_TYPE& x, int axis);
+
+    //! Clear the state, the input format, and the shape of the channels
+    void reset() noexcept;
+
+    std::size_t n_sections() const noexcept { return _coefs.size(); }
+
+protected:
+    //! Extract the sections of `sos`. Throws `nb::value_error` if `sos` has the wrong
+    //! shape or if a coefficient `a0` is not one. The derived class sets `_formats`.
+    explicit IIRFilter(const IIRSections_t<ARRAY_TYPE>& sos);
+
+    //! Output format, quantization, and overflow of each section
+    std::vector<format_type> _formats;
+
+private:
+    //! Set up the sections and the state for input format `in_spec`
+    void initialize(
+        const spec_type& in_spec, const std::vector<std::size_t>& channel_shape
+    );
+
+    //! Coefficient format and the six coefficients of each section
+    std::vector<spec_type> _coef_specs;
+    std::vector<std::vector<T>> _coefs;
+
+    //! Input format and shape of the channels, set by the first block
+    std::optional<spec_type> _in_spec;
+    std::vector<std::size_t> _channel_shape;
+    std::vector<section_type> _sections;
+
+    //! Item size of the input (signal 0) and of the output of each section (signal
+    //! `s + 1`), and the largest of them
+    std::vector<std::size_t> _itemsize;
+    std::size_t _max_itemsize;
+
+    //! The two previous samples of each signal of each channel. Signal `s` of a
+    //! channel starts at `_state_offset[s]`, and a channel spans `_state_size` items.
+    std::vector<T> _state;
+    std::vector<std::size_t> _state_offset;
+    std::size_t _state_size;
+};
+
+//! Fixed-point IIR filter with a per-section output format, quantization, and overflow
+class FixedPointIIR : public IIRFilter<APyFixedArray> {
+public:
+    //! Create a filter from second-order sections `sos`. The quantization and overflow
+    //! default to those of the fixed-point cast context active on construction.
+    FixedPointIIR(
+        const IIRSections_t<APyFixedArray>& sos,
+        const IIRSectionParam_t<int>& int_bits,
+        const IIRSectionParam_t<int>& frac_bits,
+        const std::optional<IIRSectionParam_t<QuantizationMode>>& quantization,
+        const std::optional<IIRSectionParam_t<OverflowMode>>& overflow
+    );
+};
+
+//! Floating-point IIR filter with a per-section output format and quantization
+class FloatingPointIIR : public IIRFilter<APyFloatArray> {
+public:
+    //! Create a filter from second-order sections `sos`. The bias defaults to the
+    //! IEEE-like bias, and the quantization to that of the floating-point quantization
+    //! context active on construction.
+    FloatingPointIIR(
+        const IIRSections_t<APyFloatArray>& sos,
+        const IIRSectionParam_t<int>& exp_bits,
+        const IIRSectionParam_t<int>& man_bits,
+        const std::optional<IIRSectionParam_t<exp_t>>& bias,
+        const std::optional<IIRSectionParam_t<QuantizationMode>>& quantization
+    );
+};
+
+#endif // _APYIIR_H
@@ -0,0 +1,208 @@
+#include "apyiir.h"
+
+#include <nanobind/nanobind.h>
+#include <nanobind/stl/optional.h>
+#include <nanobind/stl/variant.h>
+#include <nanobind/stl/vector.h>
+
+namespace nb = nanobind;
+
+/*
+ * Bind the methods shared by all the IIR filter classes
+ */
+template <typename IIR, typename ARRAY_TYPE>
+static void bind_iir_methods(nb::class_<IIR>& cls)
+{
+    cls.def(
+           "process",
+           [](IIR& self, const ARRAY_TYPE& x, int axis) {
+               return self.process(x, axis);
+           },
+           nb::arg("x"),
+           nb::arg("axis") = -1,
+           R"pbdoc(
+            Filter the next block of the input streams.
+
+            Each one-dimensional slice of `x` along `axis` is a block of an
+            independent channel, with its own filter state. The state carries over
+            between blocks, so filtering the streams block by block gives the same
+            result as filtering them all at once. Blocks may have any length along
+            `axis`, including zero. The format of the first block after creation or
+            :func:`reset`, and the shape of its channels, are kept for the following
+            blocks.
+
+            Parameters
+            ----------
+            x : array
+                The next block of input samples of each channel.
+            axis : :class:`int`, default: -1
+                Axis along which to filter.
+
+            Returns
+            -------
+            out : array of the same type and shape as `x`
+                The output samples of the block, in the format of the last section.
+
+            Raises
+            ------
+            :class:`ValueError`
+                If the format of `x`, or the shape of its channels, differs from that
+                of the previous blocks.
+            :class:`IndexError`
+                If `axis` is out of range.
+            )pbdoc"
+    )
+        .def(
+            "reset",
+            [](IIR& self) { self.reset(); },
+            R"pbdoc(
+            Clear the filter state, the input format, and the shape of the channels.
+
+            The next block is filtered as the start of new streams.
+            )pbdoc"
+        )
+        .def_prop_ro(
+            "n_sections",
+            [](const IIR& self) { return self.n_sections(); },
+            R"pbdoc(
+            Number of second-order sections.
+
+            Returns
+            -------
+            :class:`int`
+            )pbdoc"
+        );
+}
+
+void bind_iir(nb::module_& m)
+{
+    nb::class_<FixedPointIIR> fixed_iir(m, "APyFixedIIR", R"pbdoc(
+        Bit-true IIR filter for :class:`APyFixedArray` sample streams, as a cascade of
+        second-order sections.
+
+        Each section is evaluated in direct form I,
+
+        .. math::
+            y[n] = b_0 x[n] + b_1 x[n-1] + b_2 x[n-2] - a_1 y[n-1] - a_2 y[n-2],
+
+        where the right-hand side is computed exactly and is then quantized and
+        overflowed once, to the output format of the section. The output of each
+        section is the input of the next. Each section has its own coefficient format,
+        output format, quantization, and overflow, which makes the filter bit-true to
+        a hardware implementation with the same word lengths.
+
+        Any number of independent channels are filtered at once, and large blocks are
+        split over the channels on the thread pool.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        sos : :class:`APyFixedArray` or :class:`list` of :class:`APyFixedArray`
+            The second-order sections :code:`[b0, b1, b2, a0, a1, a2]`, in the layout
+            of :func:`scipy.signal.sosfilt`. Either a single array of shape
+            :code:`(n_sections, 6)`, or one array of shape :code:`(6,)` per section,
+            for per-section coefficient formats. The coefficient :code:`a0` must be
+            one.
+        int_bits : :class:`int` or :class:`list` of :class:`int`
+            Number of integer bits of the output of each section, either for all
+            sections or as one value per section.
+        frac_bits : :class:`int` or :class:`list` of :class:`int`
+            Number of fractional bits of the output of each section, either for all
+            sections or as one value per section.
+        quantization : :class:`QuantizationMode` or :class:`list` of \
+        :class:`QuantizationMode`, optional
+            Quantization mode of each section. Defaults to the quantization mode of
+            the :func:`set_fixed_cast_mode` context active on creation.
+        overflow : :class:`OverflowMode` or :class:`list` of \
+        :class:`OverflowMode`, optional
+            Overflow mode of each section. Defaults to the overflow mode of the
+            :func:`set_fixed_cast_mode` context active on creation.
+
+        Examples
+        --------
+        >>> import apytypes as apy
+        >>> sos = apy.fx([[0.5, 0, 0, 1, -0.5, 0]], int_bits=2, frac_bits=1)
+        >>> iir = apy.APyFixedIIR(
+        ...     sos, int_bits=3, frac_bits=3, quantization=apy.QuantizationMode.TRN
+        ... )
+        >>> iir.process(apy.fx([1, 0, 0, 0, 0], int_bits=2, frac_bits=0))
+        APyFixedArray([4, 2, 1, 0, 0], int_bits=3, frac_bits=3)
+
+        Rounding, instead of truncation, results in a limit cycle
+
+        >>> iir = apy.APyFixedIIR(
+        ...     sos, int_bits=3, frac_bits=3, quantization=apy.QuantizationMode.RND
+        ... )
+        >>> iir.process(apy.fx([1, 0, 0, 0, 0], int_bits=2, frac_bits=0))
+        APyFixedArray([4, 2, 1, 1, 1], int_bits=3, frac_bits=3)
+        )pbdoc");
+    fixed_iir.def(
+        nb::init<
+            const IIRSections_t<APyFixedArray>&,
+            const IIRSectionParam_t<int>&,
+            const IIRSectionParam_t<int>&,
+            const std::optional<IIRSectionParam_t<QuantizationMode>>&,
+            const std::optional<IIRSectionParam_t<OverflowMode>>&>(),
+        nb::arg("sos"),
+        nb::kw_only(),
+        nb::arg("int_bits"),
+        nb::arg("frac_bits"),
+        nb::arg("quantization") = nb::none(),
+        nb::arg("overflow") = nb::none()
+    );
+    bind_iir_methods<FixedPointIIR, APyFixedArray>(fixed_iir);
+
+    nb::class_<FloatingPointIIR> float_iir(m, "APyFloatIIR", R"pbdoc(
+        Bit-true IIR filter for :class:`APyFloatArray` sample streams, as a cascade of
+        second-order sections.
+
+        Each section is evaluated in direct form I. The feed-forward sum
+        :code:`b2 * x[n-2] + b1 * x[n-1] + b0 * x[n]` and the feedback sum
+        :code:`a2 * y[n-2] + a1 * y[n-1]` are accumulated in the output format of the
+        section, oldest sample first, and the output is their difference. The output
+        of each section is the input of the next.
+
+        Any number of independent channels are filtered at once, and large blocks are
+        split over the channels on the thread pool.
+
+        .. versionadded:: 0.6
+
+        Parameters
+        ----------
+        sos : :class:`APyFloatArray` or :class:`list` of :class:`APyFloatArray`
+            The second-order sections :code:`[b0, b1, b2, a0, a1, a2]`, in the layout
+            of :func:`scipy.signal.sosfilt`. Either a single array of shape
+            :code:`(n_sections, 6)`, or one array of shape :code:`(6,)` per section,
+            for per-section coefficient formats. The coefficient :code:`a0` must be
+            one.
+        exp_bits : :class:`int` or :class:`list` of :class:`int`
+            Number of exponent bits of the output of each section, either for all
+            sections or as one value per section.
+        man_bits : :class:`int` or :class:`list` of :class:`int`
+            Number of mantissa bits of the output of each section, either for all
+            sections or as one value per section.
+        bias : :class:`int` or :class:`list` of :class:`int`, optional
+            Exponent bias of the output of each section. Defaults to the IEEE-like
+            bias of each section.
+        quantization : :class:`QuantizationMode` or :class:`list` of \
+        :class:`QuantizationMode`, optional
+            Quantization mode of each section. Defaults to the
+            :func:`set_float_quantization_mode` context active on creation.
+        )pbdoc");
+    float_iir.def(
+        nb::init<
+            const IIRSections_t<APyFloatArray>&,
+            const IIRSectionParam_t<int>&,
+            const IIRSectionParam_t<int>&,
+            const std::optional<IIRSectionParam_t<exp_t>>&,
+            const std::optional<IIRSectionParam_t<QuantizationMode>>&>(),
+        nb::arg("sos"),
+        nb::kw_only(),
+        nb::arg("exp_bits"),
+        nb::arg("man_bits"),
+        nb::arg("bias") = nb::none(),
+        nb::arg("quantization") = nb::none()
+    );
+    bind_iir_methods<FloatingPointIIR, APyFloatArray>(float_iir);
+}
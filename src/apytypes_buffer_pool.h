@@ -0,0 +1,146 @@
+/*
+ * Thread-local pool of recycled array storage. While a buffer pool is active on a
+ * thread (see `APyBufferPoolContext`), the storage of every `CowVector` created and
+ * released on that thread is kept in the pool instead of being freed, and is handed
+ * out again to new `CowVector`s of similar size. This saves the heap allocation, and
+ * for result buffers that are fully overwritten (see `cow_no_init`), also the
+ * zero-initialization.
+ *
+ * The pool is an array of pointers in trivially destructible thread-local storage, so
+ * that storage released during thread or interpreter teardown never touches a
+ * destroyed pool.
+ */
+
+#ifndef _APYTYPES_BUFFER_POOL_H
+#define _APYTYPES_BUFFER_POOL_H
+
+#include <cstddef> // std::size_t
+
+//! Thread-local state shared by the buffer pools of all storage types
+struct BufferPoolState {
+    //! Maximum number of distinct storage types with recycled storage
+    static constexpr std::size_t MAX_STORAGE_TYPES = 8;
+
+    std::size_t depth;        // Number of active (nested) pool scopes
+    std::size_t max_bytes;    // Maximum number of cached bytes
+    std::size_t cached_bytes; // Currently cached bytes, over all storage types
+    void (*clear_fns[MAX_STORAGE_TYPES])() noexcept; // Clear functions of all pools
+    std::size_t n_clear_fns;
+};
+
+inline thread_local BufferPoolState buffer_pool_state {};
+
+//! Test if a buffer pool is active on the calling thread
+inline bool is_buffer_pool_active() noexcept { return buffer_pool_state.depth > 0; }
+
+//! Activate the buffer pool of the calling thread, caching at most `max_bytes` bytes.
+//! Returns the previous byte limit, to be passed to `exit_buffer_pool`.
+inline std::size_t enter_buffer_pool(std::size_t max_bytes) noexcept
+{
+    std::size_t previous_max_bytes = buffer_pool_state.max_bytes;
+    buffer_pool_state.max_bytes = max_bytes;
+    buffer_pool_state.depth++;
+    return previous_max_bytes;
+}
+
+//! Leave a buffer pool scope. Leaving the outermost scope frees all cached storage.
+inline void exit_buffer_pool(std::size_t previous_max_bytes) noexcept
+{
+    buffer_pool_state.max_bytes = previous_max_bytes;
+    if (--buffer_pool_state.depth == 0) {
+        for (std::size_t i = 0; i < buffer_pool_state.n_clear_fns; i++) {
+            buffer_pool_state.clear_fns[i]();
+        }
+        buffer_pool_state.cached_bytes = 0;
+    }
+}
+
+//! Thread-local pool of recycled storage objects (e.g., `std::vector`) of type
+//! `STORAGE`
+template <typename STORAGE> class BufferPool {
+public:
+    //! Maximum number of cached storage objects per thread
+    static constexpr std::size_t CAPACITY = 32;
+
+    //! Take cached storage with a capacity of at least `n` items, but no more than
+    //! twice that. Returns `nullptr` if no such storage is cached.
+    static STORAGE* take(std::size_t n) noexcept
+    {
+        if (!is_buffer_pool_active()) {
+            return nullptr;
+        }
+
+        BufferPool& pool = local();
+        std::size_t best = CAPACITY;
+        for (std::size_t i = 0; i < pool.n_entries; i++) {
+            std::size_t capacity = pool.entries[i]->capacity();
+            if (capacity >= n && capacity <= 2 * n
+                && (best == CAPACITY || capacity < pool.entries[best]->capacity())) {
+                best = i;
+            }
+        }
+        if (best == CAPACITY) {
+            return nullptr;
+        }
+
+        STORAGE* storage = pool.entries[best];
+        pool.entries[best] = pool.entries[--pool.n_entries];
+        buffer_pool_state.cached_bytes -= bytes(storage);
+        return storage;
+    }
+
+    //! Deleter of storage created while a pool is active. Keeps `storage` in the pool
+    //! of the calling thread if there is room for it, otherwise deletes it.
+    static void release(STORAGE* storage) noexcept
+    {
+        BufferPool& pool = local();
+        const std::size_t storage_bytes = bytes(storage);
+        if (is_buffer_pool_active() && pool.n_entries < CAPACITY
+            && buffer_pool_state.cached_bytes + storage_bytes
+                <= buffer_pool_state.max_bytes
+            && (pool.registered || register_clear_fn())) {
+            pool.entries[pool.n_entries++] = storage;
+            buffer_pool_state.cached_bytes += storage_bytes;
+        } else {
+            delete storage;
+        }
+    }
+
+private:
+    STORAGE* entries[CAPACITY];
+    std::size_t n_entries;
+    bool registered;
+
+    static BufferPool& local() noexcept
+    {
+        static thread_local BufferPool pool {};
+        return pool;
+    }
+
+    static std::size_t bytes(const STORAGE* storage) noexcept
+    {
+        return storage->capacity() * sizeof(typename STORAGE::value_type);
+    }
+
+    //! Register `clear` to be called when leaving the outermost pool scope
+    static bool register_clear_fn() noexcept
+    {
+        if (buffer_pool_state.n_clear_fns == BufferPoolState::MAX_STORAGE_TYPES) {
+            return false;
+        }
+        buffer_pool_state.clear_fns[buffer_pool_state.n_clear_fns++] = &clear;
+        local().registered = true;
+        return true;
+    }
+
+    static void clear() noexcept
+    {
+        BufferPool& pool = local();
+        for (std::size_t i = 0; i < pool.n_entries; i++) {
+            delete pool.entries[i];
+        }
+        pool.n_entries = 0;
+    }
+};
+
+#endif // _APYTYPES_BUFFER_POOL_H
@@ -192,5 +192,8 @@ ThreadPool thread_pool(
                                 : (0)
 );
 
+//! Mutex serializing the use of the global threadpool
+std::recursive_mutex thread_pool_mutex;
+
 //! The global thread pool settings
 ThreadPoolSettings thread_pool_settings {};
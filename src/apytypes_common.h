@@ -9,7 +9,9 @@
 #include <nanobind/ndarray.h>
 #include <nanobind/stl/function.h>
 
+#include <algorithm> // std::min
 #include <cstdint>  // std::uint32_t, uint64_t
+#include <mutex>    // std::recursive_mutex, std::unique_lock
 #include <optional> // std::optional
 #include <random>   // std::mt19937_64, std::random_device
 #include <utility>  // std::in_place_t
@@ -228,20 +230,111 @@ ThirdPartyArray<NB_ARGS...> make_third_party_ndarray(
 //! The global APyTypes threadpool
 extern ThreadPool thread_pool;
 
+//! Mutex serializing the use of the global threadpool. Array kernels release the GIL
+//! (see `GILRelease`), so jobs can be submitted from several Python threads at once,
+//! and waiting on the pool must only ever be done for the jobs of a single caller.
+extern std::recursive_mutex thread_pool_mutex;
+
+//! Lock `thread_pool_mutex` if `use_threadpool` is set
+[[nodiscard]] inline std::unique_lock<std::recursive_mutex>
+lock_thread_pool(bool use_threadpool)
+{
+    return use_threadpool ? std::unique_lock(thread_pool_mutex)
+                          : std::unique_lock<std::recursive_mutex>();
+}
+
 //! Array-specific thread settings class
 struct ArrayThreadSetting {
     std::size_t n_mac_threshold;
+    std::size_t n_elem_threshold;
 };
 
 //! Threadpool settings class
 struct ThreadPoolSettings {
-    ArrayThreadSetting apyfixedarray { /* n_mac_threshold = */ 10'000 };
-    ArrayThreadSetting apycfixedarray { /* n_mac_threshold = */ 2'500 };
-    ArrayThreadSetting apyfloatarray { /* n_mac_threshold = */ 5'000 };
-    ArrayThreadSetting apycfloatarray { /* n_mac_threshold = */ 1'000 };
+    ArrayThreadSetting apyfixedarray {
+        /* n_mac_threshold = */ 10'000, /* n_elem_threshold = */ 250'000
+    };
+    ArrayThreadSetting apycfixedarray {
+        /* n_mac_threshold = */ 2'500, /* n_elem_threshold = */ 100'000
+    };
+    ArrayThreadSetting apyfloatarray {
+        /* n_mac_threshold = */ 5'000, /* n_elem_threshold = */ 50'000
+    };
+    ArrayThreadSetting apycfloatarray {
+        /* n_mac_threshold = */ 1'000, /* n_elem_threshold = */ 25'000
+    };
 };
 
 //! Threadpool settings
 extern ThreadPoolSettings thread_pool_settings;
 
+/*!
+ * Test if a quantization mode draws from the thread-local random number generators.
+ * Kernels quantizing with such a mode are always evaluated on the calling thread, so
+ * that results are reproducible from the seed of that thread.
+ */
+[[maybe_unused, nodiscard]] static APY_INLINE bool
+is_stochastic_quantization(QuantizationMode q)
+{
+    return q == QuantizationMode::STOCH_WEIGHTED || q == QuantizationMode::STOCH_EQUAL;
+}
+
+/* ********************************************************************************** *
+ * *                  Releasing the Python global interpreter lock                  * *
+ * ********************************************************************************** */
+
+//! Minimum amount of work (elements, or multiply-accumulate operations) for which the
+//! array kernels release the GIL
+constexpr std::size_t GIL_RELEASE_THRESHOLD = 4096;
+
+/*!
+ * Release the Python global interpreter lock (GIL) for the lifetime of the object, so
+ * that other Python threads run while an array kernel works on its data. The GIL is
+ * only released if the calling thread holds it and `work` is at least
+ * `GIL_RELEASE_THRESHOLD`, so nested scopes are fine. Code in the scope must not touch
+ * any Python object, but may throw C++ exceptions, as the GIL is re-acquired during
+ * stack unwinding. Operands must not be modified by other threads while the GIL is
+ * released.
+ */
+class GILRelease {
+public:
+    explicit GILRelease(std::size_t work)
+    {
+        if (work >= GIL_RELEASE_THRESHOLD && PyGILState_Check()) {
+            _release.emplace();
+        }
+    }
+
+private:
+    std::optional<nanobind::gil_scoped_release> _release;
+};
+
+/*!
+ * Evaluate `f(begin, end)` over the element range `[0, n)`, with the GIL released for
+ * large `n`. If `use_threadpool` is set, the range is split into one contiguous chunk
+ * per worker and the chunks are evaluated on the global threadpool. Calls made from
+ * within a threadpool worker are always evaluated sequentially on the calling thread
+ * to avoid waiting on the pool from inside the pool. The function `f` must not throw
+ * and must not touch any Python object.
+ */
+template <typename F>
+void threadpool_chunked_for(bool use_threadpool, std::size_t n, const F& f)
+{
+    const GILRelease gil_release(n);
+    use_threadpool &= APYTYPES_THREADPOOL_ENABLED && n >= 2
+        && !ThisThread::get_pool().has_value();
+    const auto pool_lock = lock_thread_pool(use_threadpool);
+    const std::size_t n_threads = thread_pool.get_thread_count();
+    if (!use_threadpool || n_threads < 2) {
+        f(std::size_t(0), n);
+        return;
+    }
+
+    const std::size_t n_chunks = std::min(n_threads, n);
+    thread_pool.detach_loop(std::size_t(0), n_chunks, [&](std::size_t chunk) {
+        f(chunk * n / n_chunks, (chunk + 1) * n / n_chunks);
+    });
+    thread_pool.wait();
+}
+
 #endif // _APYTYPES_COMMON_H
@@ -1,5 +1,6 @@
 #include "apytypes_context.h"
 #include "apyfloat_util.h"
+#include "apytypes_buffer_pool.h"
 #include "apytypes_common.h"
 
 // Python object access through Pybind
@@ -161,3 +162,20 @@ void APyFixedAccumulatorContext::exit_context()
 {
     set_accumulator_mode_fixed(previous_mode);
 }
+
+/* ********************************************************************************** *
+ * *                              Buffer pool context                               * *
+ * ********************************************************************************** */
+
+APyBufferPoolContext::APyBufferPoolContext(std::size_t max_bytes)
+    : context_max_bytes(max_bytes)
+{
+    // Previous state must be captured on `enter_context()`
+}
+
+void APyBufferPoolContext::enter_context()
+{
+    previous_max_bytes = enter_buffer_pool(context_max_bytes);
+}
+
+void APyBufferPoolContext::exit_context() { exit_buffer_pool(previous_max_bytes); }
@@ -3,6 +3,7 @@
 
 #include "apytypes_common.h"
 
+#include <cstddef>
 #include <optional>
 
 //! Base class defining the interface for contexts
@@ -95,4 +96,19 @@ private:
     std::optional<APyFixedAccumulatorOption> previous_mode, context_mode;
 };
 
+/* ********************************************************************************** *
+ * *                              Buffer pool context                               * *
+ * ********************************************************************************** */
+
+// Recycle array storage between operations on the calling thread
+class APyBufferPoolContext : public ContextManager {
+public:
+    APyBufferPoolContext(std::size_t max_bytes = std::size_t(1) << 28);
+    void enter_context() override;
+    void exit_context() override;
+
+private:
+    std::size_t context_max_bytes, previous_max_bytes;
+};
+
 #endif // _APYTYPES_CONTEXT_H
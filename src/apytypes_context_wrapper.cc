@@ -116,3 +116,17 @@ void bind_accumulator_context(nb::module_& m)
             nb::arg("traceback") = nb::none()
         );
 }
+
+void bind_buffer_pool_context(nb::module_& m)
+{
+    nb::class_<APyBufferPoolContext, ContextManager>(m, "APyBufferPoolContext")
+        .def(nb::init<std::size_t>(), nb::arg("max_bytes") = std::size_t(1) << 28)
+        .def("__enter__", &context_enter_handler)
+        .def(
+            "__exit__",
+            &context_exit_handler,
+            nb::arg("exc_type") = nb::none(),
+            nb::arg("exc_value") = nb::none(),
+            nb::arg("traceback") = nb::none()
+        );
+}
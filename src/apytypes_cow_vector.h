@@ -0,0 +1,354 @@
+/*
+ * Copy-on-write vector used as the underlying storage of APyTypes arrays. Copies of a
+ * `CowVector` share their storage, and a `CowVector` can be a contiguous view into a
+ * sub-range of another. The shared storage is duplicated on the first mutable access
+ * of a sharing vector. The iterators are those of the underlying `std::vector`, so a
+ * `CowVector` can be used wherever iterators into `std::vector` are expected.
+ *
+ * Mutable access to a possibly shared `CowVector` must be made from a single thread.
+ *
+ * While a buffer pool is active on the calling thread (see `apytypes_buffer_pool.h`),
+ * new storage is recycled from, and released storage is returned to, that pool.
+ */
+
+#ifndef _APYTYPES_COW_VECTOR_H
+#define _APYTYPES_COW_VECTOR_H
+
+#include <algorithm>        // std::copy_n, std::equal
+#include <cassert>          // assert
+#include <cstddef>          // std::size_t, std::ptrdiff_t
+#include <initializer_list> // std::initializer_list
+#include <iterator>         // std::reverse_iterator
+#include <memory>           // std::allocator, std::shared_ptr, std::make_shared
+#include <type_traits>      // std::enable_if_t, std::is_convertible_v
+#include <utility>          // std::move, std::exchange
+#include <vector>           // std::vector
+
+#include "apytypes_buffer_pool.h"
+
+//! Tag for constructing a `CowVector` whose items are left unspecified, for storage
+//! that is fully overwritten before being read
+struct cow_no_init_t {
+    explicit cow_no_init_t() = default;
+};
+inline constexpr cow_no_init_t cow_no_init {};
+
+template <
+    typename T,                             // Item type stored in `CowVector`
+    typename Allocator = std::allocator<T>> // Allocator of the underlying storage
+class CowVector {
+public:
+    using storage_type = std::vector<T, Allocator>;
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = typename storage_type::iterator;
+    using const_iterator = typename storage_type::const_iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /* ****************************************************************************** *
+     * *                               Constructors                                 * *
+     * ****************************************************************************** */
+
+    CowVector() noexcept = default;
+
+    explicit CowVector(size_type n)
+        : CowVector(make_storage(n, /* zero_init = */ true))
+    {
+    }
+
+    //! Construct a vector of `n` items with unspecified values
+    CowVector(size_type n, cow_no_init_t)
+        : CowVector(make_storage(n, /* zero_init = */ false))
+    {
+    }
+
+    CowVector(size_type n, const T& value)
+        : CowVector(std::make_shared<storage_type>(n, value))
+    {
+    }
+
+    template <
+        typename InputIt,
+        typename = std::enable_if_t<std::is_convertible_v<
+            typename std::iterator_traits<InputIt>::iterator_category,
+            std::input_iterator_tag>>>
+    CowVector(InputIt first, InputIt last)
+        : CowVector(std::make_shared<storage_type>(first, last))
+    {
+    }
+
+    CowVector(std::initializer_list<T> list)
+        : CowVector(std::make_shared<storage_type>(list))
+    {
+    }
+
+    //! Steal the data of a `std::vector`
+    CowVector(storage_type&& vec)
+        : CowVector(std::make_shared<storage_type>(std::move(vec)))
+    {
+    }
+
+    //! Copies share the storage, unless the storage has been exported through a raw
+    //! pointer (see `mark_exported()`), in which case the data is copied immediately
+    CowVector(const CowVector& other)
+        : _storage { other._storage }
+        , _ptr { other._ptr }
+        , _size { other._size }
+    {
+        if (other._exported) {
+            _storage = std::make_shared<storage_type>(other.cbegin(), other.cend());
+            _ptr = _storage->data();
+        } else if (_storage) {
+            _shared = other._shared = true;
+        }
+    }
+
+    CowVector(CowVector&& other) noexcept
+        : _storage { std::move(other._storage) }
+        , _ptr { std::exchange(other._ptr, nullptr) }
+        , _size { std::exchange(other._size, 0) }
+        , _shared { std::exchange(other._shared, false) }
+        , _exported { std::exchange(other._exported, false) }
+    {
+    }
+
+    CowVector& operator=(const CowVector& other)
+    {
+        if (this != &other) {
+            *this = CowVector(other);
+        }
+        return *this;
+    }
+
+    CowVector& operator=(CowVector&& other) noexcept
+    {
+        _storage = std::move(other._storage);
+        _ptr = std::exchange(other._ptr, nullptr);
+        _size = std::exchange(other._size, 0);
+        _shared = std::exchange(other._shared, false);
+        _exported = std::exchange(other._exported, false);
+        return *this;
+    }
+
+    /* ****************************************************************************** *
+     * *                     Read access (never copies any data)                    * *
+     * ****************************************************************************** */
+
+    size_type size() const noexcept { return _size; }
+    bool empty() const noexcept { return _size == 0; }
+
+    const_iterator cbegin() const noexcept
+    {
+        return _storage ? _storage->cbegin() + offset() : const_iterator {};
+    }
+    const_iterator cend() const noexcept { return cbegin() + _size; }
+    const_iterator begin() const noexcept { return cbegin(); }
+    const_iterator end() const noexcept { return cend(); }
+    const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator(cend());
+    }
+    const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator(cbegin());
+    }
+    const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    const_reverse_iterator rend() const noexcept { return crend(); }
+
+    const T* data() const noexcept { return _ptr; }
+    const T& operator[](size_type i) const noexcept { return data()[i]; }
+    const T& front() const noexcept { return data()[0]; }
+    const T& back() const noexcept { return data()[_size - 1]; }
+
+    /* ****************************************************************************** *
+     * *           Mutable access (copies the data if the storage is shared)        * *
+     * ****************************************************************************** */
+
+    iterator begin()
+    {
+        make_unique();
+        return _storage ? _storage->begin() + offset() : iterator {};
+    }
+    iterator end() { return begin() + _size; }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+
+    T* data()
+    {
+        make_unique();
+        return _ptr;
+    }
+    T& operator[](size_type i) { return data()[i]; }
+    T& front() { return data()[0]; }
+    T& back() { return data()[_size - 1]; }
+
+    void resize(size_type n)
+    {
+        make_exact();
+        _storage->resize(n);
+        _ptr = _storage->data();
+        _size = n;
+    }
+
+    void resize(size_type n, const T& value)
+    {
+        make_exact();
+        _storage->resize(n, value);
+        _ptr = _storage->data();
+        _size = n;
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        difference_type first_idx = first - cbegin();
+        difference_type last_idx = last - cbegin();
+        make_exact();
+        auto it = _storage->erase(
+            _storage->cbegin() + first_idx, _storage->cbegin() + last_idx
+        );
+        _ptr = _storage->data();
+        _size = _storage->size();
+        return it;
+    }
+
+    iterator insert(const_iterator pos, const T& value)
+    {
+        difference_type pos_idx = pos - cbegin();
+        make_exact();
+        auto it = _storage->insert(_storage->cbegin() + pos_idx, value);
+        _ptr = _storage->data();
+        _size = _storage->size();
+        return it;
+    }
+
+    /* ****************************************************************************** *
+     * *                          Views and storage sharing                         * *
+     * ****************************************************************************** */
+
+    //! Return a vector of `count` items, starting at item `offset`, that shares the
+    //! storage of `*this`
+    CowVector view(size_type offset, size_type count) const
+    {
+        assert(offset + count <= _size);
+        if (_exported) {
+            return CowVector(cbegin() + offset, cbegin() + offset + count);
+        }
+        CowVector result(*this);
+        result._ptr += offset;
+        result._size = count;
+        return result;
+    }
+
+    //! Test if `*this` shares its storage with another `CowVector`
+    bool is_shared() const noexcept { return _shared && _storage.use_count() > 1; }
+
+    //! Make the data of `*this` uniquely owned and prevent future copies of `*this`
+    //! from sharing storage with it. Used when a raw pointer to the data escapes, e.g.,
+    //! through the Python Buffer Protocol.
+    void mark_exported()
+    {
+        make_unique();
+        _exported = true;
+    }
+
+    friend bool operator==(const CowVector& lhs, const CowVector& rhs) noexcept
+    {
+        return lhs.size() == rhs.size()
+            && std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
+    }
+
+    friend bool operator!=(const CowVector& lhs, const CowVector& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    //! Take ownership of `storage`, spanning all of its items
+    explicit CowVector(std::shared_ptr<storage_type>&& storage) noexcept
+        : _storage { std::move(storage) }
+        , _ptr { _storage->data() }
+        , _size { _storage->size() }
+    {
+    }
+
+    using pool_type = BufferPool<storage_type>;
+
+    //! Create storage of `n` items, recycled from the buffer pool if possible. Items of
+    //! recycled storage keep their previous values, unless `zero_init` is set.
+    static std::shared_ptr<storage_type> make_storage(size_type n, bool zero_init)
+    {
+        if (storage_type* storage = pool_type::take(n)) {
+            if (zero_init) {
+                storage->assign(n, T());
+            } else {
+                storage->resize(n);
+            }
+            return std::shared_ptr<storage_type>(storage, &pool_type::release);
+        }
+        if (is_buffer_pool_active()) {
+            return std::shared_ptr<storage_type>(
+                new storage_type(n), &pool_type::release
+            );
+        }
+        return std::make_shared<storage_type>(n);
+    }
+
+    //! Create storage holding a copy of the items in [ `first`, `last` ), recycled from
+    //! the buffer pool if possible
+    static std::shared_ptr<storage_type>
+    make_storage(const_iterator first, const_iterator last)
+    {
+        if (storage_type* storage = pool_type::take(size_type(last - first))) {
+            storage->assign(first, last);
+            return std::shared_ptr<storage_type>(storage, &pool_type::release);
+        }
+        if (is_buffer_pool_active()) {
+            return std::shared_ptr<storage_type>(
+                new storage_type(first, last), &pool_type::release
+            );
+        }
+        return std::make_shared<storage_type>(first, last);
+    }
+
+    //! Offset of the first item of `*this` in the underlying storage
+    size_type offset() const noexcept { return size_type(_ptr - _storage->data()); }
+
+    //! Copy the data if the storage is shared with another `CowVector`
+    void make_unique()
+    {
+        if (_shared) {
+            if (_storage.use_count() > 1) {
+                _storage = make_storage(cbegin(), cend());
+                _ptr = _storage->data();
+            }
+            _shared = false;
+        }
+    }
+
+    //! Make the storage uniquely owned and exactly span the items of `*this`
+    void make_exact()
+    {
+        make_unique();
+        if (!_storage) {
+            _storage = std::make_shared<storage_type>();
+        } else if (offset() != 0 || _size != _storage->size()) {
+            _storage = make_storage(cbegin(), cend());
+        }
+        _ptr = _storage->data();
+    }
+
+    std::shared_ptr<storage_type> _storage {}; // Underlying (possibly shared) storage
+    T* _ptr = nullptr;                         // First item of `*this` in `_storage`
+    size_type _size = 0;                       // Number of items
+    mutable bool _shared = false;              // Storage may be shared with a copy
+    bool _exported = false;                    // Storage exported through raw pointer
+};
+
+#endif // _APYTYPES_COW_VECTOR_H
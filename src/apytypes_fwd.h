@@ -106,6 +106,9 @@ class APyFloatArray;
 class APyCFixedArray;
 class APyCFloatArray;
 
+// Strided ndarray element reader (`array_utils.h`)
+template <typename T> class NDArrayReader;
+
 template <typename T> struct scalar_variant;
 template <typename T> struct array_variant;
 
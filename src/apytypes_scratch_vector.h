@@ -106,7 +106,7 @@ public:
         : _size { 0 }
         , _capacity { _N_SCRATCH_ELEMENTS }
         , _scratch_data() // `_scratch_data` uninitialized
-        , _ptr()          // `_ptr` uninitialized
+        , _ptr { _scratch_data.data() }
     {
         /* Default constructor */
     }
@@ -5,10 +5,16 @@
 #include <hwy/highway.h>
 
 #include <fmt/format.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
 #include <string>
 #include <vector>
 
 #include "apybuffer.h"
+#include "apytypes_common.h"
+#include "apytypes_simd.h"
 #include "apytypes_util.h"
 
 namespace simd {
@@ -814,6 +820,108 @@ namespace HWY_NAMESPACE { // required: unique per target
         return sum;
     }
 
+    //! Add vector `v` to the elements at `dst`
+    template <class D, class V>
+    HWY_ATTR HWY_INLINE void _hwy_store_add(D d, V v, apy_limb_t* HWY_RESTRICT dst)
+    {
+        hn::StoreU(hn::Add(hn::LoadU(d, dst), v), d, dst);
+    }
+
+    HWY_ATTR void _hwy_matrix_multiply_accumulate_packed(
+        apy_limb_t* HWY_RESTRICT dst,
+        const std::size_t dst_stride,
+        const apy_limb_t* HWY_RESTRICT a_packed,
+        const apy_limb_t* HWY_RESTRICT b_packed,
+        const std::size_t m,
+        const std::size_t n,
+        const std::size_t k
+    )
+    {
+        constexpr std::size_t MR = MATMUL_PANEL_ROWS;
+        static_assert(MR == 4, "the micro-kernel is unrolled for four rows");
+        constexpr const hn::ScalableTag<apy_limb_t> d;
+        const std::size_t lanes = hn::Lanes(d);
+
+        for (std::size_t i = 0; i < m; i += MR) {
+            const apy_limb_t* a = a_packed + i * k;
+            const std::size_t mr = std::min(MR, m - i);
+            apy_limb_t* c = dst + i * dst_stride;
+            std::size_t j = 0;
+
+            // Micro-tiles of [ MR x 2 * lanes ] elements
+            for (; j + 2 * lanes <= n; j += 2 * lanes) {
+                auto c00 = hn::Zero(d), c01 = hn::Zero(d);
+                auto c10 = hn::Zero(d), c11 = hn::Zero(d);
+                auto c20 = hn::Zero(d), c21 = hn::Zero(d);
+                auto c30 = hn::Zero(d), c31 = hn::Zero(d);
+                for (std::size_t p = 0; p < k; p++) {
+                    const auto b0 = hn::LoadU(d, b_packed + p * n + j);
+                    const auto b1 = hn::LoadU(d, b_packed + p * n + j + lanes);
+                    const auto a0 = hn::Set(d, a[p * MR + 0]);
+                    const auto a1 = hn::Set(d, a[p * MR + 1]);
+                    c00 = hn::MulAdd(a0, b0, c00);
+                    c01 = hn::MulAdd(a0, b1, c01);
+                    c10 = hn::MulAdd(a1, b0, c10);
+                    c11 = hn::MulAdd(a1, b1, c11);
+                    const auto a2 = hn::Set(d, a[p * MR + 2]);
+                    const auto a3 = hn::Set(d, a[p * MR + 3]);
+                    c20 = hn::MulAdd(a2, b0, c20);
+                    c21 = hn::MulAdd(a2, b1, c21);
+                    c30 = hn::MulAdd(a3, b0, c30);
+                    c31 = hn::MulAdd(a3, b1, c31);
+                }
+                _hwy_store_add(d, c00, c + j);
+                _hwy_store_add(d, c01, c + j + lanes);
+                if (mr > 1) {
+                    _hwy_store_add(d, c10, c + dst_stride + j);
+                    _hwy_store_add(d, c11, c + dst_stride + j + lanes);
+                }
+                if (mr > 2) {
+                    _hwy_store_add(d, c20, c + 2 * dst_stride + j);
+                    _hwy_store_add(d, c21, c + 2 * dst_stride + j + lanes);
+                }
+                if (mr > 3) {
+                    _hwy_store_add(d, c30, c + 3 * dst_stride + j);
+                    _hwy_store_add(d, c31, c + 3 * dst_stride + j + lanes);
+                }
+            }
+
+            // Micro-tiles of [ MR x lanes ] elements
+            for (; j + lanes <= n; j += lanes) {
+                auto c0 = hn::Zero(d), c1 = hn::Zero(d);
+                auto c2 = hn::Zero(d), c3 = hn::Zero(d);
+                for (std::size_t p = 0; p < k; p++) {
+                    const auto b0 = hn::LoadU(d, b_packed + p * n + j);
+                    c0 = hn::MulAdd(hn::Set(d, a[p * MR + 0]), b0, c0);
+                    c1 = hn::MulAdd(hn::Set(d, a[p * MR + 1]), b0, c1);
+                    c2 = hn::MulAdd(hn::Set(d, a[p * MR + 2]), b0, c2);
+                    c3 = hn::MulAdd(hn::Set(d, a[p * MR + 3]), b0, c3);
+                }
+                _hwy_store_add(d, c0, c + j);
+                if (mr > 1) {
+                    _hwy_store_add(d, c1, c + dst_stride + j);
+                }
+                if (mr > 2) {
+                    _hwy_store_add(d, c2, c + 2 * dst_stride + j);
+                }
+                if (mr > 3) {
+                    _hwy_store_add(d, c3, c + 3 * dst_stride + j);
+                }
+            }
+
+            // Remaining columns
+            for (; j < n; j++) {
+                for (std::size_t r = 0; r < mr; r++) {
+                    apy_limb_t sum = 0;
+                    for (std::size_t p = 0; p < k; p++) {
+                        sum += a[p * MR + r] * b_packed[p * n + j];
+                    }
+                    c[r * dst_stride + j] += sum;
+                }
+            }
+        }
+    }
+
     HWY_ATTR void _hwy_vector_sub_const_even_odd(
         apy_limb_t* HWY_RESTRICT dst,
         const apy_limb_t* HWY_RESTRICT src1,
@@ -954,6 +1062,879 @@ namespace HWY_NAMESPACE { // required: unique per target
         }
     }
 
+    template <QuantizationMode QUANTIZATION, bool SATURATE>
+    HWY_ATTR void _hwy_vector_cast(
+        apy_limb_signed_t* HWY_RESTRICT dst,
+        const apy_limb_signed_t* HWY_RESTRICT src,
+        int left_shift_amount,
+        unsigned dst_bits,
+        const std::size_t size
+    )
+    {
+        static_assert(
+            QUANTIZATION == QuantizationMode::TRN
+                || QUANTIZATION == QuantizationMode::RND
+                || QUANTIZATION == QuantizationMode::RND_CONV
+                || QUANTIZATION == QuantizationMode::JAM,
+            "Unsupported quantization mode for SIMD cast"
+        );
+        assert(dst_bits > 0 && dst_bits <= APY_LIMB_SIZE_BITS);
+        assert(unsigned(std::abs(left_shift_amount)) < APY_LIMB_SIZE_BITS);
+
+        constexpr const hn::ScalableTag<apy_limb_signed_t> d;
+        const std::size_t size_simd = size - size % hn::Lanes(d);
+
+        // Quantization constants. Rounding is performed by adding a bias before the
+        // arithmetic right shift. All additions are performed using unsigned limbs
+        // (wrapping), identical to the multi-limb quantization functions.
+        const bool is_left_shift = left_shift_amount >= 0;
+        const unsigned shift
+            = unsigned(is_left_shift ? left_shift_amount : -left_shift_amount);
+        const apy_limb_t half = is_left_shift ? 0 : apy_limb_t(1) << (shift - 1);
+        const apy_limb_t bias
+            = QUANTIZATION == QuantizationMode::RND_CONV ? half - 1 : half;
+
+        // Overflow constants
+        const unsigned wrap_shift = unsigned(APY_LIMB_SIZE_BITS) - dst_bits;
+        const apy_limb_signed_t sat_max
+            = apy_limb_signed_t((apy_limb_t(1) << (dst_bits - 1)) - 1);
+        const apy_limb_signed_t sat_min = ~sat_max;
+
+        const auto v_one = hn::Set(d, apy_limb_signed_t(1));
+        const auto v_bias = hn::Set(d, apy_limb_signed_t(bias));
+        const auto v_sat_max = hn::Set(d, sat_max);
+        const auto v_sat_min = hn::Set(d, sat_min);
+
+        std::size_t i = 0;
+        for (; i < size_simd; i += hn::Lanes(d)) {
+            auto v = hn::LoadU(d, src + i);
+
+            // Quantization
+            if (is_left_shift) {
+                v = hn::ShiftLeftSame(v, shift);
+            } else {
+                if constexpr (QUANTIZATION == QuantizationMode::RND) {
+                    v = hn::Add(v, v_bias);
+                } else if constexpr (QUANTIZATION == QuantizationMode::RND_CONV) {
+                    // Ties to even: add one more if the least significant bit of the
+                    // quantized result is set
+                    const auto lsb = hn::And(hn::ShiftRightSame(v, shift), v_one);
+                    v = hn::Add(v, hn::Add(v_bias, lsb));
+                }
+                v = hn::ShiftRightSame(v, shift);
+            }
+            if constexpr (QUANTIZATION == QuantizationMode::JAM) {
+                v = hn::Or(v, v_one);
+            }
+
+            // Overflowing
+            if constexpr (SATURATE) {
+                v = hn::Min(hn::Max(v, v_sat_min), v_sat_max);
+            } else {
+                v = hn::ShiftRightSame(hn::ShiftLeftSame(v, wrap_shift), wrap_shift);
+            }
+
+            hn::StoreU(v, d, dst + i);
+        }
+        for (; i < size; i++) {
+            apy_limb_t x = apy_limb_t(src[i]);
+
+            // Quantization
+            if (is_left_shift) {
+                x <<= shift;
+            } else {
+                if constexpr (QUANTIZATION == QuantizationMode::RND) {
+                    x += bias;
+                } else if constexpr (QUANTIZATION == QuantizationMode::RND_CONV) {
+                    x += bias + ((x >> shift) & 1);
+                }
+                x = apy_limb_t(apy_limb_signed_t(x) >> shift);
+            }
+            if constexpr (QUANTIZATION == QuantizationMode::JAM) {
+                x |= 1;
+            }
+
+            // Overflowing
+            if constexpr (SATURATE) {
+                dst[i] = std::min(std::max(apy_limb_signed_t(x), sat_min), sat_max);
+            } else {
+                dst[i] = apy_limb_signed_t(x << wrap_shift) >> wrap_shift;
+            }
+        }
+    }
+
+    HWY_ATTR void _hwy_vector_cast_trn(
+        apy_limb_signed_t* HWY_RESTRICT dst,
+        const apy_limb_signed_t* HWY_RESTRICT src,
+        int left_shift_amount,
+        unsigned dst_bits,
+        bool saturate,
+        const std::size_t size
+    )
+    {
+        constexpr auto Q = QuantizationMode::TRN;
+        return saturate
+            ? _hwy_vector_cast<Q, true>(dst, src, left_shift_amount, dst_bits, size)
+            : _hwy_vector_cast<Q, false>(dst, src, left_shift_amount, dst_bits, size);
+    }
+
+    HWY_ATTR void _hwy_vector_cast_rnd(
+        apy_limb_signed_t* HWY_RESTRICT dst,
+        const apy_limb_signed_t* HWY_RESTRICT src,
+        int left_shift_amount,
+        unsigned dst_bits,
+        bool saturate,
+        const std::size_t size
+    )
+    {
+        constexpr auto Q = QuantizationMode::RND;
+        return saturate
+            ? _hwy_vector_cast<Q, true>(dst, src, left_shift_amount, dst_bits, size)
+            : _hwy_vector_cast<Q, false>(dst, src, left_shift_amount, dst_bits, size);
+    }
+
+    HWY_ATTR void _hwy_vector_cast_rnd_conv(
+        apy_limb_signed_t* HWY_RESTRICT dst,
+        const apy_limb_signed_t* HWY_RESTRICT src,
+        int left_shift_amount,
+        unsigned dst_bits,
+        bool saturate,
+        const std::size_t size
+    )
+    {
+        constexpr auto Q = QuantizationMode::RND_CONV;
+        return saturate
+            ? _hwy_vector_cast<Q, true>(dst, src, left_shift_amount, dst_bits, size)
+            : _hwy_vector_cast<Q, false>(dst, src, left_shift_amount, dst_bits, size);
+    }
+
+    HWY_ATTR void _hwy_vector_cast_jam(
+        apy_limb_signed_t* HWY_RESTRICT dst,
+        const apy_limb_signed_t* HWY_RESTRICT src,
+        int left_shift_amount,
+        unsigned dst_bits,
+        bool saturate,
+        const std::size_t size
+    )
+    {
+        constexpr auto Q = QuantizationMode::JAM;
+        return saturate
+            ? _hwy_vector_cast<Q, true>(dst, src, left_shift_amount, dst_bits, size)
+            : _hwy_vector_cast<Q, false>(dst, src, left_shift_amount, dst_bits, size);
+    }
+
+    /* ************************************************************************** *
+     * *            Floating-point arithmetic on `APyFloatData` arrays           * *
+     * ************************************************************************** */
+
+    // An `APyFloatData` is 16 bytes: { `sign` (1 byte), padding (3 bytes), `exp` (4
+    // bytes), `man` (8 bytes) }. It is loaded as two 64-bit words, with the sign in
+    // the least significant bit and the exponent in the 32 most significant bits of
+    // the first word. On big-endian targets, all elements are left to the caller.
+    static_assert(sizeof(APyFloatData) == 16);
+    static_assert(offsetof(APyFloatData, exp) == 4);
+    static_assert(offsetof(APyFloatData, man) == 8);
+
+    //! Load `Lanes(d)` floating-point values from `src + i`, or broadcast `*src` if
+    //! `is_scalar`
+    template <class D, class V = hn::VFromD<D>>
+    HWY_ATTR HWY_INLINE void _hwy_load_float_data(
+        D d, const APyFloatData* src, bool is_scalar, std::size_t i, V& word, V& man
+    )
+    {
+        if (is_scalar) {
+            word = hn::Set(d, std::uint64_t(src->sign) | std::uint64_t(src->exp) << 32);
+            man = hn::Set(d, src->man);
+        } else {
+            const auto* ptr = reinterpret_cast<const std::uint64_t*>(src + i);
+            hn::LoadInterleaved2(d, ptr, word, man);
+        }
+    }
+
+    //! Store `Lanes(d)` floating-point values to `dst + i`
+    template <class D, class V = hn::VFromD<D>>
+    HWY_ATTR HWY_INLINE void _hwy_store_float_data(
+        D d, APyFloatData* dst, std::size_t i, V sign, V exp, V man
+    )
+    {
+        const auto word = hn::Or(sign, hn::ShiftLeft<32>(exp));
+        hn::StoreInterleaved2(word, man, d, reinterpret_cast<std::uint64_t*>(dst + i));
+    }
+
+    //! Quantize the `bits` least significant bits of `man` away, using `RND_CONV`
+    //! or `TRN`. `sign` is zero or one in each lane.
+    template <bool RND_CONV, class D, class V = hn::VFromD<D>>
+    HWY_ATTR HWY_INLINE V _hwy_quantize_man(D d, V man, V sign, unsigned bits)
+    {
+        const auto one = hn::Set(d, 1);
+        const auto sticky = hn::Set(d, (std::uint64_t(1) << (bits - 1)) - 1);
+        const auto res_man = hn::ShiftRightSame(man, int(bits));
+        const auto G = hn::And(hn::ShiftRightSame(man, int(bits - 1)), one);
+        const auto T = hn::VecFromMask(d, hn::Ne(hn::And(man, sticky), hn::Zero(d)));
+        if constexpr (RND_CONV) {
+            const auto B = hn::And(G, hn::Or(res_man, hn::And(T, one)));
+            return hn::Add(res_man, B);
+        } else { /* TRN */
+            const auto B = hn::And(sign, hn::Or(G, hn::And(T, one)));
+            return hn::Add(res_man, B);
+        }
+    }
+
+    //! Record indices [ `begin`, `end` ) for scalar evaluation
+    HWY_ATTR HWY_INLINE void _hwy_add_fallback(
+        std::size_t* fallback_idx,
+        std::size_t& n_fallback,
+        std::size_t begin,
+        std::size_t end
+    )
+    {
+        for (std::size_t j = begin; j < end; j++) {
+            fallback_idx[n_fallback++] = j;
+        }
+    }
+
+    template <bool RND_CONV>
+    HWY_ATTR std::size_t _hwy_floating_point_mul(
+        APyFloatData* dst,
+        const APyFloatData* src1,
+        const APyFloatData* src2,
+        bool src1_is_scalar,
+        bool src2_is_scalar,
+        std::size_t size,
+        const APyFloatSpec& src1_spec,
+        const APyFloatSpec& src2_spec,
+        const APyFloatSpec& dst_spec,
+        std::size_t* fallback_idx
+    )
+    {
+        const hn::ScalableTag<std::uint64_t> d;
+        const hn::RebindToSigned<decltype(d)> di;
+        const std::size_t lanes = hn::Lanes(d);
+        std::size_t n_fallback = 0;
+
+        const unsigned sum_man_bits = src1_spec.man_bits + src2_spec.man_bits;
+        const int man_delta = int(sum_man_bits + 2) - int(dst_spec.man_bits);
+        const std::int64_t bias_term = std::int64_t(dst_spec.bias)
+            - std::int64_t(src1_spec.bias) - std::int64_t(src2_spec.bias);
+
+        const auto zero = hn::Zero(d);
+        const auto one = hn::Set(d, 1);
+        const auto x_max_exp = hn::Set(d, (1ULL << src1_spec.exp_bits) - 1);
+        const auto y_max_exp = hn::Set(d, (1ULL << src2_spec.exp_bits) - 1);
+        const auto z_max_exp = hn::Set(di, (1LL << dst_spec.exp_bits) - 1);
+        const auto x_leading_one = hn::Set(d, 1ULL << src1_spec.man_bits);
+        const auto y_leading_one = hn::Set(d, 1ULL << src2_spec.man_bits);
+        const auto two_before = hn::Set(d, 1ULL << (sum_man_bits + 1));
+        const auto two_mask = hn::Set(d, (1ULL << (sum_man_bits + 2)) - 1);
+        const auto two_res = hn::Set(d, 1ULL << dst_spec.man_bits);
+
+        std::size_t i = 0;
+        for (; HWY_IS_LITTLE_ENDIAN && i + lanes <= size; i += lanes) {
+            hn::VFromD<decltype(d)> x_word, x_man, y_word, y_man;
+            _hwy_load_float_data(d, src1, src1_is_scalar, i, x_word, x_man);
+            _hwy_load_float_data(d, src2, src2_is_scalar, i, y_word, y_man);
+            const auto x_exp = hn::ShiftRight<32>(x_word);
+            const auto y_exp = hn::ShiftRight<32>(y_word);
+            const auto sign = hn::And(hn::Xor(x_word, y_word), one);
+
+            // Zero, subnormal, inf, and NaN operands are evaluated by the caller
+            auto fallback = hn::Or(
+                hn::Or(hn::Eq(x_exp, zero), hn::Eq(x_exp, x_max_exp)),
+                hn::Or(hn::Eq(y_exp, zero), hn::Eq(y_exp, y_max_exp))
+            );
+
+            // Product of two normal mantissas is in [1, 4)
+            const auto mx = hn::Or(x_man, x_leading_one);
+            const auto my = hn::Or(y_man, y_leading_one);
+            auto man = hn::Mul(mx, my);
+            const auto is_two = hn::Ne(hn::And(man, two_before), zero);
+            const auto exp_inc = hn::BitCast(di, hn::IfThenElseZero(is_two, one));
+            auto exp = hn::Add(
+                hn::BitCast(di, hn::Add(x_exp, y_exp)),
+                hn::Add(hn::Set(di, bias_term), exp_inc)
+            );
+            man = hn::IfThenElse(is_two, hn::ShiftLeft<1>(man), hn::ShiftLeft<2>(man));
+            man = hn::And(man, two_mask);
+
+            // Subnormal results are evaluated by the caller
+            fallback = hn::Or(fallback, hn::RebindMask(d, hn::Le(exp, hn::Zero(di))));
+
+            if (man_delta <= 0) {
+                man = hn::ShiftLeftSame(man, -man_delta);
+            } else {
+                man = _hwy_quantize_man<RND_CONV>(d, man, sign, unsigned(man_delta));
+                const auto carry = hn::Ne(hn::And(man, two_res), zero);
+                exp = hn::Add(exp, hn::BitCast(di, hn::IfThenElseZero(carry, one)));
+                man = hn::IfThenZeroElse(carry, man);
+            }
+
+            // Overflowing results are evaluated by the caller
+            fallback = hn::Or(fallback, hn::RebindMask(d, hn::Ge(exp, z_max_exp)));
+
+            if (hn::AllFalse(d, fallback)) {
+                _hwy_store_float_data(d, dst, i, sign, hn::BitCast(d, exp), man);
+            } else {
+                _hwy_add_fallback(fallback_idx, n_fallback, i, i + lanes);
+            }
+        }
+        _hwy_add_fallback(fallback_idx, n_fallback, i, size);
+        return n_fallback;
+    }
+
+    HWY_ATTR std::size_t _hwy_floating_point_mul_rnd_conv(
+        APyFloatData* dst,
+        const APyFloatData* src1,
+        const APyFloatData* src2,
+        bool src1_is_scalar,
+        bool src2_is_scalar,
+        std::size_t size,
+        const APyFloatSpec& src1_spec,
+        const APyFloatSpec& src2_spec,
+        const APyFloatSpec& dst_spec,
+        std::size_t* fallback_idx
+    )
+    {
+        return _hwy_floating_point_mul<true>(
+            dst,
+            src1,
+            src2,
+            src1_is_scalar,
+            src2_is_scalar,
+            size,
+            src1_spec,
+            src2_spec,
+            dst_spec,
+            fallback_idx
+        );
+    }
+
+    HWY_ATTR std::size_t _hwy_floating_point_mul_trn(
+        APyFloatData* dst,
+        const APyFloatData* src1,
+        const APyFloatData* src2,
+        bool src1_is_scalar,
+        bool src2_is_scalar,
+        std::size_t size,
+        const APyFloatSpec& src1_spec,
+        const APyFloatSpec& src2_spec,
+        const APyFloatSpec& dst_spec,
+        std::size_t* fallback_idx
+    )
+    {
+        return _hwy_floating_point_mul<false>(
+            dst,
+            src1,
+            src2,
+            src1_is_scalar,
+            src2_is_scalar,
+            size,
+            src1_spec,
+            src2_spec,
+            dst_spec,
+            fallback_idx
+        );
+    }
+
+    template <bool IS_SUBTRACT, bool RND_CONV>
+    HWY_ATTR std::size_t _hwy_floating_point_add_same_wl(
+        APyFloatData* dst,
+        const APyFloatData* src1,
+        const APyFloatData* src2,
+        bool src1_is_scalar,
+        bool src2_is_scalar,
+        std::size_t size,
+        const APyFloatSpec& spec,
+        std::size_t* fallback_idx
+    )
+    {
+        const hn::ScalableTag<std::uint64_t> d;
+        const std::size_t lanes = hn::Lanes(d);
+        std::size_t n_fallback = 0;
+
+        const auto zero = hn::Zero(d);
+        const auto one = hn::Set(d, 1);
+        const auto sub = hn::Set(d, IS_SUBTRACT ? 1 : 0);
+        const auto max_exp = hn::Set(d, (1ULL << spec.exp_bits) - 1);
+        const auto final_res_lo = hn::Set(d, 1ULL << spec.man_bits);
+        const auto res_lo = hn::Set(d, 1ULL << (spec.man_bits + 3));
+        const auto carry_res_lo = hn::Set(d, 1ULL << (spec.man_bits + 4));
+        const auto man_mask = hn::Set(d, (1ULL << (spec.man_bits + 4)) - 1);
+        const auto max_shift = hn::Set(d, 63);
+        const auto min_sticky_shift = hn::Set(d, 4);
+        const auto sixty_four = hn::Set(d, 64);
+
+        std::size_t i = 0;
+        for (; HWY_IS_LITTLE_ENDIAN && i + lanes <= size; i += lanes) {
+            hn::VFromD<decltype(d)> x_word, x_man, y_word, y_man;
+            _hwy_load_float_data(d, src1, src1_is_scalar, i, x_word, x_man);
+            _hwy_load_float_data(d, src2, src2_is_scalar, i, y_word, y_man);
+            const auto x_exp = hn::ShiftRight<32>(x_word);
+            const auto y_exp = hn::ShiftRight<32>(y_word);
+
+            // Zero, subnormal, inf, and NaN operands are evaluated by the caller
+            auto fallback = hn::Or(
+                hn::Or(hn::Eq(x_exp, zero), hn::Eq(x_exp, max_exp)),
+                hn::Or(hn::Eq(y_exp, zero), hn::Eq(y_exp, max_exp))
+            );
+
+            // Make sure the larger magnitude operand comes first. For normal operands,
+            // the magnitude is ordered as `(exp << man_bits) | man`.
+            const auto swap = hn::Lt(
+                hn::Or(hn::ShiftLeftSame(x_exp, spec.man_bits), x_man),
+                hn::Or(hn::ShiftLeftSame(y_exp, spec.man_bits), y_man)
+            );
+            const auto swap_v = hn::IfThenElseZero(swap, one);
+            const auto big_sign = hn::And(hn::IfThenElse(swap, y_word, x_word), one);
+            const auto small_sign = hn::And(hn::IfThenElse(swap, x_word, y_word), one);
+            const auto big_exp = hn::IfThenElse(swap, y_exp, x_exp);
+            const auto small_exp = hn::IfThenElse(swap, x_exp, y_exp);
+            const auto sign = hn::Xor(big_sign, hn::And(sub, swap_v));
+            const auto small_sign_eff = hn::Xor(small_sign, hn::AndNot(swap_v, sub));
+            const auto same_sign = hn::Eq(sign, small_sign_eff);
+
+            // Mantissas with leading one and three guard bits
+            const auto big_man = hn::IfThenElse(swap, y_man, x_man);
+            const auto small_man = hn::IfThenElse(swap, x_man, y_man);
+            const auto mx = hn::Or(res_lo, hn::ShiftLeft<3>(big_man));
+            const auto my = hn::Or(res_lo, hn::ShiftLeft<3>(small_man));
+
+            // Align the smaller mantissa, with sticky bit when shifting more than three
+            const auto exp_delta = hn::Min(hn::Sub(big_exp, small_exp), max_shift);
+            const auto sticky_shift
+                = hn::Sub(sixty_four, hn::Max(exp_delta, min_sticky_shift));
+            const auto sticky = hn::And(
+                hn::Gt(exp_delta, hn::Set(d, 3)),
+                hn::Ne(hn::Shl(my, sticky_shift), zero)
+            );
+            const auto my_aligned
+                = hn::Or(hn::Shr(my, exp_delta), hn::IfThenElseZero(sticky, one));
+
+            auto man = hn::IfThenElse(
+                same_sign, hn::Add(mx, my_aligned), hn::Sub(mx, my_aligned)
+            );
+            const auto carry = hn::Ne(hn::And(man, carry_res_lo), zero);
+            const auto normalized = hn::Ne(hn::And(man, res_lo), zero);
+
+            // Cancellation is evaluated by the caller
+            fallback = hn::Or(fallback, hn::Not(hn::Or(carry, normalized)));
+
+            auto exp = hn::Add(big_exp, hn::IfThenElseZero(carry, one));
+            man = hn::IfThenElse(carry, man, hn::ShiftLeft<1>(man));
+            man = hn::And(man, man_mask);
+
+            man = _hwy_quantize_man<RND_CONV>(d, man, sign, 4);
+            const auto man_carry = hn::Ne(hn::And(man, final_res_lo), zero);
+            exp = hn::Add(exp, hn::IfThenElseZero(man_carry, one));
+            man = hn::IfThenZeroElse(man_carry, man);
+
+            // Overflowing results are evaluated by the caller
+            fallback = hn::Or(fallback, hn::Ge(exp, max_exp));
+
+            if (hn::AllFalse(d, fallback)) {
+                _hwy_store_float_data(d, dst, i, sign, exp, man);
+            } else {
+                _hwy_add_fallback(fallback_idx, n_fallback, i, i + lanes);
+            }
+        }
+        _hwy_add_fallback(fallback_idx, n_fallback, i, size);
+        return n_fallback;
+    }
+
+    HWY_ATTR std::size_t _hwy_floating_point_add_same_wl_rnd_conv(
+        APyFloatData* dst,
+        const APyFloatData* src1,
+        const APyFloatData* src2,
+        bool src1_is_scalar,
+        bool src2_is_scalar,
+        std::size_t size,
+        const APyFloatSpec& spec,
+        std::size_t* fallback_idx
+    )
+    {
+        return _hwy_floating_point_add_same_wl<false, true>(
+            dst, src1, src2, src1_is_scalar, src2_is_scalar, size, spec, fallback_idx
+        );
+    }
+
+    HWY_ATTR std::size_t _hwy_floating_point_add_same_wl_trn(
+        APyFloatData* dst,
+        const APyFloatData* src1,
+        const APyFloatData* src2,
+        bool src1_is_scalar,
+        bool src2_is_scalar,
+        std::size_t size,
+        const APyFloatSpec& spec,
+        std::size_t* fallback_idx
+    )
+    {
+        return _hwy_floating_point_add_same_wl<false, false>(
+            dst, src1, src2, src1_is_scalar, src2_is_scalar, size, spec, fallback_idx
+        );
+    }
+
+    HWY_ATTR std::size_t _hwy_floating_point_sub_same_wl_rnd_conv(
+        APyFloatData* dst,
+        const APyFloatData* src1,
+        const APyFloatData* src2,
+        bool src1_is_scalar,
+        bool src2_is_scalar,
+        std::size_t size,
+        const APyFloatSpec& spec,
+        std::size_t* fallback_idx
+    )
+    {
+        return _hwy_floating_point_add_same_wl<true, true>(
+            dst, src1, src2, src1_is_scalar, src2_is_scalar, size, spec, fallback_idx
+        );
+    }
+
+    HWY_ATTR std::size_t _hwy_floating_point_sub_same_wl_trn(
+        APyFloatData* dst,
+        const APyFloatData* src1,
+        const APyFloatData* src2,
+        bool src1_is_scalar,
+        bool src2_is_scalar,
+        std::size_t size,
+        const APyFloatSpec& spec,
+        std::size_t* fallback_idx
+    )
+    {
+        return _hwy_floating_point_add_same_wl<true, false>(
+            dst, src1, src2, src1_is_scalar, src2_is_scalar, size, spec, fallback_idx
+        );
+    }
+
+    /* ************************************************************************** *
+     * *                 Conversion from NumPy floating-point and integers        * *
+     * ************************************************************************** */
+
+    //! Load `Lanes(d)` values from `src`, promoted to double precision
+    template <class D>
+    HWY_ATTR HWY_INLINE hn::VFromD<D> _hwy_load_as_double(D d, const double* src)
+    {
+        return hn::LoadU(d, src);
+    }
+
+    template <class D>
+    HWY_ATTR HWY_INLINE hn::VFromD<D> _hwy_load_as_double(D d, const float* src)
+    {
+        const hn::Rebind<float, D> df32;
+        return hn::PromoteTo(d, hn::LoadU(df32, src));
+    }
+
+    template <typename FLOAT_TYPE>
+    HWY_ATTR std::size_t _hwy_fixed_point_from_float(
+        std::uint64_t* HWY_RESTRICT dst,
+        const FLOAT_TYPE* HWY_RESTRICT src,
+        std::size_t size,
+        int frac_bits,
+        unsigned bits,
+        std::size_t* fallback_idx
+    )
+    {
+        std::size_t n_fallback = 0;
+        std::size_t i = 0;
+#if HWY_HAVE_FLOAT64
+        const hn::ScalableTag<double> d;
+        const hn::RebindToSigned<decltype(d)> di;
+        const hn::RebindToUnsigned<decltype(d)> du;
+        const std::size_t lanes = hn::Lanes(d);
+
+        // Scaling by a power of two is exact, except for results so small that they
+        // round to zero anyway
+        const auto scale = hn::Set(d, std::ldexp(1.0, frac_bits));
+        const auto half = hn::Set(d, 0.5);
+        const auto one = hn::Set(d, 1.0);
+        const auto limit = hn::Set(d, 0x1p63);
+        const int wrap_shift = int(64 - bits);
+
+        for (; i + lanes <= size; i += lanes) {
+            const auto x = hn::Mul(_hwy_load_as_double(d, src + i), scale);
+
+            // Non-finite values, and values that do not fit in 64 bits before
+            // wrapping, are evaluated by the caller. Comparisons with NaN are false.
+            const auto fallback = hn::Not(hn::Lt(hn::Abs(x), limit));
+
+            // Round to nearest, ties away from zero
+            const auto t = hn::Trunc(x);
+            const auto away = hn::Ge(hn::Abs(hn::Sub(x, t)), half);
+            const auto r = hn::Add(t, hn::IfThenElseZero(away, hn::CopySign(one, x)));
+
+            // Two's complement wrapping to `bits` bits
+            auto res = hn::ConvertTo(di, r);
+            res = hn::ShiftRightSame(hn::ShiftLeftSame(res, wrap_shift), wrap_shift);
+
+            if (hn::AllFalse(d, fallback)) {
+                hn::StoreU(hn::BitCast(du, res), du, dst + i);
+            } else {
+                _hwy_add_fallback(fallback_idx, n_fallback, i, i + lanes);
+            }
+        }
+#endif
+        _hwy_add_fallback(fallback_idx, n_fallback, i, size);
+        return n_fallback;
+    }
+
+    HWY_ATTR std::size_t _hwy_fixed_point_from_double(
+        std::uint64_t* HWY_RESTRICT dst,
+        const double* HWY_RESTRICT src,
+        std::size_t size,
+        int frac_bits,
+        unsigned bits,
+        std::size_t* fallback_idx
+    )
+    {
+        return _hwy_fixed_point_from_float(dst, src, size, frac_bits, bits, fallback_idx);
+    }
+
+    HWY_ATTR std::size_t _hwy_fixed_point_from_single(
+        std::uint64_t* HWY_RESTRICT dst,
+        const float* HWY_RESTRICT src,
+        std::size_t size,
+        int frac_bits,
+        unsigned bits,
+        std::size_t* fallback_idx
+    )
+    {
+        return _hwy_fixed_point_from_float(dst, src, size, frac_bits, bits, fallback_idx);
+    }
+
+    HWY_ATTR void _hwy_fixed_point_from_integer(
+        std::uint64_t* HWY_RESTRICT dst,
+        const std::uint64_t* HWY_RESTRICT src,
+        std::size_t size,
+        int frac_bits,
+        unsigned bits,
+        bool src_is_signed
+    )
+    {
+        const hn::ScalableTag<std::uint64_t> d;
+        const hn::RebindToSigned<decltype(d)> di;
+        const std::size_t lanes = hn::Lanes(d);
+        const int wrap_shift = int(64 - bits);
+
+        // Shifting out all bits leaves zero, or the sign for signed right shifts
+        if (frac_bits >= 64 || (!src_is_signed && frac_bits <= -64)) {
+            std::fill_n(dst, size, std::uint64_t(0));
+            return;
+        }
+        const int right_shift = std::min(-frac_bits, 63);
+
+        std::size_t i = 0;
+        for (; i + lanes <= size; i += lanes) {
+            const auto v = hn::LoadU(d, src + i);
+            hn::VFromD<decltype(di)> res;
+            if (frac_bits >= 0) {
+                res = hn::BitCast(di, hn::ShiftLeftSame(v, frac_bits));
+            } else if (src_is_signed) {
+                res = hn::ShiftRightSame(hn::BitCast(di, v), right_shift);
+            } else {
+                res = hn::BitCast(di, hn::ShiftRightSame(v, right_shift));
+            }
+            res = hn::ShiftRightSame(hn::ShiftLeftSame(res, wrap_shift), wrap_shift);
+            hn::StoreU(hn::BitCast(d, res), d, dst + i);
+        }
+        for (; i < size; i++) {
+            std::uint64_t res;
+            if (frac_bits >= 0) {
+                res = src[i] << frac_bits;
+            } else if (src_is_signed) {
+                res = std::uint64_t(std::int64_t(src[i]) >> right_shift);
+            } else {
+                res = src[i] >> right_shift;
+            }
+            dst[i] = std::uint64_t(std::int64_t(res << wrap_shift) >> wrap_shift);
+        }
+    }
+
+    template <typename FLOAT_TYPE>
+    HWY_ATTR std::size_t _hwy_floating_point_from_float(
+        APyFloatData* dst,
+        const FLOAT_TYPE* HWY_RESTRICT src,
+        std::size_t size,
+        const APyFloatSpec& spec,
+        std::size_t* fallback_idx
+    )
+    {
+        std::size_t n_fallback = 0;
+        std::size_t i = 0;
+#if HWY_HAVE_FLOAT64
+        const hn::ScalableTag<double> df;
+        const hn::RebindToUnsigned<decltype(df)> d;
+        const hn::RebindToSigned<decltype(df)> di;
+        const std::size_t lanes = hn::Lanes(d);
+
+        const auto zero = hn::Zero(d);
+        const auto one = hn::Set(d, 1);
+        const auto double_max_exp = hn::Set(d, 2047);
+        const auto double_man_mask = hn::Set(d, (std::uint64_t(1) << 52) - 1);
+        const auto bias_term = hn::Set(di, std::int64_t(spec.bias) - 1023);
+        const auto max_exp = hn::Set(di, (std::int64_t(1) << spec.exp_bits) - 1);
+        const auto two_res = hn::Set(d, std::uint64_t(1) << spec.man_bits);
+
+        for (; HWY_IS_LITTLE_ENDIAN && i + lanes <= size; i += lanes) {
+            const auto word = hn::BitCast(d, _hwy_load_as_double(df, src + i));
+            const auto sign = hn::ShiftRight<63>(word);
+            const auto double_exp = hn::And(hn::ShiftRight<52>(word), double_max_exp);
+            auto man = hn::And(word, double_man_mask);
+
+            // Zeros are converted here. Subnormal, inf, and NaN sources are evaluated
+            // by the caller.
+            const auto is_zero_exp = hn::Eq(double_exp, zero);
+            const auto is_zero = hn::And(is_zero_exp, hn::Eq(man, zero));
+            auto fallback = hn::Or(
+                hn::AndNot(is_zero, is_zero_exp), hn::Eq(double_exp, double_max_exp)
+            );
+
+            auto exp = hn::Add(hn::BitCast(di, double_exp), bias_term);
+            if (spec.man_bits < 52) {
+                // Round to nearest, ties to even
+                const unsigned man_delta = 52 - spec.man_bits;
+                man = _hwy_quantize_man<true>(d, man, sign, man_delta);
+                const auto carry = hn::Ne(hn::And(man, two_res), zero);
+                exp = hn::Add(exp, hn::BitCast(di, hn::IfThenElseZero(carry, one)));
+                man = hn::IfThenZeroElse(carry, man);
+            } else {
+                man = hn::ShiftLeftSame(man, int(spec.man_bits - 52));
+            }
+
+            // Subnormal and overflowing results are evaluated by the caller
+            fallback = hn::Or(
+                fallback,
+                hn::AndNot(
+                    is_zero,
+                    hn::RebindMask(
+                        d, hn::Or(hn::Le(exp, hn::Zero(di)), hn::Ge(exp, max_exp))
+                    )
+                )
+            );
+
+            if (hn::AllFalse(d, fallback)) {
+                exp = hn::IfThenZeroElse(hn::RebindMask(di, is_zero), exp);
+                man = hn::IfThenZeroElse(is_zero, man);
+                _hwy_store_float_data(d, dst, i, sign, hn::BitCast(d, exp), man);
+            } else {
+                _hwy_add_fallback(fallback_idx, n_fallback, i, i + lanes);
+            }
+        }
+#endif
+        _hwy_add_fallback(fallback_idx, n_fallback, i, size);
+        return n_fallback;
+    }
+
+    HWY_ATTR std::size_t _hwy_floating_point_from_double(
+        APyFloatData* dst,
+        const double* HWY_RESTRICT src,
+        std::size_t size,
+        const APyFloatSpec& spec,
+        std::size_t* fallback_idx
+    )
+    {
+        return _hwy_floating_point_from_float(dst, src, size, spec, fallback_idx);
+    }
+
+    HWY_ATTR std::size_t _hwy_floating_point_from_single(
+        APyFloatData* dst,
+        const float* HWY_RESTRICT src,
+        std::size_t size,
+        const APyFloatSpec& spec,
+        std::size_t* fallback_idx
+    )
+    {
+        return _hwy_floating_point_from_float(dst, src, size, spec, fallback_idx);
+    }
+
+    /* ************************************************************************** *
+     * *                   Conversion to NumPy floating-point                     * *
+     * ************************************************************************** */
+
+    HWY_ATTR void _hwy_fixed_point_to_double(
+        double* HWY_RESTRICT dst,
+        const std::uint64_t* HWY_RESTRICT src,
+        std::size_t size,
+        int frac_bits
+    )
+    {
+        // Both the conversion and the scaling by a power of two are exact
+        const double scale = std::ldexp(1.0, -frac_bits);
+        std::size_t i = 0;
+#if HWY_HAVE_FLOAT64
+        const hn::ScalableTag<double> d;
+        const hn::RebindToSigned<decltype(d)> di;
+        const std::size_t lanes = hn::Lanes(d);
+        const auto v_scale = hn::Set(d, scale);
+        const auto* src_signed = reinterpret_cast<const std::int64_t*>(src);
+        for (; i + lanes <= size; i += lanes) {
+            const auto x = hn::ConvertTo(d, hn::LoadU(di, src_signed + i));
+            hn::StoreU(hn::Mul(x, v_scale), d, dst + i);
+        }
+#endif
+        for (; i < size; i++) {
+            dst[i] = double(std::int64_t(src[i])) * scale;
+        }
+    }
+
+    HWY_ATTR std::size_t _hwy_floating_point_to_double(
+        double* HWY_RESTRICT dst,
+        const APyFloatData* HWY_RESTRICT src,
+        std::size_t size,
+        const APyFloatSpec& spec,
+        std::size_t* fallback_idx
+    )
+    {
+        std::size_t n_fallback = 0;
+        std::size_t i = 0;
+#if HWY_HAVE_FLOAT64
+        const hn::ScalableTag<std::uint64_t> d;
+        const hn::RebindToSigned<decltype(d)> di;
+        const hn::RebindToFloat<decltype(d)> df;
+        const std::size_t lanes = hn::Lanes(d);
+
+        const auto zero = hn::Zero(d);
+        const auto one = hn::Set(d, 1);
+        const auto max_exp = hn::Set(d, (std::uint64_t(1) << spec.exp_bits) - 1);
+        const auto bias_term = hn::Set(di, 1023 - std::int64_t(spec.bias));
+        const auto double_max_exp = hn::Set(di, 2047);
+        const int man_shift = 52 - spec.man_bits;
+
+        for (; HWY_IS_LITTLE_ENDIAN && i + lanes <= size; i += lanes) {
+            hn::VFromD<decltype(d)> word, man;
+            _hwy_load_float_data(d, src, false, i, word, man);
+            const auto sign = hn::And(word, one);
+            const auto exp = hn::ShiftRight<32>(word);
+            const auto is_zero = hn::And(hn::Eq(exp, zero), hn::Eq(man, zero));
+
+            // Subnormal, inf, and NaN sources, and results outside of the normal
+            // double-precision range, are evaluated by the caller
+            const auto res_exp = hn::Add(hn::BitCast(di, exp), bias_term);
+            const auto is_out_of_range = hn::Or(
+                hn::Le(res_exp, hn::Zero(di)), hn::Ge(res_exp, double_max_exp)
+            );
+            const auto fallback = hn::AndNot(
+                is_zero,
+                hn::Or(
+                    hn::Or(hn::Eq(exp, zero), hn::Eq(exp, max_exp)),
+                    hn::RebindMask(d, is_out_of_range)
+                )
+            );
+
+            if (hn::AllFalse(d, fallback)) {
+                const auto exp_field
+                    = hn::IfThenZeroElse(is_zero, hn::BitCast(d, res_exp));
+                const auto res = hn::Or(
+                    hn::Or(hn::ShiftLeft<63>(sign), hn::ShiftLeft<52>(exp_field)),
+                    hn::ShiftLeftSame(man, man_shift)
+                );
+                hn::StoreU(hn::BitCast(df, res), df, dst + i);
+            } else {
+                _hwy_add_fallback(fallback_idx, n_fallback, i, i + lanes);
+            }
+        }
+#endif
+        _hwy_add_fallback(fallback_idx, n_fallback, i, size);
+        return n_fallback;
+    }
+
     HWY_ATTR std::string _hwy_simd_version_str()
     {
         constexpr const hn::ScalableTag<apy_limb_t> d;
@@ -1010,8 +1991,26 @@ HWY_EXPORT(_hwy_vector_rsub_const);
 HWY_EXPORT(_hwy_vector_rsub_const_even_odd);
 HWY_EXPORT(_hwy_vector_rdiv_const_signed);
 HWY_EXPORT(_hwy_vector_multiply_accumulate);
+HWY_EXPORT(_hwy_matrix_multiply_accumulate_packed);
+HWY_EXPORT(_hwy_floating_point_mul_rnd_conv);
+HWY_EXPORT(_hwy_floating_point_mul_trn);
+HWY_EXPORT(_hwy_floating_point_add_same_wl_rnd_conv);
+HWY_EXPORT(_hwy_floating_point_add_same_wl_trn);
+HWY_EXPORT(_hwy_floating_point_sub_same_wl_rnd_conv);
+HWY_EXPORT(_hwy_floating_point_sub_same_wl_trn);
 HWY_EXPORT(_hwy_vector_any_zero);
 HWY_EXPORT(_hwy_vector_any_zero_pairwise);
+HWY_EXPORT(_hwy_vector_cast_trn);
+HWY_EXPORT(_hwy_vector_cast_rnd);
+HWY_EXPORT(_hwy_vector_cast_rnd_conv);
+HWY_EXPORT(_hwy_vector_cast_jam);
+HWY_EXPORT(_hwy_fixed_point_from_double);
+HWY_EXPORT(_hwy_fixed_point_from_single);
+HWY_EXPORT(_hwy_fixed_point_from_integer);
+HWY_EXPORT(_hwy_floating_point_from_double);
+HWY_EXPORT(_hwy_floating_point_from_single);
+HWY_EXPORT(_hwy_fixed_point_to_double);
+HWY_EXPORT(_hwy_floating_point_to_double);
 
 std::string get_simd_version_str()
 {
@@ -1468,6 +2467,21 @@ apy_limb_t vector_multiply_accumulate(
     );
 }
 
+void matrix_multiply_accumulate_packed(
+    apy_limb_t* dst,
+    std::size_t dst_stride,
+    const apy_limb_t* a_packed,
+    const apy_limb_t* b_packed,
+    std::size_t m,
+    std::size_t n,
+    std::size_t k
+)
+{
+    return HWY_DYNAMIC_DISPATCH(_hwy_matrix_multiply_accumulate_packed)(
+        dst, dst_stride, a_packed, b_packed, m, n, k
+    );
+}
+
 bool vector_any_zero(
     APyBuffer<apy_limb_t>::vector_type::const_iterator src_begin, std::size_t size
 )
@@ -1482,5 +2496,231 @@ bool vector_any_zero_pairwise(
     return HWY_DYNAMIC_DISPATCH(_hwy_vector_any_zero_pairwise)(&*src_begin, size);
 }
 
+void vector_cast_trn(
+    APyBuffer<apy_limb_t>::vector_type::const_iterator src_begin,
+    APyBuffer<apy_limb_t>::vector_type::iterator dst_begin,
+    int left_shift_amount,
+    unsigned dst_bits,
+    bool saturate,
+    std::size_t size
+)
+{
+    return HWY_DYNAMIC_DISPATCH(_hwy_vector_cast_trn)(
+        reinterpret_cast<apy_limb_signed_t*>(&*dst_begin),
+        reinterpret_cast<const apy_limb_signed_t*>(&*src_begin),
+        left_shift_amount,
+        dst_bits,
+        saturate,
+        size
+    );
+}
+
+void vector_cast_rnd(
+    APyBuffer<apy_limb_t>::vector_type::const_iterator src_begin,
+    APyBuffer<apy_limb_t>::vector_type::iterator dst_begin,
+    int left_shift_amount,
+    unsigned dst_bits,
+    bool saturate,
+    std::size_t size
+)
+{
+    return HWY_DYNAMIC_DISPATCH(_hwy_vector_cast_rnd)(
+        reinterpret_cast<apy_limb_signed_t*>(&*dst_begin),
+        reinterpret_cast<const apy_limb_signed_t*>(&*src_begin),
+        left_shift_amount,
+        dst_bits,
+        saturate,
+        size
+    );
+}
+
+void vector_cast_rnd_conv(
+    APyBuffer<apy_limb_t>::vector_type::const_iterator src_begin,
+    APyBuffer<apy_limb_t>::vector_type::iterator dst_begin,
+    int left_shift_amount,
+    unsigned dst_bits,
+    bool saturate,
+    std::size_t size
+)
+{
+    return HWY_DYNAMIC_DISPATCH(_hwy_vector_cast_rnd_conv)(
+        reinterpret_cast<apy_limb_signed_t*>(&*dst_begin),
+        reinterpret_cast<const apy_limb_signed_t*>(&*src_begin),
+        left_shift_amount,
+        dst_bits,
+        saturate,
+        size
+    );
+}
+
+void vector_cast_jam(
+    APyBuffer<apy_limb_t>::vector_type::const_iterator src_begin,
+    APyBuffer<apy_limb_t>::vector_type::iterator dst_begin,
+    int left_shift_amount,
+    unsigned dst_bits,
+    bool saturate,
+    std::size_t size
+)
+{
+    return HWY_DYNAMIC_DISPATCH(_hwy_vector_cast_jam)(
+        reinterpret_cast<apy_limb_signed_t*>(&*dst_begin),
+        reinterpret_cast<const apy_limb_signed_t*>(&*src_begin),
+        left_shift_amount,
+        dst_bits,
+        saturate,
+        size
+    );
+}
+
+std::size_t floating_point_mul(
+    APyFloatData* dst,
+    const APyFloatData* src1,
+    const APyFloatData* src2,
+    bool src1_is_scalar,
+    bool src2_is_scalar,
+    std::size_t size,
+    const APyFloatSpec& src1_spec,
+    const APyFloatSpec& src2_spec,
+    const APyFloatSpec& dst_spec,
+    QuantizationMode qntz,
+    std::size_t* fallback_idx
+)
+{
+    assert(qntz == QuantizationMode::RND_CONV || qntz == QuantizationMode::TRN);
+    auto f = qntz == QuantizationMode::RND_CONV
+        ? HWY_DYNAMIC_DISPATCH(_hwy_floating_point_mul_rnd_conv)
+        : HWY_DYNAMIC_DISPATCH(_hwy_floating_point_mul_trn);
+    return f(
+        dst,
+        src1,
+        src2,
+        src1_is_scalar,
+        src2_is_scalar,
+        size,
+        src1_spec,
+        src2_spec,
+        dst_spec,
+        fallback_idx
+    );
+}
+
+std::size_t floating_point_add_same_wl(
+    APyFloatData* dst,
+    const APyFloatData* src1,
+    const APyFloatData* src2,
+    bool src1_is_scalar,
+    bool src2_is_scalar,
+    std::size_t size,
+    const APyFloatSpec& spec,
+    QuantizationMode qntz,
+    bool is_subtract,
+    std::size_t* fallback_idx
+)
+{
+    assert(qntz == QuantizationMode::RND_CONV || qntz == QuantizationMode::TRN);
+    const bool rnd_conv = qntz == QuantizationMode::RND_CONV;
+    auto f = is_subtract
+        ? (rnd_conv ? HWY_DYNAMIC_DISPATCH(_hwy_floating_point_sub_same_wl_rnd_conv)
+                    : HWY_DYNAMIC_DISPATCH(_hwy_floating_point_sub_same_wl_trn))
+        : (rnd_conv ? HWY_DYNAMIC_DISPATCH(_hwy_floating_point_add_same_wl_rnd_conv)
+                    : HWY_DYNAMIC_DISPATCH(_hwy_floating_point_add_same_wl_trn));
+    return f(
+        dst, src1, src2, src1_is_scalar, src2_is_scalar, size, spec, fallback_idx
+    );
+}
+
+std::size_t fixed_point_from_double(
+    std::uint64_t* dst,
+    const double* src,
+    std::size_t size,
+    int frac_bits,
+    unsigned bits,
+    std::size_t* fallback_idx
+)
+{
+    assert(bits > 0 && bits <= 64 && std::abs(frac_bits) <= 1000);
+    return HWY_DYNAMIC_DISPATCH(_hwy_fixed_point_from_double)(
+        dst, src, size, frac_bits, bits, fallback_idx
+    );
+}
+
+std::size_t fixed_point_from_float(
+    std::uint64_t* dst,
+    const float* src,
+    std::size_t size,
+    int frac_bits,
+    unsigned bits,
+    std::size_t* fallback_idx
+)
+{
+    assert(bits > 0 && bits <= 64 && std::abs(frac_bits) <= 1000);
+    return HWY_DYNAMIC_DISPATCH(_hwy_fixed_point_from_single)(
+        dst, src, size, frac_bits, bits, fallback_idx
+    );
+}
+
+void fixed_point_from_integer(
+    std::uint64_t* dst,
+    const std::uint64_t* src,
+    std::size_t size,
+    int frac_bits,
+    unsigned bits,
+    bool src_is_signed
+)
+{
+    assert(bits > 0 && bits <= 64);
+    return HWY_DYNAMIC_DISPATCH(_hwy_fixed_point_from_integer)(
+        dst, src, size, frac_bits, bits, src_is_signed
+    );
+}
+
+std::size_t floating_point_from_double(
+    APyFloatData* dst,
+    const double* src,
+    std::size_t size,
+    const APyFloatSpec& spec,
+    std::size_t* fallback_idx
+)
+{
+    return HWY_DYNAMIC_DISPATCH(_hwy_floating_point_from_double)(
+        dst, src, size, spec, fallback_idx
+    );
+}
+
+std::size_t floating_point_from_float(
+    APyFloatData* dst,
+    const float* src,
+    std::size_t size,
+    const APyFloatSpec& spec,
+    std::size_t* fallback_idx
+)
+{
+    return HWY_DYNAMIC_DISPATCH(_hwy_floating_point_from_single)(
+        dst, src, size, spec, fallback_idx
+    );
+}
+
+void fixed_point_to_double(
+    double* dst, const std::uint64_t* src, std::size_t size, int frac_bits
+)
+{
+    assert(-1023 <= frac_bits && frac_bits <= 1022);
+    return HWY_DYNAMIC_DISPATCH(_hwy_fixed_point_to_double)(dst, src, size, frac_bits);
+}
+
+std::size_t floating_point_to_double(
+    double* dst,
+    const APyFloatData* src,
+    std::size_t size,
+    const APyFloatSpec& spec,
+    std::size_t* fallback_idx
+)
+{
+    assert(spec.man_bits <= 52);
+    return HWY_DYNAMIC_DISPATCH(_hwy_floating_point_to_double)(
+        dst, src, size, spec, fallback_idx
+    );
+}
+
 } // namespace simd
 #endif // HWY_ONCE
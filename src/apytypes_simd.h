@@ -399,6 +399,79 @@ apy_limb_t vector_multiply_accumulate(
     std::size_t size
 );
 
+//! Number of rows in each panel of the packed left-hand side of
+//! `matrix_multiply_accumulate_packed`
+constexpr std::size_t MATMUL_PANEL_ROWS = 4;
+
+/*!
+ * Single-limb (wrapping) matrix multiply-accumulate on packed operands, used as the
+ * micro-kernel of the cache-blocked fixed-point matrix multiplication. Computes
+ * `dst += A x B`, where:
+ * * A: [ `m` x `k` ] is packed in panels of `MATMUL_PANEL_ROWS` rows. Each panel is
+ *   stored column-by-column (`k` x `MATMUL_PANEL_ROWS`) and rows past `m` in the
+ *   last panel are zero.
+ * * B: [ `k` x `n` ] is stored contiguously in row-major order.
+ * * dst: [ `m` x `n` ] is stored in row-major order with a row stride of
+ *   `dst_stride` elements.
+ */
+void matrix_multiply_accumulate_packed(
+    apy_limb_t* dst,
+    std::size_t dst_stride,
+    const apy_limb_t* a_packed,
+    const apy_limb_t* b_packed,
+    std::size_t m,
+    std::size_t n,
+    std::size_t k
+);
+
+//! Test if floating-point format `spec` is supported by the SIMD floating-point
+//! arithmetic functions (`floating_point_mul` and `floating_point_add_same_wl`)
+inline bool is_floating_point_simd_format(const APyFloatSpec& spec)
+{
+    return spec.exp_bits + spec.man_bits <= 32;
+}
+
+/*!
+ * Floating-point multiplication `dst = src1 * src2` of `size` elements, quantized using
+ * `qntz`, which must be either `QuantizationMode::RND_CONV` or `QuantizationMode::TRN`.
+ * If `src1_is_scalar` (`src2_is_scalar`), `src1[0]` (`src2[0]`) is used for all
+ * elements. Only products of two normal numbers with a normal result are evaluated.
+ * The indices of all other elements, which are left untouched in `dst`, are written
+ * to `fallback_idx`, and their count is returned.
+ */
+std::size_t floating_point_mul(
+    APyFloatData* dst,
+    const APyFloatData* src1,
+    const APyFloatData* src2,
+    bool src1_is_scalar,
+    bool src2_is_scalar,
+    std::size_t size,
+    const APyFloatSpec& src1_spec,
+    const APyFloatSpec& src2_spec,
+    const APyFloatSpec& dst_spec,
+    QuantizationMode qntz,
+    std::size_t* fallback_idx
+);
+
+/*!
+ * Floating-point addition (or subtraction, if `is_subtract`) `dst = src1 +/- src2`
+ * of `size` elements, where the sources and the destination all share the floating-
+ * point format `spec`. Only sums of two normal numbers with a normal result (no
+ * cancellation) are evaluated. Otherwise the same as `floating_point_mul`.
+ */
+std::size_t floating_point_add_same_wl(
+    APyFloatData* dst,
+    const APyFloatData* src1,
+    const APyFloatData* src2,
+    bool src1_is_scalar,
+    bool src2_is_scalar,
+    std::size_t size,
+    const APyFloatSpec& spec,
+    QuantizationMode qntz,
+    bool is_subtract,
+    std::size_t* fallback_idx
+);
+
 /*!
  * Return true if any element in [ `src_begin`, `src_begin + size` ) is zero.
  */
@@ -414,6 +487,162 @@ bool vector_any_zero_pairwise(
     APyBuffer<apy_limb_t>::vector_type::const_iterator src_begin, std::size_t size
 );
 
+/*!
+ * Single-limb fixed-point cast with truncation (`QuantizationMode::TRN`). For each
+ * element in the iterator regions [ `*_begin`, `*_begin + size` ):
+ * * Shift element in `src_begin` left by `left_shift_amount` if it is non-negative,
+ *   otherwise arithmetically right by `-left_shift_amount`
+ * * Overflow the result to `dst_bits` bits using saturation if `saturate` is set,
+ *   otherwise using two's complement wrapping, and store it in `dst_begin`
+ *
+ * Requires `|left_shift_amount| < APY_LIMB_SIZE_BITS` and
+ * `0 < dst_bits <= APY_LIMB_SIZE_BITS`.
+ */
+void vector_cast_trn(
+    APyBuffer<apy_limb_t>::vector_type::const_iterator src_begin,
+    APyBuffer<apy_limb_t>::vector_type::iterator dst_begin,
+    int left_shift_amount,
+    unsigned dst_bits,
+    bool saturate,
+    std::size_t size
+);
+
+/*!
+ * Single-limb fixed-point cast with rounding, ties toward plus infinity
+ * (`QuantizationMode::RND`). Same as `vector_cast_trn` otherwise.
+ */
+void vector_cast_rnd(
+    APyBuffer<apy_limb_t>::vector_type::const_iterator src_begin,
+    APyBuffer<apy_limb_t>::vector_type::iterator dst_begin,
+    int left_shift_amount,
+    unsigned dst_bits,
+    bool saturate,
+    std::size_t size
+);
+
+/*!
+ * Single-limb fixed-point cast with rounding, ties toward even quantization steps
+ * (`QuantizationMode::RND_CONV`). Same as `vector_cast_trn` otherwise.
+ */
+void vector_cast_rnd_conv(
+    APyBuffer<apy_limb_t>::vector_type::const_iterator src_begin,
+    APyBuffer<apy_limb_t>::vector_type::iterator dst_begin,
+    int left_shift_amount,
+    unsigned dst_bits,
+    bool saturate,
+    std::size_t size
+);
+
+/*!
+ * Single-limb fixed-point cast with jamming (`QuantizationMode::JAM`). Same as
+ * `vector_cast_trn` otherwise.
+ */
+void vector_cast_jam(
+    APyBuffer<apy_limb_t>::vector_type::const_iterator src_begin,
+    APyBuffer<apy_limb_t>::vector_type::iterator dst_begin,
+    int left_shift_amount,
+    unsigned dst_bits,
+    bool saturate,
+    std::size_t size
+);
+
+/*!
+ * Convert `size` double-precision values in `src` to single-limb fixed-point with
+ * `frac_bits` fractional bits, rounded to nearest with ties away from zero, and
+ * wrapped to `bits` bits, the same as `fixed_point_from_double_single_limb` with
+ * 64-bit limbs. Values that are non-finite, or do not fit in 64 bits before wrapping,
+ * are left untouched in `dst`. Their indices are written to `fallback_idx`, and their
+ * count is returned.
+ *
+ * Requires `0 < bits <= 64` and `|frac_bits| <= 1000`.
+ */
+std::size_t fixed_point_from_double(
+    std::uint64_t* dst,
+    const double* src,
+    std::size_t size,
+    int frac_bits,
+    unsigned bits,
+    std::size_t* fallback_idx
+);
+
+//! Same as `fixed_point_from_double`, for single-precision values in `src`
+std::size_t fixed_point_from_float(
+    std::uint64_t* dst,
+    const float* src,
+    std::size_t size,
+    int frac_bits,
+    unsigned bits,
+    std::size_t* fallback_idx
+);
+
+/*!
+ * Convert `size` 64-bit integers in `src` (two's complement if `src_is_signed`) to
+ * single-limb fixed-point with `frac_bits` fractional bits, shifting out fractional
+ * bits of negative `frac_bits` toward minus infinity, and wrapping to `bits` bits.
+ * Narrower integers must be sign- or zero-extended to 64 bits by the caller.
+ *
+ * Requires `0 < bits <= 64`.
+ */
+void fixed_point_from_integer(
+    std::uint64_t* dst,
+    const std::uint64_t* src,
+    std::size_t size,
+    int frac_bits,
+    unsigned bits,
+    bool src_is_signed
+);
+
+/*!
+ * Convert `size` double-precision values in `src` to the floating-point format
+ * `spec`, rounded to nearest with ties to even, the same as
+ * `APyFloat::cast_from_double`. Only zeros and normal numbers with a normal result
+ * are evaluated. Otherwise the same as `floating_point_mul`.
+ */
+std::size_t floating_point_from_double(
+    APyFloatData* dst,
+    const double* src,
+    std::size_t size,
+    const APyFloatSpec& spec,
+    std::size_t* fallback_idx
+);
+
+//! Same as `floating_point_from_double`, for single-precision values in `src`
+std::size_t floating_point_from_float(
+    APyFloatData* dst,
+    const float* src,
+    std::size_t size,
+    const APyFloatSpec& spec,
+    std::size_t* fallback_idx
+);
+
+/*!
+ * Convert `size` single-limb fixed-point values in `src`, with `frac_bits` fractional
+ * bits and sign-extended to 64 bits, to double precision. The result is exact, and the
+ * same as `FixedPointToDouble`, if the values have at most 53 bits and the result is a
+ * normal double-precision number.
+ *
+ * Requires `-1023 <= frac_bits <= 1022`.
+ */
+void fixed_point_to_double(
+    double* dst, const std::uint64_t* src, std::size_t size, int frac_bits
+);
+
+/*!
+ * Convert `size` floating-point values in `src`, of format `spec`, to double
+ * precision, the same as the scalar `floating_point_to_double`. Only zeros and normal
+ * numbers with a normal result are evaluated. Otherwise the same as
+ * `floating_point_mul`.
+ *
+ * Requires `spec.man_bits <= 52`.
+ */
+std::size_t floating_point_to_double(
+    double* dst,
+    const APyFloatData* src,
+    std::size_t size,
+    const APyFloatSpec& spec,
+    std::size_t* fallback_idx
+);
+
 /*
  * Functor export from functions
  */
@@ -0,0 +1,406 @@
+#include "apytypes_text_io.h"
+#include "apytypes_common.h"
+
+// Python object access through Nanobind
+#include <nanobind/nanobind.h>
+namespace nb = nanobind;
+
+#include <algorithm> // std::count, std::fill
+#include <atomic>    // std::atomic
+#include <charconv>  // std::to_chars
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint64_t, std::int64_t
+#include <string>    // std::string
+#include <utility>   // std::move
+#include <vector>    // std::vector
+
+#include <fmt/format.h>
+
+TextFormat TextFormat::from_python(
+    std::string_view radix,
+    const std::optional<std::string>& delimiter,
+    std::string line_end,
+    bool is_signed
+)
+{
+    TextRadix text_radix;
+    if (radix == "dec") {
+        text_radix = TextRadix::DEC;
+    } else if (radix == "hex") {
+        text_radix = TextRadix::HEX;
+    } else if (radix == "bin") {
+        text_radix = TextRadix::BIN;
+    } else {
+        throw nb::value_error(fmt::format("Unknown radix: {}", radix).c_str());
+    }
+    return TextFormat { text_radix, delimiter, std::move(line_end), is_signed };
+}
+
+/* ********************************************************************************** *
+ * *                       Multi-word arithmetic helpers                            * *
+ * ********************************************************************************** */
+
+//! Two's complement negation of `words`
+static void negate_words(std::uint64_t* words, std::size_t n_words)
+{
+    std::uint64_t carry = 1;
+    for (std::size_t i = 0; i < n_words; i++) {
+        words[i] = ~words[i] + carry;
+        carry = carry && words[i] == 0;
+    }
+}
+
+//! Compute `words = words * factor + term`, for `factor` and `term` below 2^32.
+//! Overflowing bits are discarded.
+static void mul_add_words(
+    std::uint64_t* words, std::size_t n_words, std::uint64_t factor, std::uint64_t term
+)
+{
+    std::uint64_t carry = term;
+    for (std::size_t i = 0; i < n_words; i++) {
+        const std::uint64_t lo = (words[i] & 0xFFFFFFFF) * factor + carry;
+        const std::uint64_t hi = (words[i] >> 32) * factor + (lo >> 32);
+        words[i] = (hi << 32) | (lo & 0xFFFFFFFF);
+        carry = hi >> 32;
+    }
+}
+
+//! Compute `words = words / divisor` and return the remainder, for `divisor` below 2^32
+static std::uint64_t
+div_words(std::uint64_t* words, std::size_t n_words, std::uint64_t divisor)
+{
+    std::uint64_t rem = 0;
+    for (std::size_t i = n_words; i-- > 0;) {
+        const std::uint64_t hi = (rem << 32) | (words[i] >> 32);
+        const std::uint64_t lo = ((hi % divisor) << 32) | (words[i] & 0xFFFFFFFF);
+        words[i] = ((hi / divisor) << 32) | (lo / divisor);
+        rem = lo % divisor;
+    }
+    return rem;
+}
+
+//! Zero (`is_signed == false`) or sign-extend the bits above bit `bits - 1` of `words`
+static void
+extend_words(std::uint64_t* words, std::size_t n_words, int bits, bool is_signed)
+{
+    const std::size_t ms_word = (std::size_t(bits) - 1) / 64;
+    const unsigned ms_bits = unsigned(bits - 64 * ms_word);
+    std::uint64_t extension = 0;
+    if (ms_bits < 64) {
+        const std::uint64_t mask = (std::uint64_t(1) << ms_bits) - 1;
+        const bool is_negative = is_signed && (words[ms_word] >> (ms_bits - 1)) & 1;
+        words[ms_word] = is_negative ? words[ms_word] | ~mask : words[ms_word] & mask;
+        extension = is_negative ? ~std::uint64_t(0) : 0;
+    } else if (is_signed && std::int64_t(words[ms_word]) < 0) {
+        extension = ~std::uint64_t(0);
+    }
+    std::fill(words + ms_word + 1, words + n_words, extension);
+}
+
+/* ********************************************************************************** *
+ * *                         Formatting and parsing                                 * *
+ * ********************************************************************************** */
+
+void format_bit_pattern(
+    std::string& out,
+    std::uint64_t* words,
+    std::size_t n_words,
+    int bits,
+    TextRadix radix,
+    bool is_signed
+)
+{
+    static constexpr char DIGITS[] = "0123456789abcdef";
+    is_signed &= radix == TextRadix::DEC;
+    extend_words(words, n_words, bits, is_signed);
+
+    if (radix != TextRadix::DEC) {
+        const unsigned digit_bits = radix == TextRadix::HEX ? 4 : 1;
+        const std::uint64_t digit_mask = (std::uint64_t(1) << digit_bits) - 1;
+        const std::size_t n_digits = (std::size_t(bits) + digit_bits - 1) / digit_bits;
+        for (std::size_t d = n_digits; d-- > 0;) {
+            const std::size_t bit = d * digit_bits;
+            out += DIGITS[(words[bit / 64] >> (bit % 64)) & digit_mask];
+        }
+        return;
+    }
+
+    char buffer[24];
+    if (n_words == 1) {
+        auto [end, ec] = is_signed
+            ? std::to_chars(buffer, buffer + sizeof(buffer), std::int64_t(words[0]))
+            : std::to_chars(buffer, buffer + sizeof(buffer), words[0]);
+        (void)ec;
+        out.append(buffer, end);
+        return;
+    }
+
+    if (is_signed && std::int64_t(words[n_words - 1]) < 0) {
+        negate_words(words, n_words);
+        out += '-';
+    }
+
+    // Split the value into base-10^9 chunks, least significant first
+    constexpr std::uint64_t CHUNK_BASE = 1'000'000'000;
+    ScratchVector<std::uint32_t, 16> chunks;
+    std::size_t n_nonzero = n_words;
+    do {
+        chunks.push_back(std::uint32_t(div_words(words, n_nonzero, CHUNK_BASE)));
+        while (n_nonzero && words[n_nonzero - 1] == 0) {
+            n_nonzero--;
+        }
+    } while (n_nonzero);
+
+    auto end = std::to_chars(buffer, buffer + sizeof(buffer), chunks.back()).ptr;
+    out.append(buffer, end);
+    for (std::size_t i = chunks.size() - 1; i-- > 0;) {
+        end = std::to_chars(buffer, buffer + sizeof(buffer), chunks[i]).ptr;
+        out.append(9 - std::size_t(end - buffer), '0');
+        out.append(buffer, end);
+    }
+}
+
+bool parse_bit_pattern(
+    std::string_view token, std::uint64_t* words, std::size_t n_words, TextRadix radix
+)
+{
+    std::fill(words, words + n_words, 0);
+
+    bool is_negative = false;
+    if (radix == TextRadix::DEC && !token.empty()
+        && (token.front() == '-' || token.front() == '+')) {
+        is_negative = token.front() == '-';
+        token.remove_prefix(1);
+    }
+
+    std::size_t n_digits = 0;
+    if (radix == TextRadix::DEC) {
+        // Accumulate up to nine digits at a time
+        std::uint64_t chunk = 0, chunk_scale = 1;
+        for (char c : token) {
+            if (c == '_') {
+                continue;
+            }
+            if (c < '0' || c > '9') {
+                return false;
+            }
+            chunk = 10 * chunk + std::uint64_t(c - '0');
+            chunk_scale *= 10;
+            n_digits++;
+            if (chunk_scale == 1'000'000'000) {
+                mul_add_words(words, n_words, chunk_scale, chunk);
+                chunk = 0;
+                chunk_scale = 1;
+            }
+        }
+        if (chunk_scale > 1) {
+            mul_add_words(words, n_words, chunk_scale, chunk);
+        }
+    } else {
+        // Insert digits from the least significant one
+        const unsigned digit_bits = radix == TextRadix::HEX ? 4 : 1;
+        std::size_t bit = 0;
+        for (std::size_t i = token.size(); i-- > 0;) {
+            const char c = token[i];
+            unsigned digit;
+            if (c == '_') {
+                continue;
+            } else if (c >= '0' && c <= '9') {
+                digit = unsigned(c - '0');
+            } else if (c >= 'a' && c <= 'f') {
+                digit = unsigned(c - 'a' + 10);
+            } else if (c >= 'A' && c <= 'F') {
+                digit = unsigned(c - 'A' + 10);
+            } else {
+                return false;
+            }
+            if (digit >> digit_bits) {
+                return false;
+            }
+            if (bit < 64 * n_words) {
+                words[bit / 64] |= std::uint64_t(digit) << (bit % 64);
+            }
+            bit += digit_bits;
+            n_digits++;
+        }
+    }
+
+    if (is_negative) {
+        negate_words(words, n_words);
+    }
+    return n_digits > 0;
+}
+
+/* ********************************************************************************** *
+ * *                             Reading text files                                 * *
+ * ********************************************************************************** */
+
+//! Test if `c` is a whitespace character separating values
+static bool is_space(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+
+//! Remove leading and trailing whitespace
+static std::string_view strip(std::string_view str)
+{
+    while (!str.empty() && is_space(str.front())) {
+        str.remove_prefix(1);
+    }
+    while (!str.empty() && is_space(str.back())) {
+        str.remove_suffix(1);
+    }
+    return str;
+}
+
+//! Call `f(token)` for each value on the (stripped, non-empty) line. Return the number
+//! of values.
+template <typename F>
+static std::size_t
+for_each_token(std::string_view line, const TextFormat& format, F&& f)
+{
+    std::size_t n = 0;
+    if (format.delimiter) {
+        const std::string& delimiter = *format.delimiter;
+        for (;;) {
+            const std::size_t pos = line.find(delimiter);
+            f(strip(line.substr(0, pos)));
+            n++;
+            if (pos == std::string_view::npos) {
+                return n;
+            }
+            line.remove_prefix(pos + delimiter.size());
+        }
+    }
+    while (!line.empty()) {
+        std::size_t pos = 0;
+        while (pos < line.size() && !is_space(line[pos])) {
+            pos++;
+        }
+        f(line.substr(0, pos));
+        n++;
+        line = strip(line.substr(pos));
+    }
+    return n;
+}
+
+//! Parse the complete lines of `text` into `table`. `first_line` is the line number of
+//! the first line of `text`, used in error messages.
+static void parse_lines(
+    std::string_view text,
+    std::size_t first_line,
+    std::size_t n_words,
+    const TextFormat& format,
+    BitPatternTable& table
+)
+{
+    // Split into stripped lines holding values, with comments removed
+    std::vector<std::string_view> lines;
+    std::vector<std::size_t> line_numbers;
+    for (std::size_t line_number = first_line; !text.empty(); line_number++) {
+        const std::size_t pos = text.find('\n');
+        std::string_view line = text.substr(0, pos);
+        text.remove_prefix(pos == std::string_view::npos ? text.size() : pos + 1);
+        if (!format.delimiter) {
+            line = line.substr(0, line.find("//"));
+        }
+        line = strip(line);
+        if (!line.empty()) {
+            lines.push_back(line);
+            line_numbers.push_back(line_number);
+        }
+    }
+    if (lines.empty()) {
+        return;
+    }
+
+    // Count the values on each line
+    const std::size_t n_lines = lines.size();
+    std::vector<std::size_t> offsets(n_lines + 1);
+    const bool use_threadpool = n_lines >= TEXT_IO_THREADPOOL_THRESHOLD;
+    threadpool_chunked_for(use_threadpool, n_lines, [&](auto begin, auto end) {
+        for (std::size_t i = begin; i < end; i++) {
+            offsets[i + 1] = for_each_token(lines[i], format, [](std::string_view) { });
+        }
+    });
+    if (format.delimiter) {
+        if (table.n_lines == 0) {
+            table.columns = offsets[1];
+        }
+        for (std::size_t i = 0; i < n_lines; i++) {
+            if (offsets[i + 1] != table.columns) {
+                throw nb::value_error(
+                    fmt::format(
+                        "Line {}: expected {} values, got {}",
+                        line_numbers[i],
+                        table.columns,
+                        offsets[i + 1]
+                    )
+                        .c_str()
+                );
+            }
+        }
+    }
+    for (std::size_t i = 0; i < n_lines; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+
+    // Parse the values, recording the first line with an invalid value
+    table.words.resize(n_words * (table.n_values + offsets[n_lines]));
+    std::uint64_t* dst = table.words.data() + n_words * table.n_values;
+    std::atomic<std::size_t> first_invalid_line = n_lines;
+    threadpool_chunked_for(use_threadpool, n_lines, [&](auto begin, auto end) {
+        for (std::size_t i = begin; i < end; i++) {
+            std::uint64_t* words = dst + n_words * offsets[i];
+            bool is_valid = true;
+            for_each_token(lines[i], format, [&](std::string_view token) {
+                is_valid &= parse_bit_pattern(token, words, n_words, format.radix);
+                words += n_words;
+            });
+            std::size_t current = first_invalid_line.load();
+            while (!is_valid && i < current
+                   && !first_invalid_line.compare_exchange_weak(current, i)) { }
+        }
+    });
+
+    if (std::size_t i = first_invalid_line.load(); i < n_lines) {
+        std::string_view invalid;
+        std::vector<std::uint64_t> words(n_words);
+        for_each_token(lines[i], format, [&](std::string_view token) {
+            if (invalid.empty()
+                && !parse_bit_pattern(token, words.data(), n_words, format.radix)) {
+                invalid = token.empty() ? std::string_view("<empty>") : token;
+            }
+        });
+        throw nb::value_error(
+            fmt::format("Line {}: invalid value '{}'", line_numbers[i], invalid).c_str()
+        );
+    }
+
+    table.n_values += offsets[n_lines];
+    table.n_lines += n_lines;
+}
+
+BitPatternTable read_bit_patterns(
+    const nb::object& file, std::size_t n_words, const TextFormat& format
+)
+{
+    constexpr std::size_t BLOCK_BYTES = std::size_t(1) << 22;
+    nb::object read = file.attr("read");
+
+    BitPatternTable table;
+    std::string buffer;
+    std::size_t line_number = 1;
+    for (;;) {
+        nb::bytes block = nb::cast<nb::bytes>(read(BLOCK_BYTES));
+        const bool is_eof = block.size() == 0;
+        buffer.append(block.c_str(), block.size());
+
+        // Parse all complete lines, keep the rest for the next block
+        const std::size_t cut = is_eof ? buffer.size() : buffer.rfind('\n') + 1;
+        const std::string_view text = std::string_view(buffer).substr(0, cut);
+        parse_lines(text, line_number, n_words, format, table);
+        line_number += std::size_t(std::count(text.begin(), text.end(), '\n'));
+        buffer.erase(0, cut);
+        if (is_eof) {
+            return table;
+        }
+    }
+}
@@ -0,0 +1,162 @@
+/*
+ * Streaming text I/O of bit patterns, used by `export_csv`, `import_csv`, `export_mem`,
+ * and `import_mem`. Bit patterns are formatted and parsed one block at a time, on the
+ * thread pool for large blocks, with the GIL released. Each bit pattern is passed
+ * around as a sequence of little-endian 64-bit words, independent of the limb size.
+ */
+
+#ifndef _APYTYPES_TEXT_IO_H
+#define _APYTYPES_TEXT_IO_H
+
+#include "apytypes_common.h"
+#include "apytypes_scratch_vector.h"
+
+#include <nanobind/nanobind.h>
+namespace nb = nanobind;
+
+#include <algorithm>   // std::min
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint64_t
+#include <optional>    // std::optional
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
+
+//! Radix of bit patterns in text files
+enum class TextRadix { DEC, HEX, BIN };
+
+//! Layout of bit patterns in text files
+struct TextFormat {
+    //! Radix of the bit patterns
+    TextRadix radix;
+    //! Delimiter between values on a line. If not set, values are separated by
+    //! whitespace and `//` starts a comment, as in Verilog `$readmemh`/`$readmemb`
+    //! memory files.
+    std::optional<std::string> delimiter;
+    //! Line terminator when writing
+    std::string line_end;
+    //! Write decimal values as signed two's complement numbers
+    bool is_signed;
+
+    //! Create a `TextFormat` from its Python representation
+    static TextFormat from_python(
+        std::string_view radix,
+        const std::optional<std::string>& delimiter,
+        std::string line_end = "\n",
+        bool is_signed = false
+    );
+};
+
+//! Minimum number of values in a block for formatting or parsing it on the thread pool
+constexpr std::size_t TEXT_IO_THREADPOOL_THRESHOLD = 8192;
+
+//! Number of 64-bit words of a `bits`-bit pattern
+constexpr std::size_t bits_to_words(int bits) { return (std::size_t(bits) + 63) / 64; }
+
+//! Append the `bits`-bit pattern in the `n_words` words at `words` to `out`.
+//! Hexadecimal and binary patterns are zero-padded to `bits` bits. Decimal patterns are
+//! written as unsigned numbers, unless `is_signed` is set. The words are clobbered.
+void format_bit_pattern(
+    std::string& out,
+    std::uint64_t* words,
+    std::size_t n_words,
+    int bits,
+    TextRadix radix,
+    bool is_signed
+);
+
+//! Parse a bit pattern into the `n_words` words at `words`. Decimal values may be
+//! negative, in which case the two's complement pattern is stored. Bits beyond the
+//! words are discarded. Return `false` if `token` is not a valid number.
+bool parse_bit_pattern(
+    std::string_view token, std::uint64_t* words, std::size_t n_words, TextRadix radix
+);
+
+/*!
+ * Write `n_items` `bits`-bit patterns as text to the binary Python file object `file`,
+ * `columns` values per line. The pattern of item `i` is fetched by calling
+ * `get_words(i, words)`, which must not throw.
+ */
+template <typename GET_WORDS>
+void write_bit_patterns(
+    const nb::object& file,
+    std::size_t n_items,
+    std::size_t columns,
+    int bits,
+    const TextFormat& format,
+    const GET_WORDS& get_words
+)
+{
+    constexpr std::size_t BLOCK_ITEMS = std::size_t(1) << 16;
+    constexpr std::size_t N_SUB_BLOCKS = 64;
+    const std::size_t n_words = bits_to_words(bits);
+    const std::string delimiter = format.delimiter.value_or(" ");
+    const TextRadix radix = format.radix;
+    const bool sign = format.is_signed;
+
+    nb::object write = file.attr("write");
+    std::vector<std::string> texts(N_SUB_BLOCKS);
+    for (std::size_t block = 0; block < n_items; block += BLOCK_ITEMS) {
+        const std::size_t block_end = std::min(block + BLOCK_ITEMS, n_items);
+        const std::size_t n_block = block_end - block;
+        const std::size_t sub_size = (n_block + N_SUB_BLOCKS - 1) / N_SUB_BLOCKS;
+        const bool use_threadpool = n_block >= TEXT_IO_THREADPOOL_THRESHOLD;
+        const auto format_sub_blocks = [&](std::size_t begin, std::size_t end) {
+            ScratchVector<std::uint64_t, 4> words(n_words);
+            for (std::size_t sub = begin; sub < end; sub++) {
+                std::string& text = texts[sub];
+                text.clear();
+                const std::size_t first = block + sub * sub_size;
+                const std::size_t last = std::min(first + sub_size, block_end);
+                for (std::size_t i = first; i < last; i++) {
+                    get_words(i, words.data());
+                    format_bit_pattern(text, words.data(), n_words, bits, radix, sign);
+                    text += (i + 1) % columns ? delimiter : format.line_end;
+                }
+            }
+        };
+        {
+            const GILRelease gil_release(n_block);
+            threadpool_chunked_for(use_threadpool, N_SUB_BLOCKS, format_sub_blocks);
+        }
+        for (const std::string& text : texts) {
+            if (!text.empty()) {
+                write(nb::bytes(text.data(), text.size()));
+            }
+        }
+    }
+}
+
+//! Bit patterns read from a text file
+struct BitPatternTable {
+    //! The bit patterns, `n_words` words each
+    std::vector<std::uint64_t> words;
+    //! Number of values
+    std::size_t n_values = 0;
+    //! Number of lines holding values
+    std::size_t n_lines = 0;
+    //! Number of values on each line (only set for delimited formats)
+    std::size_t columns = 0;
+
+    //! Shape of the array holding the values. Delimited formats give one row per line,
+    //! or a one-dimensional array for a single line. Whitespace-separated formats give
+    //! a one-dimensional array.
+    std::vector<std::size_t> shape(const TextFormat& format) const
+    {
+        if (format.delimiter && n_lines > 1) {
+            return { n_lines, columns };
+        }
+        return { n_values };
+    }
+};
+
+/*!
+ * Read all bit patterns from the binary Python file object `file`, as `n_words` words
+ * each. Lines without values are skipped. For delimited formats, all lines must hold
+ * the same number of values. Throws `nb::value_error` on invalid values.
+ */
+BitPatternTable read_bit_patterns(
+    const nb::object& file, std::size_t n_words, const TextFormat& format
+);
+
+#endif // _APYTYPES_TEXT_IO_H
@@ -12,6 +12,7 @@
 #include <fmt/format.h>
 
 #include <algorithm>        // std::find, std::unique, etc...
+#include <charconv>         // std::to_chars
 #include <cstddef>          // std::size_t, std::ptrdiff_t
 #include <cstdint>          // std::int64_t
 #include <functional>       // std::bit_not
@@ -29,6 +30,7 @@
 #include "apytypes_common.h"
 #include "apytypes_fwd.h"
 #include "apytypes_mp.h"
+#include "apytypes_scratch_vector.h"
 #include "simd_hints.h"
 
 /*!
@@ -311,6 +313,52 @@ bcds_to_string(const std::vector<apy_limb_t>& bcds)
     return result;
 }
 
+/*!
+ * Append the decimal representation of the unsigned limb vector `limbs`, of `n_limbs`
+ * limbs, to `out`. Single-limb values are converted directly. Wider values are
+ * converted by repeated division with the largest power of ten fitting in a limb, one
+ * chunk of digits at a time, using a pre-computed inverse of the divisor. The limb
+ * vector is clobbered.
+ */
+[[maybe_unused]] static APY_INLINE void
+limb_vector_to_decimal(std::string& out, apy_limb_t* limbs, std::size_t n_limbs)
+{
+    char buffer[24];
+    char* const buffer_end = buffer + sizeof(buffer);
+    while (n_limbs > 1 && limbs[n_limbs - 1] == 0) {
+        n_limbs--;
+    }
+    if (n_limbs == 1) {
+        out.append(buffer, std::to_chars(buffer, buffer_end, limbs[0]).ptr);
+        return;
+    }
+
+    // Largest power of ten fitting in a limb, and its number of digits
+    constexpr std::size_t CHUNK_DIGITS = APY_LIMB_SIZE_BITS == 64 ? 19 : 9;
+    static constexpr apy_limb_t CHUNK_BASE = APY_LIMB_SIZE_BITS == 64
+        ? apy_limb_t(10'000'000'000'000'000'000ULL)
+        : apy_limb_t(1'000'000'000);
+    static const APyDivInverse inv(&CHUNK_BASE, 1);
+
+    // Chunks of digits, least significant first
+    ScratchVector<apy_limb_t, 16> chunks;
+    do {
+        chunks.push_back(
+            apy_division_single_limb_preinverted(limbs, limbs, n_limbs, &inv)
+        );
+        while (n_limbs && limbs[n_limbs - 1] == 0) {
+            n_limbs--;
+        }
+    } while (n_limbs);
+
+    out.append(buffer, std::to_chars(buffer, buffer_end, chunks.back()).ptr);
+    for (std::size_t i = chunks.size() - 1; i-- > 0;) {
+        char* end = std::to_chars(buffer, buffer_end, chunks[i]).ptr;
+        out.append(CHUNK_DIGITS - std::size_t(end - buffer), '0');
+        out.append(buffer, end);
+    }
+}
+
 //! Reverse double-dabble algorithm for BCD->binary conversion
 [[maybe_unused, nodiscard]] static APY_INLINE std::vector<apy_limb_t>
 reverse_double_dabble(const std::vector<std::uint8_t>& bcd_list)
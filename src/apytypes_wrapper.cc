@@ -5,6 +5,7 @@
 namespace nb = nanobind;
 
 void bind_accumulator_context(nb::module_& m);
+void bind_buffer_pool_context(nb::module_& m);
 void bind_cast_context(nb::module_& m);
 void bind_cfixed(nb::module_& m);
 void bind_cfixed_array(nb::module_& m);
@@ -12,6 +13,8 @@ void bind_cfloat(nb::module_& m);
 void bind_cfloat_array(nb::module_& m);
 void bind_common(nb::module_& m);
 void bind_context_manager(nb::module_& m);
+void bind_fir(nb::module_& m);
+void bind_iir(nb::module_& m);
 void bind_fixed(nb::module_& m);
 void bind_fixed_array(nb::module_& m);
 void bind_float(nb::module_& m);
@@ -29,10 +32,13 @@ NB_MODULE(_apytypes, m)
     bind_fixed_array(m);
     bind_float(m);
     bind_float_array(m);
+    bind_fir(m);
+    bind_iir(m);
     bind_context_manager(m);
     bind_quantization_context(m);
     bind_accumulator_context(m);
     bind_cast_context(m);
+    bind_buffer_pool_context(m);
 
     /*
      * Nanobind leak warnings are enabled by `NANOBIND_LEAK_WARNINGS` pre-processor
@@ -408,7 +414,12 @@ void bind_common(nb::module_& m)
         )
         .def(
             "reset_thread_pool",
-            [](std::size_t n_threads) { thread_pool.reset(n_threads); },
+            [](std::size_t n_threads) {
+                // Wait for jobs submitted by other Python threads to finish
+                nb::gil_scoped_release gil_release;
+                const std::scoped_lock pool_lock(thread_pool_mutex);
+                thread_pool.reset(n_threads);
+            },
             nb::arg("n_threads"),
             R"pbdoc(
             Reset the APyTypes thread pool with a new thread count.
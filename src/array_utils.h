@@ -3,14 +3,19 @@
 
 #include "apyfixed.h"
 #include "apyfloat.h"
+#include "apytypes_scratch_vector.h"
 #include "apytypes_util.h"
+#include "ieee754.h"
 
 #include <nanobind/nanobind.h>
 #include <nanobind/ndarray.h>
 #include <nanobind/stl/variant.h>
 namespace nb = nanobind;
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <unordered_set>
 #include <variant>
 #include <vector>
@@ -201,6 +206,291 @@ static APY_INLINE void transpose_axes_and_copy_data(
     }
 }
 
+/*!
+ * Reader of the elements of an ndarray with arbitrary strides, in C (row-major)
+ * order. Transposed, sliced, and Fortran-ordered arrays are read in place, without
+ * first being copied to a contiguous temporary. The element type `T` must match the
+ * `dtype` of the ndarray.
+ */
+template <typename T> class NDArrayReader {
+public:
+    explicit NDArrayReader(const nb::ndarray<>& ndarray)
+        : _data { static_cast<const T*>(ndarray.data()) }
+        , _shape(ndarray.ndim())
+        , _strides(ndarray.ndim())
+        , _size { ndarray.size() }
+        , _is_contiguous { true }
+    {
+        std::int64_t c_stride = 1;
+        for (std::size_t i = ndarray.ndim(); i--;) {
+            _shape[i] = ndarray.shape(i);
+            _strides[i] = ndarray.stride(i);
+            if (_shape[i] != 1 && _strides[i] != c_stride) {
+                _is_contiguous = false;
+            }
+            c_stride *= std::int64_t(_shape[i]);
+        }
+    }
+
+    //! Number of elements in the ndarray
+    std::size_t size() const noexcept { return _size; }
+
+    //! Pointer to the `n` elements starting at C-order index `begin`. If the ndarray
+    //! is C-contiguous the pointer points into it, otherwise the elements are
+    //! gathered into `buffer`, which must fit at least `n` elements.
+    const T* read(std::size_t begin, std::size_t n, T* buffer) const
+    {
+        if (_is_contiguous) {
+            return _data + begin;
+        }
+        if (n == 0) {
+            return buffer;
+        }
+
+        // Multi-dimensional index, and element offset, of `begin`
+        ScratchVector<std::size_t, 8> index(_shape.size());
+        std::int64_t offset = 0;
+        std::size_t rem = begin;
+        for (std::size_t d = _shape.size(); d--;) {
+            index[d] = rem % _shape[d];
+            rem /= _shape[d];
+            offset += std::int64_t(index[d]) * _strides[d];
+        }
+
+        const std::size_t last = _shape.size() - 1;
+        for (std::size_t k = 0;;) {
+            buffer[k] = _data[offset];
+            if (++k == n) {
+                break;
+            }
+
+            // Step to the next element in C order
+            std::size_t d = last;
+            offset += _strides[d];
+            while (++index[d] == _shape[d] && d > 0) {
+                offset -= std::int64_t(_shape[d]) * _strides[d];
+                index[d] = 0;
+                offset += _strides[--d];
+            }
+        }
+        return buffer;
+    }
+
+    //! Call `f(i, value)` for every element of the ndarray, in C order
+    template <typename FUNC> void for_each(FUNC&& f) const
+    {
+        constexpr std::size_t BLOCK_SIZE = 256;
+        T buffer[BLOCK_SIZE];
+        for (std::size_t i = 0; i < _size; i += BLOCK_SIZE) {
+            const std::size_t n = std::min(BLOCK_SIZE, _size - i);
+            const T* src = read(i, n, buffer);
+            for (std::size_t j = 0; j < n; j++) {
+                f(i + j, src[j]);
+            }
+        }
+    }
+
+private:
+    const T* _data;
+    std::vector<std::size_t> _shape;
+    std::vector<std::int64_t> _strides;
+    std::size_t _size;
+    bool _is_contiguous;
+};
+
+/* ********************************************************************************** *
+ * *                   Native binary file format payload encoding                   * *
+ * ********************************************************************************** */
+
+//! Number of bytes of a floating-point item in the native binary file format payload
+constexpr std::size_t RAW_FLOAT_RECORD_BYTES = 16;
+
+//! Store the `n_bytes` least significant bytes of `value` at `dst`, little-endian
+template <typename UINT_TYPE>
+static APY_INLINE void
+store_le(std::uint8_t* dst, UINT_TYPE value, std::size_t n_bytes)
+{
+    for (std::size_t i = 0; i < n_bytes; i++) {
+        dst[i] = std::uint8_t(value >> (8 * i));
+    }
+}
+
+//! Load a little-endian `UINT_TYPE` from `src`
+template <typename UINT_TYPE>
+static APY_INLINE UINT_TYPE load_le(const std::uint8_t* src)
+{
+    UINT_TYPE value = 0;
+    for (std::size_t i = 0; i < sizeof(UINT_TYPE); i++) {
+        value |= UINT_TYPE(src[i]) << (8 * i);
+    }
+    return value;
+}
+
+//! Encode `n` floating-point items as records of a little-endian 64-bit mantissa, a
+//! little-endian 32-bit biased exponent, an 8-bit sign, and three zero bytes
+static APY_INLINE void
+raw_from_float_data(const APyFloatData* src, std::size_t n, std::uint8_t* dst)
+{
+    for (std::size_t i = 0; i < n; i++, dst += RAW_FLOAT_RECORD_BYTES) {
+        store_le(dst + 0, std::uint64_t(src[i].man), 8);
+        store_le(dst + 8, std::uint32_t(src[i].exp), 4);
+        store_le(dst + 12, std::uint32_t(src[i].sign), 4);
+    }
+}
+
+//! Decode `n` floating-point items encoded by `raw_from_float_data`
+static APY_INLINE void
+raw_to_float_data(const std::uint8_t* src, std::size_t n, APyFloatData* dst)
+{
+    for (std::size_t i = 0; i < n; i++, src += RAW_FLOAT_RECORD_BYTES) {
+        dst[i].man = man_t(load_le<std::uint64_t>(src + 0));
+        dst[i].exp = exp_t(load_le<std::uint32_t>(src + 8));
+        dst[i].sign = bool(src[12] & 1);
+    }
+}
+
+//! Number of limbs of a `scalar_limbs`-limb fixed-point scalar in the native binary
+//! file format payload, where each scalar is padded to whole 64-bit words
+constexpr std::size_t raw_padded_limbs(std::size_t scalar_limbs)
+{
+    constexpr std::size_t limbs_per_word = 64 / APY_LIMB_SIZE_BITS;
+    return (scalar_limbs + limbs_per_word - 1) / limbs_per_word * limbs_per_word;
+}
+
+//! Encode the `n` fixed-point scalars of `scalar_limbs` limbs at `src` as
+//! little-endian limbs at `dst`. Each scalar is sign-extended to whole 64-bit words.
+static APY_INLINE void raw_from_limbs(
+    const apy_limb_t* src, std::size_t n, std::size_t scalar_limbs, std::uint8_t* dst
+)
+{
+    const std::size_t padded_limbs = raw_padded_limbs(scalar_limbs);
+    if constexpr (is_little_endian()) {
+        if (padded_limbs == scalar_limbs) {
+            std::memcpy(dst, src, n * scalar_limbs * sizeof(apy_limb_t));
+            return;
+        }
+    }
+    for (std::size_t i = 0; i < n; i++, src += scalar_limbs) {
+        const bool is_negative = apy_limb_signed_t(src[scalar_limbs - 1]) < 0;
+        const apy_limb_t sign_limb = is_negative ? ~apy_limb_t(0) : 0;
+        for (std::size_t k = 0; k < padded_limbs; k++, dst += sizeof(apy_limb_t)) {
+            store_le(dst, k < scalar_limbs ? src[k] : sign_limb, sizeof(apy_limb_t));
+        }
+    }
+}
+
+//! Decode `n` fixed-point scalars of `scalar_limbs` limbs encoded by `raw_from_limbs`
+static APY_INLINE void raw_to_limbs(
+    const std::uint8_t* src, std::size_t n, std::size_t scalar_limbs, apy_limb_t* dst
+)
+{
+    const std::size_t padded_limbs = raw_padded_limbs(scalar_limbs);
+    if constexpr (is_little_endian()) {
+        if (padded_limbs == scalar_limbs) {
+            std::memcpy(dst, src, n * scalar_limbs * sizeof(apy_limb_t));
+            return;
+        }
+    }
+    for (std::size_t i = 0; i < n; i++, src += padded_limbs * sizeof(apy_limb_t)) {
+        for (std::size_t k = 0; k < scalar_limbs; k++, dst++) {
+            *dst = load_le<apy_limb_t>(src + k * sizeof(apy_limb_t));
+        }
+    }
+}
+
+/* ********************************************************************************** *
+ * *                      Text file bit pattern word conversion                     * *
+ * ********************************************************************************** */
+
+//! Number of limbs in a 64-bit word of a text file bit pattern
+constexpr std::size_t LIMBS_PER_WORD = 64 / APY_LIMB_SIZE_BITS;
+
+//! Convert the `n_limbs` limbs at `src` to `n_words` 64-bit words, sign-extending
+//! the last limb
+static APY_INLINE void limbs_to_words(
+    const apy_limb_t* src, std::size_t n_limbs, std::uint64_t* dst, std::size_t n_words
+)
+{
+    const bool is_negative = apy_limb_signed_t(src[n_limbs - 1]) < 0;
+    const apy_limb_t sign_limb = is_negative ? ~apy_limb_t(0) : 0;
+    for (std::size_t i = 0; i < n_words; i++) {
+        std::uint64_t word = 0;
+        for (std::size_t j = 0; j < LIMBS_PER_WORD; j++) {
+            const std::size_t k = i * LIMBS_PER_WORD + j;
+            const apy_limb_t limb = k < n_limbs ? src[k] : sign_limb;
+            word |= std::uint64_t(limb) << (j * APY_LIMB_SIZE_BITS % 64);
+        }
+        dst[i] = word;
+    }
+}
+
+//! Convert the `n_words` 64-bit words at `src` to `n_limbs` limbs. Limbs past the
+//! words are set to zero.
+static APY_INLINE void words_to_limbs(
+    const std::uint64_t* src, std::size_t n_words, apy_limb_t* dst, std::size_t n_limbs
+)
+{
+    for (std::size_t k = 0; k < n_limbs; k++) {
+        const std::size_t i = k / LIMBS_PER_WORD;
+        const std::size_t shift = k % LIMBS_PER_WORD * APY_LIMB_SIZE_BITS % 64;
+        dst[k] = i < n_words ? apy_limb_t(src[i] >> shift) : 0;
+    }
+}
+
+//! Bitwise or `value` into `words`, starting at bit `pos`
+static APY_INLINE void
+or_into_words(std::uint64_t* words, std::size_t n_words, std::uint64_t value, int pos)
+{
+    const std::size_t i = std::size_t(pos) / 64;
+    const unsigned shift = unsigned(pos) % 64;
+    words[i] |= value << shift;
+    if (shift && i + 1 < n_words) {
+        words[i + 1] |= value >> (64 - shift);
+    }
+}
+
+//! Extract the `width`-bit field (`width` <= 63) starting at bit `pos` of `words`
+static APY_INLINE std::uint64_t
+extract_from_words(const std::uint64_t* words, std::size_t n_words, int pos, int width)
+{
+    const std::size_t i = std::size_t(pos) / 64;
+    const unsigned shift = unsigned(pos) % 64;
+    std::uint64_t value = words[i] >> shift;
+    if (shift && i + 1 < n_words) {
+        value |= words[i + 1] << (64 - shift);
+    }
+    return value & ((std::uint64_t(1) << width) - 1);
+}
+
+//! Convert a floating-point item to its `1 + exp_bits + man_bits`-bit pattern, as
+//! `n_words` 64-bit words
+static APY_INLINE void float_data_to_words(
+    const APyFloatData& src,
+    int exp_bits,
+    int man_bits,
+    std::uint64_t* dst,
+    std::size_t n_words
+)
+{
+    std::fill_n(dst, n_words, 0);
+    or_into_words(dst, n_words, std::uint64_t(src.man), 0);
+    or_into_words(dst, n_words, std::uint64_t(src.exp), man_bits);
+    or_into_words(dst, n_words, std::uint64_t(src.sign), man_bits + exp_bits);
+}
+
+//! Convert a `1 + exp_bits + man_bits`-bit pattern, as `n_words` 64-bit words, to a
+//! floating-point item
+static APY_INLINE APyFloatData float_data_from_words(
+    const std::uint64_t* src, std::size_t n_words, int exp_bits, int man_bits
+)
+{
+    return APyFloatData {
+        bool(extract_from_words(src, n_words, man_bits + exp_bits, 1)),
+        exp_t(extract_from_words(src, n_words, man_bits, exp_bits)),
+        man_t(extract_from_words(src, n_words, 0, man_bits)),
+    };
+}
+
 //! Convert a value to APyFixed. The format of the result will be big enough to
 //! accommodate the result.
 static APY_INLINE APyFixed to_apyfixed(const nb::object& val)